@@ -16,8 +16,9 @@
 #ifndef OHOS_DEFERRED_PROCESSING_SERVICE_BASE_TASK_GROUP_H
 #define OHOS_DEFERRED_PROCESSING_SERVICE_BASE_TASK_GROUP_H
 
+#include <deque>
+
 #include "itask_group.h"
-#include "blocking_queue.h"
 #include "thread_pool.h"
 
 namespace OHOS {
@@ -47,7 +48,7 @@ private:
     const ThreadPool* threadPool_;
     TaskGroupHandle handle_;
     std::atomic<bool> inflight_;
-    BlockingQueue<std::any> que_;
+    std::deque<std::any> que_;
 };
 } //namespace DeferredProcessing
 } // namespace CameraStandard
@@ -42,6 +42,9 @@ public:
     const std::string& GetName();
     bool Start(uint32_t delayTimeMs = 0);
     bool StartAt(uint64_t timestampMs);
+    bool StartAtMicro(uint64_t timestampUs);
+    // Lets the timer expire up to windowMs late so it shares a wake-up with timers due around the same time.
+    void SetCoalescingWindow(uint32_t windowMs);
     bool Stop();
     bool IsActive();
 
@@ -51,6 +54,7 @@ private:
     bool Initialize();
     bool StartUnlocked(uint32_t delayTimeMs = 0);
     bool StartAtUnlocked(uint64_t timestampMs);
+    bool StartAtMicroUnlocked(uint64_t timestampUs);
     void TimerExpired();
 
     std::mutex mutex_;
@@ -59,7 +63,9 @@ private:
     const TimerType timerType_;
     const uint32_t intervalMs_;
     TimerCallback callback_;
-    uint64_t expiredTimeMs_{0};
+    uint64_t expiredTimeUs_{0};
+    uint64_t coalescingWindowUs_{0};
+    uint64_t wheelId_{0}; // Registration in the timer core, guarded by mutex_.
 };
 } //namespace DeferredProcessing
 } // namespace CameraStandard
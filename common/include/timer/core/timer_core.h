@@ -16,11 +16,11 @@
 #ifndef OHOS_DEFERRED_PROCESSING_SERVICE_TIMER_CORE_H
 #define OHOS_DEFERRED_PROCESSING_SERVICE_TIMER_CORE_H
 
-#include <map>
-#include <queue>
+#include <condition_variable>
 #include <thread>
 
 #include "camera_deferred_timer.h"
+#include "timing_wheel.h"
 
 namespace OHOS {
 namespace CameraStandard {
@@ -31,22 +31,22 @@ public:
     ~TimerCore();
     bool Initialize();
     bool RegisterTimer(uint64_t timestampMs, const std::shared_ptr<Timer>& timer);
-    bool DeregisterTimer(uint64_t timestampMs, const std::shared_ptr<Timer>& timer);
+    bool RegisterTimerMicro(uint64_t timestampUs, const std::shared_ptr<Timer>& timer);
+    bool DeregisterTimer(const std::shared_ptr<Timer>& timer);
 
 private:
     TimerCore();
     void TimerLoop(const std::string& threadName);
-    std::chrono::milliseconds GetNextExpirationTimeUnlocked();
+    std::chrono::microseconds GetNextExpirationTimeUnlocked();
     void DoTimeout();
-    bool IsSameOwner(const std::shared_ptr<Timer>& lhs, const std::weak_ptr<Timer>& rhs);
 
     std::mutex mutex_;
     std::condition_variable cv_;
     std::atomic<bool> active_{false};
     std::atomic<bool> resetTimer_{false};
     std::thread worker_{};
-    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> timeline_;
-    std::map<uint64_t, std::vector<std::weak_ptr<Timer>>> registeredTimers_{};
+    TimingWheel<std::weak_ptr<Timer>> wheel_;
+    uint64_t waitUntilUs_{UINT64_MAX};
 };
 } //namespace DeferredProcessing
 } // namespace CameraStandard
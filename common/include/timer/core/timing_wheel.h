@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_DEFERRED_PROCESSING_SERVICE_TIMING_WHEEL_H
+#define OHOS_DEFERRED_PROCESSING_SERVICE_TIMING_WHEEL_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace CameraStandard {
+namespace DeferredProcessing {
+/**
+ * Hierarchical timing wheel over an absolute tick count, the timer core uses microseconds of the steady clock.
+ * Level l holds 64 slots of 64^l ticks each, an entry sits at the highest level where its expiration differs
+ * from the current tick and moves down a level when its slot is reached, expirations beyond the last level wait
+ * in an overflow list. Add and Remove are O(1), Advance expires every due entry in one call and jumps over
+ * empty slots with the per-level occupancy bitmaps. Not thread safe, the owner serializes the calls.
+ */
+template<typename T>
+class TimingWheel {
+public:
+    using TimerId = uint64_t;
+    static constexpr TimerId INVALID_TIMER_ID = 0;
+    static constexpr uint32_t SLOT_BITS = 6;
+    static constexpr uint32_t SLOT_COUNT = 1U << SLOT_BITS;
+    static constexpr uint32_t LEVEL_COUNT = 6;
+
+    explicit TimingWheel(uint64_t currentTick = 0) : currentTick_(currentTick) {}
+    ~TimingWheel() = default;
+
+    // An expiration not after the current tick is due on the next Advance.
+    TimerId Add(uint64_t expiration, T payload)
+    {
+        TimerId id = ++lastId_;
+        std::list<Node> pending;
+        pending.push_back({ id, expiration, std::move(payload), 0, 0 });
+        auto it = pending.begin();
+        Place(pending, it);
+        index_.emplace(id, it);
+        return id;
+    }
+
+    bool Remove(TimerId id)
+    {
+        auto found = index_.find(id);
+        if (found == index_.end()) {
+            return false;
+        }
+        uint32_t level = found->second->level;
+        uint32_t slot = found->second->slot;
+        auto& nodes = GetSlot(level, slot);
+        nodes.erase(found->second);
+        if (nodes.empty() && level < LEVEL_COUNT) {
+            occupied_[level] &= ~(1ULL << slot);
+        }
+        index_.erase(found);
+        return true;
+    }
+
+    // Expires every entry due at now, in expiration order across slots, and makes now the current tick.
+    void Advance(uint64_t now, std::vector<T>& expired)
+    {
+        uint64_t target = std::max(now, currentTick_);
+        uint32_t level = 0;
+        uint32_t slot = 0;
+        while (true) {
+            if (!FindNextSlot(level, slot)) {
+                if (overflow_.empty() || GetMinExpiration(overflow_) > target) {
+                    break;
+                }
+                // Nothing is left before the overflow, jump to its earliest entry.
+                currentTick_ = GetMinExpiration(overflow_);
+                PlaceAll(overflow_);
+                continue;
+            }
+            uint64_t slotStart = GetSlotStart(level, slot);
+            if (slotStart > target) {
+                break;
+            }
+            SetCurrentTick(slotStart);
+            std::list<Node> pending;
+            pending.splice(pending.end(), slots_[level][slot]);
+            occupied_[level] &= ~(1ULL << slot);
+            if (level > 0) {
+                PlaceAll(pending);
+                continue;
+            }
+            for (auto& node : pending) {
+                index_.erase(node.id);
+                expired.emplace_back(std::move(node.payload));
+            }
+        }
+        SetCurrentTick(target);
+    }
+
+    // Exact expiration of the earliest entry, false when the wheel is empty.
+    bool GetNextExpiration(uint64_t& expiration) const
+    {
+        uint32_t level = 0;
+        uint32_t slot = 0;
+        if (FindNextSlot(level, slot)) {
+            expiration = level == 0 ? GetSlotStart(level, slot) : GetMinExpiration(slots_[level][slot]);
+            return true;
+        }
+        if (!overflow_.empty()) {
+            expiration = GetMinExpiration(overflow_);
+            return true;
+        }
+        return false;
+    }
+
+    // Moves expiration up to the next multiple of the largest power of two within window, so entries
+    // sharing a window and expiring close together land on the same tick and expire in one batch.
+    static uint64_t Coalesce(uint64_t expiration, uint64_t window)
+    {
+        if (window == 0) {
+            return expiration;
+        }
+        uint64_t granularity = 1ULL << (63 - __builtin_clzll(window));
+        uint64_t rounded = (expiration + granularity - 1) & ~(granularity - 1);
+        return rounded < expiration ? expiration : rounded;
+    }
+
+    inline uint64_t GetCurrentTick() const
+    {
+        return currentTick_;
+    }
+
+    inline size_t Size() const
+    {
+        return index_.size();
+    }
+
+    inline bool Empty() const
+    {
+        return index_.empty();
+    }
+
+    void Clear()
+    {
+        for (auto& level : slots_) {
+            for (auto& slot : level) {
+                slot.clear();
+            }
+        }
+        occupied_.fill(0);
+        overflow_.clear();
+        index_.clear();
+    }
+
+private:
+    struct Node {
+        TimerId id;
+        uint64_t expiration;
+        T payload;
+        uint32_t level;
+        uint32_t slot;
+    };
+
+    static constexpr uint64_t SLOT_MASK = SLOT_COUNT - 1;
+
+    inline std::list<Node>& GetSlot(uint32_t level, uint32_t slot)
+    {
+        return level < LEVEL_COUNT ? slots_[level][slot] : overflow_;
+    }
+
+    // Moves the node into its slot relative to the current tick, iterators to it stay valid.
+    void Place(std::list<Node>& from, typename std::list<Node>::iterator it)
+    {
+        uint64_t expiration = std::max(it->expiration, currentTick_);
+        uint64_t diff = expiration ^ currentTick_;
+        uint32_t level = diff == 0 ? 0 : static_cast<uint32_t>(63 - __builtin_clzll(diff)) / SLOT_BITS;
+        it->level = std::min(level, LEVEL_COUNT);
+        it->slot = 0;
+        if (it->level < LEVEL_COUNT) {
+            it->slot = static_cast<uint32_t>((expiration >> (it->level * SLOT_BITS)) & SLOT_MASK);
+            occupied_[it->level] |= 1ULL << it->slot;
+        }
+        auto& slot = GetSlot(it->level, it->slot);
+        slot.splice(slot.end(), from, it);
+    }
+
+    // Lowest occupied level and its first slot at or after the current tick, which holds the earliest entries.
+    bool FindNextSlot(uint32_t& level, uint32_t& slot) const
+    {
+        for (level = 0; level < LEVEL_COUNT; level++) {
+            uint32_t digit = static_cast<uint32_t>((currentTick_ >> (level * SLOT_BITS)) & SLOT_MASK);
+            uint64_t candidates = occupied_[level] & (~0ULL << digit);
+            if (candidates != 0) {
+                slot = static_cast<uint32_t>(__builtin_ctzll(candidates));
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline uint64_t GetSlotStart(uint32_t level, uint32_t slot) const
+    {
+        uint32_t shift = level * SLOT_BITS;
+        uint64_t base = currentTick_ & ~((1ULL << (shift + SLOT_BITS)) - 1);
+        return std::max(base | (static_cast<uint64_t>(slot) << shift), currentTick_);
+    }
+
+    static uint64_t GetMinExpiration(const std::list<Node>& nodes)
+    {
+        uint64_t expiration = UINT64_MAX;
+        for (auto& node : nodes) {
+            expiration = std::min(expiration, node.expiration);
+        }
+        return expiration;
+    }
+
+    // Entries in the overflow list come within reach of the levels once the tick crosses into their range.
+    void SetCurrentTick(uint64_t tick)
+    {
+        constexpr uint32_t rangeShift = LEVEL_COUNT * SLOT_BITS;
+        bool rangeChanged = (tick >> rangeShift) != (currentTick_ >> rangeShift);
+        currentTick_ = tick;
+        if (rangeChanged) {
+            PlaceAll(overflow_);
+        }
+    }
+
+    void PlaceAll(std::list<Node>& nodes)
+    {
+        std::list<Node> pending;
+        pending.splice(pending.end(), nodes);
+        while (!pending.empty()) {
+            Place(pending, pending.begin());
+        }
+    }
+
+    uint64_t currentTick_;
+    TimerId lastId_ = INVALID_TIMER_ID;
+    std::array<std::array<std::list<Node>, SLOT_COUNT>, LEVEL_COUNT> slots_;
+    std::array<uint64_t, LEVEL_COUNT> occupied_ {};
+    std::list<Node> overflow_;
+    std::unordered_map<TimerId, typename std::list<Node>::iterator> index_;
+};
+} //namespace DeferredProcessing
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_DEFERRED_PROCESSING_SERVICE_TIMING_WHEEL_H
@@ -28,6 +28,7 @@ public:
     static uint64_t GetTimestampMicro();
     static uint64_t GetElapsedTimeMs(uint64_t startMs);
     static std::chrono::milliseconds GetRemainingTimeMs(uint64_t expirationTimeMs);
+    static std::chrono::microseconds GetRemainingTimeUs(uint64_t expirationTimeUs);
     SteadyClock();
     ~SteadyClock();
     void Reset();
@@ -17,9 +17,9 @@
 #define OHOS_DEFERRED_PROCESSING_SERVICE_TIME_BROKER_H
 
 #include <map>
-#include <queue>
 
 #include "camera_deferred_timer.h"
+#include "timing_wheel.h"
 
 namespace OHOS {
 namespace CameraStandard {
@@ -31,6 +31,9 @@ public:
     ~TimeBroker();
     void Initialize();
     bool RegisterCallback(uint32_t delayTimeMs, std::function<void(uint32_t handle)> timerCallback, uint32_t& handle);
+    // The callback may run up to windowMs late, so callbacks due around the same time share a wake-up.
+    bool RegisterCallback(uint32_t delayTimeMs, uint32_t windowMs, std::function<void(uint32_t handle)> timerCallback,
+        uint32_t& handle);
     void DeregisterCallback(uint32_t handle);
     std::function<void(uint32_t handle)> GetExpiredFunc(uint32_t handle);
 private:
@@ -40,8 +43,9 @@ private:
         {
         }
         uint32_t handle;
-        uint64_t timestamp;
+        uint64_t timestamp; // Microseconds of the steady clock.
         std::function<void(uint32_t handle)> timerCallback;
+        TimingWheel<uint32_t>::TimerId wheelId{TimingWheel<uint32_t>::INVALID_TIMER_ID};
     };
     bool GetNextHandle(uint32_t& handle);
     uint32_t GenerateHandle();
@@ -51,9 +55,9 @@ private:
     const std::string name_;
     std::mutex mutex_;
     std::shared_ptr<Timer> timer_;
-    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> timeline_;
+    TimingWheel<uint32_t> wheel_; // Handles by expiration.
     std::map<uint32_t, std::shared_ptr<TimerInfo>> timerInfos_;
-    std::map<uint64_t, std::vector<std::weak_ptr<TimerInfo>>> expiringTimers_;
+    uint64_t armedTimeUs_{0};
     uint32_t preHandle_{0};
 };
 } //namespace DeferredProcessing
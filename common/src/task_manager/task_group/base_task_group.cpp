@@ -26,8 +26,7 @@ BaseTaskGroup::BaseTaskGroup(const std::string& name, TaskFunc func, bool serial
       serial_(serial),
       threadPool_(threadPool),
       handle_(INVALID_TASK_GROUP_HANDLE),
-      inflight_(false),
-      que_(name + " queue")
+      inflight_(false)
 {
     MEDIA_DEBUG_LOG("task group (%s).", name_.c_str());
 }
@@ -35,14 +34,13 @@ BaseTaskGroup::BaseTaskGroup(const std::string& name, TaskFunc func, bool serial
 BaseTaskGroup::~BaseTaskGroup()
 {
     MEDIA_DEBUG_LOG("task group name: %s, handle: %{public}d", name_.c_str(), static_cast<int>(handle_));
-    que_.SetActive(false);
-    que_.Clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    que_.clear();
 }
 
 void BaseTaskGroup::Initialize()
 {
     handle_ = GenerateHandle();
-    que_.SetActive(true);
     MEDIA_DEBUG_LOG("task group (%s), handle: %{public}d", name_.c_str(), static_cast<int>(handle_));
 }
 
@@ -59,14 +57,9 @@ TaskGroupHandle BaseTaskGroup::GetHandle()
 bool BaseTaskGroup::SubmitTask(std::any param)
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (que_.Full()) {
-        MEDIA_WARNING_LOG("Submit task (%s), handle: %{public}d, que is full!", name_.c_str(), 
-            static_cast<int>(handle_));
-    } else {
-        MEDIA_DEBUG_LOG("Submit task (%s), handle: %{public}d, size: %zu.", name_.c_str(),
-            static_cast<int>(handle_), que_.Size());
-    }
-    que_.Push(std::move(param));
+    MEDIA_DEBUG_LOG("Submit task (%s), handle: %{public}d, size: %zu.", name_.c_str(),
+        static_cast<int>(handle_), que_.size());
+    que_.push_back(std::move(param));
     DispatchTaskUnlocked();
     return true;
 }
@@ -76,7 +69,7 @@ void BaseTaskGroup::CancelAllTasks()
     std::lock_guard<std::mutex> lock(mutex_);
     MEDIA_DEBUG_LOG("Cancel all tasks for task group (%s), handle: %{public}d", name_.c_str(), 
         static_cast<int>(handle_));
-    que_.Clear();
+    que_.clear();
     CHECK_RETURN(!serial_);
     inflight_ = false;
 }
@@ -85,17 +78,19 @@ size_t BaseTaskGroup::GetTaskCount()
 {
     std::lock_guard<std::mutex> lock(mutex_);
     MEDIA_DEBUG_LOG("Get task count for task group (%s), handle: %{public}d", name_.c_str(), static_cast<int>(handle_));
-    return que_.Size();
+    return que_.size();
 }
 
 std::function<void()> BaseTaskGroup::GetTaskUnlocked()
 {
-    if (que_.Empty()) {
+    if (que_.empty()) {
         MEDIA_DEBUG_LOG("(%s) no available tasks.", name_.c_str());
         return {};
     }
     std::weak_ptr<BaseTaskGroup> weakThis(shared_from_this());
-    auto task = [param = que_.Pop(), weakThis]() {
+    std::any param = std::move(que_.front());
+    que_.pop_front();
+    auto task = [param = std::move(param), weakThis]() {
         auto thiz = weakThis.lock();
         if (thiz) {
             thiz->func_(std::move(param));
@@ -103,7 +98,7 @@ std::function<void()> BaseTaskGroup::GetTaskUnlocked()
         }
     };
     MEDIA_DEBUG_LOG("return one task %s, handle:%{public}d, size: %zu.", name_.c_str(), static_cast<int>(handle_),
-        que_.Size());
+        que_.size());
     return task;
 }
 
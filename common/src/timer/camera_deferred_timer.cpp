@@ -20,6 +20,10 @@
 
 namespace OHOS {
 namespace CameraStandard {
+namespace {
+constexpr uint64_t MICRO_SECONDS_PER_MILLI = 1000;
+} // namespace
+
 namespace DeferredProcessing {
 
 std::shared_ptr<Timer> Timer::Create(const std::string& name, TimerType timerType,
@@ -41,7 +45,7 @@ std::shared_ptr<Timer> Timer::Create(const std::string& name, TimerType timerTyp
 }
 
 Timer::Timer(const std::string& name, TimerType timerType, uint32_t intervalMs, TimerCallback callback)
-    : name_(name), timerType_(timerType), intervalMs_(intervalMs), callback_(std::move(callback)), expiredTimeMs_(0)
+    : name_(name), timerType_(timerType), intervalMs_(intervalMs), callback_(std::move(callback)), expiredTimeUs_(0)
 {
     DP_DEBUG_LOG("name: %s, timer type: %{public}d(0: once, 1: periodic), intervalMs: %u",
         name_.c_str(), timerType, intervalMs);
@@ -77,6 +81,18 @@ bool Timer::StartAt(uint64_t timestampMs)
     return StartAtUnlocked(timestampMs);
 }
 
+bool Timer::StartAtMicro(uint64_t timestampUs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return StartAtMicroUnlocked(timestampUs);
+}
+
+void Timer::SetCoalescingWindow(uint32_t windowMs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    coalescingWindowUs_ = windowMs * MICRO_SECONDS_PER_MILLI;
+}
+
 bool Timer::Stop()
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -86,26 +102,32 @@ bool Timer::Stop()
         return true;
     }
     active_ = false;
-    return TimerCore::GetInstance().DeregisterTimer(expiredTimeMs_, shared_from_this());
+    return TimerCore::GetInstance().DeregisterTimer(shared_from_this());
 }
 
 bool Timer::StartUnlocked(uint32_t delayTimeMs)
 {
-    auto curTimeMs = SteadyClock::GetTimestampMilli();
-    auto timestampMs = curTimeMs + (delayTimeMs == 0 ? intervalMs_ : delayTimeMs);
+    auto curTimeUs = SteadyClock::GetTimestampMicro();
+    auto timestampUs = curTimeUs + (delayTimeMs == 0 ? intervalMs_ : delayTimeMs) * MICRO_SECONDS_PER_MILLI;
     DP_DEBUG_LOG("timer (%s), type: %{public}d(0: once, 1: periodic), curTime: %{public}d, expiredTime: %{public}d",
-        name_.c_str(), timerType_, static_cast<int>(curTimeMs), static_cast<int>(timestampMs));
-    return StartAtUnlocked(timestampMs);
+        name_.c_str(), timerType_, static_cast<int>(curTimeUs / MICRO_SECONDS_PER_MILLI),
+        static_cast<int>(timestampUs / MICRO_SECONDS_PER_MILLI));
+    return StartAtMicroUnlocked(timestampUs);
 }
 
 bool Timer::StartAtUnlocked(uint64_t timestampMs)
+{
+    return StartAtMicroUnlocked(timestampMs * MICRO_SECONDS_PER_MILLI);
+}
+
+bool Timer::StartAtMicroUnlocked(uint64_t timestampUs)
 {
     if (active_) {
-        TimerCore::GetInstance().DeregisterTimer(expiredTimeMs_, shared_from_this());
+        TimerCore::GetInstance().DeregisterTimer(shared_from_this());
     }
     active_ = true;
-    expiredTimeMs_ = timestampMs;
-    return TimerCore::GetInstance().RegisterTimer(expiredTimeMs_, shared_from_this());
+    expiredTimeUs_ = timestampUs;
+    return TimerCore::GetInstance().RegisterTimerMicro(expiredTimeUs_, shared_from_this());
 }
 
 bool Timer::IsActive()
@@ -130,7 +152,7 @@ void Timer::TimerExpired()
         }
     }
     DP_DEBUG_LOG("timer (%s) expired, type: %{public}d(0: once, 1: periodic), expiredTimeMs at %{public}d",
-        name_.c_str(), timerType_, static_cast<int>(expiredTimeMs_));
+        name_.c_str(), timerType_, static_cast<int>(expiredTimeUs_ / MICRO_SECONDS_PER_MILLI));
     if (callback_) {
         callback_();
     }
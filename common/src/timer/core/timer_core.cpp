@@ -15,6 +15,8 @@
 
 #include "timer_core.h"
 
+#include <cinttypes>
+
 #include "thread_utils.h"
 #include "steady_clock.h"
 #include "camera_log.h"
@@ -22,7 +24,8 @@
 namespace OHOS {
 namespace CameraStandard {
 namespace {
-    constexpr uint32_t EXPIREATION_TIME_MILLI_SECONDS = 12 * 60 * 1000;
+    constexpr uint64_t EXPIREATION_TIME_MICRO_SECONDS = 12 * 60 * 1000 * 1000ULL;
+    constexpr uint64_t MICRO_SECONDS_PER_MILLI = 1000;
 } //namespace
 
 namespace DeferredProcessing {
@@ -32,7 +35,7 @@ TimerCore& TimerCore::GetInstance()
     return instance;
 }
 
-TimerCore::TimerCore()
+TimerCore::TimerCore() : wheel_(SteadyClock::GetTimestampMicro())
 {
     MEDIA_DEBUG_LOG("entered.");
 }
@@ -42,7 +45,7 @@ TimerCore::~TimerCore()
     MEDIA_DEBUG_LOG("entered.");
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        registeredTimers_.clear();
+        wheel_.Clear();
         active_ = false;
         cv_.notify_one();
     }
@@ -67,6 +70,11 @@ bool TimerCore::Initialize()
 }
 
 bool TimerCore::RegisterTimer(uint64_t timestampMs, const std::shared_ptr<Timer>& timer)
+{
+    return RegisterTimerMicro(timestampMs * MICRO_SECONDS_PER_MILLI, timer);
+}
+
+bool TimerCore::RegisterTimerMicro(uint64_t timestampUs, const std::shared_ptr<Timer>& timer)
 {
     if (!active_) {
         return false;
@@ -75,21 +83,19 @@ bool TimerCore::RegisterTimer(uint64_t timestampMs, const std::shared_ptr<Timer>
         MEDIA_DEBUG_LOG("failed due to nullptr.");
         return false;
     }
+    uint64_t expirationUs = TimingWheel<std::weak_ptr<Timer>>::Coalesce(timestampUs, timer->coalescingWindowUs_);
     std::unique_lock<std::mutex> lock(mutex_);
-    if (registeredTimers_.count(timestampMs) == 0) {
-        timeline_.push(timestampMs);
-        if (timestampMs == timeline_.top()) {
-            resetTimer_ = true;
-            cv_.notify_one();
-        }
+    timer->wheelId_ = wheel_.Add(expirationUs, timer);
+    if (expirationUs < waitUntilUs_) {
+        resetTimer_ = true;
+        cv_.notify_one();
     }
-    registeredTimers_[timestampMs].push_back(timer);
-    MEDIA_DEBUG_LOG("register timer (%s), timestamp: %{public}d, timeline.top: %{public}d", timer->GetName().c_str(),
-        static_cast<int>(timestampMs), static_cast<int>(timeline_.top()));
+    MEDIA_DEBUG_LOG("register timer (%s), timestampUs: %{public}" PRIu64 ", expirationUs: %{public}" PRIu64,
+        timer->GetName().c_str(), timestampUs, expirationUs);
     return true;
 }
 
-bool TimerCore::DeregisterTimer(uint64_t timestampMs, const std::shared_ptr<Timer>& timer)
+bool TimerCore::DeregisterTimer(const std::shared_ptr<Timer>& timer)
 {
     if (!active_) {
         return true;
@@ -98,16 +104,11 @@ bool TimerCore::DeregisterTimer(uint64_t timestampMs, const std::shared_ptr<Time
         MEDIA_ERR_LOG("failed due to nullptr.");
         return false;
     }
-    MEDIA_DEBUG_LOG("(%s, %{public}d) entered.", timer->GetName().c_str(), static_cast<int>(timestampMs));
+    MEDIA_DEBUG_LOG("(%s) entered.", timer->GetName().c_str());
     std::unique_lock<std::mutex> lock(mutex_);
-    if (registeredTimers_.count(timestampMs)) {
-        auto& timers = registeredTimers_[timestampMs];
-        timers.erase(std::remove_if(timers.begin(), timers.end(),
-            [this, &timer](auto& weakTimer) { return IsSameOwner(timer, weakTimer); }), timers.end());
-        if (timers.empty()) {
-            registeredTimers_.erase(timestampMs);
-        }
-    }
+    // The id of an expired registration is gone from the wheel, removing it again is a no-op.
+    wheel_.Remove(timer->wheelId_);
+    timer->wheelId_ = TimingWheel<std::weak_ptr<Timer>>::INVALID_TIMER_ID;
     return true;
 }
 
@@ -131,13 +132,16 @@ void TimerCore::TimerLoop(const std::string& threadName)
     MEDIA_DEBUG_LOG("(%s) exited.", threadName.c_str());
 }
 
-std::chrono::milliseconds TimerCore::GetNextExpirationTimeUnlocked()
+std::chrono::microseconds TimerCore::GetNextExpirationTimeUnlocked()
 {
-    std::chrono::milliseconds expirationTime(EXPIREATION_TIME_MILLI_SECONDS);
-    if (!timeline_.empty()) {
-        expirationTime = SteadyClock::GetRemainingTimeMs(timeline_.top());
+    std::chrono::microseconds expirationTime(EXPIREATION_TIME_MICRO_SECONDS);
+    waitUntilUs_ = UINT64_MAX;
+    uint64_t expirationUs = 0;
+    if (wheel_.GetNextExpiration(expirationUs)) {
+        waitUntilUs_ = expirationUs;
+        expirationTime = SteadyClock::GetRemainingTimeUs(expirationUs);
     }
-    MEDIA_DEBUG_LOG("expiration time: %lld.", expirationTime.count());
+    MEDIA_DEBUG_LOG("expiration time: %lld us.", static_cast<long long>(expirationTime.count()));
     return expirationTime;
 }
 
@@ -146,19 +150,13 @@ void TimerCore::DoTimeout()
     std::vector<std::weak_ptr<Timer>> timers;
     {
         std::unique_lock<std::mutex> lock(mutex_);
-        if (timeline_.empty()) {
+        if (wheel_.Empty()) {
             MEDIA_DEBUG_LOG("no register timer.");
             return;
         }
-        auto timestamp = timeline_.top();
-        timeline_.pop();
-        if (registeredTimers_.count(timestamp) == 0) {
-            MEDIA_DEBUG_LOG("timer for timestamp %{public}d hasn't been registered.", static_cast<int>(timestamp));
-            return;
-        }
-        MEDIA_DEBUG_LOG("expired timestamp: %{public}d", static_cast<int>(timestamp));
-        timers = std::move(registeredTimers_[timestamp]);
-        registeredTimers_.erase(timestamp);
+        // Every timer due by now expires in this batch, including those coalesced onto the same tick.
+        wheel_.Advance(SteadyClock::GetTimestampMicro(), timers);
+        MEDIA_DEBUG_LOG("expired timers: %{public}zu", timers.size());
     }
     for (auto& weakTimer : timers) {
         if (auto timer = weakTimer.lock()) {
@@ -166,11 +164,6 @@ void TimerCore::DoTimeout()
         }
     }
 }
-
-bool TimerCore::IsSameOwner(const std::shared_ptr<Timer>& lhs, const std::weak_ptr<Timer>& rhs)
-{
-    return !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
-}
 } //namespace DeferredProcessing
 } // namespace CameraStandard
 } // namespace OHOS
@@ -55,6 +55,13 @@ std::chrono::milliseconds SteadyClock::GetRemainingTimeMs(uint64_t expirationTim
     return std::chrono::milliseconds(remainingTimeMs);
 }
 
+std::chrono::microseconds SteadyClock::GetRemainingTimeUs(uint64_t expirationTimeUs)
+{
+    auto currTime = SteadyClock::GetTimestampMicro();
+    uint64_t remainingTimeUs = (expirationTimeUs > currTime) ? (expirationTimeUs - currTime) : 0;
+    return std::chrono::microseconds(remainingTimeUs);
+}
+
 SteadyClock::SteadyClock() : start_(std::chrono::steady_clock::now())
 {
     MEDIA_DEBUG_LOG("entered.");
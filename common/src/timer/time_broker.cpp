@@ -20,6 +20,10 @@
 
 namespace OHOS {
 namespace CameraStandard {
+namespace {
+constexpr uint64_t MICRO_SECONDS_PER_MILLI = 1000;
+} // namespace
+
 namespace DeferredProcessing {
 std::shared_ptr<TimeBroker> TimeBroker::Create(std::string name)
 {
@@ -30,7 +34,7 @@ std::shared_ptr<TimeBroker> TimeBroker::Create(std::string name)
 }
 
 TimeBroker::TimeBroker(std::string name)
-    : name_(std::move(name)), timer_(nullptr), timerInfos_(), expiringTimers_()
+    : name_(std::move(name)), timer_(nullptr), wheel_(SteadyClock::GetTimestampMicro()), timerInfos_()
 {
     MEDIA_DEBUG_LOG("(%s) entered.", name_.c_str());
 }
@@ -44,7 +48,7 @@ TimeBroker::~TimeBroker()
         timer_.reset();
     }
     timerInfos_.clear();
-    expiringTimers_.clear();
+    wheel_.Clear();
 }
 
 void TimeBroker::Initialize()
@@ -59,23 +63,32 @@ void TimeBroker::Initialize()
 
 bool TimeBroker::RegisterCallback(uint32_t delayTimeMs, std::function<void(uint32_t handle)> timerCallback,
     uint32_t& handle)
+{
+    return RegisterCallback(delayTimeMs, 0, std::move(timerCallback), handle);
+}
+
+bool TimeBroker::RegisterCallback(uint32_t delayTimeMs, uint32_t windowMs,
+    std::function<void(uint32_t handle)> timerCallback, uint32_t& handle)
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    MEDIA_DEBUG_LOG("(%s) register callback with delayTimeMs (%{public}d).", 
-        name_.c_str(), static_cast<int>(delayTimeMs));
+    MEDIA_DEBUG_LOG("(%s) register callback with delayTimeMs (%{public}d), windowMs (%{public}d).",
+        name_.c_str(), static_cast<int>(delayTimeMs), static_cast<int>(windowMs));
     auto ret = GetNextHandle(handle);
     if (ret) {
-        auto timestamp = SteadyClock::GetTimestampMilli() + delayTimeMs;
+        auto timestamp = TimingWheel<uint32_t>::Coalesce(
+            SteadyClock::GetTimestampMicro() + delayTimeMs * MICRO_SECONDS_PER_MILLI,
+            windowMs * MICRO_SECONDS_PER_MILLI);
         auto timerInfo = std::make_shared<TimerInfo>(handle, timestamp, std::move(timerCallback));
-        expiringTimers_[timestamp].push_back(timerInfo);
+        timerInfo->wheelId = wheel_.Add(timestamp, handle);
         timerInfos_.emplace(handle, timerInfo);
-        timeline_.push(timestamp);
-        if (timestamp == timeline_.top()) {
-            timer_->StartAt(timestamp);
+        if (!timer_->IsActive() || timestamp < armedTimeUs_) {
+            armedTimeUs_ = timestamp;
+            timer_->StartAtMicro(timestamp);
         }
     }
     return ret;
 }
+
 void TimeBroker::DeregisterCallback(uint32_t handle)
 {
     std::lock_guard<std::mutex> lock(mutex_);
@@ -83,7 +96,13 @@ void TimeBroker::DeregisterCallback(uint32_t handle)
         MEDIA_DEBUG_LOG("(%s) invalid handle (%{public}d).", name_.c_str(), static_cast<int>(handle));
         return;
     }
-    timerInfos_.erase(handle);
+    auto it = timerInfos_.find(handle);
+    if (it == timerInfos_.end()) {
+        return;
+    }
+    // Cancelled callbacks leave the wheel at once instead of lingering until their expiration.
+    wheel_.Remove(it->second->wheelId);
+    timerInfos_.erase(it);
 }
 
 std::function<void(uint32_t handle)> TimeBroker::GetExpiredFunc(uint32_t handle)
@@ -124,21 +143,21 @@ void TimeBroker::TimerExpired()
     {
         std::lock_guard<std::mutex> lock(mutex_);
         MEDIA_DEBUG_LOG("(%s) TimerExpired.", name_.c_str());
-        if (timeline_.empty()) {
+        if (wheel_.Empty()) {
             MEDIA_DEBUG_LOG("(%s) unexpected TimerExpired", name_.c_str());
             return;
         }
-        auto timestamp = timeline_.top();
-        timeline_.pop();
-        timerInfos.reserve(expiringTimers_[timestamp].size());
-        for (auto& weakTimerInfoPtr : expiringTimers_[timestamp]) {
-            if (auto timerInfo = weakTimerInfoPtr.lock()) {
-                timerInfos_.erase(timerInfo->handle);
-                timerInfos.push_back(std::move(timerInfo));
+        std::vector<uint32_t> handles;
+        wheel_.Advance(SteadyClock::GetTimestampMicro(), handles);
+        timerInfos.reserve(handles.size());
+        for (auto handle : handles) {
+            auto it = timerInfos_.find(handle);
+            if (it != timerInfos_.end()) {
+                timerInfos.push_back(std::move(it->second));
+                timerInfos_.erase(it);
             }
         }
-        expiringTimers_.erase(timestamp);
-        auto ret = RestartTimer(timestamp);
+        auto ret = RestartTimer(true);
         if (!ret) {
             MEDIA_DEBUG_LOG("(%s) RestartTimer failed (%{public}d)", name_.c_str(), ret);
         }
@@ -150,13 +169,15 @@ void TimeBroker::TimerExpired()
 
 bool TimeBroker::RestartTimer(bool force)
 {
-    if (timeline_.empty() || (timer_->IsActive() && force == false)) {
+    uint64_t timestamp = 0;
+    if (!wheel_.GetNextExpiration(timestamp) || (timer_->IsActive() && force == false)) {
         MEDIA_DEBUG_LOG("(%s) RestartTimer unnecessary.", name_.c_str());
         return true;
     }
-    auto timestamp = timeline_.top();
-    MEDIA_DEBUG_LOG("(%s) restart timer, expiring timestamp: %{public}d", name_.c_str(), static_cast<int>(timestamp));
-    return timer_->StartAt(timestamp);
+    MEDIA_DEBUG_LOG("(%s) restart timer, expiring timestamp: %{public}d", name_.c_str(),
+        static_cast<int>(timestamp / MICRO_SECONDS_PER_MILLI));
+    armedTimeUs_ = timestamp;
+    return timer_->StartAtMicro(timestamp);
 }
 } //namespace DeferredProcessing
 } // namespace CameraStandard
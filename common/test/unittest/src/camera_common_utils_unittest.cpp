@@ -14,15 +14,27 @@
  */
 #include "camera_common_utils_unittest.h"
 
+#include <atomic>
 #include <chrono>
 #include <fcntl.h>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <limits>
 #include <thread>
+#include <vector>
 
+#include "audio_pcm_kernel.h"
 #include "camera_dynamic_loader.h"
 #include "camera_log.h"
+#include "camera_metadata.h"
+#include "camera_metadata_overlay.h"
 #include "dp_log.h"
 #include "camera_simple_timer.h"
+#include "camera_surface_buffer_pool.h"
+#include "camera_surface_buffer_util.h"
+#include "lock_free_ring.h"
+#include "ring_blocking_queue.h"
+#include "timestamp_ring_index.h"
 #include "av_codec_proxy.h"
 #include "av_codec_adapter.h"
 #include "dps_fd.h"
@@ -1006,6 +1018,559 @@ HWTEST_F(CameraCommonUtilsUnitTest, CameraPictureProxy_Test_004, TestSize.Level0
     MEDIA_INFO_LOG("CameraPictureProxy_Test_004 End");
 }
 
+/*
+ * Feature: CameraSurfaceBufferPool
+ * Function: Test Acquire reuses released buffers
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: A tracked buffer is handed out again only after its owner released it, a buffer dropped by
+ * every holder or released by another owner is never reused.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, CameraSurfaceBufferPool_Test_001, TestSize.Level0)
+{
+    auto& pool = CameraSurfaceBufferPool::GetInstance();
+    pool.Reset();
+    BufferRequestConfig config = {
+        .width = 1920,
+        .height = 1080,
+        .strideAlignment = 0x8,
+        .format = GRAPHIC_PIXEL_FMT_YCBCR_420_SP,
+        .usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA,
+        .timeout = 0,
+    };
+    const uintptr_t owner = 1;
+    sptr<SurfaceBuffer> first = pool.Acquire(config);
+    ASSERT_NE(first, nullptr);
+    SurfaceBuffer* firstAddr = first.GetRefPtr();
+    uint32_t firstSequence = first->GetSeqNum();
+    pool.Track(first, owner);
+    int32_t sequence = 0;
+    EXPECT_EQ(first->GetExtraData()->ExtraGet(SURFACE_BUFFER_POOL_SEQUENCE_KEY, sequence), GSERROR_OK);
+    EXPECT_EQ(static_cast<uint32_t>(sequence), firstSequence);
+    first = nullptr;
+
+    sptr<SurfaceBuffer> second = pool.Acquire(config);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(second.GetRefPtr(), firstAddr);
+    EXPECT_FALSE(pool.Release(firstSequence, owner + 1));
+    EXPECT_TRUE(pool.Release(firstSequence, owner));
+    sptr<SurfaceBuffer> reused = pool.Acquire(config);
+    EXPECT_EQ(reused.GetRefPtr(), firstAddr);
+
+    SurfaceBufferPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.hitCount, 1);
+    EXPECT_EQ(stats.missCount, 2);
+    EXPECT_EQ(stats.releaseCount, 1);
+    EXPECT_EQ(stats.pooledBuffers, 0);
+    pool.Reset();
+}
+
+/*
+ * Feature: CameraSurfaceBufferPool
+ * Function: Test watermark trimming
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Above the high watermark idle buffers are released first, then the oldest tracked ones. A trim
+ * is counted only when it frees something, and TrimIdle keeps the tracked buffers.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, CameraSurfaceBufferPool_Test_002, TestSize.Level0)
+{
+    auto& pool = CameraSurfaceBufferPool::GetInstance();
+    pool.Reset();
+    BufferRequestConfig config = {
+        .width = 1920,
+        .height = 1080,
+        .strideAlignment = 0x8,
+        .format = GRAPHIC_PIXEL_FMT_YCBCR_420_SP,
+        .usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA,
+        .timeout = 0,
+    };
+    const uintptr_t owner = 1;
+    sptr<SurfaceBuffer> idle = pool.Acquire(config);
+    ASSERT_NE(idle, nullptr);
+    sptr<SurfaceBuffer> held = pool.Acquire(config);
+    ASSERT_NE(held, nullptr);
+    uint64_t bufferSize = held->GetSize();
+    pool.Track(idle, owner);
+    pool.Track(held, owner);
+    EXPECT_TRUE(pool.Release(idle->GetSeqNum(), owner));
+    idle = nullptr;
+    SurfaceBufferPoolStats stats = pool.GetStats();
+    EXPECT_EQ(stats.pooledBuffers, 2);
+    EXPECT_EQ(stats.idleBuffers, 1);
+
+    pool.TrimToLowWatermark();
+    EXPECT_EQ(pool.GetStats().trimCount, 0);
+    pool.SetWatermarks(bufferSize, bufferSize, 8);
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.trimCount, 1);
+    EXPECT_EQ(stats.pooledBuffers, 1);
+    EXPECT_EQ(stats.idleBuffers, 0);
+    EXPECT_EQ(stats.pooledBytes, bufferSize);
+
+    pool.TrimIdle();
+    EXPECT_EQ(pool.GetStats().trimCount, 1);
+    pool.SetWatermarks(bufferSize, 0, 8);
+    pool.TrimToLowWatermark();
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.pooledBuffers, 0);
+    EXPECT_EQ(stats.trimCount, 2);
+    EXPECT_FALSE(pool.Release(held->GetSeqNum(), owner));
+    EXPECT_NE(held->GetVirAddr(), nullptr);
+    pool.Reset();
+}
+
+/*
+ * Feature: CameraSurfaceBufferPool
+ * Function: Test CopyExtraData on a recycled buffer
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: The deep copy gets a fresh extra data object holding the keys of the source photo. Keys of the
+ * previous photo of a recycled buffer, including its pool sequence, are gone until Track writes the new sequence.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, CameraSurfaceBufferPool_Test_003, TestSize.Level0)
+{
+    auto& pool = CameraSurfaceBufferPool::GetInstance();
+    pool.Reset();
+    BufferRequestConfig config = {
+        .width = 1920,
+        .height = 1080,
+        .strideAlignment = 0x8,
+        .format = GRAPHIC_PIXEL_FMT_YCBCR_420_SP,
+        .usage = BUFFER_USAGE_CPU_READ | BUFFER_USAGE_CPU_WRITE | BUFFER_USAGE_MEM_DMA,
+        .timeout = 0,
+    };
+    const uintptr_t owner = 1;
+    sptr<SurfaceBuffer> source = SurfaceBuffer::Create();
+    ASSERT_NE(source, nullptr);
+    const int32_t captureId = 7;
+    const int64_t imageId = 1234567890123;
+    const double expoFNumber = 1.8;
+    const std::string compositionReasons = "reason";
+    source->GetExtraData()->ExtraSet(OHOS::Camera::captureId, captureId);
+    source->GetExtraData()->ExtraSet(OHOS::Camera::imageId, imageId);
+    source->GetExtraData()->ExtraSet(OHOS::Camera::expoFNumber, expoFNumber);
+    source->GetExtraData()->ExtraSet(OHOS::Camera::compositionReasons, compositionReasons);
+
+    sptr<SurfaceBuffer> recycled = pool.Acquire(config);
+    ASSERT_NE(recycled, nullptr);
+    const int32_t staleCaptureId = 3;
+    const int32_t staleWidth = 640;
+    recycled->GetExtraData()->ExtraSet(OHOS::Camera::captureId, staleCaptureId);
+    recycled->GetExtraData()->ExtraSet(OHOS::Camera::dataWidth, staleWidth);
+    pool.Track(recycled, owner);
+    uint32_t sequence = recycled->GetSeqNum();
+    ASSERT_TRUE(pool.Release(sequence, owner));
+
+    sptr<SurfaceBuffer> copy = pool.Acquire(config);
+    ASSERT_EQ(copy.GetRefPtr(), recycled.GetRefPtr());
+    ASSERT_TRUE(CameraSurfaceBufferUtil::CopyExtraData(source, copy));
+    sptr<BufferExtraData> extraData = copy->GetExtraData();
+    ASSERT_NE(extraData, nullptr);
+    EXPECT_NE(extraData.GetRefPtr(), source->GetExtraData().GetRefPtr());
+    int32_t copiedCaptureId = 0;
+    int64_t copiedImageId = 0;
+    double copiedFNumber = 0;
+    std::string copiedReasons;
+    EXPECT_EQ(extraData->ExtraGet(OHOS::Camera::captureId, copiedCaptureId), GSERROR_OK);
+    EXPECT_EQ(copiedCaptureId, captureId);
+    EXPECT_EQ(extraData->ExtraGet(OHOS::Camera::imageId, copiedImageId), GSERROR_OK);
+    EXPECT_EQ(copiedImageId, imageId);
+    EXPECT_EQ(extraData->ExtraGet(OHOS::Camera::expoFNumber, copiedFNumber), GSERROR_OK);
+    EXPECT_EQ(copiedFNumber, expoFNumber);
+    EXPECT_EQ(extraData->ExtraGet(OHOS::Camera::compositionReasons, copiedReasons), GSERROR_OK);
+    EXPECT_EQ(copiedReasons, compositionReasons);
+    int32_t value = 0;
+    EXPECT_NE(extraData->ExtraGet(OHOS::Camera::dataWidth, value), GSERROR_OK);
+    EXPECT_NE(extraData->ExtraGet(SURFACE_BUFFER_POOL_SEQUENCE_KEY, value), GSERROR_OK);
+
+    pool.Track(copy, owner);
+    EXPECT_EQ(extraData->ExtraGet(SURFACE_BUFFER_POOL_SEQUENCE_KEY, value), GSERROR_OK);
+    EXPECT_EQ(static_cast<uint32_t>(value), copy->GetSeqNum());
+    pool.Reset();
+}
+
+/*
+ * Feature: SpscRing
+ * Function: Test FIFO order and drop-oldest overwrite
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Elements are popped in push order, TryPush fails when full and PushOverwrite evicts the
+ * oldest element.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, SpscRing_Test_001, TestSize.Level0)
+{
+    constexpr int32_t capacity = 3;
+    SpscRing<std::unique_ptr<int32_t>> ring(capacity);
+    for (int32_t i = 0; i < capacity; ++i) {
+        EXPECT_TRUE(ring.TryPush(std::make_unique<int32_t>(i)));
+    }
+    EXPECT_TRUE(ring.Full());
+    EXPECT_FALSE(ring.TryPush(std::make_unique<int32_t>(capacity)));
+
+    std::unique_ptr<int32_t> dropped;
+    EXPECT_TRUE(ring.PushOverwrite(std::make_unique<int32_t>(capacity), dropped));
+    ASSERT_NE(dropped, nullptr);
+    EXPECT_EQ(*dropped, 0);
+    EXPECT_EQ(ring.DropCount(), 1);
+
+    std::unique_ptr<int32_t> value;
+    for (int32_t i = 1; i <= capacity; ++i) {
+        ASSERT_TRUE(ring.TryPop(value));
+        EXPECT_EQ(*value, i);
+    }
+    EXPECT_TRUE(ring.Empty());
+    EXPECT_FALSE(ring.TryPop(value));
+}
+
+/*
+ * Feature: MpscRing
+ * Function: Test concurrent producers
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Every element pushed by several producers is popped exactly once by the single consumer.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, MpscRing_Test_001, TestSize.Level0)
+{
+    constexpr int32_t producerCount = 4;
+    constexpr int32_t perProducer = 10000;
+    MpscRing<int32_t> ring(64);
+    std::vector<std::thread> producers;
+    for (int32_t p = 0; p < producerCount; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (int32_t i = 0; i < perProducer; ++i) {
+                while (!ring.TryPush(p * perProducer + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    std::vector<bool> seen(producerCount * perProducer, false);
+    int32_t received = 0;
+    int32_t value = 0;
+    while (received < producerCount * perProducer) {
+        if (!ring.TryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_FALSE(seen[value]);
+        seen[value] = true;
+        received++;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(ring.Empty());
+}
+
+/*
+ * Feature: RingBlockingQueue
+ * Function: Test blocking pop and deactivation
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: A blocked Pop is woken by a push, GetAllElements keeps FIFO order, and SetActive(false) wakes
+ * every waiter.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, RingBlockingQueue_Test_001, TestSize.Level0)
+{
+    RingBlockingQueue<int32_t> queue("test", 4);
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        queue.Push(1);
+    });
+    EXPECT_EQ(queue.Pop(), 1);
+    producer.join();
+
+    queue.Push(2);
+    queue.Push(3);
+    std::vector<int32_t> elements = queue.GetAllElements();
+    ASSERT_EQ(elements.size(), 2);
+    EXPECT_EQ(elements[0], 2);
+    EXPECT_EQ(elements[1], 3);
+    EXPECT_EQ(queue.Front(), 2);
+    EXPECT_EQ(queue.Size(), 2);
+
+    queue.Clear();
+    std::vector<std::thread> waiters;
+    for (int32_t i = 0; i < 3; ++i) {
+        waiters.emplace_back([&queue]() { EXPECT_EQ(queue.Pop(), 0); });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.SetActive(false);
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_FALSE(queue.Push(4));
+}
+
+/*
+ * Feature: RingBlockingQueue
+ * Function: Test TryPopIf
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: TryPopIf pops only the elements its predicate accepts, and each element is popped or evicted
+ * exactly once while a producer keeps overwriting the full queue.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, RingBlockingQueue_Test_002, TestSize.Level0)
+{
+    RingBlockingQueue<int32_t> queue("test", 4);
+    auto isSmall = [](const int32_t& value) { return value < 3; };
+    for (int32_t i = 1; i <= 4; ++i) {
+        queue.Push(i);
+    }
+    int32_t value = 0;
+    EXPECT_TRUE(queue.TryPopIf(isSmall, value));
+    EXPECT_EQ(value, 1);
+    EXPECT_TRUE(queue.TryPopIf(isSmall, value));
+    EXPECT_EQ(value, 2);
+    EXPECT_FALSE(queue.TryPopIf(isSmall, value));
+    EXPECT_EQ(queue.Size(), 2);
+
+    constexpr int32_t count = 20000;
+    RingBlockingQueue<int32_t> overwriteQueue("overwrite", 4);
+    auto any = [](const int32_t&) { return true; };
+    std::atomic<bool> isDone {false};
+    std::vector<int32_t> popped;
+    std::thread consumer([&overwriteQueue, &isDone, &popped, &any]() {
+        int32_t element = 0;
+        while (!isDone.load() || !overwriteQueue.Empty()) {
+            if (overwriteQueue.TryPopIf(any, element)) {
+                popped.push_back(element);
+            }
+        }
+    });
+    std::vector<int32_t> seen(count + 1, 0);
+    for (int32_t i = 1; i <= count; ++i) {
+        int32_t dropped = 0;
+        if (overwriteQueue.PushOverwrite(int32_t(i), dropped)) {
+            seen[dropped]++;
+        }
+    }
+    isDone.store(true);
+    consumer.join();
+    for (int32_t element : popped) {
+        seen[element]++;
+    }
+    for (int32_t i = 1; i <= count; ++i) {
+        EXPECT_EQ(seen[i], 1);
+    }
+}
+
+/*
+ * Feature: Framework
+ * Function: Test TimestampRingIndex
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test exact and nearest lookup within the tolerance, and eviction in arrival order.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, TimestampRingIndex_Test_001, TestSize.Level0)
+{
+    TimestampRingIndex<int32_t> index(3, 10);
+    index.Add(100, 1);
+    index.Add(133, 2);
+    index.Add(166, 3);
+    EXPECT_EQ(index.Size(), 3);
+    EXPECT_EQ(index.Take(133).value_or(0), 2);
+    EXPECT_FALSE(index.Take(133).has_value());
+    EXPECT_EQ(index.Take(171).value_or(0), 3);
+    EXPECT_FALSE(index.Take(120).has_value());
+
+    index.Add(199, 4);
+    index.Add(232, 5);
+    EXPECT_EQ(index.Size(), 2);
+    EXPECT_FALSE(index.Take(100).has_value());
+    index.Add(265, 6);
+    EXPECT_EQ(index.Size(), 3);
+    EXPECT_EQ(index.Take(260).value_or(0), 6);
+    EXPECT_EQ(index.Take(199).value_or(0), 4);
+    index.Clear();
+    EXPECT_EQ(index.Size(), 0);
+    EXPECT_FALSE(index.Take(232).has_value());
+}
+
+/*
+ * Feature: Framework
+ * Function: Test CameraMetadataOverlay
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the merge keeps the base untouched, overrides base tags in place and appends new tags.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, CameraMetadataOverlay_Test_001, TestSize.Level0)
+{
+    auto base = std::make_shared<OHOS::Camera::CameraMetadata>(10, 100);
+    uint8_t baseMirror = 0;
+    std::vector<int32_t> baseFpsRange = { 15, 30 };
+    ASSERT_TRUE(base->addEntry(OHOS_CONTROL_CAPTURE_MIRROR, &baseMirror, 1));
+    ASSERT_TRUE(base->addEntry(OHOS_CONTROL_FPS_RANGES, baseFpsRange.data(), baseFpsRange.size()));
+
+    CameraMetadataOverlay overlay(base);
+    uint8_t mirror = 1;
+    uint8_t dfxSwitch = 1;
+    EXPECT_TRUE(AddOrUpdateMetadata(overlay.GetDelta(), OHOS_CONTROL_CAPTURE_MIRROR, &mirror, 1));
+    EXPECT_TRUE(AddOrUpdateMetadata(overlay.GetDelta(), OHOS_CONTROL_VIDEO_DEBUG_SWITCH, &dfxSwitch, 1));
+    EXPECT_TRUE(overlay.IsInBase(OHOS_CONTROL_FPS_RANGES));
+    EXPECT_FALSE(overlay.IsInBase(OHOS_CONTROL_VIDEO_DEBUG_SWITCH));
+    camera_metadata_item_t item;
+    ASSERT_TRUE(overlay.Find(OHOS_CONTROL_CAPTURE_MIRROR, item));
+    EXPECT_EQ(item.data.u8[0], mirror);
+
+    auto merged = overlay.Merge();
+    ASSERT_NE(merged, nullptr);
+    ASSERT_EQ(merged->get()->item_count, 3);
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItem(merged->get(), 0, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.item, OHOS_CONTROL_CAPTURE_MIRROR);
+    EXPECT_EQ(item.data.u8[0], mirror);
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItem(merged->get(), 1, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.item, OHOS_CONTROL_FPS_RANGES);
+    EXPECT_EQ(item.data.i32[1], baseFpsRange[1]);
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItem(merged->get(), 2, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.item, OHOS_CONTROL_VIDEO_DEBUG_SWITCH);
+    ASSERT_EQ(OHOS::Camera::FindCameraMetadataItem(base->get(), OHOS_CONTROL_CAPTURE_MIRROR, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.data.u8[0], baseMirror);
+    EXPECT_EQ(base->get()->item_count, 2);
+
+    std::vector<uint8_t> setting;
+    EXPECT_TRUE(overlay.Flatten(setting));
+    std::shared_ptr<OHOS::Camera::CameraMetadata> parsed = nullptr;
+    OHOS::Camera::MetadataUtils::ConvertVecToMetadata(setting, parsed);
+    ASSERT_NE(parsed, nullptr);
+    EXPECT_EQ(parsed->get()->item_count, 3);
+}
+
+namespace {
+// Sizes around the vector width, and samples around the saturation points.
+const std::vector<size_t> PCM_TEST_COUNTS = { 0, 1, 7, 8, 9, 15, 16, 17, 63, 64, 65, 960, 1923 };
+
+std::vector<int16_t> CreatePcmSamples(size_t count, uint32_t seed)
+{
+    const int16_t edgeSamples[] = { INT16_MIN, INT16_MIN + 1, -1, 0, 1, INT16_MAX - 1, INT16_MAX };
+    std::vector<int16_t> samples(count);
+    for (size_t i = 0; i < count; i++) {
+        seed = seed * 1103515245 + 12345;
+        samples[i] = (seed >> 24) % 4 == 0 ? edgeSamples[(seed >> 16) % std::size(edgeSamples)] :
+            static_cast<int16_t>(seed >> 16);
+    }
+    return samples;
+}
+} // namespace
+
+/*
+ * Feature: Framework
+ * Function: Test AudioPcmKernel analysis
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test Peak, Rms and ClipCount equal their scalar forms, the magnitude of INT16_MIN
+ * saturates to INT16_MAX.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, AudioPcmKernel_Test_001, TestSize.Level0)
+{
+    for (size_t count : PCM_TEST_COUNTS) {
+        std::vector<int16_t> samples = CreatePcmSamples(count, static_cast<uint32_t>(count));
+        EXPECT_EQ(AudioPcmKernel::Peak(samples.data(), count), AudioPcmKernel::Scalar::Peak(samples.data(), count));
+        EXPECT_EQ(AudioPcmKernel::Rms(samples.data(), count), AudioPcmKernel::Scalar::Rms(samples.data(), count));
+        EXPECT_EQ(AudioPcmKernel::ClipCount(samples.data(), count),
+            AudioPcmKernel::Scalar::ClipCount(samples.data(), count));
+    }
+    std::vector<int16_t> minSamples(17, INT16_MIN);
+    EXPECT_EQ(AudioPcmKernel::Peak(minSamples.data(), minSamples.size()), INT16_MAX);
+    EXPECT_EQ(AudioPcmKernel::ClipCount(minSamples.data(), minSamples.size()), minSamples.size());
+    EXPECT_EQ(AudioPcmKernel::Rms(minSamples.data(), minSamples.size()), 32768.0f);
+    EXPECT_EQ(AudioPcmKernel::Rms(minSamples.data(), 0), 0.0f);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test AudioPcmKernel conversions
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test int16 and float conversion, gain and fade out equal their scalar forms, saturating out of
+ * range values and converting NaN to 0.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, AudioPcmKernel_Test_002, TestSize.Level0)
+{
+    const float gains[] = { 0.0f, 0.5f, 1.0f, 1.37f, 4.0f, -1.0f, std::numeric_limits<float>::quiet_NaN() };
+    for (size_t count : PCM_TEST_COUNTS) {
+        std::vector<int16_t> samples = CreatePcmSamples(count, static_cast<uint32_t>(count) + 1);
+        std::vector<float> floats(count);
+        std::vector<float> expectedFloats(count);
+        AudioPcmKernel::Int16ToFloat(samples.data(), floats.data(), count);
+        AudioPcmKernel::Scalar::Int16ToFloat(samples.data(), expectedFloats.data(), count);
+        EXPECT_EQ(floats, expectedFloats);
+
+        std::vector<int16_t> roundTrip(count);
+        AudioPcmKernel::FloatToInt16(floats.data(), roundTrip.data(), count);
+        EXPECT_EQ(roundTrip, samples);
+        for (float gain : gains) {
+            std::vector<int16_t> gained = samples;
+            std::vector<int16_t> expectedGained = samples;
+            AudioPcmKernel::ApplyGain(gained.data(), count, gain);
+            AudioPcmKernel::Scalar::ApplyGain(expectedGained.data(), count, gain);
+            EXPECT_EQ(gained, expectedGained);
+        }
+        std::vector<int16_t> faded = samples;
+        std::vector<int16_t> expectedFaded = samples;
+        AudioPcmKernel::FadeOut(faded.data(), count);
+        AudioPcmKernel::Scalar::FadeOut(expectedFaded.data(), count);
+        EXPECT_EQ(faded, expectedFaded);
+    }
+    const float outOfRange[] = { 1.5f, -1.5f, 1.0f, -1.0f, std::numeric_limits<float>::quiet_NaN(),
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(), 0.5f / 32768.0f, 0.0f };
+    std::vector<int16_t> converted(std::size(outOfRange));
+    AudioPcmKernel::FloatToInt16(outOfRange, converted.data(), converted.size());
+    EXPECT_EQ(converted, std::vector<int16_t>({ INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN, 0, INT16_MAX, INT16_MIN,
+        0, 0 }));
+    std::vector<int16_t> loud = { INT16_MAX, INT16_MIN, 20000, -20000, 100, -100, 0, 1, INT16_MIN };
+    AudioPcmKernel::ApplyGain(loud.data(), loud.size(), 2.0f);
+    EXPECT_EQ(loud, std::vector<int16_t>({ INT16_MAX, INT16_MIN, INT16_MAX, INT16_MIN, 200, -200, 0, 2, INT16_MIN }));
+}
+
+/*
+ * Feature: Framework
+ * Function: Test AudioPcmKernel channel layout
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test stereo and three channel interleave and deinterleave round trip and equal their scalar forms.
+ */
+HWTEST_F(CameraCommonUtilsUnitTest, AudioPcmKernel_Test_003, TestSize.Level0)
+{
+    for (size_t channelCount : { 1, 2, 3 }) {
+        for (size_t frameCount : PCM_TEST_COUNTS) {
+            std::vector<std::vector<int16_t>> planes;
+            std::vector<const int16_t*> planeAddrs;
+            for (size_t channel = 0; channel < channelCount; channel++) {
+                planes.push_back(CreatePcmSamples(frameCount, static_cast<uint32_t>(frameCount + channel)));
+                planeAddrs.push_back(planes.back().data());
+            }
+            std::vector<int16_t> interleaved(frameCount * channelCount);
+            std::vector<int16_t> expectedInterleaved(frameCount * channelCount);
+            AudioPcmKernel::Interleave(planeAddrs.data(), channelCount, frameCount, interleaved.data());
+            AudioPcmKernel::Scalar::Interleave(planeAddrs.data(), channelCount, frameCount,
+                expectedInterleaved.data());
+            EXPECT_EQ(interleaved, expectedInterleaved);
+
+            std::vector<std::vector<int16_t>> outPlanes(channelCount, std::vector<int16_t>(frameCount));
+            std::vector<int16_t*> outPlaneAddrs;
+            for (auto& plane : outPlanes) {
+                outPlaneAddrs.push_back(plane.data());
+            }
+            AudioPcmKernel::Deinterleave(interleaved.data(), channelCount, frameCount, outPlaneAddrs.data());
+            EXPECT_EQ(outPlanes, planes);
+        }
+    }
+}
+
 #ifdef CAMERA_CAPTURE_YUV
 /*
  * Feature: PhotoAssetProxy
@@ -0,0 +1,514 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_pcm_kernel.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AUDIO_PCM_KERNEL_NEON
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define AUDIO_PCM_KERNEL_SSE2
+#endif
+
+namespace OHOS {
+namespace CameraStandard {
+namespace AudioPcmKernel {
+namespace {
+constexpr float INT16_SCALE = 32768.0f;
+constexpr float INT16_SCALE_INVERSE = 1.0f / INT16_SCALE;
+constexpr float INT16_MAX_FLOAT = static_cast<float>(std::numeric_limits<int16_t>::max());
+constexpr float INT16_MIN_FLOAT = static_cast<float>(std::numeric_limits<int16_t>::min());
+constexpr size_t STEREO_CHANNEL_COUNT = 2;
+// int16 lanes of a 128 bit vector.
+constexpr size_t LANE_COUNT = 8;
+
+inline int16_t SaturateToInt16(float value)
+{
+    if (std::isnan(value)) {
+        return 0;
+    }
+    value = std::min(std::max(value, INT16_MIN_FLOAT), INT16_MAX_FLOAT);
+    return static_cast<int16_t>(std::nearbyint(value));
+}
+
+inline size_t GetVectorCount(size_t count)
+{
+    return count - count % LANE_COUNT;
+}
+
+void FadeOutRange(int16_t* data, size_t begin, size_t end, size_t count)
+{
+    for (size_t k = begin; k < end; k++) {
+        int32_t sample = static_cast<int32_t>(data[k]);
+        float rate = static_cast<float>(k) / static_cast<float>(count);
+        data[k] = static_cast<int16_t>(sample - static_cast<int32_t>(sample * rate));
+    }
+}
+
+#if defined(AUDIO_PCM_KERNEL_NEON)
+inline int16x8_t FloatToInt16x8(float32x4_t low, float32x4_t high)
+{
+    // vcvtnq rounds to nearest even, saturates to int32 and maps NaN to 0, the narrowing saturates again.
+    return vcombine_s16(vqmovn_s32(vcvtnq_s32_f32(low)), vqmovn_s32(vcvtnq_s32_f32(high)));
+}
+#elif defined(AUDIO_PCM_KERNEL_SSE2)
+inline __m128i FloatToInt32x4(__m128 value)
+{
+    // Clamp first, cvtps returns INT32_MIN out of range. The ordered mask maps NaN to 0, cvtps rounds to
+    // nearest even under the default rounding mode.
+    value = _mm_and_ps(value, _mm_cmpord_ps(value, value));
+    value = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(INT16_MIN_FLOAT)), _mm_set1_ps(INT16_MAX_FLOAT));
+    return _mm_cvtps_epi32(value);
+}
+
+inline __m128i Int16ToInt32Low(__m128i value)
+{
+    return _mm_srai_epi32(_mm_unpacklo_epi16(value, value), 16);
+}
+
+inline __m128i Int16ToInt32High(__m128i value)
+{
+    return _mm_srai_epi32(_mm_unpackhi_epi16(value, value), 16);
+}
+
+inline int16_t ReduceMax(__m128i value)
+{
+    value = _mm_max_epi16(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2)));
+    value = _mm_max_epi16(value, _mm_shuffle_epi32(value, _MM_SHUFFLE(2, 3, 0, 1)));
+    value = _mm_max_epi16(value, _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<int16_t>(_mm_extract_epi16(value, 0));
+}
+#endif
+} // namespace
+
+namespace Scalar {
+int16_t Peak(const int16_t* data, size_t count)
+{
+    int32_t peak = 0;
+    for (size_t i = 0; i < count; i++) {
+        peak = std::max(peak, std::abs(static_cast<int32_t>(data[i])));
+    }
+    return static_cast<int16_t>(std::min<int32_t>(peak, std::numeric_limits<int16_t>::max()));
+}
+
+float Rms(const int16_t* data, size_t count)
+{
+    if (count == 0) {
+        return 0.0f;
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        int32_t sample = data[i];
+        sum += static_cast<uint64_t>(sample * sample);
+    }
+    return static_cast<float>(std::sqrt(static_cast<double>(sum) / static_cast<double>(count)));
+}
+
+size_t ClipCount(const int16_t* data, size_t count)
+{
+    size_t clipCount = 0;
+    for (size_t i = 0; i < count; i++) {
+        clipCount += data[i] == std::numeric_limits<int16_t>::max() || data[i] == std::numeric_limits<int16_t>::min();
+    }
+    return clipCount;
+}
+
+void Int16ToFloat(const int16_t* src, float* dst, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = static_cast<float>(src[i]) * INT16_SCALE_INVERSE;
+    }
+}
+
+void FloatToInt16(const float* src, int16_t* dst, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        dst[i] = SaturateToInt16(src[i] * INT16_SCALE);
+    }
+}
+
+void Interleave(const int16_t* const* planes, size_t channelCount, size_t frameCount, int16_t* dst)
+{
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        for (size_t channel = 0; channel < channelCount; channel++) {
+            *dst++ = planes[channel][frame];
+        }
+    }
+}
+
+void Deinterleave(const int16_t* src, size_t channelCount, size_t frameCount, int16_t* const* planes)
+{
+    for (size_t frame = 0; frame < frameCount; frame++) {
+        for (size_t channel = 0; channel < channelCount; channel++) {
+            planes[channel][frame] = *src++;
+        }
+    }
+}
+
+void ApplyGain(int16_t* data, size_t count, float gain)
+{
+    for (size_t i = 0; i < count; i++) {
+        data[i] = SaturateToInt16(static_cast<float>(data[i]) * gain);
+    }
+}
+
+void FadeOut(int16_t* data, size_t count)
+{
+    FadeOutRange(data, 0, count, count);
+}
+} // namespace Scalar
+
+#if defined(AUDIO_PCM_KERNEL_NEON)
+int16_t Peak(const int16_t* data, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    int16x8_t peak = vdupq_n_s16(0);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        peak = vmaxq_s16(peak, vqabsq_s16(vld1q_s16(data + i)));
+    }
+    return std::max(vmaxvq_s16(peak), Scalar::Peak(data + vectorCount, count - vectorCount));
+}
+
+float Rms(const int16_t* data, size_t count)
+{
+    if (count == 0) {
+        return 0.0f;
+    }
+    size_t vectorCount = GetVectorCount(count);
+    uint64x2_t sum = vdupq_n_u64(0);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8_t samples = vld1q_s16(data + i);
+        // A square is at most 2^30, so the int32 products read as uint32 never wrap.
+        sum = vpadalq_u32(sum, vreinterpretq_u32_s32(vmull_s16(vget_low_s16(samples), vget_low_s16(samples))));
+        sum = vpadalq_u32(sum, vreinterpretq_u32_s32(vmull_high_s16(samples, samples)));
+    }
+    uint64_t total = vaddvq_u64(sum);
+    for (size_t i = vectorCount; i < count; i++) {
+        int32_t sample = data[i];
+        total += static_cast<uint64_t>(sample * sample);
+    }
+    return static_cast<float>(std::sqrt(static_cast<double>(total) / static_cast<double>(count)));
+}
+
+size_t ClipCount(const int16_t* data, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    int16x8_t maxValue = vdupq_n_s16(std::numeric_limits<int16_t>::max());
+    int16x8_t minValue = vdupq_n_s16(std::numeric_limits<int16_t>::min());
+    size_t clipCount = 0;
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8_t samples = vld1q_s16(data + i);
+        uint16x8_t isClipped = vorrq_u16(vceqq_s16(samples, maxValue), vceqq_s16(samples, minValue));
+        clipCount += vaddvq_u16(vshrq_n_u16(isClipped, 15));
+    }
+    return clipCount + Scalar::ClipCount(data + vectorCount, count - vectorCount);
+}
+
+void Int16ToFloat(const int16_t* src, float* dst, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    float32x4_t scale = vdupq_n_f32(INT16_SCALE_INVERSE);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8_t samples = vld1q_s16(src + i);
+        vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))), scale));
+        vst1q_f32(dst + i + LANE_COUNT / 2, vmulq_f32(vcvtq_f32_s32(vmovl_high_s16(samples)), scale));
+    }
+    Scalar::Int16ToFloat(src + vectorCount, dst + vectorCount, count - vectorCount);
+}
+
+void FloatToInt16(const float* src, int16_t* dst, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    float32x4_t scale = vdupq_n_f32(INT16_SCALE);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        float32x4_t low = vmulq_f32(vld1q_f32(src + i), scale);
+        float32x4_t high = vmulq_f32(vld1q_f32(src + i + LANE_COUNT / 2), scale);
+        vst1q_s16(dst + i, FloatToInt16x8(low, high));
+    }
+    Scalar::FloatToInt16(src + vectorCount, dst + vectorCount, count - vectorCount);
+}
+
+void Interleave(const int16_t* const* planes, size_t channelCount, size_t frameCount, int16_t* dst)
+{
+    if (channelCount != STEREO_CHANNEL_COUNT) {
+        Scalar::Interleave(planes, channelCount, frameCount, dst);
+        return;
+    }
+    size_t vectorCount = GetVectorCount(frameCount);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8x2_t frames = { { vld1q_s16(planes[0] + i), vld1q_s16(planes[1] + i) } };
+        vst2q_s16(dst + i * STEREO_CHANNEL_COUNT, frames);
+    }
+    const int16_t* tailPlanes[STEREO_CHANNEL_COUNT] = { planes[0] + vectorCount, planes[1] + vectorCount };
+    Scalar::Interleave(tailPlanes, channelCount, frameCount - vectorCount, dst + vectorCount * STEREO_CHANNEL_COUNT);
+}
+
+void Deinterleave(const int16_t* src, size_t channelCount, size_t frameCount, int16_t* const* planes)
+{
+    if (channelCount != STEREO_CHANNEL_COUNT) {
+        Scalar::Deinterleave(src, channelCount, frameCount, planes);
+        return;
+    }
+    size_t vectorCount = GetVectorCount(frameCount);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8x2_t frames = vld2q_s16(src + i * STEREO_CHANNEL_COUNT);
+        vst1q_s16(planes[0] + i, frames.val[0]);
+        vst1q_s16(planes[1] + i, frames.val[1]);
+    }
+    int16_t* tailPlanes[STEREO_CHANNEL_COUNT] = { planes[0] + vectorCount, planes[1] + vectorCount };
+    Scalar::Deinterleave(src + vectorCount * STEREO_CHANNEL_COUNT, channelCount, frameCount - vectorCount, tailPlanes);
+}
+
+void ApplyGain(int16_t* data, size_t count, float gain)
+{
+    size_t vectorCount = GetVectorCount(count);
+    float32x4_t gainVector = vdupq_n_f32(gain);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8_t samples = vld1q_s16(data + i);
+        float32x4_t low = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))), gainVector);
+        float32x4_t high = vmulq_f32(vcvtq_f32_s32(vmovl_high_s16(samples)), gainVector);
+        vst1q_s16(data + i, FloatToInt16x8(low, high));
+    }
+    Scalar::ApplyGain(data + vectorCount, count - vectorCount, gain);
+}
+
+void FadeOut(int16_t* data, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    float32x4_t total = vdupq_n_f32(static_cast<float>(count));
+    const float laneOffsets[LANE_COUNT / 2] = { 0.0f, 1.0f, 2.0f, 3.0f };
+    float32x4_t index = vld1q_f32(laneOffsets);
+    float32x4_t step = vdupq_n_f32(static_cast<float>(LANE_COUNT / 2));
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        int16x8_t samples = vld1q_s16(data + i);
+        int32x4_t lowSamples = vmovl_s16(vget_low_s16(samples));
+        int32x4_t highSamples = vmovl_high_s16(samples);
+        float32x4_t lowRate = vdivq_f32(index, total);
+        index = vaddq_f32(index, step);
+        float32x4_t highRate = vdivq_f32(index, total);
+        index = vaddq_f32(index, step);
+        lowSamples = vsubq_s32(lowSamples, vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(lowSamples), lowRate)));
+        highSamples = vsubq_s32(highSamples, vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(highSamples), highRate)));
+        vst1q_s16(data + i, vcombine_s16(vmovn_s32(lowSamples), vmovn_s32(highSamples)));
+    }
+    FadeOutRange(data, vectorCount, count, count);
+}
+#elif defined(AUDIO_PCM_KERNEL_SSE2)
+int16_t Peak(const int16_t* data, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    __m128i peak = _mm_setzero_si128();
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        // The saturating negation turns INT16_MIN into INT16_MAX.
+        __m128i magnitude = _mm_max_epi16(samples, _mm_subs_epi16(_mm_setzero_si128(), samples));
+        peak = _mm_max_epi16(peak, magnitude);
+    }
+    return std::max(ReduceMax(peak), Scalar::Peak(data + vectorCount, count - vectorCount));
+}
+
+float Rms(const int16_t* data, size_t count)
+{
+    if (count == 0) {
+        return 0.0f;
+    }
+    size_t vectorCount = GetVectorCount(count);
+    __m128i sum = _mm_setzero_si128();
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        // A pair of squares is at most 2^31, read as uint32 and widened before adding.
+        __m128i squares = _mm_madd_epi16(samples, samples);
+        sum = _mm_add_epi64(sum, _mm_unpacklo_epi32(squares, _mm_setzero_si128()));
+        sum = _mm_add_epi64(sum, _mm_unpackhi_epi32(squares, _mm_setzero_si128()));
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum);
+    uint64_t total = lanes[0] + lanes[1];
+    for (size_t i = vectorCount; i < count; i++) {
+        int32_t sample = data[i];
+        total += static_cast<uint64_t>(sample * sample);
+    }
+    return static_cast<float>(std::sqrt(static_cast<double>(total) / static_cast<double>(count)));
+}
+
+size_t ClipCount(const int16_t* data, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    __m128i maxValue = _mm_set1_epi16(std::numeric_limits<int16_t>::max());
+    __m128i minValue = _mm_set1_epi16(std::numeric_limits<int16_t>::min());
+    size_t clipCount = 0;
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i isClipped = _mm_or_si128(_mm_cmpeq_epi16(samples, maxValue), _mm_cmpeq_epi16(samples, minValue));
+        // Two mask bits per int16 lane.
+        clipCount += static_cast<size_t>(__builtin_popcount(_mm_movemask_epi8(isClipped))) / sizeof(int16_t);
+    }
+    return clipCount + Scalar::ClipCount(data + vectorCount, count - vectorCount);
+}
+
+void Int16ToFloat(const int16_t* src, float* dst, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    __m128 scale = _mm_set1_ps(INT16_SCALE_INVERSE);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(Int16ToInt32Low(samples)), scale));
+        _mm_storeu_ps(dst + i + LANE_COUNT / 2, _mm_mul_ps(_mm_cvtepi32_ps(Int16ToInt32High(samples)), scale));
+    }
+    Scalar::Int16ToFloat(src + vectorCount, dst + vectorCount, count - vectorCount);
+}
+
+void FloatToInt16(const float* src, int16_t* dst, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    __m128 scale = _mm_set1_ps(INT16_SCALE);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i low = FloatToInt32x4(_mm_mul_ps(_mm_loadu_ps(src + i), scale));
+        __m128i high = FloatToInt32x4(_mm_mul_ps(_mm_loadu_ps(src + i + LANE_COUNT / 2), scale));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(low, high));
+    }
+    Scalar::FloatToInt16(src + vectorCount, dst + vectorCount, count - vectorCount);
+}
+
+void Interleave(const int16_t* const* planes, size_t channelCount, size_t frameCount, int16_t* dst)
+{
+    if (channelCount != STEREO_CHANNEL_COUNT) {
+        Scalar::Interleave(planes, channelCount, frameCount, dst);
+        return;
+    }
+    size_t vectorCount = GetVectorCount(frameCount);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[0] + i));
+        __m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(planes[1] + i));
+        __m128i* out = reinterpret_cast<__m128i*>(dst + i * STEREO_CHANNEL_COUNT);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(left, right));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(left, right));
+    }
+    const int16_t* tailPlanes[STEREO_CHANNEL_COUNT] = { planes[0] + vectorCount, planes[1] + vectorCount };
+    Scalar::Interleave(tailPlanes, channelCount, frameCount - vectorCount, dst + vectorCount * STEREO_CHANNEL_COUNT);
+}
+
+void Deinterleave(const int16_t* src, size_t channelCount, size_t frameCount, int16_t* const* planes)
+{
+    if (channelCount != STEREO_CHANNEL_COUNT) {
+        Scalar::Deinterleave(src, channelCount, frameCount, planes);
+        return;
+    }
+    size_t vectorCount = GetVectorCount(frameCount);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + i * STEREO_CHANNEL_COUNT);
+        __m128i first = _mm_loadu_si128(in);
+        __m128i second = _mm_loadu_si128(in + 1);
+        // Each int32 lane holds a frame, left in the low half. Both halves fit int16, so the packs are exact.
+        __m128i left = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(first, 16), 16),
+            _mm_srai_epi32(_mm_slli_epi32(second, 16), 16));
+        __m128i right = _mm_packs_epi32(_mm_srai_epi32(first, 16), _mm_srai_epi32(second, 16));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[0] + i), left);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(planes[1] + i), right);
+    }
+    int16_t* tailPlanes[STEREO_CHANNEL_COUNT] = { planes[0] + vectorCount, planes[1] + vectorCount };
+    Scalar::Deinterleave(src + vectorCount * STEREO_CHANNEL_COUNT, channelCount, frameCount - vectorCount, tailPlanes);
+}
+
+void ApplyGain(int16_t* data, size_t count, float gain)
+{
+    size_t vectorCount = GetVectorCount(count);
+    __m128 gainVector = _mm_set1_ps(gain);
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i* samplesAddr = reinterpret_cast<__m128i*>(data + i);
+        __m128i samples = _mm_loadu_si128(samplesAddr);
+        __m128i low = FloatToInt32x4(_mm_mul_ps(_mm_cvtepi32_ps(Int16ToInt32Low(samples)), gainVector));
+        __m128i high = FloatToInt32x4(_mm_mul_ps(_mm_cvtepi32_ps(Int16ToInt32High(samples)), gainVector));
+        _mm_storeu_si128(samplesAddr, _mm_packs_epi32(low, high));
+    }
+    Scalar::ApplyGain(data + vectorCount, count - vectorCount, gain);
+}
+
+void FadeOut(int16_t* data, size_t count)
+{
+    size_t vectorCount = GetVectorCount(count);
+    __m128 total = _mm_set1_ps(static_cast<float>(count));
+    __m128 index = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+    __m128 step = _mm_set1_ps(static_cast<float>(LANE_COUNT / 2));
+    for (size_t i = 0; i < vectorCount; i += LANE_COUNT) {
+        __m128i* samplesAddr = reinterpret_cast<__m128i*>(data + i);
+        __m128i samples = _mm_loadu_si128(samplesAddr);
+        __m128i lowSamples = Int16ToInt32Low(samples);
+        __m128i highSamples = Int16ToInt32High(samples);
+        __m128 lowRate = _mm_div_ps(index, total);
+        index = _mm_add_ps(index, step);
+        __m128 highRate = _mm_div_ps(index, total);
+        index = _mm_add_ps(index, step);
+        lowSamples = _mm_sub_epi32(lowSamples, _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(lowSamples), lowRate)));
+        highSamples =
+            _mm_sub_epi32(highSamples, _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(highSamples), highRate)));
+        _mm_storeu_si128(samplesAddr, _mm_packs_epi32(lowSamples, highSamples));
+    }
+    FadeOutRange(data, vectorCount, count, count);
+}
+#else
+int16_t Peak(const int16_t* data, size_t count)
+{
+    return Scalar::Peak(data, count);
+}
+
+float Rms(const int16_t* data, size_t count)
+{
+    return Scalar::Rms(data, count);
+}
+
+size_t ClipCount(const int16_t* data, size_t count)
+{
+    return Scalar::ClipCount(data, count);
+}
+
+void Int16ToFloat(const int16_t* src, float* dst, size_t count)
+{
+    Scalar::Int16ToFloat(src, dst, count);
+}
+
+void FloatToInt16(const float* src, int16_t* dst, size_t count)
+{
+    Scalar::FloatToInt16(src, dst, count);
+}
+
+void Interleave(const int16_t* const* planes, size_t channelCount, size_t frameCount, int16_t* dst)
+{
+    Scalar::Interleave(planes, channelCount, frameCount, dst);
+}
+
+void Deinterleave(const int16_t* src, size_t channelCount, size_t frameCount, int16_t* const* planes)
+{
+    Scalar::Deinterleave(src, channelCount, frameCount, planes);
+}
+
+void ApplyGain(int16_t* data, size_t count, float gain)
+{
+    Scalar::ApplyGain(data, count, gain);
+}
+
+void FadeOut(int16_t* data, size_t count)
+{
+    Scalar::FadeOut(data, count);
+}
+#endif
+} // namespace AudioPcmKernel
+} // namespace CameraStandard
+} // namespace OHOS
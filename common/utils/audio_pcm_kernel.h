@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_AUDIO_PCM_KERNEL_H
+#define OHOS_CAMERA_AUDIO_PCM_KERNEL_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Per-sample loops over 16 bit PCM, vectorized with NEON on arm64 and SSE2 on x86, scalar elsewhere. Every
+ * function gives the same result as its scalar form in AudioPcmKernel::Scalar, bit for bit. Conversions to
+ * int16 saturate and round to nearest even, a NaN converts to 0, and the magnitude of INT16_MIN saturates to
+ * INT16_MAX. Buffers need no particular alignment.
+ */
+namespace AudioPcmKernel {
+// Largest sample magnitude.
+int16_t Peak(const int16_t* data, size_t count);
+// Root mean square in int16 units, 0 for no samples.
+float Rms(const int16_t* data, size_t count);
+// Samples at INT16_MAX or INT16_MIN.
+size_t ClipCount(const int16_t* data, size_t count);
+// Scales by 1 / 32768 into [-1, 1).
+void Int16ToFloat(const int16_t* src, float* dst, size_t count);
+// Scales by 32768 and saturates.
+void FloatToInt16(const float* src, int16_t* dst, size_t count);
+// planes holds channelCount planes of frameCount samples each, dst frameCount * channelCount samples.
+void Interleave(const int16_t* const* planes, size_t channelCount, size_t frameCount, int16_t* dst);
+void Deinterleave(const int16_t* src, size_t channelCount, size_t frameCount, int16_t* const* planes);
+// Multiplies in place and saturates.
+void ApplyGain(int16_t* data, size_t count, float gain);
+// Fades linearly from full level to silence, sample k keeps data[k] - trunc(data[k] * k / count).
+void FadeOut(int16_t* data, size_t count);
+
+// Reference forms, used for the tails of the vector loops and by the tests.
+namespace Scalar {
+int16_t Peak(const int16_t* data, size_t count);
+float Rms(const int16_t* data, size_t count);
+size_t ClipCount(const int16_t* data, size_t count);
+void Int16ToFloat(const int16_t* src, float* dst, size_t count);
+void FloatToInt16(const float* src, int16_t* dst, size_t count);
+void Interleave(const int16_t* const* planes, size_t channelCount, size_t frameCount, int16_t* dst);
+void Deinterleave(const int16_t* src, size_t channelCount, size_t frameCount, int16_t* const* planes);
+void ApplyGain(int16_t* data, size_t count, float gain);
+void FadeOut(int16_t* data, size_t count);
+} // namespace Scalar
+} // namespace AudioPcmKernel
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_AUDIO_PCM_KERNEL_H
@@ -17,8 +17,12 @@
 #define CAMERA_FRAMEWORK_BLOCKING_QUEUE_H
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <limits>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 #include <vector>
@@ -94,7 +98,7 @@ public:
         if (!isActive_) {
             return {};
         }
-        T el = que_.front();
+        T el = std::move(que_.front());
         que_.pop_front();
         cvFull_.notify_one();
         return el;
@@ -111,7 +115,7 @@ public:
         if (!isActive_) {
             return {};
         }
-        T el = que_.back();
+        T el = std::move(que_.back());
         que_.pop_back();
         cvFull_.notify_one();
         return el;
@@ -153,12 +157,13 @@ public:
             return {};
         }
         if (que_.empty()) {
-            cvEmpty_.wait_for(lock, timeoutMs, [this] { return !isActive_ || !que_.empty(); });
+            cvEmpty_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                [this] { return !isActive_ || !que_.empty(); });
         }
         if (!isActive_ || que_.empty()) {
             return {};
         }
-        T el = que_.front();
+        T el = std::move(que_.front());
         que_.pop_front();
         cvFull_.notify_one();
         return el;
@@ -190,7 +195,8 @@ public:
         isActive_ = active;
         if (!active) {
             ClearUnlocked();
-            cvEmpty_.notify_one();
+            cvEmpty_.notify_all();
+            cvFull_.notify_all();
         }
     }
     std::vector<T> GetAllElements()
@@ -230,7 +236,8 @@ private:
             return false;
         }
         if (que_.size() >= capacity_) {
-            cvFull_.wait(lock, timeoutMs, [this] { return !isActive_ || que_.size() < capacity_; });
+            cvFull_.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                [this] { return !isActive_ || que_.size() < capacity_; });
         }
         if (!isActive_ || (que_.size() == capacity_)) {
             return false;
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "camera_metadata_overlay.h"
+
+#include <utility>
+
+#include "camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+// Stream start patches a handful of tags, addEntry grows the delta if more are written.
+constexpr uint32_t DELTA_ITEM_CAPACITY = 16;
+constexpr uint32_t DELTA_DATA_CAPACITY = 128;
+
+uint32_t GetItemCount(const common_metadata_header_t* header)
+{
+    return header == nullptr ? 0 : header->item_count;
+}
+
+uint32_t GetDataCount(const common_metadata_header_t* header)
+{
+    return header == nullptr ? 0 : header->data_count;
+}
+} // namespace
+
+CameraMetadataOverlay::CameraMetadataOverlay(std::shared_ptr<OHOS::Camera::CameraMetadata> base)
+    : base_(std::move(base)),
+      delta_(std::make_shared<OHOS::Camera::CameraMetadata>(DELTA_ITEM_CAPACITY, DELTA_DATA_CAPACITY))
+{}
+
+bool CameraMetadataOverlay::IsInBase(uint32_t tag) const
+{
+    CHECK_RETURN_RET(base_ == nullptr || base_->get() == nullptr, false);
+    camera_metadata_item_t item;
+    return OHOS::Camera::FindCameraMetadataItem(base_->get(), tag, &item) == CAM_META_SUCCESS;
+}
+
+bool CameraMetadataOverlay::Find(uint32_t tag, camera_metadata_item_t& item) const
+{
+    if (delta_ != nullptr && delta_->get() != nullptr &&
+        OHOS::Camera::FindCameraMetadataItem(delta_->get(), tag, &item) == CAM_META_SUCCESS) {
+        return true;
+    }
+    CHECK_RETURN_RET(base_ == nullptr || base_->get() == nullptr, false);
+    return OHOS::Camera::FindCameraMetadataItem(base_->get(), tag, &item) == CAM_META_SUCCESS;
+}
+
+std::shared_ptr<OHOS::Camera::CameraMetadata> CameraMetadataOverlay::Merge() const
+{
+    common_metadata_header_t* baseHeader = base_ == nullptr ? nullptr : base_->get();
+    common_metadata_header_t* deltaHeader = delta_ == nullptr ? nullptr : delta_->get();
+    uint32_t deltaCount = GetItemCount(deltaHeader);
+    auto merged = std::make_shared<OHOS::Camera::CameraMetadata>(GetItemCount(baseHeader) + deltaCount,
+        GetDataCount(baseHeader) + GetDataCount(deltaHeader));
+    CHECK_RETURN_RET_ELOG(merged->get() == nullptr, nullptr, "CameraMetadataOverlay::Merge alloc failed");
+    // The base goes over as two block copies, only the delta tags are written one by one.
+    if (baseHeader != nullptr) {
+        int32_t ret = OHOS::Camera::CopyCameraMetadataItems(merged->get(), baseHeader);
+        CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS, nullptr,
+            "CameraMetadataOverlay::Merge failed to copy base ret: %{public}d", ret);
+    }
+    camera_metadata_item_t item;
+    for (uint32_t index = 0; index < deltaCount; index++) {
+        CHECK_CONTINUE(OHOS::Camera::GetCameraMetadataItem(deltaHeader, index, &item) != CAM_META_SUCCESS);
+        uint32_t mergedIndex = 0;
+        int32_t ret = OHOS::Camera::CameraMetadata::FindCameraMetadataItemIndex(merged->get(), item.item,
+            &mergedIndex);
+        bool status = ret == CAM_META_SUCCESS ?
+            merged->updateEntry(item.item, item.data.u8, item.count) :
+            merged->addEntry(item.item, item.data.u8, item.count);
+        CHECK_PRINT_ELOG(!status, "CameraMetadataOverlay::Merge failed to write item: %{public}u", item.item);
+    }
+    return merged;
+}
+
+bool CameraMetadataOverlay::Flatten(std::vector<uint8_t>& setting) const
+{
+    auto merged = Merge();
+    CHECK_RETURN_RET(merged == nullptr, false);
+    return OHOS::Camera::MetadataUtils::ConvertMetadataToVec(merged, setting);
+}
+} // namespace CameraStandard
+} // namespace OHOS
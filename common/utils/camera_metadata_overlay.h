@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_METADATA_OVERLAY_H
+#define OHOS_CAMERA_METADATA_OVERLAY_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "camera_metadata_operator.h"
+#include "metadata_utils.h"
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Sparse set of tags layered over a shared base metadata that is never written. Tags are written
+ * into the delta with the usual metadata helpers, and the two are merged when the result is needed,
+ * the delta winning over the base. The HDI takes complete settings, so the merge still carries the
+ * whole base, as a block copy of its items and data; only the changed tags are written item by item.
+ */
+class CameraMetadataOverlay {
+public:
+    explicit CameraMetadataOverlay(std::shared_ptr<OHOS::Camera::CameraMetadata> base);
+    ~CameraMetadataOverlay() = default;
+
+    // Metadata receiving the changed tags.
+    inline std::shared_ptr<OHOS::Camera::CameraMetadata>& GetDelta()
+    {
+        return delta_;
+    }
+
+    // The base is read by the lookups and the merge, callers serialize them with writers of the base.
+    bool IsInBase(uint32_t tag) const;
+    bool Find(uint32_t tag, camera_metadata_item_t& item) const;
+
+    // Base tags keep their position with the delta value if overridden, delta only tags follow.
+    std::shared_ptr<OHOS::Camera::CameraMetadata> Merge() const;
+    bool Flatten(std::vector<uint8_t>& setting) const;
+
+private:
+    std::shared_ptr<OHOS::Camera::CameraMetadata> base_;
+    std::shared_ptr<OHOS::Camera::CameraMetadata> delta_;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_METADATA_OVERLAY_H
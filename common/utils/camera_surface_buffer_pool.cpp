@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "camera_surface_buffer_pool.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <sstream>
+
+#include "camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr uint32_t BYTES_PER_KB = 1024;
+}
+
+CameraSurfaceBufferPool& CameraSurfaceBufferPool::GetInstance()
+{
+    static CameraSurfaceBufferPool instance;
+    return instance;
+}
+
+SurfaceBufferPoolKey CameraSurfaceBufferPool::MakeKey(const BufferRequestConfig& config)
+{
+    return {
+        .width = config.width,
+        .height = config.height,
+        .strideAlignment = config.strideAlignment,
+        .format = config.format,
+        .usage = config.usage,
+        .colorGamut = static_cast<int32_t>(config.colorGamut),
+        .transform = static_cast<int32_t>(config.transform),
+    };
+}
+
+sptr<SurfaceBuffer> CameraSurfaceBufferPool::Acquire(const BufferRequestConfig& config)
+{
+    SurfaceBufferPoolKey key = MakeKey(config);
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        auto it = idle_.find(key);
+        if (it != idle_.end() && !it->second.empty()) {
+            sptr<SurfaceBuffer> buffer = it->second.back();
+            it->second.pop_back();
+            CHECK_EXECUTE(it->second.empty(), idle_.erase(it));
+            stats_.pooledBytes -= std::min<uint64_t>(stats_.pooledBytes, buffer->GetSize());
+            stats_.hitCount++;
+            MEDIA_DEBUG_LOG("CameraSurfaceBufferPool::Acquire hit %{public}dx%{public}d format:%{public}d",
+                key.width, key.height, key.format);
+            return buffer;
+        }
+        stats_.missCount++;
+    }
+
+    // Allocation is slow, keep it out of the pool lock.
+    sptr<SurfaceBuffer> newBuffer = SurfaceBuffer::Create();
+    CHECK_RETURN_RET_ELOG(newBuffer == nullptr, nullptr, "CameraSurfaceBufferPool::Acquire create failed");
+    GSError allocErrorCode = newBuffer->Alloc(config);
+    if (allocErrorCode != GSERROR_OK) {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        stats_.allocFailCount++;
+        MEDIA_ERR_LOG("CameraSurfaceBufferPool::Acquire alloc failed: %{public}d", allocErrorCode);
+        return nullptr;
+    }
+    MEDIA_DEBUG_LOG("CameraSurfaceBufferPool::Acquire miss size:%{public}u", newBuffer->GetSize());
+    return newBuffer;
+}
+
+void CameraSurfaceBufferPool::Track(const sptr<SurfaceBuffer>& buffer, uintptr_t owner)
+{
+    CHECK_RETURN(buffer == nullptr || owner == 0);
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    uint32_t sequence = buffer->GetSeqNum();
+    sptr<BufferExtraData> extraData = buffer->GetExtraData();
+    CHECK_RETURN_ELOG(extraData == nullptr, "CameraSurfaceBufferPool::Track extraData is null");
+    extraData->ExtraSet(SURFACE_BUFFER_POOL_SEQUENCE_KEY, static_cast<int32_t>(sequence));
+    auto it = tracked_.find(sequence);
+    CHECK_EXECUTE(it != tracked_.end(),
+        stats_.pooledBytes -= std::min<uint64_t>(stats_.pooledBytes, it->second.buffer->GetSize()));
+    tracked_[sequence] = { MakeKey(buffer->GetBufferRequestConfig()), buffer, owner };
+    stats_.pooledBytes += buffer->GetSize();
+    stats_.peakPooledBytes = std::max(stats_.peakPooledBytes, stats_.pooledBytes);
+    CHECK_EXECUTE(stats_.pooledBytes > highWatermarkBytes_, TrimLocked(lowWatermarkBytes_));
+}
+
+bool CameraSurfaceBufferPool::Release(uint32_t sequence, uintptr_t owner)
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    auto it = tracked_.find(sequence);
+    CHECK_RETURN_RET_ELOG(it == tracked_.end() || it->second.owner != owner, false,
+        "CameraSurfaceBufferPool::Release unknown buffer:%{public}u", sequence);
+    TrackedBuffer tracked = std::move(it->second);
+    tracked_.erase(it);
+    stats_.releaseCount++;
+    auto& bucket = idle_[tracked.key];
+    if (bucket.size() < maxBuffersPerKey_) {
+        bucket.emplace_back(std::move(tracked.buffer));
+        return true;
+    }
+    stats_.pooledBytes -= std::min<uint64_t>(stats_.pooledBytes, tracked.buffer->GetSize());
+    return true;
+}
+
+void CameraSurfaceBufferPool::ForgetOwner(uintptr_t owner)
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    for (auto it = tracked_.begin(); it != tracked_.end();) {
+        if (it->second.owner != owner) {
+            ++it;
+            continue;
+        }
+        stats_.pooledBytes -= std::min<uint64_t>(stats_.pooledBytes, it->second.buffer->GetSize());
+        it = tracked_.erase(it);
+    }
+}
+
+void CameraSurfaceBufferPool::SetWatermarks(
+    uint64_t highWatermarkBytes, uint64_t lowWatermarkBytes, uint32_t maxBuffersPerKey)
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    highWatermarkBytes_ = highWatermarkBytes;
+    lowWatermarkBytes_ = std::min(lowWatermarkBytes, highWatermarkBytes);
+    maxBuffersPerKey_ = maxBuffersPerKey;
+    CHECK_EXECUTE(stats_.pooledBytes > highWatermarkBytes_, TrimLocked(lowWatermarkBytes_));
+}
+
+void CameraSurfaceBufferPool::TrimToLowWatermark()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    TrimLocked(lowWatermarkBytes_);
+}
+
+void CameraSurfaceBufferPool::TrimIdle()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    uint64_t idleBytes = 0;
+    for (const auto& [key, bucket] : idle_) {
+        for (const auto& buffer : bucket) {
+            idleBytes += buffer->GetSize();
+        }
+    }
+    idle_.clear();
+    CHECK_RETURN(idleBytes == 0);
+    stats_.pooledBytes -= std::min(stats_.pooledBytes, idleBytes);
+    stats_.trimCount++;
+    MEDIA_INFO_LOG("CameraSurfaceBufferPool::TrimIdle release %{public}" PRIu64 " KB", idleBytes / BYTES_PER_KB);
+}
+
+void CameraSurfaceBufferPool::TrimAll()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    CHECK_RETURN(idle_.empty() && tracked_.empty());
+    MEDIA_INFO_LOG("CameraSurfaceBufferPool::TrimAll release %{public}" PRIu64 " KB",
+        stats_.pooledBytes / BYTES_PER_KB);
+    ClearLocked();
+    stats_.trimCount++;
+}
+
+void CameraSurfaceBufferPool::Reset()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    ClearLocked();
+    stats_ = {};
+    highWatermarkBytes_ = DEFAULT_HIGH_WATERMARK_BYTES;
+    lowWatermarkBytes_ = DEFAULT_LOW_WATERMARK_BYTES;
+    maxBuffersPerKey_ = DEFAULT_MAX_BUFFERS_PER_KEY;
+}
+
+void CameraSurfaceBufferPool::ClearLocked()
+{
+    idle_.clear();
+    tracked_.clear();
+    stats_.pooledBytes = 0;
+}
+
+void CameraSurfaceBufferPool::TrimLocked(uint64_t targetBytes)
+{
+    uint64_t pooledBytes = stats_.pooledBytes;
+    for (auto it = idle_.begin(); it != idle_.end() && stats_.pooledBytes > targetBytes;) {
+        auto& bucket = it->second;
+        while (!bucket.empty() && stats_.pooledBytes > targetBytes) {
+            stats_.pooledBytes -= std::min<uint64_t>(stats_.pooledBytes, bucket.back()->GetSize());
+            bucket.pop_back();
+        }
+        it = bucket.empty() ? idle_.erase(it) : std::next(it);
+    }
+    // The oldest buffers still held by a client are not recycled anymore, the client frees them.
+    for (auto it = tracked_.begin(); it != tracked_.end() && stats_.pooledBytes > targetBytes;) {
+        stats_.pooledBytes -= std::min<uint64_t>(stats_.pooledBytes, it->second.buffer->GetSize());
+        it = tracked_.erase(it);
+    }
+    CHECK_RETURN(stats_.pooledBytes == pooledBytes);
+    stats_.trimCount++;
+    MEDIA_DEBUG_LOG("CameraSurfaceBufferPool::TrimLocked pooled:%{public}" PRIu64 "KB target:%{public}" PRIu64 "KB",
+        stats_.pooledBytes / BYTES_PER_KB, targetBytes / BYTES_PER_KB);
+}
+
+void CameraSurfaceBufferPool::RefreshCountsLocked()
+{
+    stats_.idleBuffers = 0;
+    for (const auto& [key, bucket] : idle_) {
+        stats_.idleBuffers += static_cast<uint32_t>(bucket.size());
+    }
+    stats_.pooledBuffers = stats_.idleBuffers + static_cast<uint32_t>(tracked_.size());
+}
+
+SurfaceBufferPoolStats CameraSurfaceBufferPool::GetStats()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    RefreshCountsLocked();
+    return stats_;
+}
+
+std::string CameraSurfaceBufferPool::Dump()
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    RefreshCountsLocked();
+    std::ostringstream oss;
+    oss << "SurfaceBufferPool hit:" << stats_.hitCount << " miss:" << stats_.missCount
+        << " allocFail:" << stats_.allocFailCount << " release:" << stats_.releaseCount
+        << " trim:" << stats_.trimCount << " buffers:" << stats_.pooledBuffers << " idle:" << stats_.idleBuffers
+        << " pooled:" << stats_.pooledBytes / BYTES_PER_KB << "KB"
+        << " peak:" << stats_.peakPooledBytes / BYTES_PER_KB << "KB"
+        << " watermark:[" << lowWatermarkBytes_ / BYTES_PER_KB << "KB, " << highWatermarkBytes_ / BYTES_PER_KB
+        << "KB]";
+    for (const auto& [key, bucket] : idle_) {
+        oss << "\n  " << key.width << "x" << key.height << " format:" << key.format << " usage:" << key.usage
+            << " idle:" << bucket.size();
+    }
+    return oss.str();
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_SURFACE_BUFFER_POOL_H
+#define OHOS_CAMERA_SURFACE_BUFFER_POOL_H
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "surface_buffer.h"
+
+namespace OHOS {
+namespace CameraStandard {
+// Extra data key carrying the pool sequence of a tracked buffer to the client.
+constexpr const char* SURFACE_BUFFER_POOL_SEQUENCE_KEY = "surfaceBufferPoolSequence";
+
+struct SurfaceBufferPoolKey {
+    int32_t width = 0;
+    int32_t height = 0;
+    int32_t strideAlignment = 0;
+    int32_t format = 0;
+    uint64_t usage = 0;
+    int32_t colorGamut = 0;
+    int32_t transform = 0;
+
+    bool operator<(const SurfaceBufferPoolKey& other) const
+    {
+        return std::tie(width, height, strideAlignment, format, usage, colorGamut, transform) <
+            std::tie(other.width, other.height, other.strideAlignment, other.format, other.usage, other.colorGamut,
+                other.transform);
+    }
+};
+
+struct SurfaceBufferPoolStats {
+    uint64_t hitCount = 0;
+    uint64_t missCount = 0;
+    uint64_t allocFailCount = 0;
+    uint64_t releaseCount = 0;
+    uint64_t trimCount = 0;
+    uint64_t pooledBytes = 0;
+    uint64_t peakPooledBytes = 0;
+    uint32_t pooledBuffers = 0;
+    uint32_t idleBuffers = 0;
+};
+
+/**
+ * Recycles the SurfaceBuffers used as deep-copy targets for captured photos.
+ * A buffer handed out by Acquire belongs to its caller. The buffers sent to a
+ * client are tracked for the stream that sent them and come back to the pool
+ * only when that client releases them explicitly, a buffer whose client never
+ * answers is dropped with its stream. Retained memory is bounded by a high
+ * watermark, above which idle buffers and then the oldest tracked ones are
+ * released down to the low watermark. TrimAll forgets every buffer, the ones
+ * still in use are freed by their last holder as before.
+ */
+class CameraSurfaceBufferPool {
+public:
+    static CameraSurfaceBufferPool& GetInstance();
+
+    sptr<SurfaceBuffer> Acquire(const BufferRequestConfig& config);
+    // Records a buffer sent to the client of owner, Release hands it back once that client is done with it.
+    void Track(const sptr<SurfaceBuffer>& buffer, uintptr_t owner);
+    // Only the owner a buffer was tracked for can release it.
+    bool Release(uint32_t sequence, uintptr_t owner);
+    // The client of owner is gone, its buffers are not recycled.
+    void ForgetOwner(uintptr_t owner);
+    void SetWatermarks(uint64_t highWatermarkBytes, uint64_t lowWatermarkBytes, uint32_t maxBuffersPerKey);
+    void TrimToLowWatermark();
+    // Drops every idle buffer, for memory pressure.
+    void TrimIdle();
+    void TrimAll();
+    // Drops every buffer and restores the default watermarks and the statistics.
+    void Reset();
+    SurfaceBufferPoolStats GetStats();
+    std::string Dump();
+
+private:
+    static constexpr uint64_t DEFAULT_HIGH_WATERMARK_BYTES = 512 * 1024 * 1024;
+    static constexpr uint64_t DEFAULT_LOW_WATERMARK_BYTES = 128 * 1024 * 1024;
+    static constexpr uint32_t DEFAULT_MAX_BUFFERS_PER_KEY = 8;
+
+    struct TrackedBuffer {
+        SurfaceBufferPoolKey key;
+        sptr<SurfaceBuffer> buffer;
+        uintptr_t owner = 0;
+    };
+
+    CameraSurfaceBufferPool() = default;
+    ~CameraSurfaceBufferPool() = default;
+    CameraSurfaceBufferPool(const CameraSurfaceBufferPool&) = delete;
+    CameraSurfaceBufferPool& operator=(const CameraSurfaceBufferPool&) = delete;
+
+    static SurfaceBufferPoolKey MakeKey(const BufferRequestConfig& config);
+    void TrimLocked(uint64_t targetBytes);
+    void ClearLocked();
+    void RefreshCountsLocked();
+
+    std::mutex poolMutex_;
+    std::map<SurfaceBufferPoolKey, std::vector<sptr<SurfaceBuffer>>> idle_;
+    // Keyed by the buffer sequence, which grows with every allocation, so the oldest come first.
+    std::map<uint32_t, TrackedBuffer> tracked_;
+    SurfaceBufferPoolStats stats_;
+    uint64_t highWatermarkBytes_ = DEFAULT_HIGH_WATERMARK_BYTES;
+    uint64_t lowWatermarkBytes_ = DEFAULT_LOW_WATERMARK_BYTES;
+    uint32_t maxBuffersPerKey_ = DEFAULT_MAX_BUFFERS_PER_KEY;
+
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_SURFACE_BUFFER_POOL_H
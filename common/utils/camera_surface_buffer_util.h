@@ -16,7 +16,12 @@
 #ifndef OHOS_CAMERA_SURFACE_BUFFER_UTIL_H
 #define OHOS_CAMERA_SURFACE_BUFFER_UTIL_H
 
+#include <algorithm>
+#include <string>
+
+#include "buffer_extra_data_impl.h"
 #include "camera_log.h"
+#include "camera_surface_buffer_pool.h"
 #include "inttypes.h"
 #include "surface.h"
 #include "video_key_info.h"
@@ -50,25 +55,16 @@ public:
                 .colorGamut = surfaceBuffer->GetSurfaceBufferColorGamut(),
                 .transform = surfaceBuffer->GetSurfaceBufferTransform(),
         };
-        sptr<SurfaceBuffer> newSurfaceBuffer = SurfaceBuffer::Create();
-        auto allocErrorCode = newSurfaceBuffer->Alloc(requestConfig);
-        MEDIA_DEBUG_LOG("DeepCopyBuffer alloc ret: %{public}d", allocErrorCode);
-        CHECK_RETURN_RET_ELOG(allocErrorCode != 0, nullptr, "DeepCopyBuffer alloc failed: %{public}d", allocErrorCode);
+        sptr<SurfaceBuffer> newSurfaceBuffer = CameraSurfaceBufferPool::GetInstance().Acquire(requestConfig);
+        CHECK_RETURN_RET_ELOG(newSurfaceBuffer == nullptr, nullptr, "DeepCopyBuffer acquire buffer failed");
         if (memcpy_s(newSurfaceBuffer->GetVirAddr(), newSurfaceBuffer->GetSize(),
             surfaceBuffer->GetVirAddr(), surfaceBuffer->GetSize()) != EOK) {
             MEDIA_ERR_LOG("DeepCopyBuffer memcpy_s failed");
         }
 
         // deep copy buffer extData
-        MessageParcel extParcl;
-        sptr<BufferExtraData> bufferExtraData = surfaceBuffer->GetExtraData();
-        CHECK_RETURN_RET_ELOG(bufferExtraData == nullptr, nullptr, "DeepCopyBuffer bufferExtraData is null");
-        GSError gsErr = bufferExtraData->WriteToParcel(extParcl);
-        MEDIA_DEBUG_LOG("DeepCopyBuffer WriteToParcel gsErr=%{public}d", gsErr);
-        sptr<BufferExtraData> newBufferExtraData = newSurfaceBuffer->GetExtraData();
-        CHECK_RETURN_RET_ELOG(newBufferExtraData == nullptr, nullptr, "DeepCopyBuffer newBufferExtraData is null");
-        gsErr = newBufferExtraData->ReadFromParcel(extParcl);
-        MEDIA_DEBUG_LOG("DeepCopyBuffer ReadFromParcel gsErr=%{public}d", gsErr);
+        CHECK_RETURN_RET_ELOG(!CopyExtraData(surfaceBuffer, newSurfaceBuffer), nullptr,
+            "DeepCopyBuffer copy extraData failed");
 
         // deep metaData
         CopyMetaData(surfaceBuffer, newSurfaceBuffer);
@@ -104,6 +100,7 @@ public:
             .usage = surfaceBuffer->GetUsage(),
             .timeout = 0,
         };
+        // Thumbnails are not handed back by the client, they are not taken from the buffer pool.
         sptr<SurfaceBuffer> newSurfaceBuffer = SurfaceBuffer::Create();
         auto allocRet = newSurfaceBuffer->Alloc(requestConfig);
         if (allocRet != 0) {
@@ -143,13 +140,8 @@ public:
         }
 
         // deep copy buffer extData
-        MessageParcel extParcl;
-        sptr<BufferExtraData> bufferExtraData = surfaceBuffer->GetExtraData();
-        gsErr = bufferExtraData->WriteToParcel(extParcl);
-        MEDIA_DEBUG_LOG("DeepCopyBuffer WriteToParcel gsErr=%{public}d", gsErr);
-        sptr<BufferExtraData> newBufferExtraData = newSurfaceBuffer->GetExtraData();
-        gsErr = newBufferExtraData->ReadFromParcel(extParcl);
-        MEDIA_DEBUG_LOG("DeepCopyBuffer ReadFromParcel gsErr=%{public}d", gsErr);
+        CHECK_RETURN_RET_ELOG(!CopyExtraData(surfaceBuffer, newSurfaceBuffer), nullptr,
+            "DeepCopyThumbnailBuffer copy extraData failed");
 
         // deep metaData
         CopyMetaData(surfaceBuffer, newSurfaceBuffer);
@@ -337,12 +329,63 @@ public:
     }
 
 private:
+    // Copies the keys the photo consumers read into a fresh object, a recycled buffer keeps nothing of its previous
+    // photo. The pool sequence key is not copied, Track writes the one of the new buffer.
+    static bool CopyExtraData(const sptr<SurfaceBuffer>& inBuffer, const sptr<SurfaceBuffer>& outBuffer)
+    {
+        sptr<BufferExtraData> bufferExtraData = inBuffer->GetExtraData();
+        CHECK_RETURN_RET_ELOG(bufferExtraData == nullptr, false, "CopyExtraData: bufferExtraData is null");
+        sptr<BufferExtraData> newBufferExtraData = sptr<BufferExtraDataImpl>::MakeSptr();
+        CHECK_RETURN_RET_ELOG(newBufferExtraData == nullptr, false, "CopyExtraData: newBufferExtraData is null");
+        static const std::string int32Keys[] = { OHOS::Camera::dataSize, OHOS::Camera::captureId,
+            OHOS::Camera::burstSequenceId, OHOS::Camera::imageCount, OHOS::Camera::isDegradedImage,
+            OHOS::Camera::deferredProcessingType, OHOS::Camera::dataWidth, OHOS::Camera::dataHeight,
+            OHOS::Camera::deferredImageFormat, OHOS::Camera::dataStride, OHOS::Camera::cloudImageEnhanceFlag,
+            OHOS::Camera::dataRotation, OHOS::Camera::depthDataQualityLevel, OHOS::Camera::compositionPointIndex,
+            OHOS::Camera::expoIso };
+        static const std::string int64Keys[] = { OHOS::Camera::imageId, OHOS::Camera::expoTime,
+            OHOS::Camera::captureTime, OHOS::Camera::compositionId };
+        static const std::string doubleKeys[] = { OHOS::Camera::expoFNumber, OHOS::Camera::expoEfl };
+        static const std::string stringKeys[] = { OHOS::Camera::compositionReasons };
+        for (const auto& key : int32Keys) {
+            CopyExtraValue<int32_t>(bufferExtraData, newBufferExtraData, key);
+        }
+        for (const auto& key : int64Keys) {
+            CopyExtraValue<int64_t>(bufferExtraData, newBufferExtraData, key);
+        }
+        for (const auto& key : doubleKeys) {
+            CopyExtraValue<double>(bufferExtraData, newBufferExtraData, key);
+        }
+        for (const auto& key : stringKeys) {
+            CopyExtraValue<std::string>(bufferExtraData, newBufferExtraData, key);
+        }
+        outBuffer->SetExtraData(newBufferExtraData);
+        return true;
+    }
+
+    template<typename T>
+    static void CopyExtraValue(
+        const sptr<BufferExtraData>& inExtraData, const sptr<BufferExtraData>& outExtraData, const std::string& key)
+    {
+        T value {};
+        CHECK_RETURN(inExtraData->ExtraGet(key, value) != GSERROR_OK);
+        outExtraData->ExtraSet(key, value);
+    }
+
     static void CopyMetaData(sptr<SurfaceBuffer> &inBuffer, sptr<SurfaceBuffer> &outBuffer)
     {
         std::vector<uint32_t> keys = {};
         CHECK_RETURN_ELOG(inBuffer == nullptr, "CopyMetaData: inBuffer is nullptr");
         auto ret = inBuffer->ListMetadataKeys(keys);
         CHECK_RETURN_ELOG(ret != GSError::GSERROR_OK, "CopyMetaData: ListMetadataKeys fail! res=%{public}d", ret);
+        // a recycled buffer may still carry keys of the previous photo
+        std::vector<uint32_t> staleKeys = {};
+        if (outBuffer->ListMetadataKeys(staleKeys) == GSError::GSERROR_OK) {
+            for (uint32_t staleKey : staleKeys) {
+                CHECK_EXECUTE(std::find(keys.begin(), keys.end(), staleKey) == keys.end(),
+                    outBuffer->EraseMetadataKey(staleKey));
+            }
+        }
         for (uint32_t key : keys) {
             std::vector<uint8_t> values;
             ret = inBuffer->GetMetadata(key, values);
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CAMERA_FRAMEWORK_LOCK_FREE_RING_H
+#define CAMERA_FRAMEWORK_LOCK_FREE_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace OHOS {
+namespace CameraStandard {
+constexpr size_t RING_CACHE_LINE_SIZE = 64;
+
+/**
+ * Bounded ring with per-slot sequence numbers. The single-producer variant pushes without any
+ * read-modify-write; the multi-producer variant claims slots with a CAS on the tail. Pop always
+ * claims the head with a CAS so the producer may evict the oldest element when the ring is full.
+ * The capacity is kept exactly as requested since callers size their frame caches with it.
+ */
+template <typename T, bool MultiProducer>
+class LockFreeRing {
+public:
+    explicit LockFreeRing(size_t capacity)
+        : capacity_(capacity > 0 ? capacity : 1), slots_(new Slot[capacity_])
+    {
+        for (size_t i = 0; i < capacity_; ++i) {
+            slots_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+    ~LockFreeRing() = default;
+    LockFreeRing(const LockFreeRing&) = delete;
+    LockFreeRing& operator=(const LockFreeRing&) = delete;
+
+    bool TryPush(T&& value)
+    {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot = &slots_[pos % capacity_];
+            size_t seq = slot->seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff < 0) {
+                return false;
+            }
+            if (diff > 0) {
+                pos = tail_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if constexpr (MultiProducer) {
+                if (!tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    continue;
+                }
+            } else {
+                tail_.store(pos + 1, std::memory_order_relaxed);
+            }
+            break;
+        }
+        slot->value = std::move(value);
+        slot->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool TryPush(const T& value)
+    {
+        T copy = value;
+        return TryPush(std::move(copy));
+    }
+
+    bool TryPop(T& out)
+    {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true) {
+            slot = &slots_[pos % capacity_];
+            size_t seq = slot->seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff < 0) {
+                return false;
+            }
+            if (diff > 0) {
+                pos = head_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        out = std::move(slot->value);
+        slot->value = T();
+        slot->seq.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    // Pops the oldest element only if pred accepts it. The caller must guarantee that no element is
+    // popped concurrently; pushes are allowed.
+    template <typename Pred>
+    bool TryPopIfUnsafe(Pred&& pred, T& out)
+    {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[pos % capacity_];
+        if (slot.seq.load(std::memory_order_acquire) != pos + 1 || !pred(static_cast<const T&>(slot.value))) {
+            return false;
+        }
+        head_.store(pos + 1, std::memory_order_relaxed);
+        out = std::move(slot.value);
+        slot.value = T();
+        slot.seq.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    // Pushes the value, evicting the oldest element while the ring is full. Returns true when an
+    // element was evicted, in which case it is moved into dropped.
+    bool PushOverwrite(T&& value, T& dropped)
+    {
+        bool hasDropped = false;
+        while (!TryPush(std::move(value))) {
+            T oldest;
+            if (TryPop(oldest)) {
+                dropped = std::move(oldest);
+                hasDropped = true;
+                dropCount_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                // the consumer holds the head slot for the duration of a move
+                std::this_thread::yield();
+            }
+        }
+        return hasDropped;
+    }
+
+    // Calls func on every element in FIFO order. The caller must guarantee that no element is
+    // popped concurrently; pushes are allowed.
+    template <typename Func>
+    void ForEachUnsafe(Func&& func) const
+    {
+        size_t head = head_.load(std::memory_order_acquire);
+        size_t tail = tail_.load(std::memory_order_acquire);
+        for (size_t pos = head; pos != tail; ++pos) {
+            const Slot& slot = slots_[pos % capacity_];
+            if (slot.seq.load(std::memory_order_acquire) != pos + 1) {
+                break;
+            }
+            func(slot.value);
+        }
+    }
+
+    size_t Size() const
+    {
+        size_t tail = tail_.load(std::memory_order_acquire);
+        size_t head = head_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    bool Full() const
+    {
+        return Size() >= capacity_;
+    }
+
+    size_t Capacity() const
+    {
+        return capacity_;
+    }
+
+    uint64_t DropCount() const
+    {
+        return dropCount_.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot {
+        std::atomic<size_t> seq {0};
+        T value {};
+    };
+
+    const size_t capacity_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(RING_CACHE_LINE_SIZE) std::atomic<size_t> head_ {0};
+    alignas(RING_CACHE_LINE_SIZE) std::atomic<size_t> tail_ {0};
+    alignas(RING_CACHE_LINE_SIZE) std::atomic<uint64_t> dropCount_ {0};
+};
+
+template <typename T>
+using SpscRing = LockFreeRing<T, false>;
+
+template <typename T>
+using MpscRing = LockFreeRing<T, true>;
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // CAMERA_FRAMEWORK_LOCK_FREE_RING_H
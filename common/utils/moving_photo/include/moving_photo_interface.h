@@ -29,7 +29,6 @@ class IBufferProducer;
 
 namespace OHOS {
 namespace CameraStandard {
-template <typename T> class FixedSizeList;
 class AudioCapturerSession;
 class AvcodecTaskManager;
 class PhotoAssetIntf;
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CAMERA_FRAMEWORK_RING_BLOCKING_QUEUE_H
+#define CAMERA_FRAMEWORK_RING_BLOCKING_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lock_free_ring.h"
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * BlockingQueue compatible adapter over LockFreeRing. Push, Pop, Size, Full and Empty do not take
+ * a lock unless a thread has to sleep; the condition variables are only touched when a waiter is
+ * registered. Front and GetAllElements read slots in place, so they exclude concurrent pops through
+ * a small reader/popper guard that is uncontended on the per-frame path.
+ */
+template <typename T, bool MultiProducer = false>
+class RingBlockingQueue {
+public:
+    explicit RingBlockingQueue(const std::string& name, size_t capacity) : name_(name), ring_(capacity) {}
+    ~RingBlockingQueue() = default;
+
+    size_t Size()
+    {
+        return ring_.Size();
+    }
+    bool Full()
+    {
+        return ring_.Full();
+    }
+    size_t Capacity()
+    {
+        return ring_.Capacity();
+    }
+    bool Empty()
+    {
+        return ring_.Empty();
+    }
+    uint64_t DropCount()
+    {
+        return ring_.DropCount();
+    }
+
+    bool TryPush(T&& value)
+    {
+        if (!isActive_.load(std::memory_order_acquire) || !ring_.TryPush(std::move(value))) {
+            return false;
+        }
+        NotifyIfWaiting(emptyWaiters_, cvEmpty_);
+        return true;
+    }
+    bool Push(const T& value)
+    {
+        T copy = value;
+        return Push(std::move(copy));
+    }
+    bool Push(T&& value)
+    {
+        while (!TryPush(std::move(value))) {
+            if (!isActive_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            WaitFor(fullWaiters_, cvFull_, std::nullopt, [this] { return !isActive_ || !ring_.Full(); });
+        }
+        return true;
+    }
+    bool Push(T&& value, int timeoutMs)
+    {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (!TryPush(std::move(value))) {
+            if (!isActive_.load(std::memory_order_acquire) || std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            WaitFor(fullWaiters_, cvFull_, deadline, [this] { return !isActive_ || !ring_.Full(); });
+        }
+        return true;
+    }
+    // Pushes without blocking, evicting the oldest element when full. The evicted element, if any,
+    // is handed back so the caller can release its resources.
+    bool PushOverwrite(T&& value, T& dropped)
+    {
+        if (!isActive_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        bool hasDropped = false;
+        {
+            PopGuard guard(guard_);
+            hasDropped = ring_.PushOverwrite(std::move(value), dropped);
+        }
+        NotifyIfWaiting(emptyWaiters_, cvEmpty_);
+        return hasDropped;
+    }
+
+    bool TryPop(T& out)
+    {
+        bool popped = false;
+        {
+            PopGuard guard(guard_);
+            popped = ring_.TryPop(out);
+        }
+        if (popped) {
+            NotifyIfWaiting(fullWaiters_, cvFull_);
+        }
+        return popped;
+    }
+    // Pops the oldest element only if pred accepts it. Checking and popping happen under the pop guard, so a
+    // PushOverwrite eviction cannot take the element in between.
+    template <typename Pred>
+    bool TryPopIf(Pred&& pred, T& out)
+    {
+        bool popped = false;
+        {
+            PopGuard guard(guard_);
+            popped = ring_.TryPopIfUnsafe(std::forward<Pred>(pred), out);
+        }
+        if (popped) {
+            NotifyIfWaiting(fullWaiters_, cvFull_);
+        }
+        return popped;
+    }
+    T Pop()
+    {
+        T value {};
+        while (isActive_.load(std::memory_order_acquire) && !TryPop(value)) {
+            WaitFor(emptyWaiters_, cvEmpty_, std::nullopt, [this] { return !isActive_ || !ring_.Empty(); });
+        }
+        return value;
+    }
+    T Pop(int timeoutMs)
+    {
+        T value {};
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (isActive_.load(std::memory_order_acquire) && !TryPop(value)) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                break;
+            }
+            WaitFor(emptyWaiters_, cvEmpty_, deadline, [this] { return !isActive_ || !ring_.Empty(); });
+        }
+        return value;
+    }
+    T Front()
+    {
+        ReadGuard guard(guard_);
+        T value {};
+        bool found = false;
+        ring_.ForEachUnsafe([&value, &found](const T& element) {
+            if (!found) {
+                value = element;
+                found = true;
+            }
+        });
+        return value;
+    }
+    std::vector<T> GetAllElements()
+    {
+        ReadGuard guard(guard_);
+        std::vector<T> elements;
+        elements.reserve(ring_.Size());
+        ring_.ForEachUnsafe([&elements](const T& element) { elements.push_back(element); });
+        return elements;
+    }
+    void Clear()
+    {
+        T value {};
+        while (TryPop(value)) {
+            value = T();
+        }
+    }
+    void SetActive(bool active)
+    {
+        isActive_.store(active, std::memory_order_release);
+        if (active) {
+            return;
+        }
+        Clear();
+        std::lock_guard<std::mutex> lock(waitMutex_);
+        cvEmpty_.notify_all();
+        cvFull_.notify_all();
+    }
+
+private:
+    // guard_ > 0: readers are copying slots in place, guard_ < 0: an element is being popped.
+    class ReadGuard {
+    public:
+        explicit ReadGuard(std::atomic<int32_t>& guard) : guard_(guard)
+        {
+            int32_t expected = guard_.load(std::memory_order_relaxed);
+            while (expected < 0 || !guard_.compare_exchange_weak(expected, expected + 1,
+                std::memory_order_acquire, std::memory_order_relaxed)) {
+                if (expected < 0) {
+                    std::this_thread::yield();
+                    expected = guard_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+        ~ReadGuard()
+        {
+            guard_.fetch_sub(1, std::memory_order_release);
+        }
+    private:
+        std::atomic<int32_t>& guard_;
+    };
+
+    class PopGuard {
+    public:
+        explicit PopGuard(std::atomic<int32_t>& guard) : guard_(guard)
+        {
+            int32_t expected = 0;
+            while (!guard_.compare_exchange_weak(expected, -1, std::memory_order_acquire,
+                std::memory_order_relaxed)) {
+                expected = 0;
+                std::this_thread::yield();
+            }
+        }
+        ~PopGuard()
+        {
+            guard_.store(0, std::memory_order_release);
+        }
+    private:
+        std::atomic<int32_t>& guard_;
+    };
+
+    void NotifyIfWaiting(std::atomic<uint32_t>& waiters, std::condition_variable& cv)
+    {
+        // RMW pairs with the waiter's increment: either it sees the waiter or the waiter sees the change
+        if (waiters.fetch_add(0, std::memory_order_acq_rel) > 0) {
+            std::lock_guard<std::mutex> lock(waitMutex_);
+            cv.notify_one();
+        }
+    }
+
+    template <typename Pred>
+    void WaitFor(std::atomic<uint32_t>& waiters, std::condition_variable& cv,
+        std::optional<std::chrono::steady_clock::time_point> deadline, Pred pred)
+    {
+        std::unique_lock<std::mutex> lock(waitMutex_);
+        waiters.fetch_add(1, std::memory_order_acq_rel);
+        if (deadline.has_value()) {
+            cv.wait_until(lock, deadline.value(), pred);
+        } else {
+            cv.wait(lock, pred);
+        }
+        waiters.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    std::string name_;
+    LockFreeRing<T, MultiProducer> ring_;
+    std::atomic<bool> isActive_ {true};
+    alignas(RING_CACHE_LINE_SIZE) std::atomic<int32_t> guard_ {0};
+    std::mutex waitMutex_;
+    std::condition_variable cvFull_;
+    std::condition_variable cvEmpty_;
+    std::atomic<uint32_t> emptyWaiters_ {0};
+    std::atomic<uint32_t> fullWaiters_ {0};
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // CAMERA_FRAMEWORK_RING_BLOCKING_QUEUE_H
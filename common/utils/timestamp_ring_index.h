@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef CAMERA_FRAMEWORK_TIMESTAMP_RING_INDEX_H
+#define CAMERA_FRAMEWORK_TIMESTAMP_RING_INDEX_H
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Fixed capacity cache of timestamped values, evicting in arrival order. Values are hashed by
+ * timestamp bucket, the bucket width being the match tolerance, so Take looks at no more than
+ * three buckets whatever the capacity: an exact match wins, otherwise the nearest value within
+ * the tolerance is returned. A taken value leaves a hole that the ring reuses in turn.
+ */
+template <typename T>
+class TimestampRingIndex {
+public:
+    explicit TimestampRingIndex(size_t capacity, int64_t tolerance = 0)
+        : capacity_(capacity > 0 ? capacity : 1), tolerance_(tolerance > 0 ? tolerance : 0),
+          bucketWidth_(tolerance_ + 1), slots_(capacity_)
+    {
+        index_.reserve(capacity_ * LOAD_FACTOR_INVERSE);
+    }
+
+    void Add(int64_t timestamp, T value)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Slot& slot = slots_[next_];
+        if (slot.used) {
+            EraseIndexLocked(slot.timestamp, next_);
+        } else {
+            size_++;
+        }
+        slot.timestamp = timestamp;
+        slot.value = std::move(value);
+        slot.used = true;
+        index_.emplace(BucketOf(timestamp), next_);
+        next_ = (next_ + 1) % capacity_;
+    }
+
+    // Removes and returns the value added with timestamp, or the nearest one within the tolerance.
+    std::optional<T> Take(int64_t timestamp)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::optional<size_t> nearest;
+        int64_t nearestDistance = tolerance_ + 1;
+        int64_t bucket = BucketOf(timestamp);
+        for (int64_t candidate = bucket - 1; candidate <= bucket + 1 && nearestDistance != 0; ++candidate) {
+            auto range = index_.equal_range(candidate);
+            for (auto it = range.first; it != range.second; ++it) {
+                int64_t slotTimestamp = slots_[it->second].timestamp;
+                int64_t distance = slotTimestamp > timestamp ? slotTimestamp - timestamp : timestamp - slotTimestamp;
+                if (distance < nearestDistance) {
+                    nearestDistance = distance;
+                    nearest = it->second;
+                }
+            }
+        }
+        if (!nearest.has_value()) {
+            return std::nullopt;
+        }
+        Slot& slot = slots_[nearest.value()];
+        EraseIndexLocked(slot.timestamp, nearest.value());
+        std::optional<T> result(std::move(slot.value));
+        slot.value = T();
+        slot.used = false;
+        size_--;
+        return result;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& slot : slots_) {
+            slot.value = T();
+            slot.used = false;
+        }
+        index_.clear();
+        next_ = 0;
+        size_ = 0;
+    }
+
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return size_;
+    }
+
+private:
+    static constexpr size_t LOAD_FACTOR_INVERSE = 2;
+
+    struct Slot {
+        int64_t timestamp = 0;
+        T value {};
+        bool used = false;
+    };
+
+    int64_t BucketOf(int64_t timestamp) const
+    {
+        // floor division keeps buckets contiguous across zero
+        int64_t bucket = timestamp / bucketWidth_;
+        return (timestamp % bucketWidth_ < 0) ? bucket - 1 : bucket;
+    }
+
+    void EraseIndexLocked(int64_t timestamp, size_t slotIndex)
+    {
+        auto range = index_.equal_range(BucketOf(timestamp));
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == slotIndex) {
+                index_.erase(it);
+                return;
+            }
+        }
+    }
+
+    const size_t capacity_;
+    const int64_t tolerance_;
+    const int64_t bucketWidth_;
+    std::vector<Slot> slots_;
+    std::unordered_multimap<int64_t, size_t> index_;
+    size_t next_ = 0;
+    size_t size_ = 0;
+    mutable std::mutex mutex_;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // CAMERA_FRAMEWORK_TIMESTAMP_RING_INDEX_H
@@ -53,6 +53,8 @@ public:
     int32_t Process(vector<sptr<AudioRecord>>& audioRecords, vector<sptr<AudioRecord>>& processedRecords);
     void SetMutedAudioRecordForVecs(vector<sptr<AudioRecord>>& audioRecords,
         vector<sptr<AudioRecord>>& encodeAudioRecords);
+    // Index of the first record SetMutedAudioRecordForVecs fades or mutes, the records before it are copied as is.
+    static uint32_t GetMutedTailStart(uint32_t audioRecordsLen);
     void Release();
 
 private:
@@ -43,7 +43,8 @@ using namespace DeferredProcessing;
 using namespace Media;
 using CacheCbFunc = function<void(sptr<FrameRecord>, bool)>;
 constexpr uint32_t DEFAULT_THREAD_NUMBER = 6;
-constexpr uint32_t DEFAULT_ENCODER_THREAD_NUMBER = 5;
+// A single feeder hands frames to the codec in timestamp order, completion is driven by codec output.
+constexpr uint32_t DEFAULT_ENCODER_THREAD_NUMBER = 1;
 constexpr uint32_t GET_FD_EXPIREATION_TIME = 2000;
 constexpr int64_t ONE_BILLION = 1000000000LL;
 constexpr uint32_t MAX_FRAME_COUNT = 90;
@@ -63,6 +64,8 @@ constexpr uint32_t DEFAULT_PROCESSED_THREAD_NUMBER = 1;
 constexpr uint32_t AUDIO_RECORD_CACHE_SIZE = 200;
 constexpr int64_t MAX_AUDIO_NANOSEC_RANGE = 3200;
 constexpr int32_t AUDIO_PROCESS_MATCH_SIZE = 5;
+// one frame for the MDCT overlap and one for the AAC encoder delay
+constexpr size_t AUDIO_TAIL_LEAD_IN_COUNT = 2;
 
 
 class AudioDeferredProcessSingle {
@@ -131,6 +134,8 @@ public:
     std::map<int32_t, int64_t> mPStartTimeMap_ = {};
     std::map<int32_t, int64_t> mPEndTimeMap_ = {};
 private:
+    void FeedVideoEncoder();
+    void OnVideoBufferEncoded(sptr<FrameRecord> frameRecord, bool isEncodeSuccess, CacheCbFunc cacheCallback);
     void FinishMuxer(sptr<AudioVideoMuxer> muxer, int32_t captureId);
     void ClearManualCache(vector<sptr<FrameRecord>> manualFrameRecords, int64_t shutterTime);
     void AddManualTracks(sptr<AudioVideoMuxer> muxer, const vector<sptr<FrameRecord>>& manualFrameRecords,
@@ -145,6 +150,9 @@ private:
         int64_t clearVideoEndTime, int64_t shutterTime, int32_t captureId);
     void IgnoreDeblur(vector<sptr<FrameRecord>> frameRecords, vector<sptr<FrameRecord>> &choosedBuffer,
         int64_t shutterTime);
+    void WriteAudioSamples(sptr<AudioVideoMuxer> muxer, vector<sptr<AudioRecord>>& encodedAudioRecords);
+    void EncodeAudioTail(vector<sptr<AudioRecord>>& processedAudioRecords, size_t tailStart,
+        vector<sptr<AudioRecord>>& encodeTailRecords);
     void Release();
     shared_ptr<VideoEncoder> videoEncoder_ = nullptr;
     unique_ptr<AudioEncoder> audioEncoder_ = nullptr;
@@ -191,6 +199,8 @@ public:
     void ProcessAudioBufferToMuted(vector<sptr<AudioRecord>>& audioRecords,
         vector<sptr<AudioRecord>>& encodeAudioRecords);
     void ProcessAudioFromAudioBufferQueue();
+    void PreEncodeAudioRecords(vector<sptr<AudioRecord>>& audioRecords);
+    void StopPreEncoder();
     void SetTimerForAudioDeferredProcess();
     int32_t ClearProcessedAudioCache(int32_t captureId);
     void RemovePreviousCaptureForTimeMap(int32_t captureId);
@@ -233,6 +243,8 @@ public:
     std::mutex mutex_;
     std::mutex audioCacheMutex_;
     std::mutex captureIdToTimMutex_;
+    // guard the attr of the pre-encoded buffers of processedAudioRecordCache_ while they are written to a muxer
+    std::mutex encodedAudioMutex_;
 
 private:
     void HandleAudioRecordsProcessing(const sptr<AudioTaskManager>& sharedThis);
@@ -247,7 +259,9 @@ private:
     std::condition_variable arrivalVarible_;
     std::map<int32_t, int64_t> curCaptureIdToTimeMap_;
     std::atomic<bool> isBufferArrivalFinished_ = true;
+    // sorted by timestamp, records are encoded into AAC by preEncoder_ as soon as they are processed
     vector<sptr<AudioRecord>> processedAudioRecordCache_;
+    unique_ptr<AudioEncoder> preEncoder_ = nullptr;
 };
 
 class AvcodecExtendImageTaskManager : public RefBase {
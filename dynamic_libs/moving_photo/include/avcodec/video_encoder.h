@@ -16,9 +16,13 @@
 #ifndef AVCODEC_SAMPLE_VIDEO_ENCODER_H
 #define AVCODEC_SAMPLE_VIDEO_ENCODER_H
 
-#include <unordered_set>
+#include <deque>
+#include <functional>
+#include <queue>
 #include <set>
-#include "safe_map.h"
+#include <unordered_map>
+#include <unordered_set>
+#include "encoded_frame_arena.h"
 #include "frame_record.h"
 #include "avcodec_video_encoder.h"
 #include "camera_types.h"
@@ -39,6 +43,8 @@ using namespace std;
 using namespace OHOS::MediaAVCodec;
 class VideoEncoder : public std::enable_shared_from_this<VideoEncoder> {
 public:
+    using EncodedCallback = std::function<void(sptr<FrameRecord>, bool)>;
+
     VideoEncoder() = default;
     explicit VideoEncoder(VideoCodecType type, ColorSpace colorSpace, bool isExtendImage = false);
     ~VideoEncoder();
@@ -49,9 +55,14 @@ public:
     int32_t PushInputData(sptr<CodecAVBufferInfo> info);
     int32_t NotifyEndOfStream();
     int32_t FreeOutputData(uint32_t bufferIndex);
-    bool EncodeSurfaceBuffer(sptr<FrameRecord> frameRecord);
+    // Queues a frame for the feeder, frames are handed to the codec in timestamp order.
+    void SubmitSurfaceBuffer(sptr<FrameRecord> frameRecord, EncodedCallback callback);
+    // Takes the submitted frame with the smallest timestamp, false when none is waiting.
+    bool FetchSubmittedBuffer(sptr<FrameRecord>& frameRecord, EncodedCallback& callback);
+    // Hands the frame to the codec without waiting for its output. On success the callback runs exactly once, from
+    // the output callback of the codec or when the frame expires, on failure it is not called.
+    bool EncodeSurfaceBuffer(sptr<FrameRecord> frameRecord, EncodedCallback callback);
     int32_t Stop();
-    void TsVecInsert(int64_t timestamp);
     int32_t Release();
     int32_t GetSurface();
     int32_t ReleaseSurfaceBuffer(sptr<FrameRecord> frameRecord);
@@ -109,13 +120,17 @@ private:
     bool EnqueueBuffer(sptr<FrameRecord> frameRecord);
     bool ProcessEncodedBuffer(sptr<FrameRecord> frameRecord, sptr<VideoCodecAVBufferInfo> bufferInfo);
     bool ProcessEncodedBufferWithoutCopy(sptr<FrameRecord> frameRecord, sptr<VideoCodecAVBufferInfo> bufferInfo);
+    void OnEncodedBufferAvailable(uint32_t index, std::shared_ptr<AVBuffer> buffer);
+    void OnExtendBufferAvailable(uint32_t index, std::shared_ptr<AVBuffer> buffer);
+    void ArmExpireTimer(int64_t delayMs);
+    void OnExpireTimer();
+    void FailPendingFrames();
     std::atomic<bool> isStarted_ { false };
     std::mutex encoderMutex_;
     shared_ptr<AVCodecVideoEncoder> encoder_ = nullptr;
     std::mutex contextMutex_;
 
     sptr<VideoCodecUserData> context_ = nullptr;
-    std::condition_variable contextCond_;
     shared_ptr<Size> size_;
     int32_t rotation_;
     std::mutex surfaceMutex_; // guard codecSurface_
@@ -126,21 +141,40 @@ private:
     bool isHdr_ = false;
     bool BframeAbility_ = false;
     sptr<SurfaceBuffer> codecDetachBuf_ = nullptr;
+    std::shared_ptr<EncodedFrameArena> encodedFrameArena_ = std::make_shared<EncodedFrameArena>();
 
-    std::mutex enqueueMutex_;
-    std::condition_variable enqueueCond_;
-
-    int64_t currentMinTimestamp = INT64_MAX;
+    struct SubmittedFrame {
+        sptr<FrameRecord> frameRecord;
+        EncodedCallback callback;
+    };
+    struct SubmittedFrameGreater {
+        bool operator()(const SubmittedFrame& lhs, const SubmittedFrame& rhs) const
+        {
+            return lhs.frameRecord->GetTimeStamp() > rhs.frameRecord->GetTimeStamp();
+        }
+    };
+    std::mutex submitMutex_;
+    std::priority_queue<SubmittedFrame, std::vector<SubmittedFrame>, SubmittedFrameGreater> submittedFrames_;
 
-    std::mutex tsMutex_;
-    std::mutex overTimeMutex_;
-    std::priority_queue<int64_t, std::vector<int64_t>, std::greater<int64_t>> tsVec_;
-    std::shared_ptr<AVBuffer> XpsBuffer_;
+    // Frames in the codec waiting for their output, keyed by timestamp which the codec returns as pts.
+    struct PendingFrame {
+        sptr<FrameRecord> frameRecord;
+        EncodedCallback callback;
+        int64_t expireTimeMs = 0;
+    };
     struct OverTimeBufferInfo {
         uint32_t index = UINT32_MAX;
         sptr<VideoCodecAVBufferInfo> bufferInfo = nullptr;
     };
-    SafeMap<int64_t, OverTimeBufferInfo> overTimeMap;
+    std::mutex pendingMutex_; // guard pendingFrames_, pendingExpireTimes_, overTimeMap_ and the expire timer
+    std::unordered_map<int64_t, PendingFrame> pendingFrames_;
+    // Expire time and timestamp of the pending frames in the order they were handed to the codec.
+    std::deque<std::pair<int64_t, int64_t>> pendingExpireTimes_;
+    std::unordered_map<int64_t, OverTimeBufferInfo> overTimeMap_;
+    bool isExpireTimerArmed_ = false;
+    uint32_t expireTimerId_ = 0;
+    std::mutex overTimeMutex_;
+    std::shared_ptr<AVBuffer> XpsBuffer_;
     bool isExtendImage_ = false;
     //CHECKMP
     std::set<int64_t> timestampSet_;
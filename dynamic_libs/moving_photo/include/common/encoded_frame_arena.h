@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AVCODEC_SAMPLE_ENCODED_FRAME_ARENA_H
+#define AVCODEC_SAMPLE_ENCODED_FRAME_ARENA_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "buffer/avbuffer.h"
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Shared memory slabs holding the encoded frames of the moving photo ring. Codec output is copied once into a
+ * slab of its power of two capacity class, the returned buffer holds the slab and gives it back to the arena when
+ * its last reference is dropped, which is when the frame ages out of the ring and is no longer muxed.
+ * The bytes held in slabs are capped, frames that do not fit are copied into buffers allocated for them alone.
+ */
+class EncodedFrameArena : public std::enable_shared_from_this<EncodedFrameArena> {
+public:
+    static constexpr int32_t MIN_SLAB_CAPACITY = 16 * 1024;
+    static constexpr size_t SLAB_CLASS_COUNT = 10; // 16 KB to 8 MB
+    static constexpr size_t MAX_IDLE_PER_CLASS = 8;
+    static constexpr int64_t MAX_ARENA_BYTES = 48 * 1024 * 1024;
+
+    EncodedFrameArena() = default;
+    ~EncodedFrameArena() = default;
+    EncodedFrameArena(const EncodedFrameArena&) = delete;
+    EncodedFrameArena& operator=(const EncodedFrameArena&) = delete;
+
+    // Copies the payload and every attribute of the codec output buffer, nullptr when no memory could be allocated.
+    std::shared_ptr<Media::AVBuffer> CopyFrom(const std::shared_ptr<Media::AVBuffer>& source);
+    // Frees the idle slabs, the slabs still held by frames are freed when they come back.
+    void Trim();
+    std::string Dump();
+
+private:
+    struct Slab {
+        std::shared_ptr<Media::AVBuffer> buffer = nullptr;
+        size_t classIndex = SLAB_CLASS_COUNT;
+    };
+
+    static inline int32_t GetClassCapacity(size_t classIndex)
+    {
+        return MIN_SLAB_CAPACITY << classIndex;
+    }
+
+    static inline size_t GetClassIndex(int32_t size)
+    {
+        size_t classIndex = 0;
+        while (classIndex < SLAB_CLASS_COUNT && GetClassCapacity(classIndex) < size) {
+            classIndex++;
+        }
+        return classIndex;
+    }
+
+    static std::shared_ptr<Media::AVBuffer> AllocateBuffer(int32_t capacity);
+    Slab AcquireSlab(int32_t size);
+    void RecycleSlab(Slab slab);
+
+    std::mutex arenaMutex_;
+    std::array<std::vector<Slab>, SLAB_CLASS_COUNT> idleSlabs_ {};
+    int64_t slabBytes_ = 0;
+    int64_t inUseBytes_ = 0;
+    int64_t peakInUseBytes_ = 0;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint64_t overflowCount_ = 0;
+};
+} // CameraStandard
+} // OHOS
+#endif // AVCODEC_SAMPLE_ENCODED_FRAME_ARENA_H
@@ -21,13 +21,13 @@
 #include "safe_map.h"
 #include "moving_photo_surface_wrapper.h"
 #include "surface.h"
-#include "fixed_size_list.h"
+#include "timestamp_ring_index.h"
 #include "blocking_queue.h"
 #include "avcodec/video_encoder.h"
 
 namespace OHOS::CameraStandard {
 class SessionDrainImageCallback;
-using MetaElementType = std::pair<int64_t, sptr<SurfaceBuffer>>;
+using MetaCacheType = TimestampRingIndex<sptr<SurfaceBuffer>>;
 using OnceRecordTimeInfo = std::pair<int64_t, int64_t>;
 
 struct FrameTimestampInfo {
@@ -41,7 +41,7 @@ struct FrameTimestampInfo {
 class MovingPhotoListener : public MovingPhotoSurfaceWrapper::SurfaceBufferListener {
 public:
     explicit MovingPhotoListener(sptr<MovingPhotoSurfaceWrapper> surfaceWrapper, wptr<Surface> metaSurface,
-        shared_ptr<FixedSizeList<MetaElementType>> metaCache, uint32_t preCacheFrameCount,
+        shared_ptr<MetaCacheType> metaCache, uint32_t preCacheFrameCount,
         uint32_t postCacheFrameCount, VideoType listenerType);
     ~MovingPhotoListener() override;
     void OnBufferArrival(sptr<SurfaceBuffer> buffer, int64_t timestamp, GraphicTransformType transform) override;
@@ -104,7 +104,7 @@ private:
     void ReleaseOldestBufferWhenFull();
     VideoType listenerXtStyleType_ = VideoType::ORIGIN_VIDEO;
     wptr<Surface> metaSurface_;
-    shared_ptr<FixedSizeList<MetaElementType>> metaCache_;
+    shared_ptr<MetaCacheType> metaCache_;
     BlockingQueue<sptr<FrameRecord>> recorderBufferQueue_;
     SafeMap<sptr<SessionDrainImageCallback>, sptr<DrainImageManager>> callbackMap_;
     SafeMap<uint64_t, shared_ptr<OnceRecordTimeInfo>> timeInfoMap_;
@@ -120,13 +120,13 @@ private:
 
 class MovingPhotoMetaListener : public IBufferConsumerListener {
 public:
-    explicit MovingPhotoMetaListener(wptr<Surface> surface, shared_ptr<FixedSizeList<MetaElementType>> metaCache,
+    explicit MovingPhotoMetaListener(wptr<Surface> surface, shared_ptr<MetaCacheType> metaCache,
         wptr<MovingPhotoListener> videoListener);
     ~MovingPhotoMetaListener();
     void OnBufferAvailable() override;
 private:
     wptr<Surface> surface_;
-    shared_ptr<FixedSizeList<MetaElementType>> metaCache_;
+    shared_ptr<MetaCacheType> metaCache_;
     wptr<MovingPhotoListener> videoListener_;
 };
 
@@ -15,6 +15,7 @@
 
 #include "audio_deferred_process.h"
 
+#include "utils/audio_pcm_kernel.h"
 #include "utils/camera_log.h"
 #include "camera_util.h"
 #include "sample_info.h"
@@ -111,18 +112,12 @@ uint32_t AudioDeferredProcess::GetOneUnprocessedSize()
 void AudioDeferredProcess::FadeOneBatch(std::array<uint8_t, MAX_PROCESSED_SIZE * PROCESS_BATCH_SIZE>& processedArr)
 {
     // LCOV_EXCL_START
-    float rate;
     int16_t* data = reinterpret_cast<int16_t*>(processedArr.data());
-    int32_t temp;
     int32_t oneSize = outputOptions_.samplingRate / ONE_THOUSAND * DURATION_EACH_AUDIO_FRAME;
     CHECK_RETURN_ELOG(
         oneSize >= MAX_PROCESSED_SIZE * PROCESS_BATCH_SIZE, "AudioDeferredProcess::FadeOneBatch arrSize overSize");
-    for (int k = 0; k < oneSize; k++) {
-        temp = static_cast<int32_t>(data[k]);
-        rate = static_cast<float>(k) / oneSize;
-        temp = temp - static_cast<int32_t>(temp * rate);
-        data[k] = static_cast<int16_t>(temp);
-    }
+    CHECK_RETURN(oneSize <= 0);
+    AudioPcmKernel::FadeOut(data, static_cast<size_t>(oneSize));
     // LCOV_EXCL_STOP
 }
 
@@ -224,6 +219,14 @@ void AudioDeferredProcess::SetMutedAudioRecordForVecs(vector<sptr<AudioRecord>>&
     // LCOV_EXCL_STOP
 }
 
+uint32_t AudioDeferredProcess::GetMutedTailStart(uint32_t audioRecordsLen)
+{
+    // batches are counted from the first record, the faded batch is the one holding audioRecordsLen - batch - 1
+    constexpr uint32_t batchSize = static_cast<uint32_t>(PROCESS_BATCH_SIZE);
+    CHECK_RETURN_RET(audioRecordsLen < batchSize + 1, 0);
+    return (audioRecordsLen - batchSize - 1) / batchSize * batchSize;
+}
+
 void AudioDeferredProcess::Release()
 {
     CAMERA_SYNC_TRACE;
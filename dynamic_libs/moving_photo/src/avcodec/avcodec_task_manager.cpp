@@ -120,44 +120,75 @@ void AvcodecTaskManager::EncodeVideoBuffer(sptr<FrameRecord> frameRecord, CacheC
     // LCOV_EXCL_START
     auto thisPtr = sptr<AvcodecTaskManager>(this);
     auto encodeManager = GetEncoderManager();
-    CHECK_RETURN(!encodeManager);
-    videoEncoder_->TsVecInsert(frameRecord->GetTimeStamp());
-    encodeManager->SubmitTask([thisPtr, frameRecord, cacheCallback]() {
-        CAMERA_SYNC_TRACE;
+    CHECK_RETURN(!encodeManager || !videoEncoder_ || !frameRecord);
+    wptr<AvcodecTaskManager> weakThis = this;
+    videoEncoder_->SubmitSurfaceBuffer(frameRecord,
+        [weakThis, cacheCallback](sptr<FrameRecord> encodedFrame, bool isEncodeSuccess) {
+            auto taskManager = weakThis.promote();
+            CHECK_RETURN(taskManager == nullptr);
+            taskManager->OnVideoBufferEncoded(encodedFrame, isEncodeSuccess, cacheCallback);
+        });
+    // Each task feeds the earliest submitted frame, not necessarily the one submitted with it.
+    encodeManager->SubmitTask([thisPtr]() {
         CHECK_RETURN(thisPtr == nullptr);
-        CHECK_RETURN(!thisPtr->videoEncoder_ || !frameRecord);
-        {
-            std::lock_guard<std::mutex> encodeLock(thisPtr->startAvcodecMutex_);
-            if (thisPtr->videoEncoder_->CheckIfRestartNeeded()) {
-                thisPtr->videoEncoder_->RestartVideoCodec(frameRecord->GetFrameSize(), frameRecord->GetRotation());
-            }
-        }
-        sptr<Surface> movingSurface = thisPtr->movingSurface_.promote();
-        if (movingSurface) {
-            sptr<SurfaceBuffer> codecDetachBuf;
-            thisPtr->videoEncoder_->DetachCodecBuffer(codecDetachBuf, frameRecord);
-            SurfaceError surfaceRet = movingSurface->AttachBufferToQueue(codecDetachBuf);
-            CHECK_EXECUTE(surfaceRet != SURFACE_ERROR_OK,
-                MEDIA_ERR_LOG("movingSurface AttachBuffer, surfaceRet = %{public}d, timestamp:%{public}llu", surfaceRet,
-                    (long long unsigned)frameRecord->GetTimeStamp()));
-            surfaceRet = movingSurface->ReleaseBuffer(codecDetachBuf, SyncFence::INVALID_FENCE);
-            CHECK_EXECUTE(surfaceRet != SURFACE_ERROR_OK,
-                MEDIA_ERR_LOG("movingSurface ReleaseBuffer, surfaceRet = %{public}d", surfaceRet));
-        }
-        bool isEncodeSuccess = thisPtr->videoEncoder_->EncodeSurfaceBuffer(frameRecord);
-        CHECK_PRINT_ELOG(!isEncodeSuccess, "EncodeVideoBuffer faild");
-        frameRecord->SetEncodedResult(isEncodeSuccess);
-        frameRecord->SetFinishStatus();
-        if (isEncodeSuccess) {
-            MEDIA_INFO_LOG("encode image success %{public}s, refCount: %{public}d, timestamp:%{public}" PRIu64,
-                frameRecord->GetFrameId().c_str(), frameRecord->GetSptrRefCount(), frameRecord->GetTimeStamp());
-        } else {
-            MEDIA_ERR_LOG("encode image fail %{public}s, timestamp:%{public}" PRIu64, frameRecord->GetFrameId().c_str(),
-                frameRecord->GetTimeStamp());
-        }
-        if (cacheCallback) {
-            cacheCallback(frameRecord, isEncodeSuccess);
+        thisPtr->FeedVideoEncoder();
+    });
+    // LCOV_EXCL_STOP
+}
+
+void AvcodecTaskManager::FeedVideoEncoder()
+{
+    // LCOV_EXCL_START
+    CAMERA_SYNC_TRACE;
+    CHECK_RETURN(!videoEncoder_);
+    sptr<FrameRecord> frameRecord = nullptr;
+    VideoEncoder::EncodedCallback encodedCallback;
+    CHECK_RETURN(!videoEncoder_->FetchSubmittedBuffer(frameRecord, encodedCallback));
+    {
+        std::lock_guard<std::mutex> encodeLock(startAvcodecMutex_);
+        if (videoEncoder_->CheckIfRestartNeeded()) {
+            videoEncoder_->RestartVideoCodec(frameRecord->GetFrameSize(), frameRecord->GetRotation());
         }
+    }
+    sptr<Surface> movingSurface = movingSurface_.promote();
+    if (movingSurface) {
+        sptr<SurfaceBuffer> codecDetachBuf;
+        videoEncoder_->DetachCodecBuffer(codecDetachBuf, frameRecord);
+        SurfaceError surfaceRet = movingSurface->AttachBufferToQueue(codecDetachBuf);
+        CHECK_EXECUTE(surfaceRet != SURFACE_ERROR_OK,
+            MEDIA_ERR_LOG("movingSurface AttachBuffer, surfaceRet = %{public}d, timestamp:%{public}llu", surfaceRet,
+                (long long unsigned)frameRecord->GetTimeStamp()));
+        surfaceRet = movingSurface->ReleaseBuffer(codecDetachBuf, SyncFence::INVALID_FENCE);
+        CHECK_EXECUTE(surfaceRet != SURFACE_ERROR_OK,
+            MEDIA_ERR_LOG("movingSurface ReleaseBuffer, surfaceRet = %{public}d", surfaceRet));
+    }
+    // On success the encoder completes the frame from its output callback or its expire timer.
+    CHECK_EXECUTE(!videoEncoder_->EncodeSurfaceBuffer(frameRecord, encodedCallback) && encodedCallback,
+        encodedCallback(frameRecord, false));
+    // LCOV_EXCL_STOP
+}
+
+void AvcodecTaskManager::OnVideoBufferEncoded(
+    sptr<FrameRecord> frameRecord, bool isEncodeSuccess, CacheCbFunc cacheCallback)
+{
+    // LCOV_EXCL_START
+    CHECK_RETURN(frameRecord == nullptr);
+    CHECK_PRINT_ELOG(!isEncodeSuccess, "EncodeVideoBuffer faild");
+    frameRecord->SetEncodedResult(isEncodeSuccess);
+    frameRecord->SetFinishStatus();
+    if (isEncodeSuccess) {
+        MEDIA_INFO_LOG("encode image success %{public}s, refCount: %{public}d, timestamp:%{public}" PRIu64,
+            frameRecord->GetFrameId().c_str(), frameRecord->GetSptrRefCount(), frameRecord->GetTimeStamp());
+    } else {
+        MEDIA_ERR_LOG("encode image fail %{public}s, timestamp:%{public}" PRIu64, frameRecord->GetFrameId().c_str(),
+            frameRecord->GetTimeStamp());
+    }
+    CHECK_RETURN(!cacheCallback);
+    // Called from the codec callback thread, the cache callback must not hold it up.
+    auto encodeManager = GetEncoderManager();
+    CHECK_RETURN_ELOG(!encodeManager, "encoder manager released, drop cache callback");
+    encodeManager->SubmitTask([frameRecord, isEncodeSuccess, cacheCallback]() {
+        cacheCallback(frameRecord, isEncodeSuccess);
     });
     // LCOV_EXCL_STOP
 }
@@ -682,46 +713,95 @@ void AvcodecTaskManager::CollectAudioBuffer(vector<sptr<FrameRecord>>& choosedBu
     CHECK_RETURN_ELOG(choosedBuffer.empty(), "CollectAudioBuffer choosedBuffer is empty");
     WaitForAudioRecordFinished(choosedBuffer);
     CHECK_RETURN_ELOG(!audioTaskManager_, "audioTaskManager_ is nullptr");
-    std::lock_guard<std::mutex> lock(audioTaskManager_->audioCacheMutex_);
-    vector<sptr<AudioRecord>> &audioRecordVec = audioTaskManager_->GetProcessedAudioRecordCache();
-    CHECK_RETURN_ELOG(audioRecordVec.empty(),
-        "AvcodecTaskManager::CollectAudioBuffer audioRecordVec is empty");
     int64_t videoStartTime = NanosecToMillisec(choosedBuffer.front()->GetTimeStamp());
     int64_t videoEndTime = NanosecToMillisec(choosedBuffer.back()->GetTimeStamp());
     vector<sptr<AudioRecord>> processedAudioRecords;
-    vector<sptr<AudioRecord>> encodeAudioRecords;
-    for (auto audioRecord : audioRecordVec) {
-        if (audioRecord->GetTimeStamp() >= videoStartTime && audioRecord->GetTimeStamp() < videoEndTime) {
-            processedAudioRecords.emplace_back(audioRecord);
-            encodeAudioRecords.emplace_back(new AudioRecord(audioRecord->GetTimeStamp()));
-        }
+    {
+        std::lock_guard<std::mutex> lock(audioTaskManager_->audioCacheMutex_);
+        vector<sptr<AudioRecord>> &audioRecordVec = audioTaskManager_->GetProcessedAudioRecordCache();
+        CHECK_RETURN_ELOG(audioRecordVec.empty(),
+            "AvcodecTaskManager::CollectAudioBuffer audioRecordVec is empty");
+        auto isBefore = [](const sptr<AudioRecord>& audioRecord, int64_t timestamp) {
+            return audioRecord->GetTimeStamp() < timestamp;
+        };
+        auto startItr = std::lower_bound(audioRecordVec.begin(), audioRecordVec.end(), videoStartTime, isBefore);
+        auto endItr = std::lower_bound(startItr, audioRecordVec.end(), videoEndTime, isBefore);
+        processedAudioRecords.assign(startItr, endItr);
     }
     MEDIA_INFO_LOG("CollectAudioBuffer start with size %{public}zu", processedAudioRecords.size());
-    CHECK_EXECUTE(audioTaskManager_ && !processedAudioRecords.empty() && !encodeAudioRecords.empty(),
-        audioTaskManager_->ProcessAudioBufferToMuted(processedAudioRecords, encodeAudioRecords));
-    bool isEncodeSuccess = false;
-    CHECK_RETURN_ELOG(!audioEncoder_ || encodeAudioRecords.empty() || !muxer,
+    CHECK_RETURN_ELOG(!audioEncoder_ || processedAudioRecords.empty() || !muxer,
         "CollectAudioBuffer cannot find useful data");
+    // Only the tail of the window is faded and muted, the records before it are muxed as they were pre-encoded.
+    size_t tailStart = AudioDeferredProcess::GetMutedTailStart(processedAudioRecords.size());
+    vector<sptr<AudioRecord>> encodedAudioRecords(processedAudioRecords.begin(),
+        processedAudioRecords.begin() + tailStart);
+    vector<sptr<AudioRecord>> tailAudioRecords(processedAudioRecords.begin() + tailStart,
+        processedAudioRecords.end());
+    vector<sptr<AudioRecord>> encodeTailRecords;
+    for (auto& audioRecord : tailAudioRecords) {
+        encodeTailRecords.emplace_back(new AudioRecord(audioRecord->GetTimeStamp()));
+    }
+    audioTaskManager_->ProcessAudioBufferToMuted(tailAudioRecords, encodeTailRecords);
     if (isNeedEncode) {
-        isEncodeSuccess = audioEncoder_->EncodeAudioBuffer(encodeAudioRecords);
-        MEDIA_DEBUG_LOG("encode audio buffer result %{public}d", isEncodeSuccess);
+        // records the pre-encoder has not reached yet are encoded now, the others are skipped
+        audioTaskManager_->PreEncodeAudioRecords(encodedAudioRecords);
+        EncodeAudioTail(processedAudioRecords, tailStart, encodeTailRecords);
+    }
+    encodedAudioRecords.insert(encodedAudioRecords.end(), encodeTailRecords.begin(), encodeTailRecords.end());
+    WriteAudioSamples(muxer, encodedAudioRecords);
+    MEDIA_INFO_LOG("CollectAudioBuffer finished, pre-encoded: %{public}zu, tail: %{public}zu", tailStart,
+        encodeTailRecords.size());
+    // LCOV_EXCL_STOP
+}
+
+void AvcodecTaskManager::EncodeAudioTail(vector<sptr<AudioRecord>>& processedAudioRecords, size_t tailStart,
+    vector<sptr<AudioRecord>>& encodeTailRecords)
+{
+    // LCOV_EXCL_START
+    // The tail is spliced after units from another encoder instance. Priming audioEncoder_ with the records just
+    // before tailStart fills its MDCT overlap and delay from the same stream, so the first muxed tail unit does not
+    // start from silence. The lead-in units themselves are dropped, the pre-encoded ones are muxed in their place.
+    size_t leadInStart = tailStart > AUDIO_TAIL_LEAD_IN_COUNT ? tailStart - AUDIO_TAIL_LEAD_IN_COUNT : 0;
+    vector<sptr<AudioRecord>> encodeRecords;
+    for (size_t index = leadInStart; index < tailStart; index++) {
+        uint8_t* audioBuffer = processedAudioRecords[index]->GetAudioBuffer();
+        CHECK_CONTINUE_WLOG(audioBuffer == nullptr, "lead-in audio buffer is null");
+        uint8_t* leadInBuffer = new uint8_t[DEFAULT_MAX_INPUT_SIZE];
+        int32_t ret = memcpy_s(leadInBuffer, DEFAULT_MAX_INPUT_SIZE, audioBuffer, DEFAULT_MAX_INPUT_SIZE);
+        if (ret != 0) {
+            MEDIA_ERR_LOG("EncodeAudioTail lead-in memcpy_s err:%{public}d", ret);
+            delete[] leadInBuffer;
+            continue;
+        }
+        sptr<AudioRecord> leadInRecord = new AudioRecord(processedAudioRecords[index]->GetTimeStamp());
+        leadInRecord->SetAudioBuffer(leadInBuffer, DEFAULT_MAX_INPUT_SIZE);
+        encodeRecords.emplace_back(leadInRecord);
     }
-    size_t maxFrameCount = std::min(encodeAudioRecords.size(), MAX_AUDIO_FRAME_COUNT);
+    size_t leadInCount = encodeRecords.size();
+    encodeRecords.insert(encodeRecords.end(), encodeTailRecords.begin(), encodeTailRecords.end());
+    bool isEncodeSuccess = audioEncoder_->EncodeAudioBuffer(encodeRecords);
+    MEDIA_DEBUG_LOG("encode audio tail result %{public}d, lead-in: %{public}zu", isEncodeSuccess, leadInCount);
+    // LCOV_EXCL_STOP
+}
+
+void AvcodecTaskManager::WriteAudioSamples(sptr<AudioVideoMuxer> muxer,
+    vector<sptr<AudioRecord>>& encodedAudioRecords)
+{
+    // LCOV_EXCL_START
+    // the pre-encoded buffers are shared by the captures whose windows overlap, their attr is set per write
+    std::lock_guard<std::mutex> lock(audioTaskManager_->encodedAudioMutex_);
+    size_t maxFrameCount = std::min(encodedAudioRecords.size(), MAX_AUDIO_FRAME_COUNT);
     for (size_t index = 0; index < maxFrameCount; index++) {
         OH_AVCodecBufferAttr attr = { 0, 0, 0, AVCODEC_BUFFER_FLAGS_NONE };
-        OH_AVBuffer* buffer = encodeAudioRecords[index]->encodedBuffer;
+        CHECK_CONTINUE_WLOG(!encodedAudioRecords[index]->IsEncoded(), "audio record is not encoded");
+        OH_AVBuffer* buffer = encodedAudioRecords[index]->encodedBuffer;
         CHECK_CONTINUE_WLOG(buffer == nullptr, "audio encodedBuffer is null");
         OH_AVBuffer_GetBufferAttr(buffer, &attr);
         attr.pts = static_cast<int64_t>(index * AUDIO_FRAME_INTERVAL);
-        if (encodeAudioRecords.size() > 0) {
-            if (index == encodeAudioRecords.size() - 1) {
-                attr.flags = AVCODEC_BUFFER_FLAGS_EOS;
-            }
-        }
+        CHECK_EXECUTE(index == encodedAudioRecords.size() - 1, attr.flags = AVCODEC_BUFFER_FLAGS_EOS);
         OH_AVBuffer_SetBufferAttr(buffer, &attr);
         muxer->WriteSampleBuffer(buffer->buffer_, AUDIO_TRACK);
     }
-    MEDIA_INFO_LOG("CollectAudioBuffer finished");
     // LCOV_EXCL_STOP
 }
 
@@ -759,6 +839,7 @@ void AvcodecTaskManager::Stop()
     if (audioEncoder_ != nullptr) {
         audioEncoder_->Stop();
     }
+    CHECK_EXECUTE(audioTaskManager_ != nullptr, audioTaskManager_->StopPreEncoder());
     MEDIA_INFO_LOG("AvcodecTaskManager Stop end");
 }
 
@@ -890,6 +971,7 @@ AudioTaskManager::AudioTaskManager(sptr<AudioCapturerSession> audioCaptureSessio
 {
     CAMERA_SYNC_TRACE;
     audioCapturerSession_ = audioCaptureSession;
+    preEncoder_ = make_unique<AudioEncoder>();
     MEDIA_DEBUG_LOG("AudioTaskManager is called");
 }
 
@@ -918,6 +1000,7 @@ void AudioTaskManager::Release()
     
     arrivalAudioBufferQueue_.Clear();
     ClearTaskResource();
+    CHECK_EXECUTE(preEncoder_ != nullptr, preEncoder_->Release());
 }
 
 void AudioTaskManager::ClearTaskResource()
@@ -1129,6 +1212,8 @@ void AudioTaskManager::HandleAudioRecordsProcessing(const sptr<AudioTaskManager>
             });
     }
     sharedThis->SetIsBufferArrivalFinished(true);
+    // encode on this thread while audio keeps arriving, so that a capture only muxes the AAC units of its window
+    sharedThis->PreEncodeAudioRecords(audioRecordVec);
     MEDIA_INFO_LOG("AudioTaskManager::ProcessAudioFromAudioBufferQueue end");
     // LCOV_EXCL_STOP
 }
@@ -1180,6 +1265,24 @@ void AudioTaskManager::PrepareAudioBuffer(int64_t middleTimeStamp)
     // LCOV_EXCL_STOP
 }
 
+void AudioTaskManager::PreEncodeAudioRecords(vector<sptr<AudioRecord>>& audioRecords)
+{
+    // LCOV_EXCL_START
+    CAMERA_SYNC_TRACE;
+    CHECK_RETURN(preEncoder_ == nullptr || audioRecords.empty());
+    bool isEncodeSuccess = preEncoder_->EncodeAudioBuffer(audioRecords);
+    CHECK_PRINT_WLOG(!isEncodeSuccess, "PreEncodeAudioRecords failed, size: %{public}zu", audioRecords.size());
+    // LCOV_EXCL_STOP
+}
+
+void AudioTaskManager::StopPreEncoder()
+{
+    CHECK_RETURN(preEncoder_ == nullptr);
+    // EncodeAudioBuffer holds the encoder for a whole batch, stopping in the middle of it is refused
+    int32_t ret = preEncoder_->Stop();
+    CHECK_PRINT_WLOG(ret != 0, "StopPreEncoder failed, ret: %{public}d", ret);
+}
+
 void AudioTaskManager::ProcessAudioBufferToMuted(vector<sptr<AudioRecord>>& audioRecords,
     vector<sptr<AudioRecord>>& encodeAudioRecords)
 {
@@ -16,6 +16,8 @@
 #include "video_encoder.h"
 #include "utils/camera_log.h"
 #include <sync_fence.h>
+#include "camera_timer.h"
+#include "datetime_ex.h"
 #include "native_mfmagic.h"
 #include "media_description.h"
 #include "codec_info_util.h"
@@ -241,8 +243,13 @@ bool VideoEncoder::ProcessOverTimeFrame(sptr<FrameRecord> frameRecord)
     CHECK_RETURN_RET_ILOG(frameRecord->IsEncoded(), true,
         "ProcessOverTimeFrame overTimeMap IsEncoded, timestamp: %{public}" PRIu64, frameRecord->GetTimeStamp());
     OverTimeBufferInfo overTimeInfo;
-    CHECK_RETURN_RET_ILOG(!overTimeMap.Find(frameRecord->GetTimeStamp(), overTimeInfo), false,
-        "ProcessOverTimeFrame overTimeMap cant find, timestamp: %{public}" PRIu64, frameRecord->GetTimeStamp());
+    {
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        auto it = overTimeMap_.find(frameRecord->GetTimeStamp());
+        CHECK_RETURN_RET_ILOG(it == overTimeMap_.end(), false,
+            "ProcessOverTimeFrame overTimeMap cant find, timestamp: %{public}" PRIu64, frameRecord->GetTimeStamp());
+        overTimeInfo = it->second;
+    }
     CHECK_RETURN_RET_ILOG(overTimeInfo.bufferInfo == nullptr || overTimeInfo.bufferInfo->buffer->memory_ == nullptr,
         false,
         "ProcessOverTimeFrame: bufferInfo is nullptr or memory is alloced failed for timestamp: %{public}" PRIu64,
@@ -253,14 +260,12 @@ bool VideoEncoder::ProcessOverTimeFrame(sptr<FrameRecord> frameRecord)
                    "timestamp:%{public}" PRIu64 ", SeqNum: %{public}" PRIu32,
         overTimeInfo.bufferInfo->buffer->memory_->GetSize(), overTimeInfo.bufferInfo->buffer->flag_,
         overTimeInfo.bufferInfo->buffer->pts_, frameRecord->GetTimeStamp(), seqNum);
-    if (ProcessEncodedBufferWithoutCopy(frameRecord, overTimeInfo.bufferInfo)) {
-        frameRecord->SetEncodedResult(true);
-        overTimeMap.Erase(frameRecord->GetTimeStamp());
-        return true;
-    }
+    bool isProcessed = ProcessEncodedBufferWithoutCopy(frameRecord, overTimeInfo.bufferInfo);
+    CHECK_EXECUTE(isProcessed, frameRecord->SetEncodedResult(true));
     //no matter success or not ,bufferInfo already been released
-    overTimeMap.Erase(frameRecord->GetTimeStamp());
-    return false;
+    std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+    overTimeMap_.erase(frameRecord->GetTimeStamp());
+    return isProcessed;
     // LCOV_EXCL_STOP
 }
 
@@ -310,13 +315,15 @@ bool VideoEncoder::ProcessEncodedBuffer(sptr<FrameRecord> frameRecord, sptr<Vide
         CHECK_RETURN_RET_ELOG(!isStarted_ || encoder_ == nullptr, false, "EncodeSurfaceBuffer when encoder stop!");
     }
     if (bufferInfo->buffer->flag_ & AVCODEC_BUFFER_FLAGS_SYNC_FRAME) {
-        std::shared_ptr<Media::AVBuffer> IDRBuffer = bufferInfo->GetCopyAVBuffer();
+        std::shared_ptr<Media::AVBuffer> IDRBuffer = encodedFrameArena_->CopyFrom(bufferInfo->buffer);
+        CHECK_EXECUTE(IDRBuffer == nullptr, IDRBuffer = bufferInfo->GetCopyAVBuffer());
         frameRecord->CacheBuffer(IDRBuffer);
         frameRecord->SetIDRProperty(true);
         frameRecord->SetMuxerIndex(bufferInfo->muxerIndex_);
     } else if (bufferInfo->buffer->flag_ == AVCODEC_BUFFER_FLAGS_NONE) {
         // return P/B frame
-        std::shared_ptr<Media::AVBuffer> PBuffer = bufferInfo->GetCopyAVBuffer();
+        std::shared_ptr<Media::AVBuffer> PBuffer = encodedFrameArena_->CopyFrom(bufferInfo->buffer);
+        CHECK_EXECUTE(PBuffer == nullptr, PBuffer = bufferInfo->GetCopyAVBuffer());
         frameRecord->CacheBuffer(PBuffer);
         frameRecord->SetIDRProperty(false);
         frameRecord->SetMuxerIndex(bufferInfo->muxerIndex_);
@@ -363,59 +370,183 @@ bool VideoEncoder::ProcessEncodedBufferWithoutCopy(
     // LCOV_EXCL_STOP
 }
 
-bool VideoEncoder::EncodeSurfaceBuffer(sptr<FrameRecord> frameRecord)
+void VideoEncoder::SubmitSurfaceBuffer(sptr<FrameRecord> frameRecord, EncodedCallback callback)
+{
+    CHECK_RETURN_ELOG(frameRecord == nullptr, "SubmitSurfaceBuffer frameRecord is null");
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+    submittedFrames_.push({ frameRecord, std::move(callback) });
+}
+
+bool VideoEncoder::FetchSubmittedBuffer(sptr<FrameRecord>& frameRecord, EncodedCallback& callback)
+{
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+    CHECK_RETURN_RET(submittedFrames_.empty(), false);
+    frameRecord = submittedFrames_.top().frameRecord;
+    callback = submittedFrames_.top().callback;
+    submittedFrames_.pop();
+    return true;
+}
+
+bool VideoEncoder::EncodeSurfaceBuffer(sptr<FrameRecord> frameRecord, EncodedCallback callback)
 {
     // LCOV_EXCL_START
+    CHECK_RETURN_RET_ELOG(frameRecord == nullptr, false, "EncodeSurfaceBuffer frameRecord is null");
+    int64_t timestamp = frameRecord->GetTimeStamp();
+    bool shouldArmTimer = false;
     {
-        std::unique_lock<std::mutex> enqueueLock(enqueueMutex_);
-        enqueueCond_.wait_for(enqueueLock, std::chrono::milliseconds(QUEUE_WAIT_TIME), [this, frameRecord]() {
-            // 取出当前最小时间戳
-            std::lock_guard<std::mutex> tsLock(tsMutex_);
-            if (!tsVec_.empty()) {
-                currentMinTimestamp = tsVec_.top();
-            }
-            return currentMinTimestamp == frameRecord->GetTimeStamp();
-        });
-        auto EnqueueRet = EnqueueBuffer(frameRecord);
-        std::unique_lock<std::mutex> tsLock(tsMutex_);
-        if (!tsVec_.empty()) {
-            tsVec_.pop();
-            tsLock.unlock();
-            enqueueCond_.notify_all();
-        }
-        MEDIA_DEBUG_LOG("EncodeSurfaceBuffer::timestamp:%{public}llu, enqueue result:%{public}d",
-            (long long unsigned)frameRecord->GetTimeStamp(), EnqueueRet);
-        CHECK_RETURN_RET_ELOG(!EnqueueRet, false, "EnqueueBuffer failed,timestamp::%{public}llu",
-            (long long unsigned)frameRecord->GetTimeStamp());
+        // Registered before the buffer reaches the codec so that its output always finds the frame.
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        CHECK_RETURN_RET_ELOG(pendingFrames_.count(timestamp) != 0, false,
+            "EncodeSurfaceBuffer frame already pending, timestamp:%{public}" PRId64, timestamp);
+        int64_t expireTimeMs = GetTickCount() + BUFFER_ENCODE_EXPIREATION_TIME;
+        pendingFrames_[timestamp] = { frameRecord, std::move(callback), expireTimeMs };
+        pendingExpireTimes_.emplace_back(expireTimeMs, timestamp);
+        shouldArmTimer = !isExpireTimerArmed_;
+        isExpireTimerArmed_ = true;
     }
-    std::unique_lock<std::mutex> contextLock(contextMutex_);
-    CHECK_RETURN_RET_ELOG(context_ == nullptr, false, "VideoEncoder has been released");
-    std::map<int64_t, sptr<VideoCodecAVBufferInfo>>::iterator frameRef;
-    contextCond_.wait_for(
-        contextLock, std::chrono::milliseconds(BUFFER_ENCODE_EXPIREATION_TIME), [this, &frameRef, frameRecord]() {
-            std::unique_lock<std::mutex> lock(context_->outputMutex_);
-            frameRef = context_->outputBufferInfoMap_.find(frameRecord->GetTimeStamp());
-            return !isStarted_ || frameRef != context_->outputBufferInfoMap_.end();
-        });
-    std::unique_lock<std::mutex> lock(context_->outputMutex_);
-    if (frameRef == context_->outputBufferInfoMap_.end()) {
-        overTimeMap.EnsureInsert(frameRecord->GetTimeStamp(), OverTimeBufferInfo());
-        MEDIA_ERR_LOG("Failed frame id is : %{public}s", frameRecord->GetFrameId().c_str());
+    CHECK_EXECUTE(shouldArmTimer, ArmExpireTimer(BUFFER_ENCODE_EXPIREATION_TIME));
+    bool isEnqueued = EnqueueBuffer(frameRecord);
+    MEDIA_DEBUG_LOG("EncodeSurfaceBuffer::timestamp:%{public}" PRId64 ", enqueue result:%{public}d",
+        timestamp, isEnqueued);
+    if (!isEnqueued) {
+        MEDIA_ERR_LOG("EnqueueBuffer failed,timestamp::%{public}" PRId64, timestamp);
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        pendingFrames_.erase(timestamp);
         return false;
     }
-    sptr<VideoCodecAVBufferInfo> bufferInfo = frameRef->second;
-    CHECK_RETURN_RET_ELOG(bufferInfo->buffer->memory_ == nullptr, false, "memory is alloced failed!");
-    uint32_t seqNum = 0;
-    CHECK_EXECUTE(frameRecord->GetSurfaceBuffer() != nullptr, seqNum = frameRecord->GetSurfaceBuffer()->GetSeqNum());
-    MEDIA_INFO_LOG("Out buffer count: %{public}u, size: %{public}d, flag: %{public}u, pts:%{public}" PRIu64 ", "
-                   "timestamp:%{public}llu, SeqNum: %{public}" PRIu32,
-        context_->outputFrameCount_, bufferInfo->buffer->memory_->GetSize(), bufferInfo->buffer->flag_,
-        bufferInfo->buffer->pts_, (long long unsigned)frameRecord->GetTimeStamp(), seqNum);
-    context_->outputBufferInfoMap_.erase(frameRecord->GetTimeStamp());
-    context_->outputFrameCount_++;
-    lock.unlock();
-    contextLock.unlock();
-    return ProcessEncodedBuffer(frameRecord, bufferInfo);
+    return true;
+    // LCOV_EXCL_STOP
+}
+
+void VideoEncoder::ArmExpireTimer(int64_t delayMs)
+{
+    // LCOV_EXCL_START
+    std::weak_ptr<VideoEncoder> weakThis = weak_from_this();
+    uint32_t timerId = CameraTimer::GetInstance().Register([weakThis]() {
+        auto encoder = weakThis.lock();
+        CHECK_RETURN(encoder == nullptr);
+        encoder->OnExpireTimer();
+    }, static_cast<uint32_t>(delayMs), true);
+    std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+    expireTimerId_ = timerId;
+    CHECK_EXECUTE(timerId == 0, isExpireTimerArmed_ = false);
+    // LCOV_EXCL_STOP
+}
+
+void VideoEncoder::OnExpireTimer()
+{
+    // LCOV_EXCL_START
+    std::vector<PendingFrame> expiredFrames;
+    int64_t nextDelayMs = 0;
+    {
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        expireTimerId_ = 0;
+        int64_t currentTimeMs = GetTickCount();
+        while (!pendingExpireTimes_.empty() && pendingExpireTimes_.front().first <= currentTimeMs) {
+            int64_t timestamp = pendingExpireTimes_.front().second;
+            pendingExpireTimes_.pop_front();
+            auto it = pendingFrames_.find(timestamp);
+            CHECK_CONTINUE(it == pendingFrames_.end() || it->second.expireTimeMs > currentTimeMs);
+            expiredFrames.push_back(std::move(it->second));
+            pendingFrames_.erase(it);
+            // The output may still arrive, it is kept for ProcessOverTimeFrame.
+            overTimeMap_[timestamp] = OverTimeBufferInfo();
+        }
+        isExpireTimerArmed_ = !pendingExpireTimes_.empty();
+        CHECK_EXECUTE(isExpireTimerArmed_, nextDelayMs = pendingExpireTimes_.front().first - currentTimeMs);
+    }
+    CHECK_EXECUTE(nextDelayMs > 0, ArmExpireTimer(nextDelayMs));
+    for (auto& expiredFrame : expiredFrames) {
+        MEDIA_ERR_LOG("Failed frame id is : %{public}s", expiredFrame.frameRecord->GetFrameId().c_str());
+        CHECK_EXECUTE(expiredFrame.callback, expiredFrame.callback(expiredFrame.frameRecord, false));
+    }
+    // LCOV_EXCL_STOP
+}
+
+void VideoEncoder::FailPendingFrames()
+{
+    std::vector<PendingFrame> pendingFrames;
+    uint32_t timerId = 0;
+    {
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        for (auto& pendingFrame : pendingFrames_) {
+            pendingFrames.push_back(std::move(pendingFrame.second));
+        }
+        pendingFrames_.clear();
+        pendingExpireTimes_.clear();
+        timerId = expireTimerId_;
+        expireTimerId_ = 0;
+        isExpireTimerArmed_ = false;
+    }
+    CHECK_EXECUTE(timerId != 0, CameraTimer::GetInstance().Unregister(timerId));
+    for (auto& pendingFrame : pendingFrames) {
+        // LCOV_EXCL_START
+        MEDIA_ERR_LOG("Failed frame id is : %{public}s, encoder released",
+            pendingFrame.frameRecord->GetFrameId().c_str());
+        CHECK_EXECUTE(pendingFrame.callback, pendingFrame.callback(pendingFrame.frameRecord, false));
+        // LCOV_EXCL_STOP
+    }
+}
+
+void VideoEncoder::OnEncodedBufferAvailable(uint32_t index, std::shared_ptr<AVBuffer> buffer)
+{
+    // LCOV_EXCL_START
+    int64_t timestamp = buffer->pts_;
+    PendingFrame pendingFrame;
+    bool isOverTime = false;
+    {
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        auto it = pendingFrames_.find(timestamp);
+        if (it != pendingFrames_.end()) {
+            pendingFrame = std::move(it->second);
+            pendingFrames_.erase(it);
+        } else {
+            auto overTimeIt = overTimeMap_.find(timestamp);
+            isOverTime = overTimeIt != overTimeMap_.end() && overTimeIt->second.bufferInfo == nullptr;
+        }
+    }
+    int64_t currentMuxerIndex = muxerIndex++;
+    if (pendingFrame.frameRecord != nullptr) {
+        sptr<VideoCodecAVBufferInfo> bufferInfo = new VideoCodecAVBufferInfo(index, currentMuxerIndex, buffer);
+        uint32_t seqNum = 0;
+        sptr<SurfaceBuffer> surfaceBuffer = pendingFrame.frameRecord->GetSurfaceBuffer();
+        CHECK_EXECUTE(surfaceBuffer != nullptr, seqNum = surfaceBuffer->GetSeqNum());
+        MEDIA_INFO_LOG("Out buffer size: %{public}d, flag: %{public}u, pts:%{public}" PRIu64 ", "
+                       "timestamp:%{public}" PRId64 ", SeqNum: %{public}" PRIu32,
+            buffer->memory_ == nullptr ? 0 : buffer->memory_->GetSize(), buffer->flag_, buffer->pts_, timestamp,
+            seqNum);
+        bool isEncoded = buffer->memory_ != nullptr && ProcessEncodedBuffer(pendingFrame.frameRecord, bufferInfo);
+        CHECK_EXECUTE(buffer->memory_ == nullptr, FreeOutputData(index));
+        CHECK_EXECUTE(pendingFrame.callback, pendingFrame.callback(pendingFrame.frameRecord, isEncoded));
+        return;
+    }
+    if (!isOverTime || buffer->memory_ == nullptr) {
+        MEDIA_WARN_LOG("No frame waits for output pts:%{public}" PRId64 ", release it", timestamp);
+        FreeOutputData(index);
+        return;
+    }
+    // means no frame is waiting for this output any more, copy buffer and release
+    OverTimeBufferInfo newInfo;
+    newInfo.index = index;
+    std::shared_ptr<Media::AVBuffer> copyBuffer = encodedFrameArena_->CopyFrom(buffer);
+    CHECK_EXECUTE(copyBuffer == nullptr, copyBuffer = CopyAVBuffer(buffer));
+    FreeOutputData(index);
+    newInfo.bufferInfo = new VideoCodecAVBufferInfo(index, currentMuxerIndex, copyBuffer);
+    std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+    auto overTimeIt = overTimeMap_.find(timestamp);
+    CHECK_EXECUTE(overTimeIt != overTimeMap_.end(), overTimeIt->second = newInfo);
+    // LCOV_EXCL_STOP
+}
+
+void VideoEncoder::OnExtendBufferAvailable(uint32_t index, std::shared_ptr<AVBuffer> buffer)
+{
+    // LCOV_EXCL_START
+    CHECK_RETURN_ELOG(context_ == nullptr, "encoder context is nullptr");
+    std::lock_guard<std::mutex> lock(context_->outputMutex_);
+    sptr<VideoCodecAVBufferInfo> AVBufferInfo = new VideoCodecAVBufferInfo(index, muxerIndex, buffer);
+    context_->outputBufferInfoMap_[buffer->pts_] = AVBufferInfo;
+    muxerIndex++;
+    context_->outputCond_.notify_all();
     // LCOV_EXCL_STOP
 }
 
@@ -476,17 +607,17 @@ int32_t VideoEncoder::Release()
             MEDIA_DEBUG_LOG("encoder_ Release ret: %{public}d.", ret);
         };
     }
-    std::unique_lock<std::mutex> contextLock(contextMutex_);
-    isStarted_ = false;
+    {
+        std::unique_lock<std::mutex> contextLock(contextMutex_);
+        isStarted_ = false;
+    }
+    // Outputs of a released codec never arrive, the frames still waiting for one fail now instead of expiring.
+    FailPendingFrames();
+    MEDIA_INFO_LOG("VideoEncoder Release %{public}s", encodedFrameArena_->Dump().c_str());
+    encodedFrameArena_->Trim();
     return 0;
 }
 
-void VideoEncoder::TsVecInsert(int64_t timestamp)
-{
-    std::lock_guard<std::mutex> tsLock(tsMutex_);
-    tsVec_.push(timestamp);
-}
-
 void VideoEncoder::CallBack::OnError(MediaAVCodec::AVCodecErrorType errorType, int32_t errorCode)
 {
     // LCOV_EXCL_START
@@ -559,31 +690,16 @@ void VideoEncoder::CallBack::OnOutputBufferAvailable(uint32_t index, std::shared
         index, (long long unsigned)buffer->pts_, buffer->flag_, encoder->muxerIndex, buffer->dts_);
     FrameRecord::DumpBuffer(buffer->memory_->GetAddr(), buffer->memory_->GetSize(), buffer->pts_, "encoder_output_raw");
     encoder->ProcessFrameInfo(buffer);
-    OverTimeBufferInfo overTimeInfo;
-    if (encoder->overTimeMap.Find(buffer->pts_, overTimeInfo)) {
-        // means no contextCond_ waiting for this framerecord
-        // copy buffer and release
-        CHECK_RETURN_ELOG(buffer->memory_ == nullptr, "memory is alloced failed!");
-        OverTimeBufferInfo newInfo;
-        newInfo.index = index;
-        std::shared_ptr<Media::AVBuffer> copyBuffer = encoder->CopyAVBuffer(buffer);
-        encoder->FreeOutputData(index);
-        newInfo.bufferInfo = new VideoCodecAVBufferInfo(index, encoder->muxerIndex, copyBuffer);
-        encoder->overTimeMap.FindOldAndSetNew(buffer->pts_, overTimeInfo, newInfo);
-        encoder->muxerIndex++;
-        return;
-    }
-    CHECK_RETURN_ELOG(encoder->context_ == nullptr, "encoder context is nullptr");
-    std::unique_lock<std::mutex> lock(encoder->context_->outputMutex_);
     if (buffer->flag_ & AVCODEC_BUFFER_FLAGS_CODEC_DATA) {
         encoder->SetXpsBuffer(encoder->CopyAVBuffer(buffer));
         encoder->FreeOutputData(index);
-    } else {
-        sptr<VideoCodecAVBufferInfo> AVBufferInfo = new VideoCodecAVBufferInfo(index, encoder->muxerIndex, buffer);
-        encoder->context_->outputBufferInfoMap_[buffer->pts_] = AVBufferInfo;
-        encoder->muxerIndex++;
-        encoder->contextCond_.notify_all();
+        return;
+    }
+    if (encoder->isExtendImage_) {
+        encoder->OnExtendBufferAvailable(index, buffer);
+        return;
     }
+    encoder->OnEncodedBufferAvailable(index, buffer);
     // LCOV_EXCL_STOP
 }
 
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "encoded_frame_arena.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <securec.h>
+#include "frame_record.h"
+#include "utils/camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+std::shared_ptr<Media::AVBuffer> EncodedFrameArena::CopyFrom(const std::shared_ptr<Media::AVBuffer>& source)
+{
+    CHECK_RETURN_RET_ELOG(source == nullptr || source->memory_ == nullptr, nullptr, "source memory is null");
+    int32_t size = source->memory_->GetSize();
+    Slab slab = AcquireSlab(size);
+    CHECK_RETURN_RET_ELOG(slab.buffer == nullptr || slab.buffer->memory_ == nullptr, nullptr,
+        "EncodedFrameArena alloc failed, size: %{public}d", size);
+    auto destAddr = slab.buffer->memory_->GetAddr();
+    errno_t cpyRet = memcpy_s(reinterpret_cast<void*>(destAddr), slab.buffer->memory_->GetCapacity(),
+        reinterpret_cast<void*>(source->memory_->GetAddr()), size);
+    CHECK_PRINT_ELOG(cpyRet != 0, "EncodedFrameArena memcpy_s failed. %{public}d", cpyRet);
+    FrameRecord::TrackAddr(destAddr, slab.buffer->memory_->GetFileDescriptor(), source->pts_);
+    // recycled slabs still carry the previous frame, every field is overwritten from the source
+    slab.buffer->pts_ = source->pts_;
+    slab.buffer->dts_ = source->dts_;
+    slab.buffer->duration_ = source->duration_;
+    slab.buffer->flag_ = source->flag_;
+    slab.buffer->meta_ = source->meta_ != nullptr ? std::make_shared<Media::Meta>(*source->meta_) :
+        std::make_shared<Media::Meta>();
+    slab.buffer->memory_->SetSize(size);
+    CHECK_RETURN_RET(slab.classIndex >= SLAB_CLASS_COUNT, slab.buffer);
+    Media::AVBuffer* rawBuffer = slab.buffer.get();
+    std::weak_ptr<EncodedFrameArena> weakArena = weak_from_this();
+    return std::shared_ptr<Media::AVBuffer>(rawBuffer, [weakArena, slab](Media::AVBuffer*) mutable {
+        auto arena = weakArena.lock();
+        CHECK_RETURN(arena == nullptr);
+        arena->RecycleSlab(std::move(slab));
+    });
+}
+
+EncodedFrameArena::Slab EncodedFrameArena::AcquireSlab(int32_t size)
+{
+    Slab slab;
+    CHECK_RETURN_RET(size <= 0, slab);
+    size_t classIndex = GetClassIndex(size);
+    bool isPooled = false;
+    {
+        std::lock_guard<std::mutex> lock(arenaMutex_);
+        if (classIndex < SLAB_CLASS_COUNT && !idleSlabs_[classIndex].empty()) {
+            slab = std::move(idleSlabs_[classIndex].back());
+            idleSlabs_[classIndex].pop_back();
+            hitCount_++;
+        } else if (classIndex < SLAB_CLASS_COUNT && slabBytes_ + GetClassCapacity(classIndex) <= MAX_ARENA_BYTES) {
+            // reserve the slab bytes now so concurrent acquires cannot exceed the cap
+            slabBytes_ += GetClassCapacity(classIndex);
+            missCount_++;
+            isPooled = true;
+        } else {
+            CHECK_PRINT_WLOG(overflowCount_ == 0,
+                "EncodedFrameArena is full, frames are allocated unpooled, slabBytes: %{public}" PRId64, slabBytes_);
+            overflowCount_++;
+        }
+        if (slab.buffer != nullptr || isPooled) {
+            inUseBytes_ += GetClassCapacity(classIndex);
+            peakInUseBytes_ = std::max(peakInUseBytes_, inUseBytes_);
+        }
+    }
+    CHECK_RETURN_RET(slab.buffer != nullptr, slab);
+    slab.buffer = AllocateBuffer(isPooled ? GetClassCapacity(classIndex) : size);
+    slab.classIndex = isPooled ? classIndex : SLAB_CLASS_COUNT;
+    if (isPooled && slab.buffer == nullptr) {
+        std::lock_guard<std::mutex> lock(arenaMutex_);
+        slabBytes_ -= GetClassCapacity(classIndex);
+        inUseBytes_ -= GetClassCapacity(classIndex);
+    }
+    return slab;
+}
+
+void EncodedFrameArena::RecycleSlab(Slab slab)
+{
+    CHECK_RETURN(slab.buffer == nullptr || slab.classIndex >= SLAB_CLASS_COUNT);
+    CHECK_EXECUTE(slab.buffer->memory_ != nullptr, FrameRecord::UntrackAddr(slab.buffer->memory_->GetAddr()));
+    std::lock_guard<std::mutex> lock(arenaMutex_);
+    inUseBytes_ -= GetClassCapacity(slab.classIndex);
+    if (idleSlabs_[slab.classIndex].size() < MAX_IDLE_PER_CLASS) {
+        idleSlabs_[slab.classIndex].push_back(std::move(slab));
+        return;
+    }
+    slabBytes_ -= GetClassCapacity(slab.classIndex);
+}
+
+void EncodedFrameArena::Trim()
+{
+    std::lock_guard<std::mutex> lock(arenaMutex_);
+    for (size_t classIndex = 0; classIndex < SLAB_CLASS_COUNT; classIndex++) {
+        slabBytes_ -= static_cast<int64_t>(idleSlabs_[classIndex].size()) * GetClassCapacity(classIndex);
+        idleSlabs_[classIndex].clear();
+    }
+}
+
+std::string EncodedFrameArena::Dump()
+{
+    std::lock_guard<std::mutex> lock(arenaMutex_);
+    return "EncodedFrameArena hit:" + std::to_string(hitCount_) + " miss:" + std::to_string(missCount_) +
+           " overflow:" + std::to_string(overflowCount_) + " slabBytes:" + std::to_string(slabBytes_) +
+           " inUseBytes:" + std::to_string(inUseBytes_) + " peakInUseBytes:" + std::to_string(peakInUseBytes_);
+}
+
+std::shared_ptr<Media::AVBuffer> EncodedFrameArena::AllocateBuffer(int32_t capacity)
+{
+    auto allocator = Media::AVAllocatorFactory::CreateSharedAllocator(Media::MemoryFlag::MEMORY_READ_WRITE);
+    CHECK_RETURN_RET_ELOG(allocator == nullptr, nullptr, "create allocator failed");
+    return Media::AVBuffer::CreateAVBuffer(allocator, capacity);
+}
+} // CameraStandard
+} // OHOS
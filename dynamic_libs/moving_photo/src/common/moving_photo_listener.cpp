@@ -97,7 +97,7 @@ void SessionDrainImageCallback::OnDrainImageFinish(bool isFinished)
 
 // LCOV_EXCL_START
 MovingPhotoListener::MovingPhotoListener(sptr<MovingPhotoSurfaceWrapper> surfaceWrapper, wptr<Surface> metaSurface,
-    shared_ptr<FixedSizeList<MetaElementType>> metaCache, uint32_t preCacheFrameCount, uint32_t postCacheFrameCount,
+    shared_ptr<MetaCacheType> metaCache, uint32_t preCacheFrameCount, uint32_t postCacheFrameCount,
     VideoType listenerType)
     : movingPhotoSurfaceWrapper_(surfaceWrapper),
       listenerXtStyleType_(listenerType),
@@ -113,7 +113,7 @@ MovingPhotoListener::~MovingPhotoListener()
 {
     recorderBufferQueue_.SetActive(false);
     if (metaCache_) {
-        metaCache_->clear();
+        metaCache_->Clear();
     }
     recorderBufferQueue_.Clear();
     MEDIA_INFO_LOG("MovingPhotoListener dtor completed");
@@ -182,11 +182,10 @@ void MovingPhotoListener::OnBufferArrival(sptr<SurfaceBuffer> buffer, int64_t ti
     }
     frameRecord->SetManual();
     recorderBufferQueue_.Push(frameRecord);
-    auto metaPair =
-        metaCache_->find_if([timestamp](const MetaElementType &value) { return value.first == timestamp; });
-    if (metaPair.has_value()) {
+    auto metaBuffer = metaCache_->Take(timestamp);
+    if (metaBuffer.has_value()) {
         MEDIA_DEBUG_LOG("frame has meta");
-        frameRecord->SetMetaBuffer(metaPair.value().second);
+        frameRecord->SetMetaBuffer(metaBuffer.value());
     }
     FrameTimestampInfo currentFrameInfo(buffer->GetSeqNum(), timestamp);
     CheckFrameTimestampJump(prevFrameInfo_, currentFrameInfo);
@@ -336,11 +335,11 @@ void MovingPhotoMetaListener::OnBufferAvailable()
     auto videoListener = videoListener_.promote();
     bool isNeedAddMetaCache = true;
     CHECK_EXECUTE(videoListener, isNeedAddMetaCache = !videoListener->RefillMeta(buffer, timestamp));
-    CHECK_EXECUTE(isNeedAddMetaCache, metaCache_->add({timestamp, buffer}));
+    CHECK_EXECUTE(isNeedAddMetaCache, metaCache_->Add(timestamp, buffer));
 }
 
 MovingPhotoMetaListener::MovingPhotoMetaListener(wptr<Surface> surface,
-    shared_ptr<FixedSizeList<MetaElementType>> metaCache, wptr<MovingPhotoListener> videoListener)
+    shared_ptr<MetaCacheType> metaCache, wptr<MovingPhotoListener> videoListener)
     : surface_(surface), metaCache_(metaCache), videoListener_(videoListener)
 {
 }
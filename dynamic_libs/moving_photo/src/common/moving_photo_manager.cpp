@@ -22,6 +22,11 @@
 #include "moving_photo_adapter.h"
 
 namespace OHOS::CameraStandard {
+namespace {
+constexpr size_t META_CACHE_SIZE = 8;
+// Meta may be stamped a few microseconds off the video PTS, far below any frame interval.
+constexpr int64_t META_TIMESTAMP_TOLERANCE = 100000;
+}
 
 void MovingPhotoResource::SetXtStyleType(VideoType type)
 {
@@ -308,7 +313,7 @@ void MovingPhotoManager::ExpandMovingPhoto(VideoType videoType, int32_t width, i
     CHECK_RETURN_ELOG(surfaceWrapper == nullptr,
         "HStreamOperator::ExpandMovingPhotoRepeatStream CreateMovingPhotoSurfaceWrapper fail.");
     CHECK_RETURN_ELOG(metaSurface == nullptr, "metaSurface is nullptr");
-    auto metaCache = make_shared<FixedSizeList<pair<int64_t, sptr<SurfaceBuffer>>>>(8);
+    auto metaCache = make_shared<MetaCacheType>(META_CACHE_SIZE, META_TIMESTAMP_TOLERANCE);
     streamStruct.livephotoListener_ = new (std::nothrow) MovingPhotoListener(surfaceWrapper,
         metaSurface, metaCache, preCacheFrameCount_, postCacheFrameCount_, videoType);
     CHECK_RETURN_ELOG(streamStruct.livephotoListener_ == nullptr, "failed to new livephotoListener_!");
@@ -15,7 +15,6 @@
 #include "moving_photo_adapter.h"
 #include "frame_record.h"
 #include "camera_log.h"
-#include "fixed_size_list.h"
 #include "audio_capturer_session.h"
 #include "avcodec_task_manager.h"
 #include "moving_photo_video_cache.h"
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ability/camera_ability_index.h"
+
+#include "ability/camera_ability_parse_util.h"
+#include "camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr uint32_t ZOOM_CAP_STEP = 3;
+constexpr uint32_t ZOOM_CAP_MIN_OFFSET = 1;
+constexpr uint32_t ZOOM_CAP_MAX_OFFSET = 2;
+constexpr float ZOOM_CAP_FACTOR = 100.0;
+} // namespace
+
+CameraAbilityIndex::CameraAbilityIndex(
+    const std::shared_ptr<OHOS::Camera::CameraMetadata>& ability, int32_t sceneMode, int32_t featuredMode)
+    : ability_(ability), sceneMode_(sceneMode), featuredMode_(featuredMode)
+{
+    CHECK_RETURN_ELOG(ability_ == nullptr || ability_->get() == nullptr, "CameraAbilityIndex ability is null");
+    common_metadata_header_t* metadata = ability_->get();
+    ParseZoomRatioRange(metadata);
+    ParseRAWZoomRatioRange(metadata);
+    ParseModes(metadata);
+    MEDIA_DEBUG_LOG("CameraAbilityIndex mode: %{public}d, featuredMode: %{public}d, focus: %{public}zu, "
+        "flash: %{public}zu, exposure: %{public}zu", sceneMode_, featuredMode_, focusModes_.size(),
+        flashModes_.size(), exposureModes_.size());
+}
+
+bool CameraAbilityIndex::IsMatched(
+    const std::shared_ptr<OHOS::Camera::CameraMetadata>& ability, int32_t sceneMode, int32_t featuredMode) const
+{
+    return ability_ == ability && sceneMode_ == sceneMode && featuredMode_ == featuredMode;
+}
+
+void CameraAbilityIndex::ParseZoomRatioRange(common_metadata_header_t* metadata)
+{
+    camera_metadata_item_t item;
+    int ret = Camera::FindCameraMetadataItem(metadata, OHOS_ABILITY_SCENE_ZOOM_CAP, &item);
+    CHECK_RETURN(ret != CAM_META_SUCCESS || item.count == 0);
+    float minZoom = 0.0;
+    float maxZoom = 0.0;
+    for (uint32_t i = 0; i + ZOOM_CAP_MAX_OFFSET < item.count; i += ZOOM_CAP_STEP) {
+        CHECK_CONTINUE(item.data.i32[i] != featuredMode_);
+        minZoom = item.data.i32[i + ZOOM_CAP_MIN_OFFSET] / ZOOM_CAP_FACTOR;
+        maxZoom = item.data.i32[i + ZOOM_CAP_MAX_OFFSET] / ZOOM_CAP_FACTOR;
+        break;
+    }
+    zoomRatioRange_ = { minZoom, maxZoom };
+}
+
+void CameraAbilityIndex::ParseRAWZoomRatioRange(common_metadata_header_t* metadata)
+{
+    camera_metadata_item_t item;
+    int ret = Camera::FindCameraMetadataItem(metadata, OHOS_ABILITY_RAW_CAPTURE_SCENE_ZOOM_CAP, &item);
+    CHECK_RETURN(ret != CAM_META_SUCCESS || item.count == 0);
+    float minZoom = 0.0;
+    float maxZoom = 0.0;
+    for (uint32_t i = 0; i + ZOOM_CAP_MAX_OFFSET < item.count; i += ZOOM_CAP_STEP) {
+        CHECK_CONTINUE(static_cast<int32_t>(item.data.f[i]) != sceneMode_);
+        minZoom = item.data.f[i + ZOOM_CAP_MIN_OFFSET];
+        maxZoom = item.data.f[i + ZOOM_CAP_MAX_OFFSET];
+        break;
+    }
+    rawZoomRatioRange_ = { minZoom, maxZoom };
+}
+
+void CameraAbilityIndex::ParseModes(common_metadata_header_t* metadata)
+{
+    camera_metadata_item_t item;
+    int ret = Camera::FindCameraMetadataItem(metadata, OHOS_ABILITY_FOCUS_MODES, &item);
+    CHECK_EXECUTE(ret == CAM_META_SUCCESS, g_transformValidData(item, g_metaFocusModeMap_, focusModes_));
+    ret = Camera::FindCameraMetadataItem(metadata, OHOS_ABILITY_FLASH_MODES, &item);
+    CHECK_EXECUTE(ret == CAM_META_SUCCESS, g_transformValidData(item, g_metaFlashModeMap_, flashModes_));
+    ret = Camera::FindCameraMetadataItem(metadata, OHOS_ABILITY_EXPOSURE_MODES, &item);
+    CHECK_EXECUTE(ret == CAM_META_SUCCESS, g_transformValidData(item, g_metaExposureModeMap_, exposureModes_));
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -40,6 +40,7 @@ int32_t DeferredPhotoProcessingSessionCallback::OnProcessImageDone(const std::st
         if (addr == MAP_FAILED) {
             MEDIA_ERR_LOG("DeferredPhotoProcessingSessionCallback::OnProcessImageDone() mmap failed");
             deferredPhotoProcSession_->GetCallback()->OnError(imageId, DpsErrorCode::ERROR_IMAGE_PROC_FAILED);
+            deferredPhotoProcSession_->ReleaseImageBuffer(imageId);
             return 0;
         } else {
             deferredPhotoProcSession_->GetCallback()->OnProcessImageDone(imageId, static_cast<uint8_t*>(addr), bytes,
@@ -49,6 +50,7 @@ int32_t DeferredPhotoProcessingSessionCallback::OnProcessImageDone(const std::st
         MEDIA_INFO_LOG("DeferredPhotoProcessingSessionCallback::OnProcessImageDone not set!, Discarding callback");
     }
     munmap(addr, bytes);
+    CHECK_EXECUTE(deferredPhotoProcSession_ != nullptr, deferredPhotoProcSession_->ReleaseImageBuffer(imageId));
     return 0;
     // LCOV_EXCL_STOP
 }
@@ -169,6 +171,7 @@ int32_t DeferredPhotoProcessingSessionCallback::OnProcessImageDone(const std::st
     for (auto& img : newImageFds) {
         munmap(img.addr, img.bytes);
     }
+    deferredPhotoProcSession_->ReleaseImageBuffer(imageId);
     return 0;
     // LCOV_EXCL_STOP
 }
@@ -378,6 +381,15 @@ void DeferredPhotoProcSession::NotifyProcessImage()
     // LCOV_EXCL_STOP
 }
 
+void DeferredPhotoProcSession::ReleaseImageBuffer(const std::string& imageId)
+{
+    // LCOV_EXCL_START
+    CHECK_RETURN_ELOG(remoteSession_ == nullptr,
+        "DeferredPhotoProcSession::ReleaseImageBuffer failed due to binder died.");
+    remoteSession_->ReleaseImageBuffer(imageId);
+    // LCOV_EXCL_STOP
+}
+
 int32_t DeferredPhotoProcSession::SetDeferredPhotoSession(
     sptr<DeferredProcessing::IDeferredPhotoProcessingSession>& session)
 {
@@ -15,10 +15,12 @@
 
 #include "input/camera_manager.h"
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <nlohmann/json.hpp>
@@ -1289,6 +1291,7 @@ void CameraManager::CameraServerDied(pid_t pid)
     MEDIA_ERR_LOG("camera server has died, pid:%{public}d!", pid);
     RemoveServiceProxyDeathRecipient();
     SetServiceProxy(nullptr);
+    ResetCameraAbilityCache();
     auto cameraDeviceList = GetCameraDeviceList();
     // LCOV_EXCL_START
     for (size_t i = 0; i < cameraDeviceList.size(); i++) {
@@ -1767,17 +1770,17 @@ std::vector<sptr<CameraDevice>> CameraManager::GetCameraDeviceListFromServer()
     CHECK_RETURN_RET_ELOG(
         serviceProxy == nullptr, {}, "CameraManager::InitCameraList serviceProxy is null, returning empty list!");
     std::vector<std::string> cameraIds;
+    std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>> cameraAbilityList;
     std::vector<sptr<CameraDevice>> deviceInfoList = {};
-    int32_t retCode = serviceProxy->GetCameraIds(cameraIds);
+    int32_t retCode = GetCameraAbilitiesFromServer(serviceProxy, cameraIds, cameraAbilityList);
     if (retCode == CAMERA_OK) {
         auto dmDeviceInfoList = GetDmDeviceInfo();
-        for (auto& cameraId : cameraIds) {
+        for (size_t i = 0; i < cameraIds.size() && i < cameraAbilityList.size(); i++) {
+            auto& cameraId = cameraIds[i];
+            auto& cameraAbility = cameraAbilityList[i];
             MEDIA_DEBUG_LOG("InitCameraList cameraId= %{public}s", cameraId.c_str());
-            std::shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility;
-            retCode = serviceProxy->GetCameraAbility(cameraId, cameraAbility);
             CHECK_CONTINUE_ELOG(
                 cameraAbility == nullptr, "GetCameraDeviceListFromServer GetDeviceMetadata failed");
-            CHECK_CONTINUE(retCode != CAMERA_OK);
             auto dmDeviceInfo = GetDmDeviceInfo(cameraId, dmDeviceInfoList);
             sptr<CameraDevice> cameraObj = new (std::nothrow) CameraDevice(cameraId, dmDeviceInfo, cameraAbility);
             CHECK_CONTINUE_ELOG(cameraObj == nullptr, "failed to new CameraDevice!");
@@ -1806,6 +1809,57 @@ std::vector<sptr<CameraDevice>> CameraManager::GetCameraDeviceListFromServer()
     return deviceInfoList;
 }
 
+int32_t CameraManager::GetCameraAbilitiesFromServer(const sptr<ICameraService>& serviceProxy,
+    std::vector<std::string>& cameraIds,
+    std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>>& cameraAbilityList)
+{
+    std::lock_guard<std::mutex> lock(cameraAbilityCacheMutex_);
+    uint64_t generation = 0;
+    std::vector<std::string> changedCameraIds;
+    std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>> changedAbilityList;
+    int32_t retCode = serviceProxy->GetCamerasSince(
+        cameraAbilityGeneration_, generation, cameraIds, changedCameraIds, changedAbilityList);
+    CHECK_RETURN_RET_ELOG(retCode != CAMERA_OK, retCode, "GetCameraAbilitiesFromServer failed, ret: %{public}d",
+        retCode);
+    // An unchanged reply carries no camera, whatever came back is applied even when the generation matches.
+    // Generation 0 is never current, the service sends it when the abilities must not be cached.
+    if (generation != 0 && generation == cameraAbilityGeneration_ && cameraIds.empty()) {
+        MEDIA_DEBUG_LOG("GetCameraAbilitiesFromServer cameras unchanged");
+        cameraIds = cachedCameraIds_;
+    } else {
+        for (size_t i = 0; i < changedCameraIds.size() && i < changedAbilityList.size(); i++) {
+            cameraAbilityCache_[changedCameraIds[i]] = changedAbilityList[i];
+        }
+        for (auto it = cameraAbilityCache_.begin(); it != cameraAbilityCache_.end();) {
+            bool isRemoved = std::find(cameraIds.begin(), cameraIds.end(), it->first) == cameraIds.end();
+            it = isRemoved ? cameraAbilityCache_.erase(it) : std::next(it);
+        }
+    }
+    bool isComplete = true;
+    cameraAbilityList.clear();
+    for (auto& cameraId : cameraIds) {
+        auto& cameraAbility = cameraAbilityCache_[cameraId];
+        if (cameraAbility == nullptr) {
+            // Listed again after another camera left, the service only resends abilities that changed.
+            retCode = serviceProxy->GetCameraAbility(cameraId, cameraAbility);
+            isComplete = isComplete && retCode == CAMERA_OK && cameraAbility != nullptr;
+        }
+        cameraAbilityList.emplace_back(cameraAbility);
+    }
+    cachedCameraIds_ = cameraIds;
+    // Asks for every camera again next time if one could not be fetched.
+    cameraAbilityGeneration_ = isComplete ? generation : 0;
+    return CAMERA_OK;
+}
+
+void CameraManager::ResetCameraAbilityCache()
+{
+    std::lock_guard<std::mutex> lock(cameraAbilityCacheMutex_);
+    cameraAbilityGeneration_ = 0;
+    cachedCameraIds_.clear();
+    cameraAbilityCache_.clear();
+}
+
 bool CameraManager::GetIsFoldable()
 {
     return !foldScreenType_.empty();
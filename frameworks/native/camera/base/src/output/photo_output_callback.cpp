@@ -93,7 +93,8 @@ int32_t HStreamCapturePhotoCallbackImpl::OnPhotoAvailable(
         callback == nullptr, CAMERA_OK, "HStreamCapturePhotoCallbackImpl::OnPhotoAvailable callback is nullptr");
     CHECK_RETURN_RET_ELOG(surfaceBuffer == nullptr, CAMERA_OK,
         "HStreamCapturePhotoCallbackImpl::OnPhotoAvailable surfaceBuffer is nullptr");
-    std::shared_ptr<CameraBufferProcessor> bufferProcessor;
+    auto bufferProcessor =
+        std::make_shared<PhotoBufferReleaseProcessor>(CastStream<IStreamCapture>(photoOutput->GetStream()));
     std::shared_ptr<Media::NativeImage> image =
         std::make_shared<Media::NativeImage>(surfaceBuffer, bufferProcessor, timestamp);
     callback->OnPhotoAvailable(image, isRaw);
@@ -101,6 +102,16 @@ int32_t HStreamCapturePhotoCallbackImpl::OnPhotoAvailable(
     return CAMERA_OK;
 }
 
+void PhotoBufferReleaseProcessor::BufferRelease(sptr<SurfaceBuffer>& buffer)
+{
+    auto streamCapture = streamCapture_.promote();
+    CHECK_RETURN(streamCapture == nullptr || buffer == nullptr || buffer->GetExtraData() == nullptr);
+    // Only the buffers the service tracks carry a pool sequence.
+    int32_t sequence = 0;
+    CHECK_RETURN(buffer->GetExtraData()->ExtraGet(SURFACE_BUFFER_POOL_SEQUENCE_KEY, sequence) != GSERROR_OK);
+    streamCapture->ReleasePhotoBuffer(sequence);
+}
+
 #ifdef CAMERA_CAPTURE_YUV
 int32_t HStreamCapturePhotoCallbackImpl::OnPhotoAvailable(std::shared_ptr<PictureIntf> pictureProxy)
 {
@@ -428,6 +428,7 @@ CaptureSession::CaptureSession(sptr<ICaptureSession>& captureSession) : innerCap
 {
     compositionFeature_ = std::make_shared<CompositionFeature>(this);
     metadataResultProcessor_ = std::make_shared<CaptureSessionMetadataResultProcessor>(this);
+    RegisterResultRoutes();
     cameraDfxReportHelper_ = std::make_shared<CameraDfxReportHelper>(this);
     sptr<IRemoteObject> object = innerCaptureSession_->AsObject();
     pid_t pid = 0;
@@ -483,6 +484,7 @@ int32_t CaptureSession::BeginConfig()
 
     isColorSpaceSetted_ = false;
     pendingDisableMacroOnCommit_ = false;
+    shadowState_.Invalidate();
     int32_t errCode = CAMERA_UNKNOWN_ERROR;
     auto captureSession = GetCaptureSession();
     if (captureSession) {
@@ -550,6 +552,8 @@ int32_t CaptureSession::CommitConfig()
     SetZoomRatioForAudio(DEFAULT_ZOOM_RATIO);
     CHECK_EXECUTE (cameraDfxReportHelper_ != nullptr, cameraDfxReportHelper_->ReportCameraConfigInfo(errCode));
     CHECK_EXECUTE(errCode == CAMERA_OK, CheckAndEnableMacro());
+    // Parse the capabilities of the committed mode now rather than on the first zoom step.
+    CHECK_EXECUTE(errCode == CAMERA_OK, GetAbilityIndex());
     return ServiceToCameraError(errCode);
 }
 
@@ -1233,19 +1237,26 @@ int32_t CaptureSession::ConfigureOutput(sptr<CaptureOutput>& output)
 
 void CaptureSession::InsertOutputIntoSet(sptr<CaptureOutput>& output)
 {
-    std::lock_guard<std::mutex> lock(captureOutputSetsMutex_);
-    auto it = captureOutputSets_.begin();
-    while (it != captureOutputSets_.end()) {
-        if (*it == nullptr) {
-            it = captureOutputSets_.erase(it);
-        } else if (*it == output) {
-            break;
-        } else {
-            ++it;
+    {
+        std::lock_guard<std::mutex> lock(captureOutputSetsMutex_);
+        auto it = captureOutputSets_.begin();
+        while (it != captureOutputSets_.end()) {
+            if (*it == nullptr) {
+                it = captureOutputSets_.erase(it);
+            } else if (*it == output) {
+                break;
+            } else {
+                ++it;
+            }
         }
+        CHECK_RETURN(it != captureOutputSets_.end());
+        captureOutputSets_.insert(output);
     }
-    CHECK_RETURN(it != captureOutputSets_.end());
-    captureOutputSets_.insert(output);
+    const auto& observerTags = output->GetObserverResultTags();
+    CHECK_RETURN(observerTags.empty());
+    resultDispatcher_.AddRouteTags(
+        outputResultRouteId_, std::vector<uint32_t>(observerTags.begin(), observerTags.end()));
+    isOutputResultObserved_ = true;
 }
 
 int32_t CaptureSession::AddOutput(sptr<CaptureOutput>& output)
@@ -1306,7 +1317,7 @@ int32_t CaptureSession::AddOutputInner(sptr<ICaptureSession>& captureSession, sp
         int32_t errCode = CAMERA_UNKNOWN_ERROR;
         CHECK_EXECUTE(output->GetStream() != nullptr,
             errCode = captureSession->AddOutput(output->GetStreamType(), output->GetStream()->AsObject()));
-        CHECK_EXECUTE(output->GetOutputType() == CAPTURE_OUTPUT_TYPE_PHOTO, photoOutput_ = output);
+        CHECK_EXECUTE(output->GetOutputType() == CAPTURE_OUTPUT_TYPE_PHOTO, SetPhotoOutput(output));
         MEDIA_INFO_LOG("CaptureSession::AddOutputInner StreamType = %{public}d", output->GetStreamType());
         CHECK_RETURN_RET_ELOG(
             errCode != CAMERA_OK, ServiceToCameraErrorV2(errCode), "Failed to AddOutput!, %{public}d", errCode);
@@ -1710,6 +1721,7 @@ int32_t CaptureSession::Release()
     }
     SetInputDevice(nullptr);
     SessionRemoveDeathRecipient();
+    shadowState_.Invalidate();
     std::lock_guard<std::mutex> lock(sessionCallbackMutex_);
     captureSessionCallback_ = nullptr;
     pressureStatusCallback_ = nullptr;
@@ -2339,13 +2351,32 @@ int32_t CaptureSession::GetCurrentOISMode(OISMode &oisMode)
         "GetCurrentOISMode camera metadata is null");
     camera_metadata_item_t item;
     int ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_CONTROL_OPTICAL_IMAGE_STABILIZATION_MODE, &item);
-    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS, CameraErrorCode::SUCCESS,
-        "GetCurrentOISMode with default value");
+    if (ret != CAM_META_SUCCESS) {
+        oisMode = GetReportedOISMode();
+        MEDIA_DEBUG_LOG("GetCurrentOISMode no mode requested, reported mode %{public}d", oisMode);
+        return CameraErrorCode::SUCCESS;
+    }
     oisMode_ = static_cast<OISMode>(item.data.i32[0]);
     oisMode = oisMode_;
     return CameraErrorCode::SUCCESS;
 }
 
+OISMode CaptureSession::GetReportedOISMode()
+{
+    int32_t reportedMode = static_cast<int32_t>(oisMode_);
+    if (!shadowState_.Load(ShadowField::OIS_MODE, reportedMode)) {
+        // The results are not followed while nobody reads them, oisMode_ may be old, so the service is asked.
+        std::shared_ptr<OHOS::Camera::CameraMetadata> metaOut = nullptr;
+        camera_metadata_item_t item;
+        CHECK_RETURN_RET(!QueryDeviceStatus(OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE, &reportedMode, metaOut,
+            item), oisMode_);
+        reportedMode = item.data.i32[0];
+        shadowState_.Store(ShadowField::OIS_MODE, reportedMode, 0);
+    }
+    oisMode_ = static_cast<OISMode>(reportedMode);
+    return oisMode_;
+}
+
 int32_t CaptureSession::SetOISMode(OISMode oisMode)
 {
     MEDIA_INFO_LOG("Enter SetOISMode mode:%{public}d", oisMode);
@@ -2616,17 +2647,10 @@ int32_t CaptureSession::GetSupportedExposureModes(std::vector<ExposureMode>& sup
         }
         return CameraErrorCode::SUCCESS;
     }
-    std::shared_ptr<Camera::CameraMetadata> metadata = GetMetadata();
+    auto abilityIndex = GetAbilityIndex();
     CHECK_RETURN_RET_ELOG(
-        metadata == nullptr, CameraErrorCode::SUCCESS, "GetSupportedExposureModes camera metadata is null");
-    camera_metadata_item_t item;
-    int ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_ABILITY_EXPOSURE_MODES, &item);
-    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS, CameraErrorCode::SUCCESS,
-        "CaptureSession::GetExposureMode Failed with return code %{public}d", ret);
-    for (uint32_t i = 0; i < item.count; i++) {
-        auto itr = g_metaExposureModeMap_.find(static_cast<camera_exposure_mode_enum_t>(item.data.u8[i]));
-        CHECK_EXECUTE(itr != g_metaExposureModeMap_.end(), supportedExposureModes.emplace_back(itr->second));
-    }
+        abilityIndex == nullptr, CameraErrorCode::SUCCESS, "GetSupportedExposureModes ability index is null");
+    supportedExposureModes = abilityIndex->GetSupportedExposureModes();
     return CameraErrorCode::SUCCESS;
 }
 
@@ -2731,12 +2755,23 @@ int32_t CaptureSession::SetZoomCenterPoint(Point zoomCenterPoint)
 }
 
 int32_t CaptureSession::GetZoomCenterPoint(Point& zoomCenterPoint)
+{
+    return GetZoomCenterPoint(zoomCenterPoint, false);
+}
+
+int32_t CaptureSession::GetZoomCenterPoint(Point& zoomCenterPoint, bool isForceRefresh)
 {
     float DEFAULT_ZOOM_CENTER_POINT = 0.5;
     zoomCenterPoint.x = DEFAULT_ZOOM_CENTER_POINT;
     zoomCenterPoint.y = DEFAULT_ZOOM_CENTER_POINT;
     CHECK_RETURN_RET_ELOG(!IsSessionCommited(), CameraErrorCode::SESSION_NOT_CONFIG,
         "CaptureSession::GetZoomCenterPoint Session is not Commited");
+    std::array<float, 2> shadowCenterPoint = {};
+    if (!isForceRefresh && shadowState_.Load(ShadowField::ZOOM_CENTER_POINT, shadowCenterPoint)) {
+        zoomCenterPoint.x = shadowCenterPoint[0];
+        zoomCenterPoint.y = shadowCenterPoint[1];
+        return CameraErrorCode::SUCCESS;
+    }
     auto inputDevice = GetInputDevice();
     CHECK_RETURN_RET_ELOG(!inputDevice || !inputDevice->GetCameraDeviceInfo(), CameraErrorCode::SUCCESS,
         "CaptureSession::GetZoomCenterPoint camera device is null");
@@ -2761,6 +2796,7 @@ int32_t CaptureSession::GetZoomCenterPoint(Point& zoomCenterPoint)
         CameraErrorCode::SUCCESS, "CaptureSession::GetZoomCenterPoint Failed with return code %{public}d", ret);
     zoomCenterPoint.x = item.data.f[0];
     zoomCenterPoint.y = item.data.f[1];
+    shadowState_.Store(ShadowField::ZOOM_CENTER_POINT, std::array<float, 2> { item.data.f[0], item.data.f[1] }, 0);
     MEDIA_DEBUG_LOG("CaptureSession::GetZoomCenterPoint is called x:%{public}f, y:%{public}f",
         zoomCenterPoint.x, zoomCenterPoint.y);
     return CameraErrorCode::SUCCESS;
@@ -3002,17 +3038,10 @@ int32_t CaptureSession::GetSupportedFocusModes(std::vector<FocusMode>& supported
         }
         return CameraErrorCode::SUCCESS;
     }
-    std::shared_ptr<Camera::CameraMetadata> metadata = GetMetadata();
+    auto abilityIndex = GetAbilityIndex();
     CHECK_RETURN_RET_ELOG(
-        metadata == nullptr, CameraErrorCode::SUCCESS, "GetSupportedFocusModes camera metadata is null");
-    camera_metadata_item_t item;
-    int ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_ABILITY_FOCUS_MODES, &item);
-    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS, CameraErrorCode::SUCCESS,
-        "CaptureSession::GetSupportedFocusModes Failed with return code %{public}d", ret);
-    for (uint32_t i = 0; i < item.count; i++) {
-        auto itr = g_metaFocusModeMap_.find(static_cast<camera_focus_mode_enum_t>(item.data.u8[i]));
-        CHECK_EXECUTE(itr != g_metaFocusModeMap_.end(), supportedFocusModes.emplace_back(itr->second));
-    }
+        abilityIndex == nullptr, CameraErrorCode::SUCCESS, "GetSupportedFocusModes ability index is null");
+    supportedFocusModes = abilityIndex->GetSupportedFocusModes();
     return CameraErrorCode::SUCCESS;
 }
 
@@ -3355,14 +3384,15 @@ void CaptureSession::ProcessSnapshotDurationUpdates(const uint64_t timestamp,
     const std::shared_ptr<OHOS::Camera::CameraMetadata> &result)
 {
     MEDIA_DEBUG_LOG("Entry ProcessSnapShotDurationUpdates");
-    CHECK_RETURN(photoOutput_ == nullptr);
+    auto photoOutput = GetPhotoOutput();
+    CHECK_RETURN(photoOutput == nullptr);
     camera_metadata_item_t metadataItem;
     common_metadata_header_t* metadata = result->get();
     int ret = Camera::FindCameraMetadataItem(metadata, OHOS_CAMERA_CUSTOM_SNAPSHOT_DURATION, &metadataItem);
     CHECK_RETURN(ret != CAM_META_SUCCESS || metadataItem.count <= 0);
     const int32_t duration = static_cast<int32_t>(metadataItem.data.ui32[0]);
     if (duration != prevDuration_.load()) {
-        ((sptr<PhotoOutput>&)photoOutput_)->ProcessSnapshotDurationUpdates(duration);
+        ((sptr<PhotoOutput>&)photoOutput)->ProcessSnapshotDurationUpdates(duration);
     }
         prevDuration_ = duration;
 }
@@ -3487,26 +3517,165 @@ void CaptureSession::CaptureSessionMetadataResultProcessor::ProcessCallbacks(
     auto session = session_.promote();
     CHECK_RETURN_ELOG(session == nullptr,
         "CaptureSession::CaptureSessionMetadataResultProcessor ProcessCallbacks but session is null");
-    session->OnResultReceived(result);
-    session->ProcessAutoFocusUpdates(result);
-    session->ProcessMacroStatusChange(result);
-    session->ProcessMoonCaptureBoostStatusChange(result);
-    session->ProcessLowLightBoostStatusChange(result);
-    session->ProcessSmoothZoomDurationChange(result);
-    session->ProcessSnapshotDurationUpdates(timestamp, result);
-    session->ProcessAREngineUpdates(timestamp, result);
-    session->ProcessEffectSuggestionTypeUpdates(result);
-    session->ProcessLcdFlashStatusUpdates(result);
-    session->ProcessTripodStatusChange(result);
-    session->ProcessCompositionPositionCalibration(result);
-    session->ProcessCompositionBegin(result);
-    session->ProcessCompositionEnd(result);
-    session->ProcessCompositionPositionMatch(result);
-    session->ProcessSensorExposureTimeChange(result);
-    session->ProcessFlashStateChange(result);
-    session->ProcessIsoChange(result);
-    session->ProcessOISModeChange(result);
-    session->ProcessApertureChange(result);
+    session->resultDispatcher_.Dispatch(timestamp, result);
+}
+
+uintptr_t CaptureSession::GetShadowStateKey()
+{
+    return shadowState_.IsInUse() ? reinterpret_cast<uintptr_t>(&shadowState_) : 0;
+}
+
+bool CaptureSession::QueryDeviceStatus(uint32_t tag, const void* queryValue,
+    std::shared_ptr<OHOS::Camera::CameraMetadata>& metaOut, camera_metadata_item_t& item)
+{
+    auto inputDevice = GetInputDevice();
+    CHECK_RETURN_RET_ELOG(!inputDevice, false, "CaptureSession::QueryDeviceStatus camera device is null");
+    auto cameraDeviceObj = ((sptr<CameraInput>&)inputDevice)->GetCameraDevice();
+    CHECK_RETURN_RET_ELOG(!cameraDeviceObj, false, "CaptureSession::QueryDeviceStatus cameraDeviceObj is nullptr");
+    int32_t DEFAULT_ITEMS = 1;
+    int32_t DEFAULT_DATA_LENGTH = 100;
+    std::shared_ptr<OHOS::Camera::CameraMetadata> metaIn =
+        std::make_shared<OHOS::Camera::CameraMetadata>(DEFAULT_ITEMS, DEFAULT_DATA_LENGTH);
+    metaOut = std::make_shared<OHOS::Camera::CameraMetadata>(DEFAULT_ITEMS, DEFAULT_DATA_LENGTH);
+    metaIn->addEntry(tag, queryValue, 1);
+    int32_t ret = cameraDeviceObj->GetStatus(metaIn, metaOut);
+    CHECK_RETURN_RET_ELOG(ret != CAMERA_OK || metaOut == nullptr, false,
+        "CaptureSession::QueryDeviceStatus tag %{public}u failed, errCode = %{public}d", tag, ret);
+    ret = Camera::FindCameraMetadataItem(metaOut->get(), tag, &item);
+    return ret == CAM_META_SUCCESS && item.count > 0;
+}
+
+void CaptureSession::RegisterResultRoutes()
+{
+    using Trigger = SessionResultDispatcher::Trigger;
+    using Result = std::shared_ptr<OHOS::Camera::CameraMetadata>;
+    // Runs first so the listeners called below read the state of this result. It refreshes the confirm time
+    // of its values, so it wants every report, as long as the getters read them.
+    resultDispatcher_.AddRoute({ SessionShadowState::GetResultTags(), Trigger::ON_PRESENT, true,
+        [this]() { return GetShadowStateKey(); },
+        [this](const uint64_t timestamp, const Result& result) { shadowState_.OnResult(timestamp, result); } });
+    // The observer tags of the outputs are added to this route as the outputs join the session, each report
+    // is handed to the outputs as before. Without an observing output there is nothing to hand over.
+    outputResultRouteId_ = resultDispatcher_.AddRoute({ {}, Trigger::ON_PRESENT, true,
+        [this]() { return isOutputResultObserved_ ? reinterpret_cast<uintptr_t>(this) : 0; },
+        [this](const uint64_t, const Result& result) { OnResultReceived(result); } });
+    // Focus distance is session state kept for GetFocusDistance of system apps, it is tracked while read and
+    // refreshed from the service once the shadow value is stale.
+    resultDispatcher_.AddRoute({
+        { OHOS_CONTROL_FOCUS_MODE, OHOS_CONTROL_FOCUS_STATE, OHOS_CONTROL_LENS_FOCUS_DISTANCE },
+        Trigger::ON_CHANGE, true,
+        [this, isSystemApp = CameraSecurity::CheckSystemApp()]() {
+            uintptr_t listenerKey = SessionResultDispatcher::GetListenerKey(GetFocusCallback());
+            return listenerKey != 0 || !isSystemApp ? listenerKey : GetShadowStateKey();
+        },
+        [this](const uint64_t, const Result& result) { ProcessAutoFocusUpdates(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_CAMERA_MACRO_STATUS }, Trigger::ON_CHANGE, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetMacroStatusCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessMacroStatusChange(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_MOON_CAPTURE_DETECTION }, Trigger::ON_CHANGE, true,
+        [this]() {
+            auto featureStatusCallback = GetFeatureDetectionStatusCallback();
+            bool isSubscribed = featureStatusCallback != nullptr &&
+                featureStatusCallback->IsFeatureSubscribed(SceneFeature::FEATURE_MOON_CAPTURE_BOOST);
+            return SessionResultDispatcher::GetListenerKey(GetMoonCaptureBoostStatusCallback()) ^
+                (isSubscribed ? SessionResultDispatcher::GetListenerKey(featureStatusCallback) << 1 : 0);
+        },
+        [this](const uint64_t, const Result& result) { ProcessMoonCaptureBoostStatusChange(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_LOW_LIGHT_DETECTION }, Trigger::ON_CHANGE, true,
+        [this]() {
+            auto featureStatusCallback = GetFeatureDetectionStatusCallback();
+            bool isSubscribed = featureStatusCallback != nullptr &&
+                featureStatusCallback->IsFeatureSubscribed(SceneFeature::FEATURE_LOW_LIGHT_BOOST);
+            return isSubscribed ? SessionResultDispatcher::GetListenerKey(featureStatusCallback) : 0;
+        },
+        [this](const uint64_t, const Result& result) { ProcessLowLightBoostStatusChange(result); } });
+    // Every duration report starts a zoom, it is delivered even when equal to the previous one.
+    resultDispatcher_.AddRoute({ { OHOS_SMOOTH_ZOOM_DURATION }, Trigger::ON_PRESENT, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetSmoothZoomCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessSmoothZoomDurationChange(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_CAMERA_CUSTOM_SNAPSHOT_DURATION }, Trigger::ON_CHANGE, true,
+        [this]() { return reinterpret_cast<uintptr_t>(GetPhotoOutput().GetRefPtr()); },
+        [this](const uint64_t timestamp, const Result& result) {
+            ProcessSnapshotDurationUpdates(timestamp, result);
+        } });
+    RegisterFeatureResultRoutes();
+    RegisterStatusResultRoutes();
+}
+
+void CaptureSession::RegisterFeatureResultRoutes()
+{
+    using Trigger = SessionResultDispatcher::Trigger;
+    using Result = std::shared_ptr<OHOS::Camera::CameraMetadata>;
+    // AR engine reports every result to its listener, whatever tags it carries.
+    resultDispatcher_.AddRoute({ {}, Trigger::ON_PRESENT, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetARCallback()); },
+        [this](const uint64_t timestamp, const Result& result) { ProcessAREngineUpdates(timestamp, result); } });
+    resultDispatcher_.AddRoute({ { OHOS_CAMERA_EFFECT_SUGGESTION_TYPE }, Trigger::ON_CHANGE, true,
+        [this]() {
+            std::lock_guard<std::mutex> lock(sessionCallbackMutex_);
+            return SessionResultDispatcher::GetListenerKey(effectSuggestionCallback_);
+        },
+        [this](const uint64_t, const Result& result) { ProcessEffectSuggestionTypeUpdates(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_LCD_FLASH_STATUS }, Trigger::ON_CHANGE, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetLcdFlashStatusCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessLcdFlashStatusUpdates(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_TRIPOD_DETECTION_STATUS }, Trigger::ON_CHANGE, true,
+        [this]() {
+            auto featureStatusCallback = GetFeatureDetectionStatusCallback();
+            bool isSubscribed = featureStatusCallback != nullptr &&
+                featureStatusCallback->IsFeatureSubscribed(SceneFeature::FEATURE_TRIPOD_DETECTION);
+            return isSubscribed ? SessionResultDispatcher::GetListenerKey(featureStatusCallback) : 0;
+        },
+        [this](const uint64_t, const Result& result) { ProcessTripodStatusChange(result); } });
+    // Composition tags are events, each report is delivered.
+    resultDispatcher_.AddRoute({ { OHOS_COMPOSITION_POSITION_CALIBRATION }, Trigger::ON_PRESENT, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetCompositionPositionCalibrationCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessCompositionPositionCalibration(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_COMPOSITION_BEGIN }, Trigger::ON_PRESENT, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetCompositionBeginCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessCompositionBegin(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_COMPOSITION_END }, Trigger::ON_PRESENT, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetCompositionEndCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessCompositionEnd(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_COMPOSITION_MATCHED }, Trigger::ON_PRESENT, true,
+        [this]() { return SessionResultDispatcher::GetListenerKey(GetCompositionPositionMatchCallback()); },
+        [this](const uint64_t, const Result& result) { ProcessCompositionPositionMatch(result); } });
+}
+
+void CaptureSession::RegisterStatusResultRoutes()
+{
+    using Trigger = SessionResultDispatcher::Trigger;
+    using Result = std::shared_ptr<OHOS::Camera::CameraMetadata>;
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_SENSOR_EXPOSURE_TIME }, Trigger::ON_CHANGE, true,
+        [this]() {
+            std::lock_guard<std::mutex> lock(sessionCallbackMutex_);
+            return SessionResultDispatcher::GetListenerKey(exposureInfoCallback_);
+        },
+        [this](const uint64_t, const Result& result) { ProcessSensorExposureTimeChange(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_CONTROL_FLASH_STATE }, Trigger::ON_CHANGE, true,
+        [this]() {
+            std::lock_guard<std::mutex> lock(sessionCallbackMutex_);
+            return SessionResultDispatcher::GetListenerKey(flashStateCallback_);
+        },
+        [this](const uint64_t, const Result& result) { ProcessFlashStateChange(result); } });
+    // Iso value and OIS mode are session state read by the getters, they are tracked while a listener or a getter
+    // reads them. A getter finding the shadow value stale asks the service instead of serving the old mirror.
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_ISO_VALUE }, Trigger::ON_CHANGE, true,
+        [this]() {
+            std::lock_guard<std::mutex> lock(sessionCallbackMutex_);
+            uintptr_t listenerKey = SessionResultDispatcher::GetListenerKey(isoInfoSyncCallback_);
+            return listenerKey != 0 ? listenerKey : GetShadowStateKey();
+        },
+        [this](const uint64_t, const Result& result) { ProcessIsoChange(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE }, Trigger::ON_CHANGE, true,
+        [this]() { return GetShadowStateKey(); },
+        [this](const uint64_t, const Result& result) { ProcessOISModeChange(result); } });
+    resultDispatcher_.AddRoute({ { OHOS_STATUS_CAMERA_APERTURE_VALUE }, Trigger::ON_CHANGE, true,
+        [this]() {
+            std::lock_guard<std::mutex> lock(sessionCallbackMutex_);
+            return SessionResultDispatcher::GetListenerKey(apertureInfoCallback_);
+        },
+        [this](const uint64_t, const Result& result) { ProcessApertureChange(result); } });
 }
 
 std::vector<FlashMode> CaptureSession::GetSupportedFlashModes()
@@ -3550,14 +3719,10 @@ int32_t CaptureSession::GetSupportedFlashModes(std::vector<FlashMode>& supported
         }
         return CameraErrorCode::SUCCESS;
     }
-    std::shared_ptr<Camera::CameraMetadata> metadata = GetMetadata();
+    auto abilityIndex = GetAbilityIndex();
     CHECK_RETURN_RET_ELOG(
-        metadata == nullptr, CameraErrorCode::SUCCESS, "GetSupportedFlashModes camera metadata is null");
-    camera_metadata_item_t item;
-    int ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_ABILITY_FLASH_MODES, &item);
-    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS, CameraErrorCode::SUCCESS,
-        "CaptureSession::GetSupportedFlashModes Failed with return code %{public}d", ret);
-    g_transformValidData(item, g_metaFlashModeMap_, supportedFlashModes);
+        abilityIndex == nullptr, CameraErrorCode::SUCCESS, "GetSupportedFlashModes ability index is null");
+    supportedFlashModes = abilityIndex->GetSupportedFlashModes();
     return CameraErrorCode::SUCCESS;
 }
 
@@ -3775,34 +3940,17 @@ int32_t CaptureSession::GetRAWZoomRatioRange(std::vector<float>& zoomRatioRange)
     zoomRatioRange.clear();
     CHECK_RETURN_RET_ELOG(!IsSessionCommited(), CameraErrorCode::SESSION_NOT_CONFIG,
         "CaptureSession::GetRAWZoomRatioRange Session is not Commited");
-    std::shared_ptr<Camera::CameraMetadata> metadata = GetMetadata();
-    CHECK_RETURN_RET_ELOG(
-        metadata == nullptr, CameraErrorCode::OPERATION_NOT_ALLOWED, "GetZoomRatioRange camera metadata is null");
-    camera_metadata_item_t item;
-    int ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_ABILITY_RAW_CAPTURE_SCENE_ZOOM_CAP, &item);
-    CHECK_RETURN_RET_WLOG(ret != CAM_META_SUCCESS || item.count == 0, CameraErrorCode::SUCCESS,
-        "CaptureSession::GetRAWZoomRatioRange Failed with return code %{public}d,item.count = %{public}d", ret,
-        item.count);
-    float minZoom = 0.0;
-    float maxZoom = 0.0;
-    const uint32_t step = 3;
-    const uint32_t minOffset = 1;
-    const uint32_t maxOffset = 2;
+    auto abilityIndex = GetAbilityIndex();
+    CHECK_RETURN_RET_ELOG(abilityIndex == nullptr, CameraErrorCode::OPERATION_NOT_ALLOWED,
+        "GetRAWZoomRatioRange ability index is null");
+    CHECK_RETURN_RET_WLOG(abilityIndex->GetRAWZoomRatioRange().empty(), CameraErrorCode::SUCCESS,
+        "CaptureSession::GetRAWZoomRatioRange raw scene zoom cap not found");
+    zoomRatioRange = abilityIndex->GetRAWZoomRatioRange();
     const uint32_t minIndex = 0;
     const uint32_t maxIndex = 1;
-    for (uint32_t i = 0; i < item.count; i += step) {
-        CHECK_BREAK_ELOG(i + maxOffset >= item.count,
-            "CaptureSession::GetRAWZoomRatioRange: invalid data format, i + maxOffset >= item.count");
-        if (GetMode() == static_cast<int32_t>(item.data.f[i])) {
-            minZoom = item.data.f[i + minOffset];
-            maxZoom = item.data.f[i + maxOffset];
-            break;
-        }
-    }
-    CHECK_PRINT_ELOG(minZoom == 0.0 && maxZoom == 0.0,
+    CHECK_PRINT_ELOG(zoomRatioRange[minIndex] == 0.0 && zoomRatioRange[maxIndex] == 0.0,
         "CaptureSession::GetRAWZoomRatioRange: current mode %{public}d is not supported", GetMode());
-    zoomRatioRange = { minZoom, maxZoom };
-    MEDIA_INFO_LOG("CaptureSession::GetRAWZoomRatioRange:%{public}f,%{public}f", zoomRatioRange[minIndex],
+    MEDIA_DEBUG_LOG("CaptureSession::GetRAWZoomRatioRange:%{public}f,%{public}f", zoomRatioRange[minIndex],
         zoomRatioRange[maxIndex]);
     return CameraErrorCode::SUCCESS;
 }
@@ -3842,28 +3990,10 @@ int32_t CaptureSession::GetZoomRatioRange(std::vector<float>& zoomRatioRange)
         }
         return CameraErrorCode::SUCCESS;
     }
-    std::shared_ptr<Camera::CameraMetadata> metadata = GetMetadata();
-    CHECK_RETURN_RET_ELOG(metadata == nullptr, CameraErrorCode::SUCCESS, "GetZoomRatioRange camera metadata is null");
-    camera_metadata_item_t item;
-    int ret = Camera::FindCameraMetadataItem(metadata->get(), OHOS_ABILITY_SCENE_ZOOM_CAP, &item);
-    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS || item.count == 0, 0,
-        "CaptureSession::GetZoomRatio Failed with return code %{public}d,item.count = %{public}d", ret, item.count);
-    constexpr float factor = 100.0;
-    float minZoom = 0.0;
-    float maxZoom = 0.0;
-    const uint32_t step = 3;
-    uint32_t minOffset = 1;
-    uint32_t maxOffset = 2;
-    for (uint32_t i = 0; i < item.count; i += step) {
-        MEDIA_INFO_LOG("Scene zoom cap mode: %{public}d, min: %{public}d, max: %{public}d", item.data.i32[i],
-            item.data.i32[i + minOffset], item.data.i32[i + maxOffset]);
-        if (GetFeaturesMode().GetFeaturedMode() == item.data.i32[i]) {
-            minZoom = item.data.i32[i + minOffset] / factor;
-            maxZoom = item.data.i32[i + maxOffset] / factor;
-            break;
-        }
-    }
-    zoomRatioRange = {minZoom, maxZoom};
+    auto abilityIndex = GetAbilityIndex();
+    CHECK_RETURN_RET_ELOG(abilityIndex == nullptr, CameraErrorCode::SUCCESS, "GetZoomRatioRange ability index is null");
+    zoomRatioRange = abilityIndex->GetZoomRatioRange();
+    CHECK_PRINT_ELOG(zoomRatioRange.empty(), "CaptureSession::GetZoomRatioRange scene zoom cap not found");
     return CameraErrorCode::SUCCESS;
 }
 
@@ -3875,10 +4005,18 @@ float CaptureSession::GetZoomRatio()
 }
 
 int32_t CaptureSession::GetZoomRatio(float& zoomRatio)
+{
+    return GetZoomRatio(zoomRatio, false);
+}
+
+int32_t CaptureSession::GetZoomRatio(float& zoomRatio, bool isForceRefresh)
 {
     zoomRatio = 0;
     CHECK_RETURN_RET_ELOG(!IsSessionCommited(), CameraErrorCode::SESSION_NOT_CONFIG,
         "CaptureSession::GetZoomRatio Session is not Commited");
+    // The results of the running stream already carry the zoom ratio, the service is only asked when they are stale.
+    CHECK_RETURN_RET(!isForceRefresh && shadowState_.Load(ShadowField::ZOOM_RATIO, zoomRatio),
+        CameraErrorCode::SUCCESS);
     auto inputDevice = GetInputDevice();
     CHECK_RETURN_RET_ELOG(!inputDevice, CameraErrorCode::SUCCESS, "CaptureSession::GetZoomRatio camera device is null");
     int32_t DEFAULT_ITEMS = 1;
@@ -3902,6 +4040,7 @@ int32_t CaptureSession::GetZoomRatio(float& zoomRatio)
     CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS, CameraErrorCode::SUCCESS,
         "CaptureSession::GetZoomRatio Failed with return code %{public}d", ret);
     zoomRatio = static_cast<float>(item.data.ui32[0]) / static_cast<float>(zoomRatioMultiple);
+    shadowState_.Store(ShadowField::ZOOM_RATIO, zoomRatio, 0);
     MEDIA_ERR_LOG("CaptureSession::GetZoomRatio %{public}f", zoomRatio);
     return CameraErrorCode::SUCCESS;
 }
@@ -4616,11 +4755,28 @@ int32_t CaptureSession::GetFocusDistance(float& focusDistance)
     auto inputDevice = GetInputDevice();
     CHECK_RETURN_RET_ELOG(!inputDevice || !inputDevice->GetCameraDeviceInfo(), CameraErrorCode::OPERATION_NOT_ALLOWED,
         "CaptureSession::GetFocusDistance camera device is null");
+    CHECK_EXECUTE(CameraSecurity::CheckSystemApp(), RefreshFocusDistance());
     focusDistance = focusDistance_;
     return CameraErrorCode::SUCCESS;
     // LCOV_EXCL_STOP
 }
 
+void CaptureSession::RefreshFocusDistance()
+{
+    float lensFocusDistance = 0.0f;
+    if (!shadowState_.Load(ShadowField::FOCUS_DISTANCE, lensFocusDistance)) {
+        // The results are not followed while nobody reads them, focusDistance_ may be old, so the service is asked.
+        std::shared_ptr<OHOS::Camera::CameraMetadata> metaOut = nullptr;
+        camera_metadata_item_t item;
+        CHECK_RETURN(!QueryDeviceStatus(OHOS_CONTROL_LENS_FOCUS_DISTANCE, &lensFocusDistance, metaOut, item));
+        lensFocusDistance = item.data.f[0];
+        shadowState_.Store(ShadowField::FOCUS_DISTANCE, lensFocusDistance, 0);
+    }
+    float minimumFocusDistance = GetMinimumFocusDistance();
+    CHECK_RETURN(FloatIsEqual(minimumFocusDistance, 0.0));
+    focusDistance_ = 1.0 - (lensFocusDistance / minimumFocusDistance);
+}
+
 int32_t CaptureSession::SetFocusDistance(float focusDistance)
 {
     CAMERA_SYNC_TRACE;
@@ -5840,6 +5996,20 @@ void CaptureSession::SetAbilityCallback(std::shared_ptr<AbilityCallback> ability
     abilityCallback_ = abilityCallback;
 }
 
+std::shared_ptr<const CameraAbilityIndex> CaptureSession::GetAbilityIndex()
+{
+    auto inputDevice = GetInputDevice();
+    CHECK_RETURN_RET(inputDevice == nullptr || inputDevice->GetCameraDeviceInfo() == nullptr, nullptr);
+    std::shared_ptr<Camera::CameraMetadata> metadata = GetMetadata();
+    CHECK_RETURN_RET(metadata == nullptr, nullptr);
+    int32_t sceneMode = GetMode();
+    int32_t featuredMode = GetFeaturesMode().GetFeaturedMode();
+    std::lock_guard<std::mutex> lock(abilityIndexMutex_);
+    bool isMatched = abilityIndex_ != nullptr && abilityIndex_->IsMatched(metadata, sceneMode, featuredMode);
+    CHECK_EXECUTE(!isMatched, abilityIndex_ = std::make_shared<CameraAbilityIndex>(metadata, sceneMode, featuredMode));
+    return abilityIndex_;
+}
+
 std::shared_ptr<OHOS::Camera::CameraMetadata> CaptureSession::GetMetadata()
 {
     auto inputDevice = GetInputDevice();
@@ -7711,7 +7881,17 @@ void CaptureSession::SetZoomRatioForAudio(float zoomRatio)
 
 uint32_t CaptureSession::GetIsoValue()
 {
+    uint32_t isoValue = 0;
+    CHECK_RETURN_RET(shadowState_.Load(ShadowField::ISO_VALUE, isoValue), isoValue);
+    // The results are not followed while nobody reads them, so a stale shadow means the mirror may be old as well.
+    std::shared_ptr<OHOS::Camera::CameraMetadata> metaOut = nullptr;
+    camera_metadata_item_t item;
+    bool isQueried = QueryDeviceStatus(OHOS_STATUS_ISO_VALUE, &isoValue, metaOut, item);
     std::lock_guard<std::mutex> isoLock(isoValueMutex_);
+    if (isQueried) {
+        isoValue_ = item.data.ui32[0];
+        shadowState_.Store(ShadowField::ISO_VALUE, isoValue_, 0);
+    }
     return isoValue_;
 }
 
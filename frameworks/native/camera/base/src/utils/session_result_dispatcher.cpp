@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "session_result_dispatcher.h"
+
+#include <algorithm>
+
+#include "camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+size_t GetDataTypeSize(uint8_t dataType)
+{
+    switch (dataType) {
+        case META_TYPE_BYTE:
+            return sizeof(uint8_t);
+        case META_TYPE_INT32:
+        case META_TYPE_UINT32:
+        case META_TYPE_FLOAT:
+            return sizeof(int32_t);
+        case META_TYPE_INT64:
+        case META_TYPE_DOUBLE:
+            return sizeof(int64_t);
+        case META_TYPE_RATIONAL:
+            return sizeof(camera_rational_t);
+        default:
+            return 0;
+    }
+}
+
+uint64_t HashItemValue(const camera_metadata_item_t& item)
+{
+    uint64_t hash = FNV_OFFSET_BASIS ^ item.count;
+    size_t size = GetDataTypeSize(item.data_type) * item.count;
+    for (size_t index = 0; index < size; index++) {
+        hash = (hash ^ item.data.u8[index]) * FNV_PRIME;
+    }
+    return hash;
+}
+} // namespace
+
+size_t SessionResultDispatcher::AddRoute(Route route)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    CHECK_RETURN_RET_ELOG(routes_.size() >= MAX_SESSION_RESULT_ROUTES, MAX_SESSION_RESULT_ROUTES,
+        "SessionResultDispatcher::AddRoute route table is full");
+    uint64_t routeBit = 1ULL << routes_.size();
+    for (uint32_t tag : route.tags) {
+        tagStates_[tag].routeMask |= routeBit;
+    }
+    routes_.push_back({ std::move(route) });
+    return routes_.size() - 1;
+}
+
+void SessionResultDispatcher::AddRouteTags(size_t routeId, const std::vector<uint32_t>& tags)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    CHECK_RETURN_ELOG(routeId >= routes_.size(), "SessionResultDispatcher::AddRouteTags invalid route: %{public}zu",
+        routeId);
+    auto& routeTags = routes_[routeId].route.tags;
+    for (uint32_t tag : tags) {
+        CHECK_CONTINUE(std::find(routeTags.begin(), routeTags.end(), tag) != routeTags.end());
+        routeTags.push_back(tag);
+        tagStates_[tag].routeMask |= 1ULL << routeId;
+    }
+    routes_[routeId].isReplayPending = true;
+}
+
+void SessionResultDispatcher::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    isInvalidated_ = true;
+}
+
+void SessionResultDispatcher::ScanResultUnlocked(
+    const common_metadata_header_t* header, uint64_t& presentMask, uint64_t& changedMask)
+{
+    camera_metadata_item_t item;
+    uint32_t count = OHOS::Camera::GetCameraMetadataItemCount(header);
+    for (uint32_t index = 0; index < count; index++) {
+        CHECK_CONTINUE(OHOS::Camera::GetCameraMetadataItem(header, index, &item) != CAM_META_SUCCESS);
+        auto it = tagStates_.find(item.item);
+        CHECK_CONTINUE(it == tagStates_.end() || item.count == 0);
+        TagState& state = it->second;
+        uint64_t valueHash = HashItemValue(item);
+        // A tag missing from the previous result counts as changed when it shows up again.
+        bool isChanged = isInvalidated_ || state.seenFrame + 1 != frameIndex_ || state.valueHash != valueHash;
+        CHECK_EXECUTE(isChanged, changedMask |= state.routeMask);
+        presentMask |= state.routeMask;
+        state.valueHash = valueHash;
+        state.seenFrame = frameIndex_;
+    }
+    isInvalidated_ = false;
+}
+
+void SessionResultDispatcher::Dispatch(
+    const uint64_t timestamp, const std::shared_ptr<OHOS::Camera::CameraMetadata>& result)
+{
+    CHECK_RETURN(result == nullptr || result->get() == nullptr);
+    // The probes take the session locks, they are read out of the dispatcher lock. Routes are not added anymore
+    // once results flow, so the probes can be read without it.
+    size_t routeCount = routes_.size();
+    std::array<uintptr_t, MAX_SESSION_RESULT_ROUTES> listenerKeys {};
+    bool hasActiveRoute = false;
+    for (size_t index = 0; index < routeCount; index++) {
+        const Route& route = routes_[index].route;
+        listenerKeys[index] = route.probe == nullptr ? 0 : route.probe();
+        hasActiveRoute = hasActiveRoute || !route.isListenerRequired || listenerKeys[index] != 0;
+    }
+    uint64_t dispatchMask = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frameIndex_++;
+        // Nobody listens, the result is not even walked.
+        CHECK_RETURN(!hasActiveRoute);
+        uint64_t presentMask = 0;
+        uint64_t changedMask = 0;
+        ScanResultUnlocked(result->get(), presentMask, changedMask);
+        for (size_t index = 0; index < routeCount; index++) {
+            RouteState& state = routes_[index];
+            if (state.listenerKey != listenerKeys[index]) {
+                state.listenerKey = listenerKeys[index];
+                state.isReplayPending = true;
+            }
+            CHECK_CONTINUE(state.route.isListenerRequired && state.listenerKey == 0);
+            uint64_t routeBit = 1ULL << index;
+            bool isTriggered = state.route.trigger == Trigger::ON_PRESENT || state.isReplayPending ||
+                (changedMask & routeBit) != 0;
+            CHECK_CONTINUE(!state.route.tags.empty() && ((presentMask & routeBit) == 0 || !isTriggered));
+            state.isReplayPending = false;
+            dispatchMask |= routeBit;
+        }
+    }
+    // Handlers take the session locks, they are called out of the dispatcher lock. A route keeps its handler
+    // once added.
+    for (size_t index = 0; index < routeCount; index++) {
+        CHECK_CONTINUE((dispatchMask & (1ULL << index)) == 0);
+        const Handler& handler = routes_[index].route.handler;
+        CHECK_EXECUTE(handler != nullptr, handler(timestamp, result));
+    }
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "session_shadow_state.h"
+
+#include <chrono>
+
+#include "camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr float ZOOM_RATIO_MULTIPLE = 100.0f;
+constexpr uint32_t ZOOM_CENTER_POINT_COUNT = 2;
+
+int64_t GetSteadyTimeMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+} // namespace
+
+const std::vector<uint32_t>& SessionShadowState::GetResultTags()
+{
+    static const std::vector<uint32_t> tags = { OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO, OHOS_CONTROL_ZOOM_CENTER_POINT,
+        OHOS_STATUS_ISO_VALUE, OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE, OHOS_CONTROL_LENS_FOCUS_DISTANCE };
+    return tags;
+}
+
+void SessionShadowState::OnResult(
+    const uint64_t timestamp, const std::shared_ptr<OHOS::Camera::CameraMetadata>& result)
+{
+    CHECK_RETURN(result == nullptr || result->get() == nullptr);
+    // A single walk of the result, StoreItem picks out the mirrored tags.
+    const common_metadata_header_t* header = result->get();
+    camera_metadata_item_t item;
+    uint32_t count = OHOS::Camera::GetCameraMetadataItemCount(header);
+    for (uint32_t index = 0; index < count; index++) {
+        CHECK_CONTINUE(OHOS::Camera::GetCameraMetadataItem(header, index, &item) != CAM_META_SUCCESS ||
+            item.count == 0);
+        StoreItem(item, timestamp);
+    }
+}
+
+void SessionShadowState::StoreItem(const camera_metadata_item_t& item, uint64_t timestamp)
+{
+    switch (item.item) {
+        // The zoom the device reports, as GetStatus answers it, not the requested OHOS_CONTROL_ZOOM_RATIO.
+        case OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO:
+            Store(ShadowField::ZOOM_RATIO, static_cast<float>(item.data.ui32[0]) / ZOOM_RATIO_MULTIPLE, timestamp);
+            break;
+        case OHOS_CONTROL_ZOOM_CENTER_POINT: {
+            CHECK_RETURN(item.count < ZOOM_CENTER_POINT_COUNT);
+            std::array<float, ZOOM_CENTER_POINT_COUNT> centerPoint = { item.data.f[0], item.data.f[1] };
+            Store(ShadowField::ZOOM_CENTER_POINT, centerPoint, timestamp);
+            break;
+        }
+        case OHOS_STATUS_ISO_VALUE:
+            Store(ShadowField::ISO_VALUE, item.data.ui32[0], timestamp);
+            break;
+        case OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE:
+            Store(ShadowField::OIS_MODE, item.data.i32[0], timestamp);
+            break;
+        // The lens distance as reported, GetFocusDistance maps it with the minimum focus distance of the device.
+        case OHOS_CONTROL_LENS_FOCUS_DISTANCE:
+            Store(ShadowField::FOCUS_DISTANCE, item.data.f[0], timestamp);
+            break;
+        default:
+            break;
+    }
+}
+
+void SessionShadowState::StoreBits(ShadowField field, uint64_t bits, uint64_t timestamp)
+{
+    CHECK_RETURN(field >= ShadowField::FIELD_COUNT);
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    Entry& entry = entries_[static_cast<size_t>(field)];
+    // Results may be delivered out of order, an older frame never replaces a newer one.
+    CHECK_RETURN(timestamp != 0 && timestamp < entry.timestamp.load(std::memory_order_relaxed));
+    uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+    entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    entry.bits.store(bits, std::memory_order_relaxed);
+    entry.timestamp.store(timestamp, std::memory_order_relaxed);
+    entry.confirmTimeMs.store(GetSteadyTimeMs(), std::memory_order_relaxed);
+    entry.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool SessionShadowState::LoadBits(ShadowField field, uint64_t& bits, uint64_t& timestamp, int64_t maxAgeMs) const
+{
+    CHECK_RETURN_RET(field >= ShadowField::FIELD_COUNT, false);
+    MarkInUse();
+    const Entry& entry = entries_[static_cast<size_t>(field)];
+    int64_t confirmTimeMs = 0;
+    uint32_t sequence = 0;
+    do {
+        sequence = entry.sequence.load(std::memory_order_acquire);
+        bits = entry.bits.load(std::memory_order_relaxed);
+        timestamp = entry.timestamp.load(std::memory_order_relaxed);
+        confirmTimeMs = entry.confirmTimeMs.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) != 0 || sequence != entry.sequence.load(std::memory_order_relaxed));
+    return confirmTimeMs != 0 && GetSteadyTimeMs() - confirmTimeMs <= maxAgeMs;
+}
+
+void SessionShadowState::MarkInUse() const
+{
+    lastReadTimeMs_.store(GetSteadyTimeMs(), std::memory_order_relaxed);
+}
+
+bool SessionShadowState::IsInUse() const
+{
+    int64_t lastReadTimeMs = lastReadTimeMs_.load(std::memory_order_relaxed);
+    return lastReadTimeMs != 0 && GetSteadyTimeMs() - lastReadTimeMs <= IN_USE_WINDOW_MS;
+}
+
+void SessionShadowState::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    for (auto& entry : entries_) {
+        uint32_t sequence = entry.sequence.load(std::memory_order_relaxed);
+        entry.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        entry.timestamp.store(0, std::memory_order_relaxed);
+        entry.confirmTimeMs.store(0, std::memory_order_relaxed);
+        entry.sequence.store(sequence + 2, std::memory_order_release);
+    }
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -14,7 +14,10 @@
  */
 
 #include "camera_deferred_base_unittest.h"
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <mutex>
 #include <vector>
 #include "camera_manager.h"
 #include "camera_util.h"
@@ -24,9 +27,11 @@
 
 #include "time_broker.h"
 #include "shared_buffer.h"
+#include "shared_buffer_pool.h"
 #include "task_manager/thread_pool.h"
 #include "steady_clock.h"
 #include "timer_core.h"
+#include "timing_wheel.h"
 #include "basic_definitions.h"
 #include "dps.h"
 #include "session_manager.h"
@@ -198,8 +203,9 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_006, TestSize.Level
     timeBroker->RegisterCallback(delayTimeMs, timerCallback, handle);
     timeBroker->TimerExpired();
     bool force = true;
-    if (!(timeBroker->timeline_.empty() || (timeBroker->timer_->IsActive()))) {
-        EXPECT_EQ(timeBroker->RestartTimer(force), timeBroker->timer_->StartAt(timeBroker->timeline_.top()));
+    uint64_t timestamp = 0;
+    if (timeBroker->wheel_.GetNextExpiration(timestamp) && !timeBroker->timer_->IsActive()) {
+        EXPECT_EQ(timeBroker->RestartTimer(force), timeBroker->timer_->StartAtMicro(timestamp));
     } else {
         force = false;
         EXPECT_TRUE(timeBroker->RestartTimer(force));
@@ -226,7 +232,7 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_007, TestSize.Level
     const std::shared_ptr<Timer>& timer = Timer::Create("camera_deferred_base", TimerType::ONCE, 0, timerCallback);
     EXPECT_TRUE(timerCore->RegisterTimer(timestampMs, timer));
     timerCore->GetNextExpirationTimeUnlocked();
-    EXPECT_TRUE(timerCore->DeregisterTimer(timestampMs, timer));
+    EXPECT_TRUE(timerCore->DeregisterTimer(timer));
 }
 
 /*
@@ -249,7 +255,7 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_008, TestSize.Level
     const std::shared_ptr<Timer>& timer = Timer::Create("camera_deferred_base", TimerType::ONCE, 0, timerCallback);
     timerCore->active_ = false;
     EXPECT_FALSE(timerCore->RegisterTimer(timestampMs, timer));
-    EXPECT_TRUE(timerCore->DeregisterTimer(timestampMs, timer));
+    EXPECT_TRUE(timerCore->DeregisterTimer(timer));
 }
 
 /*
@@ -273,7 +279,7 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_009, TestSize.Level
     const std::shared_ptr<Timer>& timer = temp;
     timerCore->active_ = true;
     EXPECT_FALSE(timerCore->RegisterTimer(timestampMs, timer));
-    EXPECT_FALSE(timerCore->DeregisterTimer(timestampMs, timer));
+    EXPECT_FALSE(timerCore->DeregisterTimer(timer));
 }
 
 /*
@@ -288,7 +294,7 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_010, TestSize.Level
 {
     std::shared_ptr<TimerCore> timerCore = std::make_shared<TimerCore>();
     ASSERT_NE(timerCore, nullptr);
-    timerCore->timeline_ = std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>();
+    timerCore->wheel_.Clear();
     timerCore->DoTimeout();
     EXPECT_EQ(timerCore->GetNextExpirationTimeUnlocked(), std::chrono::milliseconds(EXPIREATION_TIME_MILLI_SECONDS));
 }
@@ -364,8 +370,8 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_014, TestSize.Level
     std::shared_ptr<TimeBroker> timeBroker = TimeBroker::Create("camera_deferred_base");
     ASSERT_NE(timeBroker, nullptr);
     timeBroker->Initialize();
-    timeBroker->timeline_ = std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>>();
-    EXPECT_TRUE((timeBroker->timeline_.empty()));
+    timeBroker->wheel_.Clear();
+    EXPECT_TRUE((timeBroker->wheel_.Empty()));
     timeBroker->TimerExpired();
 }
 
@@ -385,7 +391,7 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_015, TestSize.Level
     ASSERT_NE(timer, nullptr);
     timer->active_ = true;
     timer->StartAtUnlocked(timestampMs);
-    EXPECT_EQ(timer->expiredTimeMs_, 0);
+    EXPECT_EQ(timer->expiredTimeUs_, 0);
 }
 
 /*
@@ -956,5 +962,176 @@ HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_047, TestSize.Level
     notifier.SetNotifyCallback(callback);
     EXPECT_FALSE(notifier.isCompletedProcess());
 }
+
+/*
+ * Feature: SharedBufferPool
+ * Function: Test Acquire, Release, recycle and Trim of pooled shared buffers
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Acquire should return an initialized buffer rounded up to a size class. A recycled region
+ * should only be reused after the client of its image released it, and a reused region should not show the
+ * tail of the earlier image. A forced Trim should drop the cache.
+ */
+HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_048, TestSize.Level0)
+{
+    const int32_t userId = 100;
+    auto& pool = SharedBufferPool::GetInstance();
+    pool.Trim(true);
+    EXPECT_EQ(pool.Acquire(0, userId, "image_048"), nullptr);
+
+    int64_t dataSize = 1000;
+    auto buffer = pool.Acquire(dataSize, userId, "image_048");
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_NE(buffer->GetFd(), -1);
+    EXPECT_GE(buffer->GetSize(), dataSize);
+    std::vector<uint8_t> data(dataSize, 1);
+    EXPECT_EQ(buffer->CopyFrom(data.data(), dataSize), DP_OK);
+    EXPECT_EQ(pool.GetOutstandingCount(), 1);
+    int firstFd = buffer->GetFd();
+
+    buffer = nullptr;
+    EXPECT_EQ(pool.GetOutstandingCount(), 0);
+    EXPECT_EQ(pool.GetCachedCount(), 0);
+    EXPECT_EQ(pool.GetLentCount(), 1);
+
+    auto next = pool.Acquire(dataSize, userId, "image_048_next");
+    ASSERT_NE(next, nullptr);
+    EXPECT_NE(next->GetFd(), firstFd);
+
+    pool.Release(userId + 1, "image_048");
+    EXPECT_EQ(pool.GetCachedCount(), 0);
+    pool.Release(userId, "image_048");
+    EXPECT_EQ(pool.GetCachedCount(), 1);
+    EXPECT_EQ(pool.GetLentCount(), 1);
+
+    int64_t smallSize = 100;
+    auto reused = pool.Acquire(smallSize, userId, "image_048_reuse");
+    ASSERT_NE(reused, nullptr);
+    EXPECT_EQ(reused->GetFd(), firstFd);
+    std::vector<uint8_t> smallData(smallSize, 2);
+    EXPECT_EQ(reused->CopyFrom(smallData.data(), smallSize), DP_OK);
+    auto tail = static_cast<const uint8_t*>(reused->ashmem_->ReadFromAshmem(dataSize - smallSize, smallSize));
+    ASSERT_NE(tail, nullptr);
+    EXPECT_TRUE(std::all_of(tail, tail + dataSize - smallSize, [](uint8_t value) { return value == 0; }));
+
+    pool.Release(userId, "image_048_reuse");
+    reused = nullptr;
+    EXPECT_EQ(pool.GetCachedCount(), 1);
+
+    next = nullptr;
+    pool.Trim(true);
+    EXPECT_EQ(pool.GetCachedCount(), 0);
+    EXPECT_EQ(pool.GetLentCount(), 0);
+}
+
+/*
+ * Feature: TimingWheel
+ * Function: Test expiration order, cascading and cancellation of the timing wheel
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Entries spread over several levels should expire in order of expiration, each one
+ * exactly when its tick is reached, and a removed entry should never expire.
+ */
+HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_049, TestSize.Level0)
+{
+    uint64_t start = 1000000;
+    TimingWheel<uint64_t> wheel(start);
+    std::vector<uint64_t> delays = { 5000000, 1, 63, 64, 4097, 262145, 70 };
+    for (auto delay : delays) {
+        wheel.Add(start + delay, delay);
+    }
+    auto cancelled = wheel.Add(start + 100, 100);
+    EXPECT_TRUE(wheel.Remove(cancelled));
+    EXPECT_FALSE(wheel.Remove(cancelled));
+    EXPECT_EQ(wheel.Size(), delays.size());
+
+    uint64_t next = 0;
+    std::vector<uint64_t> expired;
+    std::sort(delays.begin(), delays.end());
+    for (auto delay : delays) {
+        ASSERT_TRUE(wheel.GetNextExpiration(next));
+        EXPECT_EQ(next, start + delay);
+        wheel.Advance(next - 1, expired);
+        EXPECT_TRUE(expired.empty());
+        wheel.Advance(next, expired);
+        ASSERT_EQ(expired.size(), 1);
+        EXPECT_EQ(expired[0], delay);
+        expired.clear();
+    }
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_FALSE(wheel.GetNextExpiration(next));
+}
+
+/*
+ * Feature: TimingWheel
+ * Function: Test batched expiry, overflow and coalescing of the timing wheel
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: One Advance should expire every due entry including those past the last level,
+ * an entry due in the past should expire on the next Advance, and entries coalesced with the same
+ * window should share one expiration.
+ */
+HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_050, TestSize.Level0)
+{
+    uint64_t start = 1ULL << 40;
+    TimingWheel<int32_t> wheel(start);
+    uint64_t farDelay = 1ULL << 37;
+    wheel.Add(start + farDelay, 1);
+    wheel.Add(start + 10, 0);
+    wheel.Add(start - 10, -1);
+    std::vector<int32_t> expired;
+    wheel.Advance(start, expired);
+    ASSERT_EQ(expired.size(), 1);
+    EXPECT_EQ(expired[0], -1);
+    expired.clear();
+    wheel.Advance(start + farDelay, expired);
+    EXPECT_EQ(expired, std::vector<int32_t>({ 0, 1 }));
+    EXPECT_EQ(wheel.GetCurrentTick(), start + farDelay);
+
+    uint64_t window = 10000;
+    uint64_t first = TimingWheel<int32_t>::Coalesce(start + 1001, window);
+    uint64_t second = TimingWheel<int32_t>::Coalesce(start + 7003, window);
+    EXPECT_EQ(first, second);
+    EXPECT_GE(first, start + 7003);
+    EXPECT_LT(first, start + 1001 + window);
+    EXPECT_EQ(TimingWheel<int32_t>::Coalesce(start + 1001, 0), start + 1001);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test coalesced callbacks of the time broker
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Callbacks registered with a coalescing window should all run, and a deregistered
+ * callback should leave the wheel at once.
+ */
+HWTEST_F(DeferredBaseUnitTest, camera_deferred_base_unittest_051, TestSize.Level0)
+{
+    std::shared_ptr<TimeBroker> timeBroker = TimeBroker::Create("camera_deferred_base");
+    ASSERT_NE(timeBroker, nullptr);
+    std::mutex mutex;
+    std::condition_variable cv;
+    int32_t calls = 0;
+    auto callback = [&mutex, &cv, &calls](uint32_t handle) {
+        std::lock_guard<std::mutex> lock(mutex);
+        calls++;
+        cv.notify_one();
+    };
+    uint32_t windowMs = 20;
+    uint32_t handle = 0;
+    EXPECT_TRUE(timeBroker->RegisterCallback(1, windowMs, callback, handle));
+    EXPECT_TRUE(timeBroker->RegisterCallback(2, windowMs, callback, handle));
+    uint32_t cancelled = 0;
+    EXPECT_TRUE(timeBroker->RegisterCallback(3, windowMs, callback, cancelled));
+    timeBroker->DeregisterCallback(cancelled);
+    EXPECT_EQ(timeBroker->wheel_.Size(), 2);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    EXPECT_TRUE(cv.wait_for(lock, std::chrono::seconds(1), [&calls] { return calls == 2; }));
+}
 } // CameraStandard
 } // OHOS
@@ -15,6 +15,11 @@
 
 #include "deferred_photo_job_unittest.h"
 
+#include <csignal>
+#include <fstream>
+#include <sys/wait.h>
+#include <unistd.h>
+
 #include "basic_definitions.h"
 #include "deferred_utils_unittest.h"
 #include "dp_utils.h"
@@ -35,6 +40,8 @@ namespace {
     const std::string TEST_IMAGE_4 = "testImage4";
     constexpr int32_t WAIT_TIME_AFTER_CAPTURE = 10;
     const std::string SYSTEM_CAMERA = "com.huawei.hmos.camera";
+    const std::string JOURNAL_PATH = "/data/test/media/dps_photo_job_test.journal";
+    constexpr int32_t JOURNAL_JOB_COUNT = 200;
 }
 
 void DeferredPhotoJobUnitTest::SetUpTestCase(void) {}
@@ -73,6 +80,11 @@ public:
     {
         DP_DEBUG_LOG("entered.");
     }
+
+    void UpdateJobState(const std::string& imageId, JobState state, JobPriority priority)
+    {
+        DP_DEBUG_LOG("entered.");
+    }
 };
 
 HWTEST_F(DeferredPhotoJobUnitTest, photo_job_queue_unittest_001, TestSize.Level0)
@@ -1260,6 +1272,132 @@ HWTEST_F(DeferredPhotoJobUnitTest, photo_job_state_listener_unittest_008, TestSi
     EXPECT_NE(listener, nullptr);
 }
 
+/*
+ * Feature: PhotoJobJournal
+ * Function: Test RestoreJobs after the process is killed in the middle of a backlog
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Every job added before the kill comes back once, with its priority and final state
+ */
+HWTEST_F(DeferredPhotoJobUnitTest, photo_job_journal_unittest_001, TestSize.Level0)
+{
+    unlink(JOURNAL_PATH.c_str());
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        auto repository = PhotoJobRepository::Create(USER_ID);
+        repository->RestoreJobs(JOURNAL_PATH);
+        DpsMetadata metadata;
+        metadata.Set(DEFERRED_PROCESSING_TYPE_KEY, DPS_OFFLINE);
+        for (int32_t i = 0; i < JOURNAL_JOB_COUNT; i++) {
+            repository->AddDeferredJob(std::to_string(i), true, metadata, SYSTEM_CAMERA);
+        }
+        repository->RequestJob("1");
+        repository->GetJobUnLocked("2")->Start(1);
+        repository->GetJobUnLocked("3")->Start(1);
+        repository->GetJobUnLocked("3")->Complete();
+        repository->RemoveDeferredJob("4", false);
+        repository->RemoveDeferredJob("5", true);
+        raise(SIGKILL);
+    }
+    int32_t status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    ASSERT_TRUE(WIFSIGNALED(status));
+
+    auto repository = PhotoJobRepository::Create(USER_ID);
+    ASSERT_NE(repository, nullptr);
+    EXPECT_EQ(repository->RestoreJobs(JOURNAL_PATH), DP_OK);
+    EXPECT_EQ(repository->GetOfflineJobSize(), JOURNAL_JOB_COUNT - 1);
+    EXPECT_EQ(repository->GetJobPriority("1"), JobPriority::HIGH);
+    EXPECT_EQ(repository->GetJobState("2"), JobState::PENDING);
+    EXPECT_EQ(repository->GetJobState("3"), JobState::COMPLETED);
+    EXPECT_EQ(repository->GetJobState("4"), JobState::NONE);
+    EXPECT_EQ(repository->GetJobPriority("5"), JobPriority::LOW);
+    EXPECT_EQ(repository->GetJobPriority("6"), JobPriority::NORMAL);
+    EXPECT_EQ(repository->GetJob()->GetImageId(), "1");
+    repository.reset();
+    unlink(JOURNAL_PATH.c_str());
+}
+
+/*
+ * Feature: PhotoJobJournal
+ * Function: Test compaction of a journal holding mostly removed jobs
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Compaction keeps the live jobs in the order they were added
+ */
+HWTEST_F(DeferredPhotoJobUnitTest, photo_job_journal_unittest_002, TestSize.Level0)
+{
+    unlink(JOURNAL_PATH.c_str());
+    std::vector<PhotoJobRecord> jobs;
+    {
+        PhotoJobJournal journal(JOURNAL_PATH);
+        ASSERT_EQ(journal.Open(jobs), DP_OK);
+        PhotoJobRecord record;
+        record.bundleName = SYSTEM_CAMERA;
+        for (int32_t i = 0; i < JOURNAL_JOB_COUNT * JOURNAL_JOB_COUNT; i++) {
+            record.imageId = std::to_string(i);
+            journal.RecordAdd(record);
+            DP_CHECK_EXECUTE(i % JOURNAL_JOB_COUNT != 0, journal.RecordRemove(record.imageId));
+        }
+        EXPECT_LT(journal.recordCount_, JOURNAL_JOB_COUNT * JOURNAL_JOB_COUNT);
+    }
+    PhotoJobJournal journal(JOURNAL_PATH);
+    ASSERT_EQ(journal.Open(jobs), DP_OK);
+    ASSERT_EQ(jobs.size(), JOURNAL_JOB_COUNT);
+    for (int32_t i = 0; i < JOURNAL_JOB_COUNT; i++) {
+        EXPECT_EQ(jobs[i].imageId, std::to_string(i * JOURNAL_JOB_COUNT));
+        EXPECT_EQ(jobs[i].bundleName, SYSTEM_CAMERA);
+    }
+    unlink(JOURNAL_PATH.c_str());
+}
+
+/*
+ * Feature: PhotoJobJournal
+ * Function: Test replay of a journal whose last record is torn
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Replay stops at the record failing its CRC and new records follow the intact ones
+ */
+HWTEST_F(DeferredPhotoJobUnitTest, photo_job_journal_unittest_003, TestSize.Level0)
+{
+    unlink(JOURNAL_PATH.c_str());
+    std::vector<PhotoJobRecord> jobs;
+    size_t tornOffset = 0;
+    {
+        PhotoJobJournal journal(JOURNAL_PATH);
+        ASSERT_EQ(journal.Open(jobs), DP_OK);
+        PhotoJobRecord record;
+        record.imageId = TEST_IMAGE_1;
+        journal.RecordAdd(record);
+        tornOffset = journal.offset_;
+        record.imageId = TEST_IMAGE_2;
+        journal.RecordAdd(record);
+        journal.base_[journal.offset_ - 1] ^= 0xFF;
+    }
+    {
+        PhotoJobJournal journal(JOURNAL_PATH);
+        ASSERT_EQ(journal.Open(jobs), DP_OK);
+        ASSERT_EQ(jobs.size(), 1);
+        EXPECT_EQ(jobs[0].imageId, TEST_IMAGE_1);
+        EXPECT_EQ(journal.offset_, tornOffset);
+        PhotoJobRecord record;
+        record.imageId = TEST_IMAGE_3;
+        journal.RecordAdd(record);
+        journal.RecordState(TEST_IMAGE_1, JobState::FAILED, JobPriority::LOW);
+    }
+    PhotoJobJournal journal(JOURNAL_PATH);
+    ASSERT_EQ(journal.Open(jobs), DP_OK);
+    ASSERT_EQ(jobs.size(), 2);
+    EXPECT_EQ(jobs[0].imageId, TEST_IMAGE_1);
+    EXPECT_EQ(jobs[0].state, JobState::FAILED);
+    EXPECT_EQ(jobs[0].priority, JobPriority::LOW);
+    EXPECT_EQ(jobs[1].imageId, TEST_IMAGE_3);
+    unlink(JOURNAL_PATH.c_str());
+}
 } // namespace DeferredProcessing
 } // namespace CameraStandard
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "avcodec_task_manager_unittest.h"
 
+#include <chrono>
+#include "audio_deferred_process.h"
 #include "avcodec_task_manager.h"
 #include "camera_dynamic_loader.h"
 #include "camera_log.h"
@@ -833,5 +835,126 @@ HWTEST_F(AvcodecTaskManagerUnitTest, avcodec_task_manager_unittest_027, TestSize
     taskManager->CollectAudioBuffer(choosedBuffer, muxer, true);
     EXPECT_EQ(choosedBuffer.size(), 0);
 }
+
+/*
+ * Feature: Framework
+ * Function: Test AudioDeferredProcess GetMutedTailStart.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the muted tail of a window starts at the batch SetMutedAudioRecordForVecs fades.
+ */
+HWTEST_F(AvcodecTaskManagerUnitTest, avcodec_task_manager_unittest_028, TestSize.Level0)
+{
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(0), 0);
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(5), 0);
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(10), 0);
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(11), 5);
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(94), 85);
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(95), 85);
+    EXPECT_EQ(AudioDeferredProcess::GetMutedTailStart(96), 90);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test AvcodecTaskManager CollectAudioBuffer with pre-encoded audio.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test back-to-back captures mux the pre-encoded AAC units of their windows without encoding
+ *     them again, and that collecting a window is not slower than muting and encoding the whole window.
+ */
+HWTEST_F(AvcodecTaskManagerUnitTest, avcodec_task_manager_unittest_029, TestSize.Level1)
+{
+    sptr<AudioCapturerSession> session = new AudioCapturerSession();
+    VideoCodecType type = VideoCodecType::VIDEO_ENCODE_TYPE_AVC;
+    ColorSpace colorSpace = ColorSpace::DISPLAY_P3;
+    sptr<AvcodecTaskManager> taskManager = new AvcodecTaskManager(session, type, colorSpace);
+    sptr<AudioTaskManager> audioTaskManager = new AudioTaskManager(session);
+    taskManager->audioTaskManager_ = audioTaskManager;
+
+    const int64_t audioStartTime = 900;
+    const int64_t audioEndTime = 4100;
+    const int32_t encodedSize = 256;
+    const int64_t timingSlackUs = 2000;
+    std::vector<OH_AVBuffer*> encodedBuffers;
+    for (int64_t timestamp = audioStartTime; timestamp < audioEndTime; timestamp += AUDIO_RECORD_DURATION) {
+        sptr<AudioRecord> audioRecord = new AudioRecord(timestamp);
+        audioRecord->SetAudioBuffer(new uint8_t[DEFAULT_MAX_INPUT_SIZE](), DEFAULT_MAX_INPUT_SIZE);
+        audioRecord->CacheEncodedBuffer(OH_AVBuffer_Create(encodedSize));
+        audioRecord->SetEncodedResult(true);
+        encodedBuffers.push_back(audioRecord->encodedBuffer);
+        audioTaskManager->processedAudioRecordCache_.push_back(audioRecord);
+    }
+
+    std::vector<int64_t> shutterStartTimes = { 1000000000LL, 1500000000LL };
+    for (auto startTime : shutterStartTimes) {
+        vector<sptr<FrameRecord>> choosedBuffer;
+        for (int64_t timestamp = startTime; timestamp <= startTime + 2500000000LL; timestamp += 500000000LL) {
+            sptr<SurfaceBuffer> surfaceBuffer = SurfaceBuffer::Create();
+            choosedBuffer.push_back(new FrameRecord(surfaceBuffer, timestamp, GRAPHIC_ROTATE_90));
+        }
+        // the path before pre-encoding: mute and encode every record of the window at capture time
+        int64_t videoStartTime = startTime / 1000000LL;
+        int64_t videoEndTime = choosedBuffer.back()->GetTimeStamp() / 1000000LL;
+        vector<sptr<AudioRecord>> windowRecords;
+        vector<sptr<AudioRecord>> fullWindowRecords;
+        for (auto& audioRecord : audioTaskManager->processedAudioRecordCache_) {
+            if (audioRecord->GetTimeStamp() >= videoStartTime && audioRecord->GetTimeStamp() < videoEndTime) {
+                windowRecords.push_back(audioRecord);
+                fullWindowRecords.push_back(new AudioRecord(audioRecord->GetTimeStamp()));
+            }
+        }
+        auto fullWindowStart = std::chrono::steady_clock::now();
+        audioTaskManager->ProcessAudioBufferToMuted(windowRecords, fullWindowRecords);
+        taskManager->audioEncoder_->EncodeAudioBuffer(fullWindowRecords);
+        auto fullWindowLatencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - fullWindowStart).count();
+
+        sptr<AudioVideoMuxer> muxer = new AudioVideoMuxer();
+        auto collectStart = std::chrono::steady_clock::now();
+        taskManager->CollectAudioBuffer(choosedBuffer, muxer, true);
+        auto latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - collectStart).count();
+        MEDIA_INFO_LOG("avcodec_task_manager_unittest_029 window: %{public}zu, latency: %{public}lld us, "
+            "full window: %{public}lld us", windowRecords.size(), static_cast<long long>(latencyUs),
+            static_cast<long long>(fullWindowLatencyUs));
+        EXPECT_LE(latencyUs, fullWindowLatencyUs + timingSlackUs);
+    }
+
+    auto &processedAudioRecordCache = audioTaskManager->processedAudioRecordCache_;
+    ASSERT_EQ(processedAudioRecordCache.size(), encodedBuffers.size());
+    for (size_t index = 0; index < processedAudioRecordCache.size(); index++) {
+        EXPECT_EQ(processedAudioRecordCache[index]->encodedBuffer, encodedBuffers[index]);
+    }
+}
+
+/*
+ * Feature: Framework
+ * Function: Test AvcodecTaskManager Stop with pre-encoder.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test Stop of AvcodecTaskManager also stops the pre-encoder of its audio task manager.
+ */
+HWTEST_F(AvcodecTaskManagerUnitTest, avcodec_task_manager_unittest_030, TestSize.Level0)
+{
+    sptr<AudioCapturerSession> session = new AudioCapturerSession();
+    VideoCodecType type = VideoCodecType::VIDEO_ENCODE_TYPE_AVC;
+    ColorSpace colorSpace = ColorSpace::DISPLAY_P3;
+    sptr<AvcodecTaskManager> taskManager = new AvcodecTaskManager(session, type, colorSpace);
+    sptr<AudioTaskManager> audioTaskManager = new AudioTaskManager(session);
+    taskManager->audioTaskManager_ = audioTaskManager;
+    ASSERT_NE(audioTaskManager->preEncoder_, nullptr);
+
+    vector<sptr<AudioRecord>> audioRecords;
+    sptr<AudioRecord> audioRecord = new AudioRecord(1000);
+    audioRecord->SetAudioBuffer(new uint8_t[DEFAULT_MAX_INPUT_SIZE](), DEFAULT_MAX_INPUT_SIZE);
+    audioRecords.push_back(audioRecord);
+    audioTaskManager->PreEncodeAudioRecords(audioRecords);
+
+    taskManager->Stop();
+    EXPECT_FALSE(audioTaskManager->preEncoder_->isStarted_.load());
+}
 } // CameraStandard
-} // OHOS
\ No newline at end of file
+} // OHOS
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "encoded_frame_arena_unittest.h"
+#include "encoded_frame_arena.h"
+#include "camera_log.h"
+#include "securec.h"
+
+using namespace testing::ext;
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+std::shared_ptr<Media::AVBuffer> CreateEncodedBuffer(int32_t size, int64_t pts, uint32_t flag)
+{
+    auto allocator = Media::AVAllocatorFactory::CreateSharedAllocator(Media::MemoryFlag::MEMORY_READ_WRITE);
+    if (allocator == nullptr) {
+        return nullptr;
+    }
+    std::shared_ptr<Media::AVBuffer> buffer = Media::AVBuffer::CreateAVBuffer(allocator, size);
+    if (buffer == nullptr || buffer->memory_ == nullptr) {
+        return nullptr;
+    }
+    memset_s(buffer->memory_->GetAddr(), size, static_cast<int32_t>(pts & 0xFF), size);
+    buffer->memory_->SetSize(size);
+    buffer->pts_ = pts;
+    buffer->flag_ = flag;
+    return buffer;
+}
+} // namespace
+
+void EncodedFrameArenaUnitTest::SetUpTestCase(void) {}
+
+void EncodedFrameArenaUnitTest::TearDownTestCase(void) {}
+
+void EncodedFrameArenaUnitTest::SetUp() {}
+
+void EncodedFrameArenaUnitTest::TearDown() {}
+
+/*
+ * Feature: Framework
+ * Function: Test CopyFrom
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test CopyFrom copies the payload, pts and flag of the codec output into a slab.
+ */
+HWTEST_F(EncodedFrameArenaUnitTest, encoded_frame_arena_unittest_001, TestSize.Level0)
+{
+    auto arena = std::make_shared<EncodedFrameArena>();
+    auto source = CreateEncodedBuffer(20000, 33, AVCODEC_BUFFER_FLAGS_SYNC_FRAME);
+    ASSERT_NE(source, nullptr);
+    auto copy = arena->CopyFrom(source);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(copy->pts_, 33);
+    EXPECT_EQ(copy->flag_, AVCODEC_BUFFER_FLAGS_SYNC_FRAME);
+    EXPECT_EQ(copy->memory_->GetSize(), 20000);
+    EXPECT_EQ(memcmp(copy->memory_->GetAddr(), source->memory_->GetAddr(), 20000), 0);
+    EXPECT_EQ(arena->inUseBytes_, 32 * 1024);
+    EXPECT_EQ(arena->slabBytes_, 32 * 1024);
+
+    EXPECT_EQ(arena->CopyFrom(nullptr), nullptr);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test slab recycling
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test a slab comes back to the arena with the last reference of its buffer and is reused by
+ *     the next frame of its class without keeping any attribute of the previous frame.
+ */
+HWTEST_F(EncodedFrameArenaUnitTest, encoded_frame_arena_unittest_002, TestSize.Level0)
+{
+    auto arena = std::make_shared<EncodedFrameArena>();
+    auto source = CreateEncodedBuffer(20000, 1, AVCODEC_BUFFER_FLAGS_NONE);
+    ASSERT_NE(source, nullptr);
+    source->dts_ = 1;
+    source->meta_->Set<Media::Tag::VIDEO_ENCODER_ENABLE_WATERMARK>(true);
+    auto copy = arena->CopyFrom(source);
+    ASSERT_NE(copy, nullptr);
+    EXPECT_EQ(copy->dts_, 1);
+    EXPECT_NE(copy->meta_->Find(Media::Tag::VIDEO_ENCODER_ENABLE_WATERMARK), copy->meta_->end());
+    uint8_t* slabAddr = copy->memory_->GetAddr();
+    auto heldCopy = copy;
+    copy = nullptr;
+    EXPECT_EQ(arena->inUseBytes_, 32 * 1024);
+    heldCopy = nullptr;
+    EXPECT_EQ(arena->inUseBytes_, 0);
+    EXPECT_EQ(arena->idleSlabs_[1].size(), 1U);
+
+    auto nextSource = CreateEncodedBuffer(17000, 2, AVCODEC_BUFFER_FLAGS_NONE);
+    ASSERT_NE(nextSource, nullptr);
+    auto nextCopy = arena->CopyFrom(nextSource);
+    ASSERT_NE(nextCopy, nullptr);
+    EXPECT_EQ(nextCopy->memory_->GetAddr(), slabAddr);
+    EXPECT_EQ(nextCopy->memory_->GetSize(), 17000);
+    EXPECT_EQ(nextCopy->pts_, 2);
+    EXPECT_EQ(nextCopy->dts_, 0);
+    EXPECT_EQ(nextCopy->meta_->Find(Media::Tag::VIDEO_ENCODER_ENABLE_WATERMARK), nextCopy->meta_->end());
+    EXPECT_EQ(arena->hitCount_, 1U);
+    EXPECT_EQ(arena->missCount_, 1U);
+    EXPECT_EQ(arena->slabBytes_, 32 * 1024);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test arena cap
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test frames that do not fit the slab budget are copied into buffers of their own, and Trim
+ *     frees the idle slabs.
+ */
+HWTEST_F(EncodedFrameArenaUnitTest, encoded_frame_arena_unittest_003, TestSize.Level1)
+{
+    auto arena = std::make_shared<EncodedFrameArena>();
+    auto source = CreateEncodedBuffer(20000, 3, AVCODEC_BUFFER_FLAGS_NONE);
+    ASSERT_NE(source, nullptr);
+    arena->slabBytes_ = EncodedFrameArena::MAX_ARENA_BYTES;
+    auto overflowCopy = arena->CopyFrom(source);
+    ASSERT_NE(overflowCopy, nullptr);
+    EXPECT_EQ(overflowCopy->pts_, 3);
+    EXPECT_EQ(arena->overflowCount_, 1U);
+    overflowCopy = nullptr;
+    EXPECT_EQ(arena->idleSlabs_[1].size(), 0U);
+
+    arena->slabBytes_ = 0;
+    auto copy = arena->CopyFrom(source);
+    ASSERT_NE(copy, nullptr);
+    copy = nullptr;
+    EXPECT_EQ(arena->slabBytes_, 32 * 1024);
+    arena->Trim();
+    EXPECT_EQ(arena->slabBytes_, 0);
+    EXPECT_EQ(arena->idleSlabs_[1].size(), 0U);
+    EXPECT_FALSE(arena->Dump().empty());
+}
+} // CameraStandard
+} // OHOS
@@ -97,15 +97,19 @@ HWTEST_F(VideoEncoderUnitTest, video_encoder_unittest_002, TestSize.Level0)
     int64_t timestamp = VIDEO_FRAMERATE;
     GraphicTransformType graphicTransformType = GraphicTransformType::GRAPHIC_ROTATE_90;
     sptr<FrameRecord> frameRecord = new(std::nothrow) FrameRecord(videoBuffer, timestamp, graphicTransformType);
+    int32_t callbackCount = 0;
+    auto callback = [&callbackCount](sptr<FrameRecord>, bool) { callbackCount++; };
     frameRecord->timestamp_ = 1600000001LL;
-    encoder->EncodeSurfaceBuffer(frameRecord);
+    EXPECT_FALSE(encoder->EncodeSurfaceBuffer(frameRecord, callback));
 
     frameRecord->timestamp_ = 1000000000LL;
-    encoder->EncodeSurfaceBuffer(frameRecord);
+    EXPECT_FALSE(encoder->EncodeSurfaceBuffer(frameRecord, callback));
 
 
     frameRecord->timestamp_ = 1000000000LL;
-    encoder->EncodeSurfaceBuffer(frameRecord);
+    EXPECT_FALSE(encoder->EncodeSurfaceBuffer(frameRecord, callback));
+    EXPECT_EQ(callbackCount, 0);
+    EXPECT_TRUE(encoder->pendingFrames_.empty());
 
     std::string imageId = "testImageId";
     EXPECT_EQ(encoder->Release(), 0);
@@ -301,5 +305,39 @@ HWTEST_F(VideoEncoderUnitTest, video_encoder_unittest_014, TestSize.Level1)
     EXPECT_FALSE(encoder->EnqueueBuffer(frameRecord));
 }
 
+/*
+ * Feature: Framework
+ * Function: Test SubmitSurfaceBuffer and FetchSubmittedBuffer.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test submitted frames are fetched in timestamp order whatever the submission order.
+ */
+HWTEST_F(VideoEncoderUnitTest, video_encoder_unittest_015, TestSize.Level1)
+{
+    VideoCodecType type = VideoCodecType::VIDEO_ENCODE_TYPE_AVC;
+    ColorSpace colorSpace = ColorSpace::DISPLAY_P3;
+    std::shared_ptr<VideoEncoder> encoder = make_unique<VideoEncoder>(type, colorSpace);
+    GraphicTransformType graphicTransformType = GraphicTransformType::GRAPHIC_ROTATE_90;
+    std::vector<int64_t> timestamps = { 1000000300LL, 1000000100LL, 1000000200LL };
+    for (auto timestamp : timestamps) {
+        sptr<SurfaceBuffer> videoBuffer = SurfaceBuffer::Create();
+        ASSERT_NE(videoBuffer, nullptr);
+        encoder->SubmitSurfaceBuffer(new (std::nothrow) FrameRecord(videoBuffer, timestamp, graphicTransformType),
+            nullptr);
+    }
+    encoder->SubmitSurfaceBuffer(nullptr, nullptr);
+
+    sptr<FrameRecord> frameRecord = nullptr;
+    VideoEncoder::EncodedCallback callback;
+    ASSERT_TRUE(encoder->FetchSubmittedBuffer(frameRecord, callback));
+    EXPECT_EQ(frameRecord->GetTimeStamp(), 1000000100LL);
+    ASSERT_TRUE(encoder->FetchSubmittedBuffer(frameRecord, callback));
+    EXPECT_EQ(frameRecord->GetTimeStamp(), 1000000200LL);
+    ASSERT_TRUE(encoder->FetchSubmittedBuffer(frameRecord, callback));
+    EXPECT_EQ(frameRecord->GetTimeStamp(), 1000000300LL);
+    EXPECT_FALSE(encoder->FetchSubmittedBuffer(frameRecord, callback));
+}
+
 } // CameraStandard
 } // OHOS
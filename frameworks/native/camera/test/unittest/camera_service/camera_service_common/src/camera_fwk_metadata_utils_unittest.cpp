@@ -117,5 +117,52 @@ HWTEST_F(CameraFwkMetadataUtilsUnitTest, camera_fwk_metadata_utils_unittest_003,
     bool ret = CameraFwkMetadataUtils::UpdateMetadataTag(item, dstMetadata);
     EXPECT_FALSE(ret);
 }
+
+/*
+ * Feature: Framework
+ * Function: Test MergeMetadata with the system caller decision passed in.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test existing tags are updated in place, new tags are appended after the destination grows
+ * and system tags are dropped for a non system caller, by the merge and by the copy.
+ */
+HWTEST_F(CameraFwkMetadataUtilsUnitTest, camera_fwk_metadata_utils_unittest_004, TestSize.Level0)
+{
+    std::shared_ptr<OHOS::Camera::CameraMetadata> dstMetadata = std::make_shared<OHOS::Camera::CameraMetadata>(1, 0);
+    float zoomRatio = 1.0f;
+    ASSERT_TRUE(dstMetadata->addEntry(OHOS_CONTROL_ZOOM_RATIO, &zoomRatio, 1));
+
+    std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata = std::make_shared<OHOS::Camera::CameraMetadata>(3, 0);
+    float newZoomRatio = 2.0f;
+    uint8_t focusMode = OHOS_CAMERA_FOCUS_MODE_AUTO;
+    uint8_t beautyType = OHOS_CAMERA_BEAUTY_TYPE_AUTO;
+    ASSERT_TRUE(srcMetadata->addEntry(OHOS_CONTROL_BEAUTY_TYPE, &beautyType, 1));
+    ASSERT_TRUE(srcMetadata->addEntry(OHOS_CONTROL_FOCUS_MODE, &focusMode, 1));
+    ASSERT_TRUE(srcMetadata->addEntry(OHOS_CONTROL_ZOOM_RATIO, &newZoomRatio, 1));
+
+    EXPECT_TRUE(CameraFwkMetadataUtils::MergeMetadata(srcMetadata, dstMetadata, false));
+    camera_metadata_item_t item;
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItemCount(dstMetadata->get()), 2);
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItem(dstMetadata->get(), 0, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.item, OHOS_CONTROL_ZOOM_RATIO);
+    EXPECT_EQ(item.data.f[0], newZoomRatio);
+    ASSERT_EQ(OHOS::Camera::GetCameraMetadataItem(dstMetadata->get(), 1, &item), CAM_META_SUCCESS);
+    EXPECT_EQ(item.item, OHOS_CONTROL_FOCUS_MODE);
+    EXPECT_NE(OHOS::Camera::FindCameraMetadataItem(dstMetadata->get(), OHOS_CONTROL_BEAUTY_TYPE, &item),
+        CAM_META_SUCCESS);
+
+    EXPECT_TRUE(CameraFwkMetadataUtils::MergeMetadata(srcMetadata, dstMetadata, true));
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemCount(dstMetadata->get()), 3);
+    std::shared_ptr<OHOS::Camera::CameraMetadata> copyMetadata = CameraFwkMetadataUtils::CopyMetadata(dstMetadata);
+    ASSERT_NE(copyMetadata, nullptr);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemCount(copyMetadata->get()), 3);
+
+    copyMetadata = CameraFwkMetadataUtils::CopyMetadata(dstMetadata, false);
+    ASSERT_NE(copyMetadata, nullptr);
+    EXPECT_EQ(OHOS::Camera::GetCameraMetadataItemCount(copyMetadata->get()), 2);
+    EXPECT_NE(OHOS::Camera::FindCameraMetadataItem(copyMetadata->get(), OHOS_CONTROL_BEAUTY_TYPE, &item),
+        CAM_META_SUCCESS);
+}
 } // CameraStandard
 } // OHOS
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "camera_result_dispatcher_unittest.h"
+
+#include <memory>
+
+#include "camera_log.h"
+#include "camera_result_dispatcher.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace CameraStandard {
+
+void CameraResultDispatcherUnitTest::SetUpTestCase(void)
+{
+    MEDIA_DEBUG_LOG("CameraResultDispatcherUnitTest::SetUpTestCase started!");
+}
+
+void CameraResultDispatcherUnitTest::TearDownTestCase(void)
+{
+    MEDIA_DEBUG_LOG("CameraResultDispatcherUnitTest::TearDownTestCase started!");
+}
+
+void CameraResultDispatcherUnitTest::SetUp()
+{
+    MEDIA_DEBUG_LOG("CameraResultDispatcherUnitTest::SetUp started!");
+}
+
+void CameraResultDispatcherUnitTest::TearDown()
+{
+    MEDIA_DEBUG_LOG("CameraResultDispatcherUnitTest::TearDown started!");
+}
+
+/*
+ * Feature: Framework
+ * Function: Test CameraResultDispatcher Dispatch
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test that a subscriber is called once per result when any of its tags is present,
+ * and is not called when none of them is.
+ */
+HWTEST_F(CameraResultDispatcherUnitTest, camera_result_dispatcher_unittest_001, TestSize.Level0)
+{
+    const int32_t itemCount = 8;
+    const int32_t dataSize = 64;
+    auto result = std::make_shared<OHOS::Camera::CameraMetadata>(itemCount, dataSize);
+    float zoomRatio = 2.0f;
+    uint8_t protectionStatus = 1;
+    EXPECT_TRUE(result->addEntry(OHOS_CONTROL_ZOOM_RATIO, &zoomRatio, 1));
+    EXPECT_TRUE(result->addEntry(OHOS_DEVICE_PROTECTION_STATE, &protectionStatus, 1));
+
+    CameraResultDispatcher dispatcher;
+    int32_t zoomCalls = 0;
+    int32_t bothCalls = 0;
+    int32_t absentCalls = 0;
+    EXPECT_TRUE(dispatcher.Subscribe({ OHOS_CONTROL_ZOOM_RATIO },
+        [&zoomCalls](const CameraResultItems& items, uint64_t timestamp) {
+            zoomCalls++;
+            EXPECT_NE(items.Find(OHOS_CONTROL_ZOOM_RATIO), nullptr);
+        }));
+    EXPECT_TRUE(dispatcher.Subscribe({ OHOS_CONTROL_ZOOM_RATIO, OHOS_DEVICE_PROTECTION_STATE },
+        [&bothCalls](const CameraResultItems& items, uint64_t timestamp) { bothCalls++; }));
+    EXPECT_TRUE(dispatcher.Subscribe({ OHOS_CONTROL_FOCUS_MODE },
+        [&absentCalls](const CameraResultItems& items, uint64_t timestamp) { absentCalls++; }));
+    EXPECT_FALSE(dispatcher.Subscribe({ OHOS_CONTROL_FOCUS_MODE }, nullptr));
+
+    dispatcher.Dispatch(result->get(), 0);
+    dispatcher.Dispatch(nullptr, 0);
+    EXPECT_EQ(zoomCalls, 1);
+    EXPECT_EQ(bothCalls, 1);
+    EXPECT_EQ(absentCalls, 0);
+    EXPECT_NE(dispatcher.Dump().find("frames:1"), std::string::npos);
+}
+} // CameraStandard
+} // OHOS
@@ -1156,5 +1156,171 @@ HWTEST_F(HCameraHostManagerUnit, hcamera_host_manager_unittest_038, TestSize.Lev
     cameraHostManager_->NotifyDeviceStateChangeInfo(1, 2);
     ASSERT_NE(cameraHostManager_, nullptr);
 }
+
+/*
+ * Feature: Framework
+ * Function: Test BinaryCacheConverter save and parse.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the restore params read back from the binary cache equal the saved ones, an unchanged
+ *                  save keeps the cached records and a corrupted file is rejected.
+ */
+HWTEST_F(HCameraHostManagerUnit, hcamera_host_manager_unittest_039, TestSize.Level1)
+{
+    const std::string binaryFilePath = "/data/local/tmp/hcamera_host_manager_unittest_039.bin";
+    std::string clientName = "com.example.camera";
+    std::string cameraId = "device/0";
+    std::vector<StreamInfo_V1_1> streamInfos(1);
+    streamInfos[0].v1_0.streamId_ = 1;
+    streamInfos[0].v1_0.width_ = 1920;
+    streamInfos[0].v1_0.height_ = 1080;
+    std::shared_ptr<OHOS::Camera::CameraMetadata> settings = std::make_shared<OHOS::Camera::CameraMetadata>(1, 1);
+    uint8_t muteMode = 0;
+    settings->addEntry(OHOS_CONTROL_MUTE_MODE, &muteMode, 1);
+    sptr<HCameraRestoreParam> param = new HCameraRestoreParam(clientName, cameraId, streamInfos, settings,
+        PERSISTENT_DEFAULT_PARAM_OHOS, 0);
+    param->SetCloseCameraTime({1, 0});
+    BinaryCacheConverter::PersistentParamMap pMap = {{clientName, {{cameraId, param}}}};
+    BinaryCacheConverter::TransientParamMap tMap = {{clientName, param}};
+
+    BinaryCacheConverter converter;
+    EXPECT_TRUE(converter.SaveMapToBinaryFile(binaryFilePath, pMap, tMap, clientName, cameraId));
+    EXPECT_EQ(converter.records_.size(), 2);
+    EXPECT_TRUE(converter.SaveMapToBinaryFile(binaryFilePath, pMap, tMap, clientName, cameraId));
+
+    BinaryCacheConverter loader;
+    BinaryCacheConverter::PersistentParamMap loadedPMap;
+    BinaryCacheConverter::TransientParamMap loadedTMap;
+    std::string loadedClientName;
+    std::string loadedCameraId;
+    EXPECT_TRUE(loader.ParseBinaryFileToMap(binaryFilePath, loadedPMap, loadedTMap, loadedClientName, loadedCameraId));
+    EXPECT_EQ(loadedClientName, clientName);
+    EXPECT_EQ(loadedCameraId, cameraId);
+    ASSERT_EQ(loadedPMap[clientName].size(), 1);
+    ASSERT_EQ(loadedTMap.size(), 1);
+    sptr<HCameraRestoreParam> loadedParam = loadedPMap[clientName][cameraId];
+    ASSERT_NE(loadedParam, nullptr);
+    EXPECT_EQ(loadedParam->GetStreamInfo().size(), 1);
+    EXPECT_EQ(loadedParam->GetStreamInfo()[0].v1_0.width_, 1920);
+    EXPECT_EQ(loadedParam->GetCloseCameraTime().tv_sec, 1);
+    EXPECT_EQ(loadedParam->GetRestoreParamType(), PERSISTENT_DEFAULT_PARAM_OHOS);
+
+    FILE* file = fopen(binaryFilePath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    fseek(file, -1, SEEK_END);
+    fputc(0xff, file);
+    fclose(file);
+    loadedPMap.clear();
+    loadedTMap.clear();
+    EXPECT_FALSE(loader.ParseBinaryFileToMap(binaryFilePath, loadedPMap, loadedTMap, loadedClientName,
+        loadedCameraId));
+    EXPECT_TRUE(loadedPMap.empty());
+    remove(binaryFilePath.c_str());
+}
+
+/*
+ * Feature: Framework
+ * Function: Test BinaryCacheConverter migration from the json cache.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test LoadOrMigrate reads the json cache once, writes the binary cache and removes the json file,
+ *                  keeping the json file while the binary cache cannot be saved.
+ */
+HWTEST_F(HCameraHostManagerUnit, hcamera_host_manager_unittest_040, TestSize.Level1)
+{
+    const std::string jsonFilePath = "/data/local/tmp/hcamera_host_manager_unittest_040.json";
+    const std::string binaryFilePath = "/data/local/tmp/hcamera_host_manager_unittest_040.bin";
+    std::string clientName = "com.example.camera";
+    std::string cameraId = "device/0";
+    std::vector<StreamInfo_V1_1> streamInfos(1);
+    streamInfos[0].v1_0.streamId_ = 1;
+    std::shared_ptr<OHOS::Camera::CameraMetadata> settings = std::make_shared<OHOS::Camera::CameraMetadata>(1, 1);
+    sptr<HCameraRestoreParam> param = new HCameraRestoreParam(clientName, cameraId, streamInfos, settings,
+        PERSISTENT_DEFAULT_PARAM_OHOS, 0);
+    BinaryCacheConverter::PersistentParamMap pMap = {{clientName, {{cameraId, param}}}};
+    BinaryCacheConverter::TransientParamMap tMap;
+    remove(binaryFilePath.c_str());
+    ASSERT_TRUE(JsonCacheConverter::SaveMapToJsonFile(jsonFilePath, pMap, tMap, clientName, cameraId));
+
+    BinaryCacheConverter converter;
+    BinaryCacheConverter::PersistentParamMap loadedPMap;
+    BinaryCacheConverter::TransientParamMap loadedTMap;
+    std::string loadedClientName;
+    std::string loadedCameraId;
+    const std::string unwritableFilePath = "/data/local/tmp/hcamera_host_manager_unittest_040_absent/cache.bin";
+    EXPECT_TRUE(converter.LoadOrMigrate(unwritableFilePath, jsonFilePath, loadedPMap, loadedTMap, loadedClientName,
+        loadedCameraId));
+    EXPECT_EQ(loadedPMap[clientName].size(), 1);
+    EXPECT_EQ(access(jsonFilePath.c_str(), F_OK), 0);
+
+    loadedPMap.clear();
+    EXPECT_TRUE(converter.LoadOrMigrate(binaryFilePath, jsonFilePath, loadedPMap, loadedTMap, loadedClientName,
+        loadedCameraId));
+    EXPECT_EQ(loadedPMap[clientName].size(), 1);
+    EXPECT_EQ(loadedClientName, clientName);
+    EXPECT_NE(access(jsonFilePath.c_str(), F_OK), 0);
+    EXPECT_EQ(access(binaryFilePath.c_str(), F_OK), 0);
+    remove(binaryFilePath.c_str());
+
+    uint32_t generation = param->GetGeneration();
+    param->SetScanStatus(true);
+    EXPECT_NE(param->GetGeneration(), generation);
+    generation = param->GetGeneration();
+    param->MarkSettingChanged();
+    EXPECT_NE(param->GetGeneration(), generation);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test GetCameraAbility repeated calls.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test GetCameraAbility hands the same ability to repeated calls of the same client instead of
+ *                  building it again.
+ */
+HWTEST_F(HCameraHostManagerUnit, hcamera_host_manager_unittest_041, TestSize.Level1)
+{
+    cameraHostManager_->Init();
+    std::vector<std::string> cameraIds;
+    EXPECT_EQ(cameraHostManager_->GetCameras(cameraIds), CAMERA_OK);
+    for (const auto& cameraId : cameraIds) {
+        std::shared_ptr<OHOS::Camera::CameraMetadata> firstAbility;
+        std::shared_ptr<OHOS::Camera::CameraMetadata> secondAbility;
+        ASSERT_EQ(cameraHostManager_->GetCameraAbility(cameraId, firstAbility), CAMERA_OK);
+        ASSERT_EQ(cameraHostManager_->GetCameraAbility(cameraId, secondAbility), CAMERA_OK);
+        ASSERT_NE(firstAbility, nullptr);
+#ifndef HOOK_CAMERA_OPERATOR
+        EXPECT_EQ(firstAbility, secondAbility);
+#endif
+    }
+}
+
+/*
+ * Feature: Framework
+ * Function: Test camera generation.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test every camera reports the generation it was added at, no later than the current camera
+ *                  generation, and that an unknown camera reports 0.
+ */
+HWTEST_F(HCameraHostManagerUnit, hcamera_host_manager_unittest_042, TestSize.Level1)
+{
+    cameraHostManager_->Init();
+    std::vector<std::string> cameraIds;
+    EXPECT_EQ(cameraHostManager_->GetCameras(cameraIds), CAMERA_OK);
+    uint64_t generation = cameraHostManager_->GetCameraGeneration();
+    EXPECT_NE(generation, 0);
+    for (const auto& cameraId : cameraIds) {
+        uint64_t abilityGeneration = cameraHostManager_->GetCameraAbilityGeneration(cameraId);
+        EXPECT_NE(abilityGeneration, 0);
+        EXPECT_LE(abilityGeneration, generation);
+    }
+    EXPECT_EQ(cameraHostManager_->GetCameraAbilityGeneration("unknown_camera"), 0);
+    EXPECT_EQ(cameraHostManager_->GetCameraGeneration(), generation);
+}
 } // CameraStandard
 } // OHOS
\ No newline at end of file
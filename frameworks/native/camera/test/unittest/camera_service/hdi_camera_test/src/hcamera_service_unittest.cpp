@@ -3169,5 +3169,81 @@ HWTEST_F(HCameraServiceUnit, HCamera_service_unittest_079, TestSize.Level0)
     }
     EXPECT_EQ(isCorrect, false);
 }
+
+/*
+ * Feature: CameraService
+ * Function: Test GetCamerasSince
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test GetCamerasSince returns every camera for an unknown generation, the same cameras as
+ * GetCameraIds, and nothing for the generation it returned while no camera is added or removed. With the
+ * rotate plugin hook the generation is 0, so the abilities are never cached.
+ */
+HWTEST_F(HCameraServiceUnit, HCamera_service_unittest_080, TestSize.Level0)
+{
+    std::vector<string> expectedCameraIds;
+    cameraService_->GetCameraIds(expectedCameraIds);
+    ASSERT_NE(expectedCameraIds.size(), 0);
+
+    uint64_t generation = 0;
+    std::vector<string> cameraIds;
+    std::vector<string> changedCameraIds;
+    std::vector<shared_ptr<OHOS::Camera::CameraMetadata>> changedAbilityList;
+    EXPECT_EQ(cameraService_->GetCamerasSince(0, generation, cameraIds, changedCameraIds, changedAbilityList),
+        CAMERA_OK);
+#ifdef HOOK_CAMERA_OPERATOR
+    EXPECT_EQ(generation, 0);
+#else
+    EXPECT_NE(generation, 0);
+#endif
+    EXPECT_EQ(cameraIds, expectedCameraIds);
+    EXPECT_EQ(changedCameraIds, expectedCameraIds);
+    ASSERT_EQ(changedAbilityList.size(), expectedCameraIds.size());
+    for (size_t i = 0; i < expectedCameraIds.size(); i++) {
+        shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility;
+        cameraService_->GetCameraAbility(expectedCameraIds[i], cameraAbility);
+        EXPECT_EQ(changedAbilityList[i], cameraAbility);
+    }
+#ifndef HOOK_CAMERA_OPERATOR
+    uint64_t knownGeneration = generation;
+    EXPECT_EQ(cameraService_->GetCamerasSince(knownGeneration, generation, cameraIds, changedCameraIds,
+        changedAbilityList), CAMERA_OK);
+    EXPECT_EQ(generation, knownGeneration);
+    EXPECT_TRUE(cameraIds.empty());
+    EXPECT_TRUE(changedCameraIds.empty());
+    EXPECT_TRUE(changedAbilityList.empty());
+#endif
+}
+
+/*
+ * Feature: Framework
+ * Function: Test GetCatalogCameraMetaInfo
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the cached meta info of a camera is derived again when the foldable state changes
+ */
+HWTEST_F(HCameraServiceUnit, HCamera_service_unittest_081, TestSize.Level0)
+{
+#ifndef HOOK_CAMERA_OPERATOR
+    std::vector<string> cameraIds;
+    cameraService_->GetCameraIds(cameraIds);
+    ASSERT_NE(cameraIds.size(), 0);
+    shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility;
+    ASSERT_EQ(cameraService_->GetCameraAbility(cameraIds[0], cameraAbility), CAMERA_OK);
+    bool isFoldable = cameraService_->isFoldable;
+
+    cameraService_->GetCatalogCameraMetaInfo(cameraIds[0], cameraAbility);
+    ASSERT_NE(cameraService_->cameraCatalog_.find(cameraIds[0]), cameraService_->cameraCatalog_.end());
+    EXPECT_EQ(cameraService_->cameraCatalog_[cameraIds[0]].isFoldable, isFoldable);
+
+    cameraService_->isFoldable = !isFoldable;
+    cameraService_->GetCatalogCameraMetaInfo(cameraIds[0], cameraAbility);
+    EXPECT_EQ(cameraService_->cameraCatalog_[cameraIds[0]].isFoldable, !isFoldable);
+    cameraService_->isFoldable = isFoldable;
+    cameraService_->GetCatalogCameraMetaInfo(cameraIds[0], cameraAbility);
+#endif
+}
 }
 }
\ No newline at end of file
@@ -791,5 +791,121 @@ HWTEST_F(HStreamOperatorUnitTest, GetSupportRedoXtStyle_002, TestSize.Level0)
     ColorStylePhotoType flag = streamOp_->GetSupportRedoXtStyle();
     EXPECT_EQ(flag, ColorStylePhotoType::UNSET);
 }
+
+/**
+ * @tc.name  : Test StreamContainer lookups with stale ids
+ * @tc.number: StreamContainer_001
+ * @tc.desc  : Test GetStream and GetHdiStream, an index hit is checked against the current id of the stream and
+ *             a stream whose id changed after it was added is still found by a scan
+ */
+HWTEST_F(HStreamOperatorUnitTest, StreamContainer_001, TestSize.Level0)
+{
+    sptr<HStreamCommon> streamCap = GenStreamCapture();
+    ASSERT_NE(streamCap, nullptr);
+    const int32_t oldFwkId = 1;
+    const int32_t newFwkId = 2;
+    const int32_t oldHdiId = 11;
+    const int32_t newHdiId = 12;
+    streamCap->fwkStreamId_ = oldFwkId;
+    streamCap->SetHdiStreamId(oldHdiId);
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(streamCap));
+    EXPECT_EQ(streamOp_->streamContainer_.GetStream(oldFwkId), streamCap);
+    EXPECT_EQ(streamOp_->streamContainer_.GetHdiStream(oldHdiId), streamCap);
+
+    streamCap->fwkStreamId_ = newFwkId;
+    streamCap->SetHdiStreamId(newHdiId);
+    EXPECT_EQ(streamOp_->streamContainer_.GetStream(oldFwkId), nullptr);
+    EXPECT_EQ(streamOp_->streamContainer_.GetHdiStream(oldHdiId), nullptr);
+    EXPECT_EQ(streamOp_->streamContainer_.GetStream(newFwkId), streamCap);
+    EXPECT_EQ(streamOp_->streamContainer_.GetHdiStream(newHdiId), streamCap);
+}
+
+/**
+ * @tc.name  : Test StreamContainer with duplicate ids
+ * @tc.number: StreamContainer_002
+ * @tc.desc  : Test streams sharing an id keep the former order, the latest added first, in the lookups and in
+ *             GetStreams and GetAllStreams
+ */
+HWTEST_F(HStreamOperatorUnitTest, StreamContainer_002, TestSize.Level0)
+{
+    sptr<HStreamCommon> firstCap = GenStreamCapture();
+    sptr<HStreamCommon> secondCap = GenStreamCapture();
+    ASSERT_NE(firstCap, nullptr);
+    ASSERT_NE(secondCap, nullptr);
+    const int32_t sharedFwkId = 5;
+    const int32_t sharedHdiId = 15;
+    firstCap->fwkStreamId_ = sharedFwkId;
+    firstCap->SetHdiStreamId(sharedHdiId);
+    secondCap->fwkStreamId_ = sharedFwkId;
+    secondCap->SetHdiStreamId(sharedHdiId);
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(firstCap));
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(secondCap));
+
+    EXPECT_EQ(streamOp_->streamContainer_.GetStream(sharedFwkId), secondCap);
+    EXPECT_EQ(streamOp_->streamContainer_.GetHdiStream(sharedHdiId), secondCap);
+    std::list<sptr<HStreamCommon>> expected = { secondCap, firstCap };
+    EXPECT_EQ(streamOp_->streamContainer_.GetStreams(StreamType::CAPTURE), expected);
+    EXPECT_EQ(streamOp_->streamContainer_.GetAllStreams(), expected);
+}
+
+/**
+ * @tc.name  : Test StreamContainer Reindex
+ * @tc.number: StreamContainer_003
+ * @tc.desc  : Test Reindex indexes the ids assigned after the streams were added, and LinkInputAndOutputs
+ *             publishes a new snapshot once it assigned the HDI ids
+ */
+HWTEST_F(HStreamOperatorUnitTest, StreamContainer_003, TestSize.Level0)
+{
+    sptr<HStreamCommon> streamRep = GenStreamRepeat(RepeatStreamType::PREVIEW);
+    ASSERT_NE(streamRep, nullptr);
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(streamRep));
+    const int32_t hdiId = 21;
+    streamRep->SetHdiStreamId(hdiId);
+    EXPECT_EQ(streamOp_->streamContainer_.GetSnapshot()->hdiIndex.count(hdiId), 0);
+    streamOp_->streamContainer_.Reindex();
+    EXPECT_EQ(streamOp_->streamContainer_.GetSnapshot()->hdiIndex.count(hdiId), 1);
+    EXPECT_EQ(streamOp_->streamContainer_.GetHdiStream(hdiId), streamRep);
+
+    streamOp_->streamContainer_.Clear();
+    auto snapshot = streamOp_->streamContainer_.GetSnapshot();
+    streamOp_->LinkInputAndOutputs(nullptr, 0);
+    EXPECT_NE(streamOp_->streamContainer_.GetSnapshot(), snapshot);
+}
+
+/**
+ * @tc.name  : Test StreamContainer ordering
+ * @tc.number: StreamContainer_004
+ * @tc.desc  : Test GetStreams returns the streams of a type and GetAllStreams the streams of every type ordered
+ *             by framework id, whatever the order they were added in
+ */
+HWTEST_F(HStreamOperatorUnitTest, StreamContainer_004, TestSize.Level0)
+{
+    sptr<HStreamCommon> preview = GenStreamRepeat(RepeatStreamType::PREVIEW);
+    sptr<HStreamCommon> video = GenStreamRepeat(RepeatStreamType::VIDEO);
+    sptr<HStreamCommon> capture = GenStreamCapture();
+    ASSERT_NE(preview, nullptr);
+    ASSERT_NE(video, nullptr);
+    ASSERT_NE(capture, nullptr);
+    const int32_t videoFwkId = 1;
+    const int32_t captureFwkId = 2;
+    const int32_t previewFwkId = 3;
+    preview->fwkStreamId_ = previewFwkId;
+    video->fwkStreamId_ = videoFwkId;
+    capture->fwkStreamId_ = captureFwkId;
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(preview));
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(capture));
+    ASSERT_TRUE(streamOp_->streamContainer_.AddStream(video));
+
+    std::list<sptr<HStreamCommon>> expectedRepeat = { video, preview };
+    EXPECT_EQ(streamOp_->streamContainer_.GetStreams(StreamType::REPEAT), expectedRepeat);
+    std::list<sptr<HStreamCommon>> expectedAll = { video, capture, preview };
+    EXPECT_EQ(streamOp_->streamContainer_.GetAllStreams(), expectedAll);
+    EXPECT_TRUE(streamOp_->streamContainer_.GetStreams(StreamType::METADATA).empty());
+
+    ASSERT_TRUE(streamOp_->streamContainer_.RemoveStream(capture));
+    expectedAll = { video, preview };
+    EXPECT_EQ(streamOp_->streamContainer_.GetAllStreams(), expectedAll);
+}
+
 } // namespace CameraStandard
 } // namespace OHOS
\ No newline at end of file
@@ -14,6 +14,7 @@
  */
 #include "camera_common_pipeline_unittest.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <future>
@@ -30,7 +31,6 @@
 #include "unified_pipeline_plugin.h"
 #include "unified_pipeline_process_node.h"
 #include "unified_pipeline_threadpool.h"
-#include "unified_pipeline_worker_thread.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -44,373 +44,6 @@ public:
     void TearDown() override {};
 };
 
-// Mock回调类
-class MockStatusCallback : public WorkerThread::WorkerThreadStatusCallback {
-public:
-    MOCK_METHOD(void, OnIdle, (), (override));
-};
-
-class WorkerThreadTest : public testing::Test {
-protected:
-    void SetUp() override
-    {
-        callback_ = std::make_shared<MockStatusCallback>();
-        worker_ = std::make_unique<WorkerThread>();
-        worker_->SetStatusCallback(callback_);
-    };
-    void TearDown() override
-    {
-        if (worker_) {
-            worker_->Shutdown();
-        }
-    };
-
-    std::shared_ptr<MockStatusCallback> callback_;
-    std::unique_ptr<WorkerThread> worker_;
-};
-
-/*
- * Feature: WorkerThread
- * Function: BasicOperation
- * SubFunction: TaskHandling
- * FunctionPoints: TaskSubmission, PromiseHandling
- * EnvConditions: NA
- * CaseDescription: Validate fundamental worker thread operations including task submission,
- * promise synchronization, and graceful shutdown procedure.
- */
-HWTEST_F(WorkerThreadTest, BasicOperation, TestSize.Level0)
-{
-    // Set expectation for OnIdle callback
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-
-    // Submit task
-    std::promise<void> promise;
-    auto future = promise.get_future();
-    auto task = std::make_shared<PipelineTask>([&promise]() { promise.set_value(); });
-
-    worker_->SubmitTask(task);
-    future.get(); // Wait for task completion
-
-    // Wait idle status
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-
-    worker_->Shutdown();
-}
-
-/*
- * Feature: WorkerThread
- * Function: IdleStateDetection
- * SubFunction: CallbackMechanism
- * FunctionPoints: OnIdleTrigger, StateTransition
- * EnvConditions: NA
- * CaseDescription: Verify idle callback triggering mechanism after task completion,
- * ensuring correct state transition to idle when no tasks are pending.
- */
-HWTEST_F(WorkerThreadTest, OnIdleTrigger, TestSize.Level0)
-{
-    // Set expectation for OnIdle callback
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-
-    // Submit empty task
-    auto task = std::make_shared<PipelineTask>([]() {});
-    worker_->SubmitTask(task);
-
-    // Wait for task completion and state transition
-    std::this_thread::sleep_for(std::chrono::milliseconds(50));
-
-    worker_->Shutdown();
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test basic state transitions
- * SubFunction: StateManagement
- * FunctionPoints: IdleState, RunningState
- * EnvConditions: NA
- * CaseDescription: Verify worker thread state transitions from idle to running and back to idle after task completion.
- * Checks initial idle state, task submission, execution verification and post-execution state.
- */
-HWTEST_F(WorkerThreadTest, BasicStateTransitions, TestSize.Level0)
-{
-    // Initial state should be IDLE
-    EXPECT_TRUE(worker_->IsIdle());
-
-    // Submit task
-    auto task = std::make_shared<PipelineTask>();
-    std::atomic<bool> taskExecuted(false);
-    task->func = [&] { taskExecuted = true; };
-
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-    EXPECT_TRUE(worker_->SubmitTask(task));
-
-    // Wait for task execution
-    int waitCount = 0;
-    while (!taskExecuted && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    EXPECT_TRUE(taskExecuted);
-    EXPECT_TRUE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test task submission in busy state
- * SubFunction: TaskSubmission
- * FunctionPoints: StateValidation
- * EnvConditions: NA
- * CaseDescription: Verify task submission fails when worker thread is not idle.
- *  Creates blocking task to keep thread busy, then attempts to submit second task which should be rejected.
- */
-HWTEST_F(WorkerThreadTest, SubmitWhenNotIdle, TestSize.Level0)
-{
-    std::mutex taskMutex;
-    std::condition_variable taskCv;
-    bool taskBlock = true;
-
-    // Create blocking task
-    auto blockingTask = std::make_shared<PipelineTask>();
-    blockingTask->func = [&] {
-        std::unique_lock<std::mutex> lock(taskMutex);
-        taskCv.wait(lock, [&] { return !taskBlock; });
-    };
-
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-    EXPECT_TRUE(worker_->SubmitTask(blockingTask));
-
-    // Wait for entering running state
-    int waitCount = 0;
-    while (worker_->threadStatus_ != WorkerThread::ThreadStatus::RUNNING && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    EXPECT_FALSE(worker_->IsIdle());
-
-    // Try to submit new task (should fail)
-    auto secondTask = std::make_shared<PipelineTask>();
-    secondTask->func = [] {};
-    EXPECT_FALSE(worker_->SubmitTask(secondTask));
-
-    // Release task
-    {
-        std::lock_guard<std::mutex> lock(taskMutex);
-        taskBlock = false;
-        taskCv.notify_one();
-    }
-
-    // Wait for entering running state
-    waitCount = 0;
-    while (worker_->threadStatus_ != WorkerThread::ThreadStatus::IDLE && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    EXPECT_TRUE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test shutdown operation
- * SubFunction: LifecycleManagement
- * FunctionPoints: ShutdownProcedure
- * EnvConditions: NA
- * CaseDescription: Verify proper shutdown behavior including task rejection after shutdown and final state transition.
- *  Tests immediate shutdown and validates post-shutdown state and task submission blocking.
- */
-HWTEST_F(WorkerThreadTest, ShutdownBehavior, TestSize.Level0)
-{
-    // Shutdown immediately
-    worker_->Shutdown();
-
-    // Submitting task after shutdown should fail
-    auto task = std::make_shared<PipelineTask>();
-    task->func = [] {};
-    EXPECT_FALSE(worker_->SubmitTask(task));
-
-    // State after shutdown should be DONE
-    EXPECT_FALSE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test shutdown during task execution
- * SubFunction: LifecycleManagement
- * FunctionPoints: ShutdownSafety
- * EnvConditions: NA
- * CaseDescription: Verify safe shutdown during task execution.
- *  Task initiates shutdown internally, validates proper task completion and thread state after shutdown.
- */
-HWTEST_F(WorkerThreadTest, ShutdownDuringTask, TestSize.Level0)
-{
-    std::atomic<bool> taskCompleted(false);
-    std::atomic<bool> taskStarted(false);
-
-    auto task = std::make_shared<PipelineTask>();
-    task->func = [&] {
-        taskStarted = true;
-        // Call shutdown inside task
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        taskCompleted = true;
-    };
-
-    EXPECT_CALL(*callback_, OnIdle()).Times(0);
-    EXPECT_TRUE(worker_->SubmitTask(task));
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    EXPECT_TRUE(taskStarted);
-
-    worker_->Shutdown();
-    // Wait for task completion
-    int waitCount = 0;
-    while (!taskCompleted && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
-    EXPECT_TRUE(taskCompleted);
-    // State after shutdown should be DONE
-    EXPECT_FALSE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test null/empty task handling
- * SubFunction: TaskValidation
- * FunctionPoints: NullTaskHandling
- * EnvConditions: NA
- * CaseDescription: Verify proper handling of null tasks and tasks with empty functions.
- *  Tests submission of nullptr task and task with null function, validates state transitions remain stable.
- */
-HWTEST_F(WorkerThreadTest, NullTaskHandling, TestSize.Level0)
-{
-    // Test nullptr task
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-    EXPECT_TRUE(worker_->SubmitTask(nullptr));
-
-    // Wait for idle state
-    int waitCount = 0;
-    while (!worker_->IsIdle() && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    // Test empty function task
-    auto emptyTask = std::make_shared<PipelineTask>();
-    emptyTask->func = nullptr;
-
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-    EXPECT_TRUE(worker_->SubmitTask(emptyTask));
-
-    // Wait for idle state
-    waitCount = 0;
-    while (!worker_->IsIdle() && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    EXPECT_TRUE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test callback object lifecycle
- * SubFunction: ResourceManagement
- * FunctionPoints: CallbackSafety
- * EnvConditions: NA
- * CaseDescription: Verify thread safety when callback object is destroyed before worker thread.
- *  Creates and destroys callback object, then validates task submission doesn't cause crashes.
- */
-HWTEST_F(WorkerThreadTest, CallbackDestruction, TestSize.Level0)
-{
-    // Create temporary callback
-    auto tempCallback = std::make_shared<MockStatusCallback>();
-    worker_->SetStatusCallback(tempCallback);
-
-    // Destroy callback object
-    tempCallback.reset();
-
-    // Submitting task should not crash
-    auto task = std::make_shared<PipelineTask>();
-    task->func = [] {};
-    EXPECT_TRUE(worker_->SubmitTask(task));
-
-    // Wait for task completion
-    int waitCount = 0;
-    while (!worker_->IsIdle() && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    EXPECT_TRUE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test sequential task submission
- * SubFunction: TaskProcessing
- * FunctionPoints: TaskQueueing
- * EnvConditions: NA
- * CaseDescription: Verify proper execution of multiple sequential tasks.
- *  Submits series of tasks, validates all execute successfully and maintain correct state transitions between tasks.
- */
-HWTEST_F(WorkerThreadTest, MultipleTaskSubmission, TestSize.Level0)
-{
-    constexpr int TASK_COUNT = 5;
-    std::atomic<int> taskCounter(0);
-
-    EXPECT_CALL(*callback_, OnIdle()).Times(TASK_COUNT);
-
-    for (int i = 0; i < TASK_COUNT; i++) {
-        auto task = std::make_shared<PipelineTask>();
-        task->func = [&] { taskCounter++; };
-
-        // Wait for idle state
-        int waitCount = 0;
-        while (!worker_->IsIdle() && waitCount++ < 50) {
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        }
-
-        EXPECT_TRUE(worker_->SubmitTask(task));
-    }
-
-    // Wait for all tasks completion
-    int waitCount = 0;
-    while (taskCounter < TASK_COUNT && waitCount++ < 100) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-    EXPECT_EQ(taskCounter, TASK_COUNT);
-    EXPECT_TRUE(worker_->IsIdle());
-}
-
-/*
- * Feature: WorkerThread
- * Function: Test concurrent access
- * SubFunction: ThreadSafety
- * FunctionPoints: ConcurrencyControl
- * EnvConditions: NA
- * CaseDescription: Verify thread safety under concurrent access.
- *  Creates multiple threads attempting to submit tasks simultaneously, validates only one submission succeeds.
- */
-HWTEST_F(WorkerThreadTest, ConcurrentAccess, TestSize.Level0)
-{
-    EXPECT_CALL(*callback_, OnIdle()).Times(1);
-    constexpr int THREAD_COUNT = 4;
-    std::vector<std::thread> threads;
-    std::atomic<int> successCount(0);
-
-    for (int i = 0; i < THREAD_COUNT; i++) {
-        threads.emplace_back([&] {
-            auto task = std::make_shared<PipelineTask>();
-            task->func = [] { std::this_thread::sleep_for(std::chrono::milliseconds(10)); };
-            if (worker_->IsIdle() && worker_->SubmitTask(task)) {
-                successCount++;
-            }
-        });
-    }
-
-    for (auto& t : threads) {
-        t.join();
-    }
-
-    // Wait for idle state
-    int waitCount = 0;
-    while (!worker_->IsIdle() && waitCount++ < 50) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-    }
-
-    // Only one task should be submitted successfully
-    EXPECT_EQ(successCount, 1);
-}
-
 /*
  * Feature: UnifiedPipelineThreadpool
  * Function: BasicFunctionality
@@ -581,6 +214,82 @@ HWTEST_F(UnifiedPipelineThreadpoolTest, SubmitTasksOverThreads, TestSize.Level0)
     threadpool->Shutdown();
 }
 
+/*
+ * Feature: UnifiedPipelineThreadpool
+ * Function: WorkStealing
+ * SubFunction: LoadBalancing
+ * FunctionPoints: Post, StealTask
+ * EnvConditions: NA
+ * CaseDescription: Block one worker and verify the tasks queued on its deque are stolen and run by the other worker.
+ */
+HWTEST_F(UnifiedPipelineThreadpoolTest, StealFromBlockedWorker, TestSize.Level0)
+{
+    constexpr size_t MIN_THREADS = 1;
+    constexpr size_t MAX_THREADS = 2;
+    constexpr int32_t TASK_COUNT = 10;
+    auto threadpool = std::make_shared<UnifiedPipelineThreadpool>(MIN_THREADS, MAX_THREADS);
+
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    auto blocker = threadpool->Submit([released]() { released.wait(); });
+    ASSERT_NE(blocker, nullptr);
+
+    std::vector<std::future<void>> futures;
+    for (int32_t i = 0; i < TASK_COUNT; i++) {
+        auto taskPtr = threadpool->Submit([]() {});
+        ASSERT_NE(taskPtr, nullptr);
+        futures.push_back(taskPtr->get_future());
+    }
+    // Half of the tasks were queued behind the blocker, they only complete if they are stolen.
+    for (auto& future : futures) {
+        EXPECT_EQ(future.wait_for(std::chrono::milliseconds(1000)), std::future_status::ready);
+    }
+    EXPECT_EQ(threadpool->workers_.size(), MAX_THREADS);
+
+    release.set_value();
+    blocker->get_future().get();
+    threadpool->Shutdown();
+}
+
+/*
+ * Feature: UnifiedPipelineThreadpool
+ * Function: PressureStatistics
+ * SubFunction: Histogram
+ * FunctionPoints: GetPressure
+ * EnvConditions: NA
+ * CaseDescription: Verify every task is accounted in the queue depth and latency histograms and the percentiles
+ * are ordered.
+ */
+HWTEST_F(UnifiedPipelineThreadpoolTest, PressureHistogram, TestSize.Level0)
+{
+    constexpr size_t MIN_THREADS = 1;
+    constexpr size_t MAX_THREADS = 1;
+    constexpr int32_t TASK_COUNT = 20;
+    auto threadpool = std::make_shared<UnifiedPipelineThreadpool>(MIN_THREADS, MAX_THREADS);
+
+    std::shared_ptr<std::packaged_task<void()>> lastTask = nullptr;
+    for (int32_t i = 0; i < TASK_COUNT; i++) {
+        lastTask = threadpool->Submit([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+        ASSERT_NE(lastTask, nullptr);
+    }
+    lastTask->get_future().get();
+
+    PipelinePressure pressure = threadpool->GetPressure();
+    uint64_t depthSamples = 0;
+    uint64_t latencySamples = 0;
+    for (size_t i = 0; i < PipelinePressure::BUCKET_COUNT; i++) {
+        depthSamples += pressure.depthHistogram[i];
+        latencySamples += pressure.latencyHistogram[i];
+    }
+    EXPECT_EQ(depthSamples, TASK_COUNT);
+    EXPECT_EQ(latencySamples, TASK_COUNT);
+    EXPECT_EQ(pressure.queueDepth, 0);
+    EXPECT_GT(pressure.latencyP50Us, 0);
+    EXPECT_GE(pressure.latencyP99Us, pressure.latencyP50Us);
+
+    threadpool->Shutdown();
+}
+
 // Mock Data Consumer Class
 class MockDataConsumer : public UnifiedPipelineDataConsumer {
 public:
@@ -779,6 +488,154 @@ HWTEST_F(UnifiedPipelineUnitTest, RemovePlugin_Normal, TestSize.Level0)
     EXPECT_EQ(pipeline_->plugins_.size(), 0);
 }
 
+class IndexedPipelineBuffer : public UnifiedPipelineBuffer {
+public:
+    explicit IndexedPipelineBuffer(int32_t index) : index_(index) {}
+    int32_t index_ = 0;
+};
+
+// Finishes buffers out of order and consumes every command
+class ShufflingPlugin : public UnifiedPipelinePlugin {
+public:
+    std::unique_ptr<UnifiedPipelineBuffer> ProcessBuffer(std::unique_ptr<UnifiedPipelineBuffer> bufferIn) override
+    {
+        auto indexed = static_cast<IndexedPipelineBuffer*>(bufferIn.get());
+        // 0, 5, 3, 1, 6, 4, 2 ms, so neighbours on different workers overtake each other
+        constexpr int32_t delayStride = 5;
+        constexpr int32_t delayModulus = 7;
+        std::this_thread::sleep_for(std::chrono::milliseconds(indexed->index_ * delayStride % delayModulus));
+        std::lock_guard<std::mutex> lock(mutex_);
+        finishOrder_.push_back(indexed->index_);
+        return bufferIn;
+    }
+
+    void ProcessCommand(UnifiedPipelineCommand* command) override
+    {
+        command->AddFlag(UnifiedPipelineCommand::FLAG_CONSUMED);
+    }
+
+    std::mutex mutex_;
+    std::vector<int32_t> finishOrder_;
+};
+
+class OrderRecordingConsumer : public UnifiedPipelineDataConsumer {
+public:
+    void OnBufferArrival(std::unique_ptr<UnifiedPipelineBuffer> pipelineBuffer) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        indexes_.push_back(static_cast<IndexedPipelineBuffer*>(pipelineBuffer.get())->index_);
+        cv_.notify_all();
+    }
+
+    void OnCommandArrival(std::unique_ptr<UnifiedPipelineCommand> command) override
+    {
+        commandCount_++;
+    }
+
+    bool WaitForCount(size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, std::chrono::seconds(2), [this, count] { return indexes_.size() >= count; });
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<int32_t> indexes_;
+    std::atomic<int32_t> commandCount_ { 0 };
+};
+
+/*
+ * Feature: UnifiedPipeline
+ * Function: OnBufferArrival
+ * SubFunction: NA
+ * FunctionPoints: Ordered delivery
+ * EnvConditions: NA
+ * CaseDescription: Test buffers reach the data consumer in arrival order when several workers finish them out of
+ * order, and a command consumed by a plugin does not hold back the buffers behind it
+ */
+HWTEST_F(UnifiedPipelineUnitTest, OnBufferArrival_OrderedDelivery, TestSize.Level0)
+{
+    constexpr int32_t bufferCount = 100;
+    constexpr size_t workerCount = 4;
+    auto pipeline = std::make_shared<UnifiedPipeline>(workerCount);
+    pipeline->GetThreadPool()->SetThreadCount(workerCount, workerCount);
+    auto dataConsumer = std::make_shared<OrderRecordingConsumer>();
+    auto plugin = std::make_shared<ShufflingPlugin>();
+    pipeline->SetDataConsumer(dataConsumer);
+    pipeline->AddPlugin(1, plugin);
+
+    for (int32_t i = 0; i < bufferCount; i++) {
+        pipeline->OnBufferArrival(std::make_unique<IndexedPipelineBuffer>(i));
+        if (i == bufferCount / 2) {
+            pipeline->OnCommandArrival(
+                std::make_unique<UnifiedPipelineCommand>(UnifiedPipelineCommandId::VIDEO_BUFFER_END, nullptr));
+        }
+    }
+
+    ASSERT_TRUE(dataConsumer->WaitForCount(bufferCount));
+    EXPECT_EQ(pipeline->GetThreadPool()->workers_.size(), workerCount);
+    {
+        // the plugin really finished buffers out of order, otherwise the check below proves nothing
+        std::lock_guard<std::mutex> lock(plugin->mutex_);
+        EXPECT_FALSE(std::is_sorted(plugin->finishOrder_.begin(), plugin->finishOrder_.end()));
+    }
+    std::lock_guard<std::mutex> lock(dataConsumer->mutex_);
+    for (int32_t i = 0; i < bufferCount; i++) {
+        EXPECT_EQ(dataConsumer->indexes_[i], i);
+    }
+    EXPECT_EQ(dataConsumer->commandCount_, 0);
+}
+
+// Records the latency samples the pipeline reports while the node runs
+class PressureRecordingNode : public UnifiedPiplineProcessNodeDefault {
+public:
+    std::unique_ptr<UnifiedPipelineBuffer> ProcessBuffer(std::unique_ptr<UnifiedPipelineBuffer> bufferIn) override
+    {
+        PipelinePressure pressure = GetPipelinePressureStats();
+        uint64_t latencySamples = 0;
+        for (size_t i = 0; i < PipelinePressure::BUCKET_COUNT; i++) {
+            latencySamples += pressure.latencyHistogram[i];
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        latencySamples_.push_back(latencySamples);
+        return bufferIn;
+    }
+
+    std::mutex mutex_;
+    std::vector<uint64_t> latencySamples_;
+};
+
+/*
+ * Feature: UnifiedPipeline
+ * Function: GetPipelinePressureStats
+ * SubFunction: NA
+ * FunctionPoints: Pressure monitor wiring
+ * EnvConditions: NA
+ * CaseDescription: Test a process node added through a plugin reads the latency histogram of the pipeline
+ * thread pool, and its own task is already accounted when it runs
+ */
+HWTEST_F(UnifiedPipelineUnitTest, GetPipelinePressureStats_FromProcessNode, TestSize.Level0)
+{
+    constexpr int32_t bufferCount = 10;
+    auto dataConsumer = std::make_shared<OrderRecordingConsumer>();
+    auto plugin = std::make_shared<UnifiedPipelinePlugin>();
+    auto node = std::make_shared<PressureRecordingNode>();
+    plugin->AddProcessNode(1, node);
+    pipeline_->SetDataConsumer(dataConsumer);
+    pipeline_->AddPlugin(1, plugin);
+
+    for (int32_t i = 0; i < bufferCount; i++) {
+        pipeline_->OnBufferArrival(std::make_unique<IndexedPipelineBuffer>(i));
+    }
+
+    ASSERT_TRUE(dataConsumer->WaitForCount(bufferCount));
+    std::lock_guard<std::mutex> lock(node->mutex_);
+    ASSERT_EQ(node->latencySamples_.size(), bufferCount);
+    for (auto latencySamples : node->latencySamples_) {
+        EXPECT_GT(latencySamples, 0);
+    }
+}
+
 class UnifiedPipelineManagerTest : public testing::Test {
 protected:
     void SetUp() override
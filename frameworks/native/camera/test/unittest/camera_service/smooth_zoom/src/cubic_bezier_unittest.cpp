@@ -22,6 +22,65 @@ using namespace testing::ext;
 
 namespace OHOS {
 namespace CameraStandard {
+namespace {
+// Reference of the curve as it was solved before the X samples were tabulated, the search reevaluates the curve
+// at every probe.
+struct ReferenceBezier {
+    float x1;
+    float y1;
+    float x2;
+    float y2;
+};
+
+float ReferenceBezierValue(float time, float point1, float point2)
+{
+    constexpr float CUBIC_BEZIER_MULTIPLE = 3.0;
+    return CUBIC_BEZIER_MULTIPLE * (1 - time) * (1 - time) * time * point1 +
+        CUBIC_BEZIER_MULTIPLE * (1 - time) * time * time * point2 + time * time * time;
+}
+
+float ReferenceInterpolation(const ReferenceBezier& curve, float input)
+{
+    constexpr float MAX_RESOLUTION = 4000.0;
+    constexpr float SERCH_STEP = 1.0 / MAX_RESOLUTION;
+    int low = 0;
+    int high = MAX_RESOLUTION;
+    int found = -1;
+    while (low <= high && found < 0) {
+        int middle = (low + high) / 2;
+        float approximation = ReferenceBezierValue(SERCH_STEP * middle, curve.x1, curve.x2);
+        if (approximation < input) {
+            low = middle + 1;
+        } else if (approximation > input) {
+            high = middle - 1;
+        } else {
+            found = middle;
+        }
+    }
+    return ReferenceBezierValue(SERCH_STEP * (found < 0 ? low : found), curve.y1, curve.y2);
+}
+
+void ExpectSameZoomArray(std::shared_ptr<CubicBezier> cubicBezier, const ReferenceBezier& curve)
+{
+    const std::vector<std::pair<float, float>> zoomPairs = {
+        {100.0, 200.0}, {100.0, 1000.0}, {1000.0, 100.0}, {250.0, 260.0}, {60.0, 1500.0}, {510.0, 100.0},
+    };
+    for (float frameInterval : {1000.0f / 30, 1000.0f / 60, 1000.0f / 24}) {
+        for (const auto& zoomPair : zoomPairs) {
+            float duration = cubicBezier->GetDuration(zoomPair.first, zoomPair.second);
+            std::vector<float> result = cubicBezier->GetZoomArray(zoomPair.first, zoomPair.second, frameInterval);
+            int arraySize = static_cast<int>(duration / frameInterval);
+            ASSERT_EQ(result.size(), static_cast<size_t>(arraySize + 1));
+            for (int i = 1; i <= arraySize; i++) {
+                float zoom = zoomPair.first + (zoomPair.second - zoomPair.first) *
+                    ReferenceInterpolation(curve, frameInterval * i / duration);
+                EXPECT_FLOAT_EQ(result[i - 1], zoom);
+            }
+            EXPECT_FLOAT_EQ(result.back(), zoomPair.second);
+        }
+    }
+}
+} // namespace
 
 void CubicBezierUnitTest::SetUpTestCase(void)
 {
@@ -292,5 +351,85 @@ HWTEST_F(CubicBezierUnitTest, cubic_bezier_unittest_014, TestSize.Level1)
     float intput = cubicBezier->GetCubicBezierX(SERCH_STEP * middle);
     EXPECT_FLOAT_EQ(cubicBezier->BinarySearch(intput), middle);
 }
+
+/*
+ * Feature: Framework
+ * Function: Test GetInterpolation.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test GetInterpolation matches the reference solve over the whole input range.
+ */
+HWTEST_F(CubicBezierUnitTest, cubic_bezier_unittest_015, TestSize.Level1)
+{
+    auto cubicBezier = std::make_shared<CubicBezier>();
+    std::vector<float> zoomBezierValue = {300.0, 0.3, 0.1, 0.6, 0.9};
+    ReferenceBezier defaultCurve = {0.4, 0.0, 0.2, 1.0};
+    ReferenceBezier halCurve = {0.3, 0.1, 0.6, 0.9};
+    constexpr int INPUT_COUNT = 10000;
+    for (int i = 0; i <= INPUT_COUNT; i++) {
+        float input = static_cast<float>(i) / INPUT_COUNT;
+        EXPECT_FLOAT_EQ(cubicBezier->GetInterpolation(input), ReferenceInterpolation(defaultCurve, input));
+    }
+    EXPECT_TRUE(cubicBezier->SetBezierValue(zoomBezierValue));
+    for (int i = 0; i <= INPUT_COUNT; i++) {
+        float input = static_cast<float>(i) / INPUT_COUNT;
+        EXPECT_FLOAT_EQ(cubicBezier->GetInterpolation(input), ReferenceInterpolation(halCurve, input));
+    }
+}
+
+/*
+ * Feature: Framework
+ * Function: Test GetZoomArray.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test GetZoomArray matches the reference curve with the default and the HAL control points.
+ */
+HWTEST_F(CubicBezierUnitTest, cubic_bezier_unittest_016, TestSize.Level1)
+{
+    auto cubicBezier = std::make_shared<CubicBezier>();
+    ExpectSameZoomArray(cubicBezier, {0.4, 0.0, 0.2, 1.0});
+    std::vector<float> zoomBezierValue = {450.0, 0.25, 0.1, 0.25, 1.0};
+    EXPECT_TRUE(cubicBezier->SetBezierValue(zoomBezierValue));
+    ExpectSameZoomArray(cubicBezier, {0.25, 0.1, 0.25, 1.0});
+}
+
+/*
+ * Feature: Framework
+ * Function: Test SetBezierValue.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the control points of one instance do not affect another instance.
+ */
+HWTEST_F(CubicBezierUnitTest, cubic_bezier_unittest_017, TestSize.Level1)
+{
+    auto halBezier = std::make_shared<CubicBezier>();
+    auto defaultBezier = std::make_shared<CubicBezier>();
+    std::vector<float> zoomBezierValue = {300.0, 0.5, 0.5, 1.0, 1.0};
+    EXPECT_TRUE(halBezier->SetBezierValue(zoomBezierValue));
+    EXPECT_FLOAT_EQ(defaultBezier->mDurationBase, 450.0);
+    EXPECT_FLOAT_EQ(defaultBezier->mControPointX1, 0.4);
+    EXPECT_FLOAT_EQ(defaultBezier->mControPointX2, 0.2);
+    ExpectSameZoomArray(defaultBezier, {0.4, 0.0, 0.2, 1.0});
+}
+
+/*
+ * Feature: Framework
+ * Function: Test SetBezierValue.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test SetBezierValue abnormal branch with too few values.
+ */
+HWTEST_F(CubicBezierUnitTest, cubic_bezier_unittest_018, TestSize.Level1)
+{
+    auto cubicBezier = std::make_shared<CubicBezier>();
+    std::vector<float> zoomBezierValue = {300.0, 0.5};
+    EXPECT_FALSE(cubicBezier->SetBezierValue(zoomBezierValue));
+    EXPECT_FLOAT_EQ(cubicBezier->mDurationBase, 450.0);
+    EXPECT_FLOAT_EQ(cubicBezier->mControPointX1, 0.4);
+}
 } // CameraStandard
 } // OHOS
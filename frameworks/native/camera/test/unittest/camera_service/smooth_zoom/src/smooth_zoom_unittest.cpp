@@ -18,6 +18,7 @@
 #include "camera_log.h"
 #include "cubic_bezier.h"
 #include "smooth_zoom.h"
+#include "smooth_zoom_planner.h"
 
 using namespace testing::ext;
 
@@ -61,5 +62,91 @@ HWTEST_F(SmoothZoomUnitTest, smooth_zoom_unittest_001, TestSize.Level1)
     ASSERT_TRUE(algorithm != nullptr);
 }
 
+/*
+ * Feature: Framework
+ * Function: Test SmoothZoomPlanner GetZoomStatus.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the cached status is only returned for the device, generation and mode it was read for.
+ */
+HWTEST_F(SmoothZoomUnitTest, smooth_zoom_unittest_002, TestSize.Level1)
+{
+    SmoothZoomPlanner planner;
+    int device = 0;
+    int otherDevice = 0;
+    float fps = 0.0f;
+    std::vector<float> crossZoomAndTime;
+    EXPECT_FALSE(planner.GetZoomStatus(&device, 1, 0, fps, crossZoomAndTime));
+
+    planner.SetZoomStatus(&device, 1, 0, 30.0f, {200.0, 300.0, 400.0});
+    EXPECT_TRUE(planner.GetZoomStatus(&device, 1, 0, fps, crossZoomAndTime));
+    EXPECT_FLOAT_EQ(fps, 30.0f);
+    EXPECT_EQ(crossZoomAndTime, std::vector<float>({200.0, 300.0, 400.0}));
+    EXPECT_FALSE(planner.GetZoomStatus(&device, 2, 0, fps, crossZoomAndTime));
+    EXPECT_FALSE(planner.GetZoomStatus(&device, 1, 1, fps, crossZoomAndTime));
+    EXPECT_FALSE(planner.GetZoomStatus(&otherDevice, 1, 0, fps, crossZoomAndTime));
+
+    planner.Invalidate();
+    EXPECT_FALSE(planner.GetZoomStatus(&device, 1, 0, fps, crossZoomAndTime));
+}
+
+/*
+ * Feature: Framework
+ * Function: Test SmoothZoomPlanner GetZoomArray.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the planner keeps its curve in step with the control points it is given.
+ */
+HWTEST_F(SmoothZoomUnitTest, smooth_zoom_unittest_003, TestSize.Level1)
+{
+    SmoothZoomPlanner planner;
+    std::vector<float> zoomBezierValue = {300.0, 0.3, 0.1, 0.6, 0.9};
+    float frameInterval = 1000.0f / 30;
+    auto defaultBezier = SmoothZoom::GetZoomAlgorithm(SmoothZoomType::NORMAL);
+    auto halBezier = SmoothZoom::GetZoomAlgorithm(SmoothZoomType::NORMAL);
+    ASSERT_TRUE(halBezier->SetBezierValue(zoomBezierValue));
+
+    std::vector<float> expected = defaultBezier->GetZoomArray(100.0, 500.0, frameInterval);
+    EXPECT_EQ(planner.GetZoomArray(SmoothZoomType::NORMAL, {}, 100.0, 500.0, frameInterval), expected);
+    expected = halBezier->GetZoomArray(100.0, 500.0, frameInterval);
+    EXPECT_EQ(planner.GetZoomArray(SmoothZoomType::NORMAL, zoomBezierValue, 100.0, 500.0, frameInterval), expected);
+    expected = halBezier->GetZoomArray(500.0, 120.0, frameInterval);
+    EXPECT_EQ(planner.GetZoomArray(SmoothZoomType::NORMAL, zoomBezierValue, 500.0, 120.0, frameInterval), expected);
+    expected = defaultBezier->GetZoomArray(500.0, 120.0, frameInterval);
+    EXPECT_EQ(planner.GetZoomArray(SmoothZoomType::NORMAL, {}, 500.0, 120.0, frameInterval), expected);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test SmoothZoomPlanner GetZoomBezierValue.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the bezier control points are served for the ability they were read from only.
+ */
+HWTEST_F(SmoothZoomUnitTest, smooth_zoom_unittest_004, TestSize.Level1)
+{
+    SmoothZoomPlanner planner;
+    auto ability = std::make_shared<int>(0);
+    auto otherAbility = std::make_shared<int>(0);
+    bool isFound = false;
+    std::vector<float> zoomBezierValue;
+    EXPECT_FALSE(planner.GetZoomBezierValue(ability, isFound, zoomBezierValue));
+
+    planner.SetZoomBezierValue(ability, true, {300.0, 0.3, 0.1, 0.6, 0.9});
+    EXPECT_TRUE(planner.GetZoomBezierValue(ability, isFound, zoomBezierValue));
+    EXPECT_TRUE(isFound);
+    EXPECT_EQ(zoomBezierValue, std::vector<float>({300.0, 0.3, 0.1, 0.6, 0.9}));
+    EXPECT_FALSE(planner.GetZoomBezierValue(otherAbility, isFound, zoomBezierValue));
+
+    planner.SetZoomBezierValue(otherAbility, false, {});
+    EXPECT_TRUE(planner.GetZoomBezierValue(otherAbility, isFound, zoomBezierValue));
+    EXPECT_FALSE(isFound);
+    EXPECT_TRUE(zoomBezierValue.empty());
+    otherAbility = nullptr;
+    EXPECT_FALSE(planner.GetZoomBezierValue(otherAbility, isFound, zoomBezierValue));
+}
 } // CameraStandard
 } // OHOS
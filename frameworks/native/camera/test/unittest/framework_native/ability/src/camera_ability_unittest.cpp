@@ -20,6 +20,7 @@
 #include "message_parcel.h"
 #include "surface.h"
 #include "ability/camera_ability.h"
+#include "ability/camera_ability_index.h"
 
 using namespace testing::ext;
 
@@ -152,5 +153,40 @@ HWTEST_F(CameraAbilityUnitTest, camera_ability_unittest_006, TestSize.Level0)
     EXPECT_FALSE(cameraAbility->IsFocusDrivenTypeSupported(FocusDrivenType::FOCUS_DRIVEN_TYPE_AUTO));
 }
 
+/*
+ * Feature: Framework
+ * Function: Test CameraAbilityIndex parses the capabilities of one mode
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test the zoom range of the featured mode and the supported modes are parsed once,
+ *                  and the index only matches its own ability and modes
+ */
+HWTEST_F(CameraAbilityUnitTest, camera_ability_unittest_007, TestSize.Level0)
+{
+    auto ability = std::make_shared<OHOS::Camera::CameraMetadata>(4, 64);
+    std::vector<int32_t> zoomCap = { SceneMode::CAPTURE, 100, 1000, SceneMode::VIDEO, 100, 600 };
+    ability->addEntry(OHOS_ABILITY_SCENE_ZOOM_CAP, zoomCap.data(), zoomCap.size());
+    std::vector<uint8_t> flashModes = { OHOS_CAMERA_FLASH_MODE_CLOSE, OHOS_CAMERA_FLASH_MODE_AUTO };
+    ability->addEntry(OHOS_ABILITY_FLASH_MODES, flashModes.data(), flashModes.size());
+
+    CameraAbilityIndex index(ability, SceneMode::VIDEO, SceneMode::VIDEO);
+    std::vector<float> expectedRange = { 1.0, 6.0 };
+    EXPECT_EQ(index.GetZoomRatioRange(), expectedRange);
+    EXPECT_TRUE(index.GetRAWZoomRatioRange().empty());
+    std::vector<FlashMode> expectedFlashModes = { FLASH_MODE_CLOSE, FLASH_MODE_AUTO };
+    EXPECT_EQ(index.GetSupportedFlashModes(), expectedFlashModes);
+    EXPECT_TRUE(index.GetSupportedFocusModes().empty());
+
+    EXPECT_TRUE(index.IsMatched(ability, SceneMode::VIDEO, SceneMode::VIDEO));
+    EXPECT_FALSE(index.IsMatched(ability, SceneMode::CAPTURE, SceneMode::CAPTURE));
+    auto copiedAbility = std::make_shared<OHOS::Camera::CameraMetadata>(4, 64);
+    EXPECT_FALSE(index.IsMatched(copiedAbility, SceneMode::VIDEO, SceneMode::VIDEO));
+
+    CameraAbilityIndex missingIndex(ability, SceneMode::PORTRAIT, SceneMode::PORTRAIT);
+    expectedRange = { 0.0, 0.0 };
+    EXPECT_EQ(missingIndex.GetZoomRatioRange(), expectedRange);
+}
+
 } // CameraStandard
 } // OHOS
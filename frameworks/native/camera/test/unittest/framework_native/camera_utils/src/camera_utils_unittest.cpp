@@ -15,6 +15,9 @@
 
 #include "camera_utils_unittest.h"
 
+#include <chrono>
+#include <thread>
+
 #include "camera_log.h"
 #include "capture_scene_const.h"
 #include "message_parcel.h"
@@ -23,6 +26,8 @@
 #include "utils/camera_security_utils.h"
 #include "utils/dps_metadata_info.h"
 #include "utils/metadata_common_utils.h"
+#include "utils/session_result_dispatcher.h"
+#include "utils/session_shadow_state.h"
 
 using namespace testing::ext;
 
@@ -409,5 +414,125 @@ HWTEST_F(CameraUtilsUnitTest, camera_utils_unittest_015, TestSize.Level0)
     EXPECT_EQ(ret, 0);
 }
 
+/*
+ * Feature: Framework
+ * Function: Test SessionResultDispatcher routes results by tag and change.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test an ON_CHANGE route is called only when its tag value changes or its listener is replaced,
+ *                  an ON_PRESENT route on every report, a route without listener is not called, and a route
+ *                  given its tags later is called only once it has a listener and one of them is reported.
+ */
+HWTEST_F(CameraUtilsUnitTest, camera_utils_unittest_016, TestSize.Level0)
+{
+    SessionResultDispatcher dispatcher;
+    std::shared_ptr<int32_t> listener = std::make_shared<int32_t>(0);
+    int32_t changeCount = 0;
+    int32_t presentCount = 0;
+    int32_t idleCount = 0;
+    dispatcher.AddRoute({ { OHOS_CAMERA_MACRO_STATUS }, SessionResultDispatcher::Trigger::ON_CHANGE, true,
+        [&listener]() { return SessionResultDispatcher::GetListenerKey(listener); },
+        [&changeCount](const uint64_t, const std::shared_ptr<OHOS::Camera::CameraMetadata>&) { changeCount++; } });
+    dispatcher.AddRoute({ { OHOS_SMOOTH_ZOOM_DURATION }, SessionResultDispatcher::Trigger::ON_PRESENT, false, nullptr,
+        [&presentCount](const uint64_t, const std::shared_ptr<OHOS::Camera::CameraMetadata>&) { presentCount++; } });
+    dispatcher.AddRoute({ { OHOS_CAMERA_MACRO_STATUS }, SessionResultDispatcher::Trigger::ON_PRESENT, true, nullptr,
+        [&idleCount](const uint64_t, const std::shared_ptr<OHOS::Camera::CameraMetadata>&) { idleCount++; } });
+    bool isObserved = false;
+    int32_t observerCount = 0;
+    size_t observerRouteId = dispatcher.AddRoute({ {}, SessionResultDispatcher::Trigger::ON_PRESENT, true,
+        [&isObserved, &dispatcher]() { return isObserved ? reinterpret_cast<uintptr_t>(&dispatcher) : 0; },
+        [&observerCount](const uint64_t, const std::shared_ptr<OHOS::Camera::CameraMetadata>&) { observerCount++; } });
+
+    auto makeResult = [](uint8_t macroStatus) {
+        auto result = std::make_shared<OHOS::Camera::CameraMetadata>(2, 8);
+        int32_t duration = 100;
+        result->addEntry(OHOS_CAMERA_MACRO_STATUS, &macroStatus, 1);
+        result->addEntry(OHOS_SMOOTH_ZOOM_DURATION, &duration, 1);
+        return result;
+    };
+    dispatcher.Dispatch(0, makeResult(0));
+    dispatcher.Dispatch(1, makeResult(0));
+    EXPECT_EQ(changeCount, 1);
+    EXPECT_EQ(presentCount, 2);
+    dispatcher.Dispatch(2, makeResult(1));
+    EXPECT_EQ(changeCount, 2);
+    listener = std::make_shared<int32_t>(0);
+    dispatcher.Dispatch(3, makeResult(1));
+    EXPECT_EQ(changeCount, 3);
+    dispatcher.Invalidate();
+    dispatcher.Dispatch(4, makeResult(1));
+    EXPECT_EQ(changeCount, 4);
+    EXPECT_EQ(presentCount, 5);
+    EXPECT_EQ(idleCount, 0);
+    EXPECT_EQ(observerCount, 0);
+
+    dispatcher.AddRouteTags(observerRouteId, { OHOS_STATUS_SKETCH_STREAM_INFO });
+    isObserved = true;
+    dispatcher.Dispatch(5, makeResult(1));
+    EXPECT_EQ(observerCount, 0);
+    auto sketchResult = std::make_shared<OHOS::Camera::CameraMetadata>(1, 4);
+    int32_t sketchInfo = 1;
+    sketchResult->addEntry(OHOS_STATUS_SKETCH_STREAM_INFO, &sketchInfo, 1);
+    dispatcher.Dispatch(6, sketchResult);
+    EXPECT_EQ(observerCount, 1);
+    EXPECT_EQ(changeCount, 4);
+}
+
+/*
+ * Feature: Framework
+ * Function: Test SessionShadowState keeps the latest reported values within the staleness bound.
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test a result updates the shadow with the zoom, ISO, OIS mode and focus distance the device
+ *                  reports, an older frame does not replace a newer one, a stale value or an invalidated shadow is
+ *                  not served.
+ */
+HWTEST_F(CameraUtilsUnitTest, camera_utils_unittest_017, TestSize.Level0)
+{
+    SessionShadowState shadowState;
+    float zoomRatio = 0.0f;
+    EXPECT_FALSE(shadowState.Load(ShadowField::ZOOM_RATIO, zoomRatio));
+
+    auto result = std::make_shared<OHOS::Camera::CameraMetadata>(5, 20);
+    float requestedZoomRatio = 3.0f;
+    uint32_t currentZoomRatio = 200;
+    float reportedZoomRatio = 2.0f;
+    uint32_t isoValue = 400;
+    int32_t oisMode = TEST_INT32_VALUE;
+    float lensFocusDistance = 0.5f;
+    result->addEntry(OHOS_CONTROL_ZOOM_RATIO, &requestedZoomRatio, 1);
+    result->addEntry(OHOS_STATUS_CAMERA_CURRENT_ZOOM_RATIO, &currentZoomRatio, 1);
+    result->addEntry(OHOS_STATUS_ISO_VALUE, &isoValue, 1);
+    result->addEntry(OHOS_STATUS_OPTICAL_IMAGE_STABILIZATION_MODE, &oisMode, 1);
+    result->addEntry(OHOS_CONTROL_LENS_FOCUS_DISTANCE, &lensFocusDistance, 1);
+    shadowState.OnResult(TEST_INT64_VALUE, result);
+    EXPECT_TRUE(shadowState.Load(ShadowField::ZOOM_RATIO, zoomRatio));
+    EXPECT_EQ(zoomRatio, reportedZoomRatio);
+    uint32_t shadowIsoValue = 0;
+    EXPECT_TRUE(shadowState.Load(ShadowField::ISO_VALUE, shadowIsoValue));
+    EXPECT_EQ(shadowIsoValue, isoValue);
+    int32_t shadowOisMode = 0;
+    EXPECT_TRUE(shadowState.Load(ShadowField::OIS_MODE, shadowOisMode));
+    EXPECT_EQ(shadowOisMode, oisMode);
+    float shadowFocusDistance = 0.0f;
+    EXPECT_TRUE(shadowState.Load(ShadowField::FOCUS_DISTANCE, shadowFocusDistance));
+    EXPECT_EQ(shadowFocusDistance, lensFocusDistance);
+
+    shadowState.Store(ShadowField::ZOOM_RATIO, 1.0f, TEST_INT32_VALUE);
+    EXPECT_TRUE(shadowState.Load(ShadowField::ZOOM_RATIO, zoomRatio));
+    EXPECT_EQ(zoomRatio, reportedZoomRatio);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(TEST_INT32_VALUE));
+    EXPECT_FALSE(shadowState.Load(ShadowField::ZOOM_RATIO, zoomRatio, 1));
+    EXPECT_TRUE(shadowState.Load(ShadowField::ZOOM_RATIO, zoomRatio));
+
+    shadowState.Invalidate();
+    EXPECT_FALSE(shadowState.Load(ShadowField::ZOOM_RATIO, zoomRatio));
+    EXPECT_FALSE(shadowState.Load(ShadowField::ISO_VALUE, shadowIsoValue));
+    EXPECT_FALSE(shadowState.Load(ShadowField::FOCUS_DISTANCE, shadowFocusDistance));
+}
+
 } // CameraStandard
 } // OHOS
@@ -16703,5 +16703,57 @@ HWTEST_F(CaptureSessionUnitTest, capture_session_ext_unittest_017, TestSize.Leve
     int32_t ret = session->LockFocusTracking(point);
     EXPECT_EQ(CameraErrorCode::SESSION_NOT_CONFIG, ret);
 }
+
+/*
+ * Feature: Framework
+ * Function: Test GetIsoValue with a stale shadow state
+ * SubFunction: NA
+ * FunctionPoints: NA
+ * EnvConditions: NA
+ * CaseDescription: Test GetIsoValue serves a fresh shadow value, and once the shadow is stale it asks the service
+ *                  instead of returning the old mirror, and marks the shadow in use so the result routes run again
+ */
+HWTEST_F(CaptureSessionUnitTest, capture_session_ext_unittest_018, TestSize.Level0)
+{
+    sptr<CaptureSession> session = cameraManager_->CreateCaptureSession();
+    ASSERT_NE(session, nullptr);
+
+    auto cameraInput = cameraManager_->CreateCameraInput(cameras_[0]);
+    ASSERT_TRUE(DisMdmOpenCheck(cameraInput));
+
+    sptr<CaptureInput> input = cameraInput;
+    ASSERT_NE(input, nullptr);
+    input->Open();
+    UpdateCameraOutputCapability();
+    sptr<CaptureOutput> preview = CreatePreviewOutput(previewProfile_[0]);
+    ASSERT_NE(preview, nullptr);
+
+    EXPECT_EQ(session->BeginConfig(), CAMERA_OK);
+    EXPECT_EQ(session->AddInput(input), CAMERA_OK);
+    EXPECT_EQ(session->AddOutput(preview), CAMERA_OK);
+    EXPECT_EQ(session->CommitConfig(), CAMERA_OK);
+
+    uint32_t shadowIsoValue = 100;
+    session->shadowState_.Store(ShadowField::ISO_VALUE, shadowIsoValue, 0);
+    EXPECT_EQ(session->GetIsoValue(), shadowIsoValue);
+
+    uint32_t staleIsoValue = 123;
+    session->isoValue_ = staleIsoValue;
+    session->shadowState_.Invalidate();
+    uint32_t isoValue = session->GetIsoValue();
+    EXPECT_TRUE(session->shadowState_.IsInUse());
+    uint32_t refreshedIsoValue = 0;
+    if (session->shadowState_.Load(ShadowField::ISO_VALUE, refreshedIsoValue)) {
+        EXPECT_EQ(isoValue, refreshedIsoValue);
+        EXPECT_EQ(session->isoValue_, refreshedIsoValue);
+    } else {
+        EXPECT_EQ(isoValue, staleIsoValue);
+    }
+
+    input->Close();
+    preview->Release();
+    input->Release();
+    session->Release();
+}
 }
 }
\ No newline at end of file
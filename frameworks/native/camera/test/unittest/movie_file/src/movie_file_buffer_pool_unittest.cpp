@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/movie_file_buffer_pool.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+using TestBuffer = std::shared_ptr<std::vector<uint8_t>>;
+using TestBufferPool = MovieFileBufferPool<TestBuffer>;
+
+std::unique_ptr<TestBufferPool> CreateTestBufferPool(int32_t& allocCount, int32_t& freeCount)
+{
+    return std::make_unique<TestBufferPool>(
+        "testBufferPool",
+        [&allocCount](int32_t capacity) {
+            allocCount++;
+            return std::make_shared<std::vector<uint8_t>>(capacity);
+        },
+        [&freeCount](TestBuffer& buffer) {
+            freeCount++;
+            buffer = nullptr;
+        },
+        [](const TestBuffer& buffer) { return static_cast<int32_t>(buffer->size()); });
+}
+} // namespace
+
+class MovieFileBufferPoolUnitTest : public testing::Test {
+public:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/*
+ * Feature: MovieFileBufferPool
+ * Function: Acquire, Release
+ * SubFunction: NA
+ * FunctionPoints: Verify a released buffer is reused by samples of the same capacity class.
+ * EnvConditions: NA
+ * CaseDescription: Samples of 100 and 1000 bytes share the 1 KB class, the second acquire is a hit and allocates
+ *                  nothing.
+ */
+HWTEST_F(MovieFileBufferPoolUnitTest, AcquireRelease_ReusesCapacityClass, TestSize.Level0)
+{
+    int32_t allocCount = 0;
+    int32_t freeCount = 0;
+    auto bufferPool = CreateTestBufferPool(allocCount, freeCount);
+
+    TestBuffer buffer = bufferPool->Acquire(100);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(buffer->size(), static_cast<size_t>(TestBufferPool::MIN_CAPACITY));
+    auto* bufferData = buffer->data();
+    bufferPool->Release(std::move(buffer));
+
+    buffer = bufferPool->Acquire(1000);
+    ASSERT_NE(buffer, nullptr);
+    EXPECT_EQ(buffer->data(), bufferData);
+    EXPECT_EQ(allocCount, 1);
+    EXPECT_EQ(bufferPool->hitCount_, 1);
+    EXPECT_EQ(bufferPool->missCount_, 1);
+
+    TestBuffer largerBuffer = bufferPool->Acquire(TestBufferPool::MIN_CAPACITY + 1);
+    ASSERT_NE(largerBuffer, nullptr);
+    EXPECT_EQ(largerBuffer->size(), static_cast<size_t>(TestBufferPool::MIN_CAPACITY * 2));
+    EXPECT_EQ(allocCount, 2);
+    EXPECT_EQ(bufferPool->peakInUseCount_, 2);
+    bufferPool->Release(std::move(buffer));
+    bufferPool->Release(std::move(largerBuffer));
+    EXPECT_EQ(bufferPool->inUseCount_, 0);
+    EXPECT_EQ(freeCount, 0);
+}
+
+/*
+ * Feature: MovieFileBufferPool
+ * Function: Acquire, Release
+ * SubFunction: NA
+ * FunctionPoints: Verify the pool bounds what it keeps.
+ * EnvConditions: NA
+ * CaseDescription: Samples beyond the biggest class and buffers beyond the idle limit of a class are freed on
+ *                  release, the idle ones are freed with the pool.
+ */
+HWTEST_F(MovieFileBufferPoolUnitTest, Release_FreesUnpooledBuffers, TestSize.Level0)
+{
+    int32_t allocCount = 0;
+    int32_t freeCount = 0;
+    auto bufferPool = CreateTestBufferPool(allocCount, freeCount);
+
+    int32_t hugeSize = TestBufferPool::MIN_CAPACITY << TestBufferPool::CAPACITY_CLASS_COUNT;
+    TestBuffer hugeBuffer = bufferPool->Acquire(hugeSize);
+    ASSERT_NE(hugeBuffer, nullptr);
+    EXPECT_EQ(hugeBuffer->size(), static_cast<size_t>(hugeSize));
+    bufferPool->Release(std::move(hugeBuffer));
+    EXPECT_EQ(freeCount, 1);
+
+    std::vector<TestBuffer> buffers;
+    for (size_t i = 0; i < TestBufferPool::MAX_IDLE_PER_CLASS + 1; i++) {
+        buffers.push_back(bufferPool->Acquire(1));
+    }
+    for (auto& buffer : buffers) {
+        bufferPool->Release(std::move(buffer));
+    }
+    EXPECT_EQ(freeCount, 2);
+    EXPECT_EQ(bufferPool->Acquire(0), nullptr);
+
+    bufferPool = nullptr;
+    EXPECT_EQ(freeCount, static_cast<int32_t>(TestBufferPool::MAX_IDLE_PER_CLASS) + 2);
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_ABILITY_INDEX_H
+#define OHOS_CAMERA_ABILITY_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ability/camera_ability_const.h"
+#include "camera_metadata_operator.h"
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Capabilities of a device ability for one scene mode and featured mode, parsed once so the session
+ * getters read a field instead of looking the tags up and walking the per-mode arrays on each call.
+ * The index is immutable, a new ability or mode makes a new index.
+ */
+class CameraAbilityIndex {
+public:
+    CameraAbilityIndex(
+        const std::shared_ptr<OHOS::Camera::CameraMetadata>& ability, int32_t sceneMode, int32_t featuredMode);
+    ~CameraAbilityIndex() = default;
+
+    bool IsMatched(
+        const std::shared_ptr<OHOS::Camera::CameraMetadata>& ability, int32_t sceneMode, int32_t featuredMode) const;
+
+    // Empty when the ability has no scene zoom cap, {0, 0} when it has none for the featured mode.
+    inline const std::vector<float>& GetZoomRatioRange() const
+    {
+        return zoomRatioRange_;
+    }
+
+    // Empty when the ability has no raw zoom cap, {0, 0} when it has none for the scene mode.
+    inline const std::vector<float>& GetRAWZoomRatioRange() const
+    {
+        return rawZoomRatioRange_;
+    }
+
+    inline const std::vector<FocusMode>& GetSupportedFocusModes() const
+    {
+        return focusModes_;
+    }
+
+    inline const std::vector<FlashMode>& GetSupportedFlashModes() const
+    {
+        return flashModes_;
+    }
+
+    inline const std::vector<ExposureMode>& GetSupportedExposureModes() const
+    {
+        return exposureModes_;
+    }
+
+private:
+    void ParseZoomRatioRange(common_metadata_header_t* metadata);
+    void ParseRAWZoomRatioRange(common_metadata_header_t* metadata);
+    void ParseModes(common_metadata_header_t* metadata);
+
+    // Held so the identity check cannot match a new ability allocated at the same address.
+    std::shared_ptr<OHOS::Camera::CameraMetadata> ability_;
+    int32_t sceneMode_;
+    int32_t featuredMode_;
+    std::vector<float> zoomRatioRange_;
+    std::vector<float> rawZoomRatioRange_;
+    std::vector<FocusMode> focusModes_;
+    std::vector<FlashMode> flashModes_;
+    std::vector<ExposureMode> exposureModes_;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_ABILITY_INDEX_H
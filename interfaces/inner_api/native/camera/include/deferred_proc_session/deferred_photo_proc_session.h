@@ -58,6 +58,7 @@ public:
     void ProcessImage(const std::string& appName, const std::string& imageId);
     bool CancelProcessImage(const std::string& imageId);
     void NotifyProcessImage();
+    void ReleaseImageBuffer(const std::string& imageId);
     std::shared_ptr<IDeferredPhotoProcSessionCallback> GetCallback();
 private:
     friend class CameraManager;
@@ -1220,6 +1220,10 @@ private:
     void ReportEvent(const string& cameraId);
     int32_t RefreshServiceProxy();
     std::vector<sptr<CameraDevice>> GetCameraDeviceListFromServer();
+    int32_t GetCameraAbilitiesFromServer(const sptr<ICameraService>& serviceProxy,
+        std::vector<std::string>& cameraIds,
+        std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>>& cameraAbilityList);
+    void ResetCameraAbilityCache();
     bool IsSystemApp();
     vector<CameraFormat> GetSupportPhotoFormat(const int32_t modeName,
         std::shared_ptr<OHOS::Camera::CameraMetadata> metadata);
@@ -1311,6 +1315,12 @@ private:
     std::mutex cameraDeviceAbilitySupportMapMutex_;
     std::unordered_map<CameraAbilitySupportCacheKey, bool> cameraDeviceAbilitySupportMap_;
 
+    // Cameras and abilities as of cameraAbilityGeneration_, the service only resends what changed since.
+    std::mutex cameraAbilityCacheMutex_;
+    uint64_t cameraAbilityGeneration_ = 0;
+    std::vector<std::string> cachedCameraIds_;
+    std::unordered_map<std::string, std::shared_ptr<OHOS::Camera::CameraMetadata>> cameraAbilityCache_;
+
     std::mutex serviceProxyMutex_;
     sptr<ICameraService> serviceProxyPrivate_;
     std::mutex deathRecipientMutex_;
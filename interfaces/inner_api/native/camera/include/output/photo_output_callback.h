@@ -17,6 +17,7 @@
 #define OHOS_CAMERA_PHOTO_OUTPUT_CALLBACK_H
 
 #include "hstream_capture_photo_callback_stub.h"
+#include "istream_capture.h"
 #include "hstream_capture_thumbnail_callback_stub.h"
 #include "stream_capture_photo_asset_callback_stub.h"
 #include <native_image.h>
@@ -76,6 +77,16 @@ private:
     wptr<Surface> surface_ = nullptr;
 };
 
+// Hands the photo buffer back to the service once the app released the image, so it can be recycled.
+class PhotoBufferReleaseProcessor : public Media::IBufferProcessor {
+public:
+    explicit PhotoBufferReleaseProcessor(sptr<IStreamCapture> streamCapture) : streamCapture_(streamCapture) {}
+    void BufferRelease(sptr<SurfaceBuffer>& buffer) override;
+
+private:
+    wptr<IStreamCapture> streamCapture_ = nullptr;
+};
+
 class HStreamCapturePhotoCallbackImpl : public HStreamCapturePhotoCallbackStub {
 public:
     explicit HStreamCapturePhotoCallbackImpl(PhotoOutput* photoOutput) : innerPhotoOutput_(photoOutput) {}
@@ -47,12 +47,15 @@
 #include "effect_suggestion_info_parse.h"
 #include "capture_scene_const.h"
 #include "ability/camera_ability.h"
+#include "ability/camera_ability_index.h"
 #include "ability/camera_ability_parse_util.h"
 #include "fold_service_callback_stub.h"
 #include "pressure_status_callback_stub.h"
 #include "camera_switch_session_callback_stub.h"
 #include "native_info_callback.h"
 #include "features/composition_feature.h"
+#include "utils/session_result_dispatcher.h"
+#include "utils/session_shadow_state.h"
 
 namespace OHOS {
 namespace CameraStandard {
@@ -1067,6 +1070,14 @@ public:
      */
     int32_t GetZoomCenterPoint(Point& zoomCenterPoint);
 
+    /**
+     * @brief Get the zoom center point.
+     * @param Point current zoom center point.
+     * @param isForceRefresh query the service instead of the state reported by the latest results.
+     * @return errCode
+     */
+    int32_t GetZoomCenterPoint(Point& zoomCenterPoint, bool isForceRefresh);
+
     /**
      * @brief Set the centre point of exposure area.
      * @param Point which specifies the area to expose.
@@ -1387,6 +1398,14 @@ public:
      */
     int32_t GetZoomRatio(float& zoomRatio);
 
+    /**
+     * @brief Get the current Zoom Ratio.
+     * @param zoomRatio current Zoom Ratio.
+     * @param isForceRefresh query the service instead of the state reported by the latest results.
+     * @return Returns errCode.
+     */
+    int32_t GetZoomRatio(float& zoomRatio, bool isForceRefresh);
+
     /**
      * @brief Set Zoom ratio.
      *
@@ -2005,6 +2024,8 @@ public:
                                     const std::shared_ptr<OHOS::Camera::CameraMetadata> &result);
 
     virtual std::shared_ptr<OHOS::Camera::CameraMetadata> GetMetadata();
+    // Capabilities of the current device ability and mode, rebuilt when either changes.
+    std::shared_ptr<const CameraAbilityIndex> GetAbilityIndex();
 
     void GetMetadataFromService(sptr<CameraDevice> device);
 
@@ -2489,6 +2510,12 @@ protected:
     std::map<BeautyType, std::vector<int32_t>> beautyTypeAndRanges_;
     std::map<BeautyType, int32_t> beautyTypeAndLevels_;
     std::shared_ptr<MetadataResultProcessor> metadataResultProcessor_ = nullptr;
+    SessionResultDispatcher resultDispatcher_;
+    size_t outputResultRouteId_ = 0;
+    std::atomic<bool> isOutputResultObserved_ { false };
+    SessionShadowState shadowState_;
+    std::mutex abilityIndexMutex_;
+    std::shared_ptr<const CameraAbilityIndex> abilityIndex_ = nullptr;
     bool isImageDeferred_ = false;
     std::atomic<bool> isRawImageDelivery_ { false };
     bool isVideoDeferred_ = false;
@@ -2523,9 +2550,22 @@ protected:
     static const std::unordered_map<CameraEffectSuggestionType, EffectSuggestionType> metaEffectSuggestionTypeMap_;
     static const std::unordered_set<SceneMode> videoModeSet_;
 
+    std::mutex photoOutputMutex_;
     sptr<CaptureOutput> photoOutput_;
     std::atomic<int32_t> prevDrawingState_{-1};
 
+    inline void SetPhotoOutput(sptr<CaptureOutput> photoOutput)
+    {
+        std::lock_guard<std::mutex> lock(photoOutputMutex_);
+        photoOutput_ = photoOutput;
+    }
+
+    inline sptr<CaptureOutput> GetPhotoOutput()
+    {
+        std::lock_guard<std::mutex> lock(photoOutputMutex_);
+        return photoOutput_;
+    }
+
     inline void ClearPreconfigProfiles()
     {
         std::lock_guard<std::mutex> lock(preconfigProfilesMutex_);
@@ -2736,6 +2776,16 @@ protected:
     void RemoveOutputFromSet(sptr<CaptureOutput>& output);
     void OnSettingUpdated(std::shared_ptr<OHOS::Camera::CameraMetadata> changedMetadata);
     void OnResultReceived(std::shared_ptr<OHOS::Camera::CameraMetadata> changedMetadata);
+    void RegisterResultRoutes();
+    void RegisterFeatureResultRoutes();
+    void RegisterStatusResultRoutes();
+    // Listener key of the routes feeding the getters, 0 while no getter reads the shadow state.
+    uintptr_t GetShadowStateKey();
+    // GetStatus round trip for a getter whose shadow value went stale, metaOut keeps the data of item alive.
+    bool QueryDeviceStatus(uint32_t tag, const void* queryValue,
+        std::shared_ptr<OHOS::Camera::CameraMetadata>& metaOut, camera_metadata_item_t& item);
+    OISMode GetReportedOISMode();
+    void RefreshFocusDistance();
     ColorSpaceInfo GetSupportedColorSpaceInfo();
     void UpdateDeviceDeferredability();
     void SetAppHint();
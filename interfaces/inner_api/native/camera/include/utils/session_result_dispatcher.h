@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_SESSION_RESULT_DISPATCHER_H
+#define OHOS_CAMERA_SESSION_RESULT_DISPATCHER_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "camera_metadata_operator.h"
+#include "metadata_utils.h"
+
+namespace OHOS {
+namespace CameraStandard {
+constexpr size_t MAX_SESSION_RESULT_ROUTES = 64;
+
+/**
+ * Routes the device results received by a session to its result handlers. A route names the tags its
+ * handler reads and, through a probe, the listener it reports to. The routed tags are looked up in a
+ * single walk of the result, skipped entirely when no route has a listener, and a route is called when
+ * one of its tags is present, or only when one of them changed since the previous result. A new
+ * listener makes its route see the current values once, so it is not left waiting for the next change.
+ * Each tag keeps the mask of the routes reading it, the walk yields the routes to call without a lookup
+ * per route.
+ */
+class SessionResultDispatcher {
+public:
+    enum class Trigger : int32_t {
+        ON_PRESENT = 0,
+        ON_CHANGE,
+    };
+
+    using Handler =
+        std::function<void(const uint64_t timestamp, const std::shared_ptr<OHOS::Camera::CameraMetadata>& result)>;
+    // Identity of the listener behind a route, 0 when nobody listens.
+    using ListenerProbe = std::function<uintptr_t()>;
+
+    struct Route {
+        std::vector<uint32_t> tags;  // Empty to be called on every result.
+        Trigger trigger = Trigger::ON_PRESENT;
+        bool isListenerRequired = true;
+        ListenerProbe probe = nullptr;
+        Handler handler = nullptr;
+    };
+
+    // Routes are added while the session is built, before results flow. Returns the route id, or
+    // MAX_SESSION_RESULT_ROUTES when the route table is full.
+    size_t AddRoute(Route route);
+    void AddRouteTags(size_t routeId, const std::vector<uint32_t>& tags);
+    // Next result counts every present tag as changed.
+    void Invalidate();
+    void Dispatch(const uint64_t timestamp, const std::shared_ptr<OHOS::Camera::CameraMetadata>& result);
+
+    template<typename T>
+    static inline uintptr_t GetListenerKey(const std::shared_ptr<T>& listener)
+    {
+        return reinterpret_cast<uintptr_t>(listener.get());
+    }
+
+private:
+    struct RouteState {
+        Route route;
+        uintptr_t listenerKey = 0;
+        bool isReplayPending = true;
+    };
+
+    struct TagState {
+        uint64_t valueHash = 0;
+        uint64_t seenFrame = 0;
+        uint64_t routeMask = 0;
+    };
+
+    // Fills the masks of the routes with a tag present, and with a tag changed, in the result.
+    void ScanResultUnlocked(const common_metadata_header_t* header, uint64_t& presentMask, uint64_t& changedMask);
+
+    std::mutex mutex_;
+    std::vector<RouteState> routes_;
+    std::unordered_map<uint32_t, TagState> tagStates_;
+    uint64_t frameIndex_ = 0;
+    bool isInvalidated_ = false;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_SESSION_RESULT_DISPATCHER_H
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_SESSION_SHADOW_STATE_H
+#define OHOS_CAMERA_SESSION_SHADOW_STATE_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "camera_metadata_operator.h"
+
+namespace OHOS {
+namespace CameraStandard {
+enum class ShadowField : uint32_t {
+    ZOOM_RATIO = 0,
+    ZOOM_CENTER_POINT,
+    ISO_VALUE,
+    OIS_MODE,
+    FOCUS_DISTANCE,
+    FIELD_COUNT,
+};
+
+/**
+ * Last known device state of a session, fed by the per-frame results and by the status the getters read
+ * from the service, so the getters can answer without a GetStatus round trip. Each value carries
+ * the timestamp of the frame that reported it and the time it was last confirmed, a value older than
+ * the staleness bound is not served. Writers are serialized, reads take no lock. Reads also mark the state
+ * in use for a while, the session only feeds it from the results as long as it is read.
+ */
+class SessionShadowState {
+public:
+    static constexpr int64_t DEFAULT_MAX_AGE_MS = 200;
+    static constexpr int64_t IN_USE_WINDOW_MS = 1000;
+
+    static const std::vector<uint32_t>& GetResultTags();
+
+    void OnResult(const uint64_t timestamp, const std::shared_ptr<OHOS::Camera::CameraMetadata>& result);
+    // Forget every value, the getters go to the service until the results report them again.
+    void Invalidate();
+    // For the getters of session state kept outside of the shadow fields.
+    void MarkInUse() const;
+    // True when a read happened within IN_USE_WINDOW_MS.
+    bool IsInUse() const;
+
+    template<typename T>
+    void Store(ShadowField field, const T& value, uint64_t timestamp)
+    {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(uint64_t), "unsupported shadow type");
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(T));
+        StoreBits(field, bits, timestamp);
+    }
+
+    // Returns false when the value was never reported or is older than maxAgeMs.
+    template<typename T>
+    bool Load(ShadowField field, T& value, int64_t maxAgeMs = DEFAULT_MAX_AGE_MS) const
+    {
+        static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(uint64_t), "unsupported shadow type");
+        uint64_t bits = 0;
+        uint64_t timestamp = 0;
+        if (!LoadBits(field, bits, timestamp, maxAgeMs)) {
+            return false;
+        }
+        std::memcpy(&value, &bits, sizeof(T));
+        return true;
+    }
+
+private:
+    struct Entry {
+        std::atomic<uint32_t> sequence = 0; // Odd while the entry is written.
+        std::atomic<uint64_t> bits = 0;
+        std::atomic<uint64_t> timestamp = 0;
+        std::atomic<int64_t> confirmTimeMs = 0; // 0 when the entry holds no value.
+    };
+
+    void StoreBits(ShadowField field, uint64_t bits, uint64_t timestamp);
+    bool LoadBits(ShadowField field, uint64_t& bits, uint64_t& timestamp, int64_t maxAgeMs) const;
+    void StoreItem(const camera_metadata_item_t& item, uint64_t timestamp);
+
+    std::mutex writeMutex_;
+    mutable std::atomic<int64_t> lastReadTimeMs_ = 0;
+    std::array<Entry, static_cast<size_t>(ShadowField::FIELD_COUNT)> entries_;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_SESSION_SHADOW_STATE_H
@@ -17,6 +17,7 @@
 #define OHOS_CAMERA_MEDIA_STREAM_AUDIO_BUFFER_WRAPPER_H
 
 #include "buffer_wrapper_base.h"
+#include <memory>
 #include <string>
 #include <condition_variable>
 
@@ -28,6 +29,10 @@ class AudioBufferWrapper : public BufferWrapperBase {
 public:
     explicit AudioBufferWrapper(int64_t timestamp);
     explicit AudioBufferWrapper(int64_t timestamp, uint8_t* audioBuffer, uint32_t bufferSize);
+    // Refers to bufferSize bytes at offset inside a block shared with other wrappers, the block is
+    // freed with its last wrapper.
+    explicit AudioBufferWrapper(
+        int64_t timestamp, std::shared_ptr<uint8_t[]> sharedBlock, uint32_t offset, uint32_t bufferSize);
     ~AudioBufferWrapper() override;
 
     void SetStatusFinishEncodeStatus()
@@ -71,15 +76,19 @@ public:
     void SetAudioBuffer(uint8_t* audioBuffer, uint32_t bufferSize)
     {
         std::unique_lock<std::mutex> lock(mutex_);
+        FreeAudioBufferLocked();
         audioBuffer_ = audioBuffer;
         bufferSize_ = bufferSize;
     }
 
 private:
+    void FreeAudioBufferLocked();
+
     std::string wrapperId_;
     std::mutex mutex_;
     std::condition_variable canReleased_;
     uint8_t* audioBuffer_ {nullptr};
+    std::shared_ptr<uint8_t[]> sharedBlock_ {nullptr};
     uint32_t bufferSize_ {0};
 };
 } // CameraStandard
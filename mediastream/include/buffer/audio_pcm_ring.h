@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_MEDIA_STREAM_AUDIO_PCM_RING_H
+#define OHOS_CAMERA_MEDIA_STREAM_AUDIO_PCM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace OHOS {
+namespace CameraStandard {
+struct AudioPcmChunkView {
+    uint64_t sequence = 0;
+    int64_t timestamp = 0;
+    const uint8_t* data = nullptr;
+    uint32_t size = 0;
+};
+
+struct AudioPcmRange {
+    std::shared_ptr<uint8_t[]> block;
+    std::vector<int64_t> timestamps;
+    uint32_t chunkSize = 0;
+};
+
+/**
+ * Preallocated PCM history for moving photo audio. A single producer reads the capturer straight
+ * into the next chunk slot and commits it with a timestamp; timestamps are kept per slot so range
+ * queries binary search the ring instead of scanning it. Readers never block the producer: the
+ * oldest slot is the one being refilled and is never returned, and a copy is validated against the
+ * write sequence afterwards so chunks overwritten mid-copy are dropped instead of returned torn.
+ */
+class AudioPcmRing {
+public:
+    AudioPcmRing(uint32_t chunkCount, uint32_t chunkSize);
+    ~AudioPcmRing() = default;
+    AudioPcmRing(const AudioPcmRing&) = delete;
+    AudioPcmRing& operator=(const AudioPcmRing&) = delete;
+
+    // Producer side: fill the slot returned by AcquireWriteSlot, then publish it with CommitWrite.
+    uint8_t* AcquireWriteSlot();
+    void CommitWrite(int64_t timestamp);
+
+    // Views into the ring for chunks with timestamp in [startTime, endTime). A view stays readable
+    // until the producer laps it, which IsViewValid reports.
+    size_t GetRangeViews(int64_t startTime, int64_t endTime, std::vector<AudioPcmChunkView>& views) const;
+    bool IsViewValid(const AudioPcmChunkView& view) const;
+    // Copies chunks with timestamp in [startTime, endTime) into one contiguous block.
+    size_t CopyRange(int64_t startTime, int64_t endTime, AudioPcmRange& range) const;
+
+    uint32_t GetChunkCount() const
+    {
+        return chunkCount_;
+    }
+    uint32_t GetChunkSize() const
+    {
+        return chunkSize_;
+    }
+    size_t Size() const;
+
+private:
+    // Returns the first readable sequence and the write sequence, the latter being exclusive.
+    void GetReadableWindow(uint64_t& first, uint64_t& end) const;
+    uint64_t LowerBound(uint64_t first, uint64_t end, int64_t timestamp) const;
+    uint64_t FirstIntactSequence() const;
+
+    const uint32_t chunkCount_;
+    const uint32_t chunkSize_;
+    std::unique_ptr<uint8_t[]> storage_;
+    std::unique_ptr<std::atomic<int64_t>[]> timestamps_;
+    std::atomic<uint64_t> writeSequence_ {0};
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_MEDIA_STREAM_AUDIO_PCM_RING_H
@@ -17,7 +17,7 @@
 #define OHOS_CAMERA_MEDIA_STREAM_AUDIO_CAPTURER_SESSION_ADAPTER_H
 
 #include "audio_capturer.h"
-#include "blocking_queue.h"
+#include "audio_pcm_ring.h"
 #include "refbase.h"
 #include <atomic>
 #include <cstdint>
@@ -58,10 +58,10 @@ private:
     AudioCapturerInfo capturerInfo_;
     bool CreateAudioCapturer();
     std::unique_ptr<AudioCapturer> audioCapturer_ = nullptr;
-    BlockingQueue<sptr<AudioBufferWrapper>> audioBufferQueue_;
     std::atomic<bool> startAudioCapture_ { false };
     std::unique_ptr<std::thread> audioThread_ = nullptr;
     size_t bufferSize_;
+    std::unique_ptr<AudioPcmRing> audioRing_ = nullptr;
 };
 } // CameraStandard
 } // OHOS
@@ -20,7 +20,7 @@
 #include "surface.h"
 #include "blocking_queue.h"
 #include "video_buffer_wrapper.h"
-#include "fixed_size_list.h"
+#include "timestamp_ring_index.h"
 #include "meta_buffer_wrapper.h"
 #include "engine_context_ext.h"
 #include "cfilter.h"
@@ -69,7 +69,7 @@ protected:
 
 private:
     std::shared_ptr<Task> taskPtr_{nullptr};
-    std::shared_ptr<FixedSizeList<sptr<MetaBufferWrapper>>> metaCache_{nullptr};
+    std::shared_ptr<TimestampRingIndex<sptr<MetaBufferWrapper>>> metaCache_{nullptr};
     std::string name_;
     CFilterType filterType_ = CFilterType::MOVING_PHOTO_META_CACHE;
 
@@ -18,7 +18,7 @@
 
 #include "avbuffer_queue.h"
 #include "surface.h"
-#include "blocking_queue.h"
+#include "ring_blocking_queue.h"
 #include "video_buffer_wrapper.h"
 #include "meta_buffer_wrapper.h"
 #include "engine_context_ext.h"
@@ -108,7 +108,7 @@ private:
     int64_t latestPausedTime_{-1};
     int64_t totalPausedTime_{0};
 
-    BlockingQueue<sptr<VideoBufferWrapper>> videoBufferWrapperQueue_;
+    RingBlockingQueue<sptr<VideoBufferWrapper>> videoBufferWrapperQueue_;
     uint32_t preCacheFrameCount_ = PRE_CACHE_FRAME_COUNT;
     uint32_t postCacheFrameCount_ = POST_CACHE_FRAME_COUNT;
 };
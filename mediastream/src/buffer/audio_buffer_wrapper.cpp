@@ -33,13 +33,19 @@ AudioBufferWrapper::AudioBufferWrapper(
     SetAudioBuffer(audioBuffer, bufferSize);
 }
 
+AudioBufferWrapper::AudioBufferWrapper(int64_t timestamp, std::shared_ptr<uint8_t[]> sharedBlock, uint32_t offset,
+    uint32_t bufferSize) : AudioBufferWrapper(timestamp)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    sharedBlock_ = std::move(sharedBlock);
+    audioBuffer_ = sharedBlock_ == nullptr ? nullptr : sharedBlock_.get() + offset;
+    bufferSize_ = bufferSize;
+}
+
 AudioBufferWrapper::~AudioBufferWrapper()
 {
     MEDIA_DEBUG_LOG("~AudioBufferWrapper %{public}" PRId64, GetTimestamp());
-    if (audioBuffer_ != nullptr) {
-        delete audioBuffer_;
-        audioBuffer_ = nullptr;
-    }
+    FreeAudioBufferLocked();
 }
 
 bool AudioBufferWrapper::Release()
@@ -51,13 +57,20 @@ bool AudioBufferWrapper::Release()
             [this] { return IsFinishEncode(); });
         MEDIA_DEBUG_LOG("releaseSurfaceBuffer go %{public}s", wrapperId_.c_str());
     }
-    if (audioBuffer_ != nullptr) {
-        delete audioBuffer_;
-        audioBuffer_ = nullptr;
-    }
+    FreeAudioBufferLocked();
     return MEDIA_OK;
 }
 
+void AudioBufferWrapper::FreeAudioBufferLocked()
+{
+    if (sharedBlock_ != nullptr) {
+        sharedBlock_.reset();
+    } else if (audioBuffer_ != nullptr) {
+        delete[] audioBuffer_;
+    }
+    audioBuffer_ = nullptr;
+}
+
 } // namespace CameraStandard
 } // namespace OHOS
 // LCOV_EXCL_STOP
\ No newline at end of file
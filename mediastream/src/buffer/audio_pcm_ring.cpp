@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_pcm_ring.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+// Keeps at least one chunk between the producer and the readers, see GetReadableWindow.
+constexpr uint32_t MIN_CHUNK_COUNT = 2;
+}
+
+AudioPcmRing::AudioPcmRing(uint32_t chunkCount, uint32_t chunkSize)
+    : chunkCount_(std::max(chunkCount, MIN_CHUNK_COUNT)), chunkSize_(chunkSize),
+      storage_(new uint8_t[static_cast<size_t>(chunkCount_) * chunkSize_]()),
+      timestamps_(new std::atomic<int64_t>[chunkCount_])
+{
+    for (uint32_t i = 0; i < chunkCount_; ++i) {
+        timestamps_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+uint8_t* AudioPcmRing::AcquireWriteSlot()
+{
+    uint64_t sequence = writeSequence_.load(std::memory_order_relaxed);
+    return storage_.get() + static_cast<size_t>(sequence % chunkCount_) * chunkSize_;
+}
+
+void AudioPcmRing::CommitWrite(int64_t timestamp)
+{
+    uint64_t sequence = writeSequence_.load(std::memory_order_relaxed);
+    timestamps_[sequence % chunkCount_].store(timestamp, std::memory_order_relaxed);
+    writeSequence_.store(sequence + 1, std::memory_order_release);
+    // Keeps the writes into the next slot after the publish, the readers rely on it to detect a lap.
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+size_t AudioPcmRing::Size() const
+{
+    uint64_t first = 0;
+    uint64_t end = 0;
+    GetReadableWindow(first, end);
+    return static_cast<size_t>(end - first);
+}
+
+void AudioPcmRing::GetReadableWindow(uint64_t& first, uint64_t& end) const
+{
+    end = writeSequence_.load(std::memory_order_acquire);
+    // The slot of sequence end - chunkCount_ is the one the producer refills next.
+    first = end >= chunkCount_ ? end - chunkCount_ + 1 : 0;
+}
+
+uint64_t AudioPcmRing::FirstIntactSequence() const
+{
+    uint64_t first = 0;
+    uint64_t end = 0;
+    GetReadableWindow(first, end);
+    return first;
+}
+
+uint64_t AudioPcmRing::LowerBound(uint64_t first, uint64_t end, int64_t timestamp) const
+{
+    while (first < end) {
+        uint64_t mid = first + (end - first) / 2;
+        if (timestamps_[mid % chunkCount_].load(std::memory_order_relaxed) < timestamp) {
+            first = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return first;
+}
+
+size_t AudioPcmRing::GetRangeViews(int64_t startTime, int64_t endTime, std::vector<AudioPcmChunkView>& views) const
+{
+    views.clear();
+    uint64_t first = 0;
+    uint64_t end = 0;
+    GetReadableWindow(first, end);
+    uint64_t begin = LowerBound(first, end, startTime);
+    uint64_t stop = LowerBound(begin, end, endTime);
+    views.reserve(static_cast<size_t>(stop - begin));
+    for (uint64_t sequence = begin; sequence < stop; ++sequence) {
+        size_t slot = static_cast<size_t>(sequence % chunkCount_);
+        views.push_back({ sequence, timestamps_[slot].load(std::memory_order_relaxed),
+            storage_.get() + slot * chunkSize_, chunkSize_ });
+    }
+    // Drop whatever the producer lapped while the views were being built.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t intact = FirstIntactSequence();
+    auto firstValid = std::find_if(views.begin(), views.end(),
+        [intact](const AudioPcmChunkView& view) { return view.sequence >= intact; });
+    views.erase(views.begin(), firstValid);
+    return views.size();
+}
+
+bool AudioPcmRing::IsViewValid(const AudioPcmChunkView& view) const
+{
+    // Orders the caller's reads of the view before the sequence check.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return view.sequence >= FirstIntactSequence();
+}
+
+size_t AudioPcmRing::CopyRange(int64_t startTime, int64_t endTime, AudioPcmRange& range) const
+{
+    range.block.reset();
+    range.timestamps.clear();
+    range.chunkSize = chunkSize_;
+    uint64_t first = 0;
+    uint64_t end = 0;
+    GetReadableWindow(first, end);
+    uint64_t begin = LowerBound(first, end, startTime);
+    uint64_t stop = LowerBound(begin, end, endTime);
+    if (begin == stop) {
+        return 0;
+    }
+    size_t count = static_cast<size_t>(stop - begin);
+    std::shared_ptr<uint8_t[]> block(new uint8_t[count * chunkSize_]);
+    range.timestamps.reserve(count);
+    for (uint64_t sequence = begin; sequence < stop; ++sequence) {
+        size_t slot = static_cast<size_t>(sequence % chunkCount_);
+        range.timestamps.push_back(timestamps_[slot].load(std::memory_order_relaxed));
+        (void)memcpy(block.get() + static_cast<size_t>(sequence - begin) * chunkSize_,
+            storage_.get() + slot * chunkSize_, chunkSize_);
+    }
+    // The copy above must not be reordered past the sequence check, or a torn chunk could pass it.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t intact = FirstIntactSequence();
+    if (intact > begin) {
+        // The oldest chunks were refilled during the copy, move the intact tail to the front.
+        size_t lapped = static_cast<size_t>(std::min<uint64_t>(intact - begin, count));
+        count -= lapped;
+        (void)memmove(block.get(), block.get() + lapped * chunkSize_, count * chunkSize_);
+        range.timestamps.erase(range.timestamps.begin(), range.timestamps.begin() + lapped);
+    }
+    if (count > 0) {
+        range.block = std::move(block);
+    }
+    return count;
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -15,7 +15,10 @@
 
 #include "audio_capture_adapter.h"
 
+#include <algorithm>
+
 #include "audio_errors.h"
+#include "audio_pcm_kernel.h"
 #include "audio_session_manager.h"
 #include "camera_log.h"
 #include "errors.h"
@@ -433,15 +436,8 @@ void AudioCaptureAdapter::SetAudioSource(AudioStandard::SourceType source)
 
 void AudioCaptureAdapter::TrackMaxAmplitude(int16_t *data, int32_t size)
 {
-    for (int32_t i = 0; i < size; i++) {
-        int16_t value = *data++;
-        if (value < 0) {
-            value = -value;
-        }
-        if (maxAmplitude_ < value) {
-            maxAmplitude_ = value;
-        }
-    }
+    CHECK_RETURN(data == nullptr || size <= 0);
+    maxAmplitude_ = std::max<int32_t>(maxAmplitude_, AudioPcmKernel::Peak(data, static_cast<size_t>(size)));
 }
 
 void AudioCaptureAdapter::SetFaultEvent(const std::string &errMsg, int32_t ret)
@@ -30,10 +30,7 @@
 namespace OHOS {
 namespace CameraStandard {
 
-constexpr int32_t READ_AUDIO_WAIT_TIME = 5;
-
 AudioCapturerSessionAdapter::AudioCapturerSessionAdapter()
-    : audioBufferQueue_("audioBuffer", AUDIO_CACHE_NUMBER)
 {
     deferredInputOptions_ = AudioStreamInfo(
         AudioSamplingRate::SAMPLE_RATE_48000,
@@ -52,6 +49,7 @@ AudioCapturerSessionAdapter::AudioCapturerSessionAdapter()
 
     bufferSize_ = static_cast<size_t>(deferredInputOptions_.samplingRate / AudioDeferredProcessAdapter::ONE_THOUSAND *
         deferredInputOptions_.channels * AudioDeferredProcessAdapter::DURATION_EACH_AUDIO_FRAME * sizeof(short));
+    audioRing_ = std::make_unique<AudioPcmRing>(AUDIO_CACHE_NUMBER, static_cast<uint32_t>(bufferSize_));
 }
 
 AudioChannel AudioCapturerSessionAdapter::getMicNum()
@@ -94,8 +92,6 @@ bool AudioCapturerSessionAdapter::CreateAudioCapturer()
 AudioCapturerSessionAdapter::~AudioCapturerSessionAdapter()
 {
     MEDIA_INFO_LOG("~AudioCapturerSessionAdapter enter");
-    audioBufferQueue_.SetActive(false);
-    audioBufferQueue_.Clear();
     Stop();
 }
 
@@ -126,12 +122,14 @@ void AudioCapturerSessionAdapter::GetAudioBuffersInTimeRange(
     int64_t startTime, int64_t endTime, vector<sptr<AudioBufferWrapper>> &audioBuffers)
 {
     audioBuffers.clear();
-    vector<sptr<AudioBufferWrapper>> cachedAudioBuffers = audioBufferQueue_.GetAllElements();
-    for (const auto& audioBuffer : cachedAudioBuffers) {
-        if (audioBuffer->GetTimestamp() >= startTime && audioBuffer->GetTimestamp() < endTime) {
-            audioBuffers.push_back(audioBuffer);
-        }
+    AudioPcmRange range;
+    size_t count = audioRing_->CopyRange(startTime, endTime, range);
+    audioBuffers.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        audioBuffers.emplace_back(new AudioBufferWrapper(
+            range.timestamps[i], range.block, static_cast<uint32_t>(i * range.chunkSize), range.chunkSize));
     }
+    MEDIA_DEBUG_LOG("GetAudioBuffersInTimeRange count: %{public}zu", count);
 }
 
 void AudioCapturerSessionAdapter::ReadLoop()
@@ -140,13 +138,12 @@ void AudioCapturerSessionAdapter::ReadLoop()
     size_t bufferLen = GetBufferSize();
     while (true) {
         CHECK_BREAK_WLOG(!startAudioCapture_, "Audio capture work done, thread out");
-        auto buffer = std::make_unique<uint8_t[]>(bufferLen);
-        CHECK_RETURN_ELOG(buffer == nullptr, "Failed to allocate buffer");
+        // Read straight into the ring slot, the capturer blocks until a full period is available.
+        uint8_t* buffer = audioRing_->AcquireWriteSlot();
         size_t bytesRead = 0;
         while (bytesRead < bufferLen) {
-            MEDIA_DEBUG_LOG("ReadLoop loop");
             CHECK_BREAK_WLOG(!startAudioCapture_, "ReadLoop loop, break out");
-            int32_t len = audioCapturer_->Read(*(buffer.get() + bytesRead), bufferLen - bytesRead, false);
+            int32_t len = audioCapturer_->Read(*(buffer + bytesRead), bufferLen - bytesRead, true);
             if (len >= 0) {
                 bytesRead += static_cast<size_t>(len);
             } else {
@@ -154,23 +151,14 @@ void AudioCapturerSessionAdapter::ReadLoop()
                 startAudioCapture_ = false;
                 break;
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(READ_AUDIO_WAIT_TIME));
         }
         if (!startAudioCapture_) {
-            buffer.reset();
             MEDIA_INFO_LOG("Audio capture work done, thread out");
             break;
         }
-        if (audioBufferQueue_.Full()) {
-            auto popWrapper = audioBufferQueue_.Pop();
-            CHECK_EXECUTE(popWrapper, popWrapper->Release());
-            MEDIA_DEBUG_LOG("audio release popBuffer");
-        }
-        sptr<AudioBufferWrapper> bufferWrapper = new AudioBufferWrapper(
-            GetTickCount() - TIME_OFFSET, buffer.get(), bufferLen);
-        MEDIA_DEBUG_LOG("OnBufferAvailable timestamp: %{public}" PRId64, bufferWrapper->GetTimestamp());
-        buffer.release();
-        audioBufferQueue_.Push(bufferWrapper);
+        int64_t timestamp = GetTickCount() - TIME_OFFSET;
+        audioRing_->CommitWrite(timestamp);
+        MEDIA_DEBUG_LOG("OnBufferAvailable timestamp: %{public}" PRId64, timestamp);
     }
 }
 
@@ -179,6 +167,8 @@ void AudioCapturerSessionAdapter::Stop()
     CAMERA_SYNC_TRACE;
     MEDIA_INFO_LOG("Audio capture stop enter");
     startAudioCapture_ = false;
+    // Wakes up a blocking Read so the read thread can observe the stop flag.
+    CHECK_EXECUTE(audioCapturer_ != nullptr, audioCapturer_->Stop());
     if (audioThread_ && audioThread_->joinable()) {
         audioThread_->join();
         audioThread_.reset();
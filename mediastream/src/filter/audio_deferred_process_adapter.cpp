@@ -15,6 +15,7 @@
 
 #include "audio_deferred_process_adapter.h"
 
+#include "audio_pcm_kernel.h"
 #include "camera_log.h"
 #include <cstring>
 
@@ -113,17 +114,11 @@ uint32_t AudioDeferredProcessAdapter::GetSingleInputSize()
 
 void AudioDeferredProcessAdapter::FadeOneBatch(OutputArray& outputArr)
 {
-    float rate;
     int16_t* data = reinterpret_cast<int16_t*>(outputArr.data());
-    int32_t temp;
     int32_t oneSize = outputOptions_.samplingRate / ONE_THOUSAND * DURATION_EACH_AUDIO_FRAME;
     CHECK_RETURN_ELOG(oneSize >= MAX_BATCH_OUTPUT_SIZE, "AudioDeferredProcessAdapter::FadeOneBatch arrSize overSize");
-    for (int k = 0; k < oneSize; k++) {
-        temp = static_cast<int32_t>(data[k]);
-        rate = static_cast<float>(k) / oneSize;
-        temp = temp - static_cast<int32_t>(temp * rate);
-        data[k] = static_cast<int16_t>(temp);
-    }
+    CHECK_RETURN(oneSize <= 0);
+    AudioPcmKernel::FadeOut(data, static_cast<size_t>(oneSize));
 }
 
 void AudioDeferredProcessAdapter::EffectChainProcess(InputArray& inputArr, OutputArray& outputArr)
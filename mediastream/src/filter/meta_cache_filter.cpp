@@ -30,6 +30,11 @@
 // LCOV_EXCL_START
 namespace OHOS {
 namespace CameraStandard {
+namespace {
+constexpr size_t META_CACHE_SIZE = 8;
+// Meta may be stamped a few microseconds off the video PTS, far below any frame interval.
+constexpr int64_t META_TIMESTAMP_TOLERANCE = 100000;
+}
 
 static AutoRegisterCFilter<MetaCacheFilter> g_registerMetaCacheFilter("builtin.camera.meta_cache",
     CFilterType::MOVING_PHOTO_META_CACHE,
@@ -100,7 +105,7 @@ private:
 MetaCacheFilter::MetaCacheFilter(std::string name, CFilterType type)
     : CFilter(name, type) {
 
-    metaCache_ = make_shared<FixedSizeList<sptr<MetaBufferWrapper>>>(8);
+    metaCache_ = make_shared<TimestampRingIndex<sptr<MetaBufferWrapper>>>(META_CACHE_SIZE, META_TIMESTAMP_TOLERANCE);
 
     MEDIA_INFO_LOG("MetaCacheFilter::MetaCacheFilter called");
 }
@@ -295,19 +300,17 @@ void MetaCacheFilter::OnBufferAvailable()
     surfaceRet = inputSurface_->DetachBufferFromQueue(buffer, true);
     CHECK_RETURN_ELOG(surfaceRet != SURFACE_ERROR_OK, "Failed to detach meta buffer. %{public}d", surfaceRet);
     sptr<MetaBufferWrapper> metaRecord = new MetaBufferWrapper(buffer, timestamp, inputSurface_);
-    metaCache_->add(metaRecord);
+    metaCache_->Add(timestamp, metaRecord);
     MEDIA_DEBUG_LOG("MetaCacheFilter::OnBufferAvailable %{public}" PRId64, timestamp);
     MEDIA_DEBUG_LOG("MetaCacheFilter::OnBufferAvailable X");
 }
 
 sptr<MetaBufferWrapper> MetaCacheFilter::FindMetaBufferWrapper(int64_t timestamp)
 {
-    auto metaRecord =
-        metaCache_->find_if([timestamp](const sptr<MetaBufferWrapper> obj) {
-          return obj && obj->GetTimestamp() == timestamp;
-        });
-    if (metaRecord.has_value()) {
-        MEDIA_DEBUG_LOG("MetaCacheFilter::FindMetaBufferWrapper success");\
+    auto metaRecord = metaCache_->Take(timestamp);
+    if (metaRecord.has_value() && metaRecord.value() != nullptr) {
+        MEDIA_DEBUG_LOG("MetaCacheFilter::FindMetaBufferWrapper success, delta: %{public}" PRId64,
+            metaRecord.value()->GetTimestamp() - timestamp);
         return metaRecord.value();
     }
     return nullptr;
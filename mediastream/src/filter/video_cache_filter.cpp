@@ -314,12 +314,6 @@ void VideoCacheFilter::OnBufferAvailable()
     ret = inputSurface_->DetachBufferFromQueue(videoBuffer,true);
     CHECK_RETURN_ELOG(ret != GSERROR_OK, "VideoCacheFilter::OnBufferAvailable DetachBuffer fail. %{public}d", ret);
     MEDIA_DEBUG_LOG("VideoCacheFilter::OnBufferAvailable timestamp %{public}" PRId64, timestamp);
-    if (videoBufferWrapperQueue_.Full()) {
-        MEDIA_DEBUG_LOG("VideoCacheFilter::OnBufferAvailable videoBufferWrapperQueue_ is FULL");
-        sptr<VideoBufferWrapper> popVideoBufferWrapper = videoBufferWrapperQueue_.Pop();
-        CHECK_EXECUTE(popVideoBufferWrapper, popVideoBufferWrapper->Release());
-        CHECK_EXECUTE(popVideoBufferWrapper, popVideoBufferWrapper->ReleaseMetaBuffer());
-    }
     sptr<VideoBufferWrapper> videoBufferWrapper = new (std::nothrow) VideoBufferWrapper(
         videoBuffer, timestamp, transform, inputSurface_, outputSurface_);
     CHECK_RETURN_ELOG(videoBufferWrapper == nullptr, "videoBufferWrapper is nullptr");
@@ -331,7 +325,12 @@ void VideoCacheFilter::OnBufferAvailable()
             popFlag_ = false;
         }
     }
-    videoBufferWrapperQueue_.Push(videoBufferWrapper);
+    sptr<VideoBufferWrapper> popVideoBufferWrapper = nullptr;
+    if (videoBufferWrapperQueue_.PushOverwrite(sptr<VideoBufferWrapper>(videoBufferWrapper), popVideoBufferWrapper)) {
+        MEDIA_DEBUG_LOG("VideoCacheFilter::OnBufferAvailable videoBufferWrapperQueue_ is FULL");
+        CHECK_EXECUTE(popVideoBufferWrapper, popVideoBufferWrapper->Release());
+        CHECK_EXECUTE(popVideoBufferWrapper, popVideoBufferWrapper->ReleaseMetaBuffer());
+    }
     videoBufferWrapper->SetMetaBuffer(FindMetaBuffer(timestamp));
     DrainImage(videoBufferWrapper);
     MEDIA_DEBUG_LOG("VideoCacheFilter::OnBufferAvailable X");
@@ -359,14 +358,19 @@ void VideoCacheFilter::ClearCache(uint64_t timestamp)
 {
     CHECK_RETURN_ELOG(!clearFlag_, "not need clear"); // flag 是从切镜像时设置
     shutterTime_ = static_cast<int64_t>(timestamp);
-    while (!videoBufferWrapperQueue_.Empty()) {
-        sptr<VideoBufferWrapper> popFrame = videoBufferWrapperQueue_.Front();
-        if (popFrame->GetTimestamp() > shutterTime_) {
-            clearFlag_ = false;
-            return;
-        }
-        videoBufferWrapperQueue_.Pop();
+    int64_t shutterTime = shutterTime_;
+    auto isBeforeShutter = [shutterTime](const sptr<VideoBufferWrapper>& frame) {
+        return frame != nullptr && frame->GetTimestamp() <= shutterTime;
+    };
+    // Test and pop in one step, OnBufferAvailable may evict the front frame through PushOverwrite meanwhile.
+    sptr<VideoBufferWrapper> popFrame = nullptr;
+    while (videoBufferWrapperQueue_.TryPopIf(isBeforeShutter, popFrame)) {
         popFrame->Release();
+        popFrame = nullptr;
+    }
+    if (!videoBufferWrapperQueue_.Empty()) {
+        clearFlag_ = false;
+        return;
     }
     popFlag_ = true;
 }
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "audio_pcm_ring_unit_test.h"
+
+#include <cstring>
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr uint32_t CHUNK_COUNT = 8;
+constexpr uint32_t CHUNK_SIZE = 16;
+constexpr int64_t CHUNK_DURATION = 20;
+
+void WriteChunks(AudioPcmRing& ring, uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i) {
+        uint8_t* slot = ring.AcquireWriteSlot();
+        memset(slot, static_cast<int>(i & 0xff), CHUNK_SIZE);
+        ring.CommitWrite(static_cast<int64_t>(i) * CHUNK_DURATION);
+    }
+}
+}
+
+void AudioPcmRingUnitTest::SetUpTestCase(void)
+{
+    std::cout << "[SetUpTestCase] is called" << std::endl;
+}
+
+void AudioPcmRingUnitTest::TearDownTestCase(void)
+{
+    std::cout << "[TearDownTestCase] is called" << std::endl;
+}
+
+void AudioPcmRingUnitTest::SetUp()
+{
+    std::cout << "[SetUp] is called" << std::endl;
+}
+
+void AudioPcmRingUnitTest::TearDown()
+{
+    std::cout << "[TearDown] is called" << std::endl;
+}
+
+/*
+ * Feature: AudioPcmRing
+ * CaseDescription: Test CopyRange returns the chunks in [start, end) as one contiguous block
+ */
+HWTEST_F(AudioPcmRingUnitTest, CopyRange_001, TestSize.Level1)
+{
+    AudioPcmRing ring(CHUNK_COUNT, CHUNK_SIZE);
+    WriteChunks(ring, 5);
+    AudioPcmRange range;
+    ASSERT_EQ(ring.CopyRange(CHUNK_DURATION, 4 * CHUNK_DURATION, range), 3);
+    ASSERT_NE(range.block, nullptr);
+    EXPECT_EQ(range.chunkSize, CHUNK_SIZE);
+    for (size_t i = 0; i < range.timestamps.size(); ++i) {
+        EXPECT_EQ(range.timestamps[i], static_cast<int64_t>(i + 1) * CHUNK_DURATION);
+        EXPECT_EQ(range.block[i * CHUNK_SIZE], i + 1);
+        EXPECT_EQ(range.block[i * CHUNK_SIZE + CHUNK_SIZE - 1], i + 1);
+    }
+    EXPECT_EQ(ring.CopyRange(10 * CHUNK_DURATION, 20 * CHUNK_DURATION, range), 0);
+    EXPECT_EQ(range.block, nullptr);
+}
+
+/*
+ * Feature: AudioPcmRing
+ * CaseDescription: Test the oldest chunks are overwritten once the ring wraps and the slot being
+ *                  refilled is never returned
+ */
+HWTEST_F(AudioPcmRingUnitTest, GetRangeViews_001, TestSize.Level1)
+{
+    AudioPcmRing ring(CHUNK_COUNT, CHUNK_SIZE);
+    WriteChunks(ring, 2 * CHUNK_COUNT + 3);
+    EXPECT_EQ(ring.Size(), CHUNK_COUNT - 1);
+    std::vector<AudioPcmChunkView> views;
+    ASSERT_EQ(ring.GetRangeViews(0, INT64_MAX, views), CHUNK_COUNT - 1);
+    EXPECT_EQ(views.front().timestamp, (CHUNK_COUNT + 4) * CHUNK_DURATION);
+    EXPECT_EQ(views.back().timestamp, (2 * CHUNK_COUNT + 2) * CHUNK_DURATION);
+    EXPECT_EQ(views.back().data[0], 2 * CHUNK_COUNT + 2);
+    EXPECT_TRUE(ring.IsViewValid(views.front()));
+    WriteChunks(ring, 1);
+    EXPECT_FALSE(ring.IsViewValid(views.front()));
+    EXPECT_TRUE(ring.IsViewValid(views.back()));
+}
+} // namespace CameraStandard
+} // namespace OHOS
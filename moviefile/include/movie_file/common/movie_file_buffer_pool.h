@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_MOVIE_FILE_BUFFER_POOL_H
+#define OHOS_CAMERA_MOVIE_FILE_BUFFER_POOL_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Sample buffers of one track, reused instead of allocating shared memory for every sample. Buffers are kept
+ * in power of two capacity classes, a sample takes an idle buffer of its class or allocates one, and gives it
+ * back once the muxer wrote it. Samples larger than the biggest class are allocated and freed as before.
+ */
+template<typename T>
+class MovieFileBufferPool {
+public:
+    using Allocator = std::function<T(int32_t capacity)>;
+    using Deleter = std::function<void(T& buffer)>;
+    using CapacityGetter = std::function<int32_t(const T& buffer)>;
+
+    static constexpr int32_t MIN_CAPACITY = 1024;
+    static constexpr size_t CAPACITY_CLASS_COUNT = 12; // 1 KB to 2 MB
+    static constexpr size_t MAX_IDLE_PER_CLASS = 4;
+
+    MovieFileBufferPool(std::string name, Allocator allocator, Deleter deleter, CapacityGetter capacityGetter)
+        : name_(std::move(name)), allocator_(std::move(allocator)), deleter_(std::move(deleter)),
+          capacityGetter_(std::move(capacityGetter))
+    {
+    }
+
+    ~MovieFileBufferPool()
+    {
+        for (auto& idleBuffers : idleBuffers_) {
+            for (auto& buffer : idleBuffers) {
+                deleter_(buffer);
+            }
+        }
+    }
+
+    MovieFileBufferPool(const MovieFileBufferPool&) = delete;
+    MovieFileBufferPool& operator=(const MovieFileBufferPool&) = delete;
+
+    T Acquire(int32_t size)
+    {
+        if (size <= 0) {
+            return T {};
+        }
+        size_t classIndex = GetClassIndex(size);
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            inUseCount_++;
+            peakInUseCount_ = std::max(peakInUseCount_, inUseCount_);
+            if (classIndex < CAPACITY_CLASS_COUNT && !idleBuffers_[classIndex].empty()) {
+                T buffer = std::move(idleBuffers_[classIndex].back());
+                idleBuffers_[classIndex].pop_back();
+                hitCount_++;
+                return buffer;
+            }
+            missCount_++;
+        }
+        T buffer = allocator_(classIndex < CAPACITY_CLASS_COUNT ? GetClassCapacity(classIndex) : size);
+        if (buffer == nullptr) {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            inUseCount_--;
+        }
+        return buffer;
+    }
+
+    void Release(T buffer)
+    {
+        if (buffer == nullptr) {
+            return;
+        }
+        int32_t capacity = capacityGetter_(buffer);
+        size_t classIndex = GetClassIndex(capacity);
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            inUseCount_ = inUseCount_ > 0 ? inUseCount_ - 1 : 0;
+            bool isPooled = classIndex < CAPACITY_CLASS_COUNT && GetClassCapacity(classIndex) == capacity;
+            if (isPooled && idleBuffers_[classIndex].size() < MAX_IDLE_PER_CLASS) {
+                idleBuffers_[classIndex].push_back(std::move(buffer));
+                return;
+            }
+        }
+        deleter_(buffer);
+    }
+
+    std::string Dump()
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        size_t idleCount = 0;
+        for (auto& idleBuffers : idleBuffers_) {
+            idleCount += idleBuffers.size();
+        }
+        return name_ + " hit:" + std::to_string(hitCount_) + " miss:" + std::to_string(missCount_) +
+               " inUse:" + std::to_string(inUseCount_) + " peak:" + std::to_string(peakInUseCount_) +
+               " idle:" + std::to_string(idleCount);
+    }
+
+private:
+    static inline int32_t GetClassCapacity(size_t classIndex)
+    {
+        return MIN_CAPACITY << classIndex;
+    }
+
+    static inline size_t GetClassIndex(int32_t size)
+    {
+        size_t classIndex = 0;
+        while (classIndex < CAPACITY_CLASS_COUNT && GetClassCapacity(classIndex) < size) {
+            classIndex++;
+        }
+        return classIndex;
+    }
+
+    std::mutex poolMutex_;
+    std::string name_;
+    Allocator allocator_;
+    Deleter deleter_;
+    CapacityGetter capacityGetter_;
+    std::array<std::vector<T>, CAPACITY_CLASS_COUNT> idleBuffers_ {};
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    uint32_t inUseCount_ = 0;
+    uint32_t peakInUseCount_ = 0;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_MOVIE_FILE_BUFFER_POOL_H
@@ -25,6 +25,7 @@
 #include "audio_info.h"
 #include "audio_capturer.h"
 #include "avmuxer.h"
+#include "common/movie_file_buffer_pool.h"
 #include "unified_pipeline_audio_buffer.h"
 #include "unified_pipeline_audio_encoded_buffer.h"
 #include "unified_pipeline_data_consumer.h"
@@ -245,6 +246,11 @@ private:
     void WriteMetaDataFor4_2_AUDIO(
        AudioStandard::CaptureMetaDataType type, const std::vector<uint8_t>& metaData, int64_t timestamp);
 
+    using AVBufferPool = MovieFileBufferPool<std::shared_ptr<Media::AVBuffer>>;
+    static std::unique_ptr<AVBufferPool> CreateSampleBufferPool(const std::string& name);
+    int32_t WriteSampleFromPool(
+        AVBufferPool& bufferPool, int32_t trackId, const uint8_t* data, int32_t size, int64_t pts);
+
     void RecordTimeStamps(int64_t startTimeStamp, int64_t endTimeStamp);
 
     std::string GetTimeStamps();
@@ -268,6 +274,8 @@ private:
     int32_t metaTrackId4_2_ = INVALID_TRACKID;
 
     ConsumerTimeKeeper timeKeeper_;
+    std::unique_ptr<AVBufferPool> metaBufferPool_ = CreateSampleBufferPool("metaBufferPool");
+    std::unique_ptr<AVBufferPool> metaBufferPool4_2_ = CreateSampleBufferPool("metaBufferPool4_2");
     BufferQueue<UnifiedPipelineAudioPackagedEncodedBuffer> audioEncodedBufferQueue_ { BUFFER_CACHE_SIZE };
     BufferQueue<UnifiedPipelineAudioPackagedEncodedBuffer> audioEncodedRawBufferQueue_ { BUFFER_CACHE_SIZE };
 
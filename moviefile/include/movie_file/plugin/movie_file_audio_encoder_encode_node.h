@@ -19,6 +19,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common/movie_file_buffer_pool.h"
 #include "movie_file_common_const.h"
 #include "native_audio_channel_layout.h"
 #include "native_avcodec_audiocodec.h"
@@ -108,6 +109,9 @@ private:
 
     std::shared_ptr<MovieFileAudioEncoderEncodeNodeEncoderCallback> encoderCallback_;
 
+    // Encoded frames are copied out of the encoder buffers into these, so the encoder gets its buffers back at once.
+    std::shared_ptr<MovieFileBufferPool<OH_AVBuffer*>> outputBufferPool_;
+
     std::atomic<int64_t> baseTimestamp_ = INVALID_TIMESTAMP;
 };
 } // namespace CameraStandard
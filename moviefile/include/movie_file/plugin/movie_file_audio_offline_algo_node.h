@@ -51,6 +51,8 @@ public:
 private:
     // 私有的方法，代码处理可以保证 processedPtr 不会踩内存，无需传入数组大小
     std::unique_ptr<UnifiedPipelineAudioPackagedBuffer> MakeUpResultPack(uint8_t* processedPtr, size_t dataSize);
+    // Batch size for the effect chain, chosen from the queueing latency of the pipeline.
+    size_t GetPackageCount();
 
     std::unique_ptr<AudioStandard::OfflineAudioEffectManager> offlineAudioEffectManager_ = nullptr;
     std::unique_ptr<AudioStandard::OfflineAudioEffectChain> offlineEffectChain_ = nullptr;
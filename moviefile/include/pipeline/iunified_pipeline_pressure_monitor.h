@@ -16,15 +16,39 @@
 #ifndef OHOS_I_UNIFIED_PIPELINE_PRESSURE_MONITOR_H
 #define OHOS_I_UNIFIED_PIPELINE_PRESSURE_MONITOR_H
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 
 namespace OHOS {
 namespace CameraStandard {
+// Recent queue depth and queueing latency of a pipeline, as histograms plus the derived percentiles.
+struct PipelinePressure {
+    static constexpr size_t BUCKET_COUNT = 10;
+    // Inclusive upper bounds of every bucket but the last, which is open ended.
+    static constexpr std::array<int64_t, BUCKET_COUNT - 1> DEPTH_BOUNDS = { 0, 1, 2, 4, 8, 16, 32, 64, 128 };
+    static constexpr std::array<int64_t, BUCKET_COUNT - 1> LATENCY_BOUNDS_US = { 250, 500, 1000, 2000, 4000, 8000,
+        16000, 33000, 66000 };
+
+    int64_t queueDepth = 0;
+    int64_t latencyP50Us = 0;
+    int64_t latencyP99Us = 0;
+    std::array<uint64_t, BUCKET_COUNT> depthHistogram {};
+    std::array<uint64_t, BUCKET_COUNT> latencyHistogram {};
+};
+
 class IUnifyPipelinePressureMonitor {
 public:
     virtual ~IUnifyPipelinePressureMonitor() = default;
+    // Number of tasks waiting for a worker.
     virtual int64_t GetPipelinePressure() = 0;
+    virtual PipelinePressure GetPipelinePressureStats()
+    {
+        PipelinePressure pressure;
+        pressure.queueDepth = GetPipelinePressure();
+        return pressure;
+    }
 };
 } // namespace CameraStandard
 } // namespace OHOS
@@ -48,6 +48,16 @@ public:
         return monitor->GetPipelinePressure();
     }
 
+    inline PipelinePressure GetPipelinePressureStats()
+    {
+        std::lock_guard<std::mutex> lock(pipelinePressureMonitorMtx_);
+        auto monitor = pipelinePressureMonitor_.lock();
+        if (!monitor) {
+            return {};
+        }
+        return monitor->GetPipelinePressureStats();
+    }
+
 private:
     std::mutex pipelinePressureMonitorMtx_;
     std::weak_ptr<IUnifyPipelinePressureMonitor> pipelinePressureMonitor_;
@@ -16,51 +16,115 @@
 #ifndef OHOS_UNIFIED_PIPELINE_THREADPOOL_H
 #define OHOS_UNIFIED_PIPELINE_THREADPOOL_H
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <future>
-#include <list>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
-#include "unified_pipeline_worker_thread.h"
+#include "iunified_pipeline_pressure_monitor.h"
 
 namespace OHOS {
 namespace CameraStandard {
+struct PipelineTask {
+public:
+    PipelineTask() {};
+    PipelineTask(std::function<void()> fun) : func(fun) {};
+    std::function<void()> func;
+};
 
-class UnifiedPipelineThreadpool : public WorkerThread::WorkerThreadStatusCallback,
-                                  public std::enable_shared_from_this<UnifiedPipelineThreadpool> {
+// Preferred cores for the workers: audio chains are light and go to the efficiency cores, video
+// chains to the performance cores. Best effort, ignored when the topology cannot be read.
+enum class PipelineAffinityHint : int32_t { NONE = 0, AUDIO, VIDEO };
+
+/**
+ * Work stealing executor. Every worker owns a deque, posted tasks are spread over the deques round
+ * robin and a worker runs its own deque in order before stealing the oldest task of another one, so
+ * no task waits behind a busy worker while another worker is idle. Workers start on demand up to
+ * maxThreads; past minThreads they retire after idling for a while.
+ */
+class UnifiedPipelineThreadpool : public std::enable_shared_from_this<UnifiedPipelineThreadpool> {
 public:
     // Default thread size is 1
     explicit UnifiedPipelineThreadpool(size_t minThreads = 1, size_t maxThreads = 1);
     virtual ~UnifiedPipelineThreadpool();
 
-    void OnIdle() override;
-
     template<typename F, typename... Args>
     auto Submit(F&& f, Args&&... args) -> std::shared_ptr<std::packaged_task<decltype(f(args...))()>>;
 
+    // Queues a prepared task as is, for callers that recycle their tasks and need no future.
+    bool Post(const std::shared_ptr<PipelineTask>& task);
+
     void SetThreadCount(size_t min, size_t max);
+    void SetAffinityHint(PipelineAffinityHint hint);
     void Shutdown();
 
     inline int64_t GetTaskSize()
     {
-        std::lock_guard<std::mutex> taskLock(workerMutex_);
-        return tasks_.size();
+        int64_t taskSize = queuedTasks_.load();
+        return taskSize > 0 ? taskSize : 0;
     }
 
+    PipelinePressure GetPressure();
+
 private:
-    std::shared_ptr<WorkerThread> CreateWorkerNoLock();
-    std::shared_ptr<WorkerThread> GetAnIdleWorkerNoLock();
+    struct QueuedTask {
+        std::shared_ptr<PipelineTask> task;
+        std::chrono::steady_clock::time_point postTime;
+    };
+
+    struct Worker {
+        std::mutex taskMutex; // lock for tasks and isRetired
+        std::deque<QueuedTask> tasks;
+        bool isRetired = false;
+        std::thread thread;
+    };
 
-    void HandleTaskWithThreadLeader();
-    void HandleTask();
+    using WorkerList = std::vector<std::shared_ptr<Worker>>;
+
+    bool TryStartWorker();
+    void PublishWorkersLocked();
+    std::shared_ptr<const WorkerList> LoadWorkers();
+    bool PushTask(QueuedTask& queuedTask);
+    void WakeWorker();
+
+    void WorkerLoop(std::shared_ptr<Worker> self);
+    bool PopTask(const std::shared_ptr<Worker>& self, QueuedTask& queuedTask);
+    bool StealTask(const std::shared_ptr<Worker>& self, QueuedTask& queuedTask);
+    void RunTask(QueuedTask& queuedTask);
+    bool WaitForTask(const std::shared_ptr<Worker>& self);
+    bool TryRetire(const std::shared_ptr<Worker>& self);
+    void ApplyAffinityHint(PipelineAffinityHint& appliedHint);
+
+    void RecordDepth(int64_t depth);
+    void RecordLatency(int64_t latencyUs);
+
+    std::mutex workerMutex_; // Lock for workers_, retiredWorkers_ and publishing workerList_
+    std::vector<std::shared_ptr<Worker>> workers_;
+    std::vector<std::shared_ptr<Worker>> retiredWorkers_;
+    std::shared_ptr<const WorkerList> workerList_;
+    std::atomic<size_t> nextWorker_ = 0;
+
+    std::mutex parkMutex_;
+    std::condition_variable parkCondition_;
+    std::atomic<int64_t> queuedTasks_ = 0;
+    std::atomic<int64_t> idleWorkers_ = 0;
 
-    std::mutex workerMutex_; // Lock for workers_ & tasks_
-    std::vector<std::shared_ptr<WorkerThread>> workers_;
-    std::list<std::shared_ptr<PipelineTask>> tasks_;
     std::atomic<bool> isShutdown_ = false;
     std::atomic<size_t> minThreads_ = 1;
     std::atomic<size_t> maxThreads_ = 1;
+    std::atomic<PipelineAffinityHint> affinityHint_ = PipelineAffinityHint::NONE;
+
+    std::array<std::atomic<uint64_t>, PipelinePressure::BUCKET_COUNT> depthBuckets_ {};
+    std::array<std::atomic<uint64_t>, PipelinePressure::BUCKET_COUNT> latencyBuckets_ {};
+    std::atomic<uint64_t> depthSamples_ = 0;
+    std::atomic<uint64_t> latencySamples_ = 0;
 };
 
 template<typename F, typename... Args>
@@ -70,14 +134,9 @@ auto UnifiedPipelineThreadpool::Submit(F&& f, Args&&... args)
     using ReturnType = decltype(f(args...));
     auto task =
         std::make_shared<std::packaged_task<ReturnType()>>(std::bind(std::forward<F>(f), std::forward<Args>(args)...));
-    {
-        std::unique_lock<std::mutex> lock(workerMutex_);
-        if (isShutdown_) {
-            return nullptr;
-        }
-        tasks_.emplace_back(std::make_shared<PipelineTask>([task]() { (*task)(); }));
+    if (!Post(std::make_shared<PipelineTask>([task]() { (*task)(); }))) {
+        return nullptr;
     }
-    HandleTask();
     return task;
 }
 } // namespace CameraStandard
@@ -16,10 +16,14 @@
 #ifndef OHOS_UNIFIED_PIPELINE_H
 #define OHOS_UNIFIED_PIPELINE_H
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "iunified_pipeline_pressure_monitor.h"
+#include "lock_free_ring.h"
 #include "unified_pipeline_buffer.h"
 #include "unified_pipeline_buffer_listener.h"
 #include "unified_pipeline_data_consumer.h"
@@ -34,7 +38,7 @@ class UnifiedPipeline : public UnifiedPipelineBufferListener,
                         public std::enable_shared_from_this<UnifiedPipeline> {
 public:
     UnifiedPipeline(int32_t maxThreadSize = 1);
-    virtual ~UnifiedPipeline() = default;
+    virtual ~UnifiedPipeline();
 
     void OnBufferArrival(std::unique_ptr<UnifiedPipelineBuffer> sourceData) override;
     virtual void OnCommandArrival(std::unique_ptr<UnifiedPipelineCommand> command) override;
@@ -47,31 +51,74 @@ public:
 
     void SetDataConsumer(std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer);
 
+    void SetAffinityHint(PipelineAffinityHint hint);
+
     int64_t GetPipelinePressure() override;
+    PipelinePressure GetPipelinePressureStats() override;
 
 private:
+    // Immutable view of the plugin chain and consumer, replaced as a whole whenever either changes so
+    // the per-frame path only takes a reference to it.
+    struct PipelineSnapshot {
+        std::vector<std::shared_ptr<UnifiedPipelinePlugin>> plugins;
+        std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer;
+    };
+
+    // Recycled per-dispatch state; task is bound to the node once when the node is created.
+    struct DispatchNode {
+        uint64_t sequence = 0;
+        std::unique_ptr<UnifiedPipelineBuffer> buffer;
+        std::unique_ptr<UnifiedPipelineCommand> command;
+        std::shared_ptr<const PipelineSnapshot> snapshot;
+        std::shared_ptr<PipelineTask> task;
+    };
+
+    // Completed nodes wait here until every earlier sequence has been delivered.
+    struct ReorderSlot {
+        std::atomic<DispatchNode*> node { nullptr };
+    };
+
     std::shared_ptr<UnifiedPipelineThreadpool> GetThreadPool();
 
     static std::unique_ptr<UnifiedPipelineBuffer> PluginsProcessBuffer(std::unique_ptr<UnifiedPipelineBuffer> inBuffer,
-        const std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>>& plugins);
+        const std::vector<std::shared_ptr<UnifiedPipelinePlugin>>& plugins);
 
     static void PluginsProcessCommand(UnifiedPipelineCommand* command,
-        const std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>>& plugins);
-
-    std::mutex pluginsMutex_;
+        const std::vector<std::shared_ptr<UnifiedPipelinePlugin>>& plugins);
+
+    void PublishSnapshotLocked();
+    std::shared_ptr<const PipelineSnapshot> LoadSnapshot();
+    DispatchNode* AcquireNode();
+    void RecycleNode(DispatchNode* node);
+    void Dispatch(DispatchNode* node);
+    void RunNode(DispatchNode* node);
+    void CompleteNode(DispatchNode* node);
+    void DeliverNode(DispatchNode* node);
+
+    std::mutex pluginsMutex_; // lock for plugins_, dataConsumer_ and publishing snapshot_
     std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>> plugins_;
+    std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer_;
+    std::shared_ptr<const PipelineSnapshot> snapshot_;
+
+    static constexpr size_t REORDER_WINDOW = 64;
+    static constexpr size_t NODE_POOL_SIZE = REORDER_WINDOW;
+    std::mutex nodesMutex_; // lock for nodes_, only taken when the pool grows or shrinks
+    std::vector<std::unique_ptr<DispatchNode>> nodes_;
+    MpscRing<DispatchNode*> nodePool_ { NODE_POOL_SIZE };
+    ReorderSlot reorderSlots_[REORDER_WINDOW];
+    std::mutex dispatchMutex_; // keeps sequence order identical to thread pool submission order
+    uint64_t nextSequence_ = 0;
+    alignas(RING_CACHE_LINE_SIZE) std::atomic<uint64_t> deliverSequence_ { 0 };
+    std::atomic<bool> isDelivering_ { false };
+    // Only taken when a node completes more than REORDER_WINDOW sequences ahead of delivery.
+    std::mutex windowMutex_;
+    std::condition_variable windowCv_;
+    std::atomic<uint32_t> windowWaiters_ { 0 };
+    std::atomic<bool> isShutdown_ { false };
 
     int32_t maxThreadSize_ = 1;
     std::mutex threadPoolMutex_;
     std::shared_ptr<UnifiedPipelineThreadpool> threadPool_ = nullptr;
-
-    std::mutex dataConsumerMutex_;
-    std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer_;
-
-    std::mutex pipelineThreadMtx_; // lock for pipelineThreadCv_,currentBufferId_,handledBufferId_
-    std::condition_variable pipelineThreadCv_;
-    uint64_t currentBufferId_ = 0;
-    uint64_t handledBufferId_ = 0;
 };
 
 } // namespace CameraStandard
@@ -34,7 +34,8 @@ public:
 public:
     explicit UnifiedPipelineManager();
     std::shared_ptr<UnifiedPipeline> GetPipelineWithProducer(
-        std::shared_ptr<UnifiedPipelineDataProducer> producer, int32_t threadMax = 1);
+        std::shared_ptr<UnifiedPipelineDataProducer> producer, int32_t threadMax = 1,
+        PipelineAffinityHint affinityHint = PipelineAffinityHint::NONE);
 
 private:
     std::mutex pipelinesMutex_;
@@ -94,6 +94,8 @@ MovieFileConsumer::~MovieFileConsumer()
     if (movieFileConfig_.fd >= 0) {
         close(movieFileConfig_.fd);
     }
+    MEDIA_INFO_LOG("MovieFileConsumer ~MovieFileConsumer %{public}s, %{public}s", metaBufferPool_->Dump().c_str(),
+        metaBufferPool4_2_->Dump().c_str());
     MEDIA_INFO_LOG("MovieFileConsumer ~MovieFileConsumer done");
 }
 
@@ -527,23 +529,12 @@ void MovieFileConsumer::WriteMetaBuffer(std::unique_ptr<UnifiedPipelineSurfaceBu
         return;
     }
 
-    AVBufferConfig avBufferConfig;
-    avBufferConfig.size = bufferSize;
-    avBufferConfig.memoryType = MemoryType::SHARED_MEMORY;
-    avBufferConfig.memoryFlag = MemoryFlag::MEMORY_READ_WRITE;
-
-    std::shared_ptr<AVBuffer> metaAvBuffer = AVBuffer::CreateAVBuffer(avBufferConfig);
-    CHECK_RETURN_ELOG(metaAvBuffer == nullptr, "MovieFileConsumer::OnMetaBufferArrival metaAvBuffer is nullptr");
-    CHECK_RETURN_ELOG(
-        metaAvBuffer->memory_ == nullptr, "MovieFileConsumer::OnMetaBufferArrival metaAvBuffer->memory_ is nullptr.");
-
-    std::shared_ptr<AVMemory>& bufferMem = metaAvBuffer->memory_;
-    bufferMem->Write((const uint8_t*)buffer->GetVirAddr(), bufferSize, 0);
-    metaAvBuffer->pts_ = timeKeeper_.GetMetadataRelativeTime(data.timestamp);
-    muxer_->WriteSample(metaTrackId_, metaAvBuffer);
-    MEDIA_DEBUG_LOG("MovieFileConsumer::OnMetaBufferArrival metaAvBuffer->pts is %{public}" PRIi64
+    int64_t fixedPts = timeKeeper_.GetMetadataRelativeTime(data.timestamp);
+    int32_t ret = WriteSampleFromPool(*metaBufferPool_, metaTrackId_,
+        static_cast<const uint8_t*>(buffer->GetVirAddr()), bufferSize, fixedPts);
+    MEDIA_DEBUG_LOG("MovieFileConsumer::OnMetaBufferArrival ret:%{public}d metaAvBuffer->pts is %{public}" PRIi64
                     " fixed pts is %{public}" PRIi64 " bufferSize is %{public}d",
-        data.timestamp, metaAvBuffer->pts_, bufferSize);
+        ret, data.timestamp, fixedPts, bufferSize);
 }
 
 void MovieFileConsumer::OnMetaDataBufferArrivalFor4_2_AUDIO(
@@ -563,23 +554,49 @@ void MovieFileConsumer::WriteMetaDataFor4_2_AUDIO(
 {
     CHECK_RETURN(metaData.empty());
 
-    AVBufferConfig avBufferConfig;
-    avBufferConfig.size = static_cast<int32_t>(metaData.size());
-    avBufferConfig.memoryType = MemoryType::SHARED_MEMORY;
-    avBufferConfig.memoryFlag = MemoryFlag::MEMORY_READ_WRITE;
-
-    std::shared_ptr<AVBuffer> metaAvBuffer = AVBuffer::CreateAVBuffer(avBufferConfig);
-    CHECK_RETURN_ELOG(metaAvBuffer == nullptr, "MovieFileConsumer::WriteMetaDataFor4_2_AUDIO metaAvBuffer is nullptr");
-    CHECK_RETURN_ELOG(metaAvBuffer->memory_ == nullptr,
-        "MovieFileConsumer::WriteMetaDataFor4_2_AUDIO metaAvBuffer->memory_ is nullptr.");
-
-    std::shared_ptr<AVMemory>& bufferMem = metaAvBuffer->memory_;
-    bufferMem->Write(metaData.data(), static_cast<int32_t>(metaData.size()), 0);
-    metaAvBuffer->pts_ = timeKeeper_.GetMetadataRelativeTime4_2(timestamp);
-    int32_t ret = muxer_->WriteSample(metaTrackId4_2_, metaAvBuffer);
+    int64_t fixedPts = timeKeeper_.GetMetadataRelativeTime4_2(timestamp);
+    int32_t ret = WriteSampleFromPool(
+        *metaBufferPool4_2_, metaTrackId4_2_, metaData.data(), static_cast<int32_t>(metaData.size()), fixedPts);
     MEDIA_DEBUG_LOG("MovieFileConsumer::WriteMetaDataFor4_2_AUDIO type:%{public}d ret:%{public}d origin pts:%{public}"
                     PRIi64 " fixed pts:%{public}" PRIi64 " bufferSize:%{public}zu",
-        type, ret, timestamp, metaAvBuffer->pts_, metaData.size());
+        type, ret, timestamp, fixedPts, metaData.size());
+}
+
+std::unique_ptr<MovieFileConsumer::AVBufferPool> MovieFileConsumer::CreateSampleBufferPool(const std::string& name)
+{
+    return std::make_unique<AVBufferPool>(
+        name,
+        [](int32_t capacity) {
+            AVBufferConfig avBufferConfig;
+            avBufferConfig.size = capacity;
+            avBufferConfig.memoryType = MemoryType::SHARED_MEMORY;
+            avBufferConfig.memoryFlag = MemoryFlag::MEMORY_READ_WRITE;
+            return AVBuffer::CreateAVBuffer(avBufferConfig);
+        },
+        [](std::shared_ptr<AVBuffer>& buffer) { buffer = nullptr; },
+        [](const std::shared_ptr<AVBuffer>& buffer) {
+            return buffer->memory_ == nullptr ? 0 : buffer->memory_->GetCapacity();
+        });
+}
+
+// WriteSample copies the sample into the muxer track queue, so the buffer goes back to the pool once it returns.
+int32_t MovieFileConsumer::WriteSampleFromPool(
+    AVBufferPool& bufferPool, int32_t trackId, const uint8_t* data, int32_t size, int64_t pts)
+{
+    std::shared_ptr<AVBuffer> sampleBuffer = bufferPool.Acquire(size);
+    if (sampleBuffer == nullptr || sampleBuffer->memory_ == nullptr) {
+        MEDIA_ERR_LOG("MovieFileConsumer::WriteSampleFromPool acquire buffer failed, size:%{public}d", size);
+        bufferPool.Release(std::move(sampleBuffer));
+        return AVCS_ERR_NO_MEMORY;
+    }
+    std::shared_ptr<AVMemory>& bufferMem = sampleBuffer->memory_;
+    bufferMem->SetSize(0);
+    bufferMem->Write(data, size, 0);
+    sampleBuffer->pts_ = pts;
+    sampleBuffer->flag_ = 0;
+    int32_t ret = muxer_->WriteSample(trackId, sampleBuffer);
+    bufferPool.Release(std::move(sampleBuffer));
+    return ret;
 }
 
 void MovieFileConsumer::FlushBufferQueueCache()
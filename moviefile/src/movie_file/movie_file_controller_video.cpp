@@ -201,7 +201,8 @@ void MovieFileControllerVideo::ConfigAudioPipeline(
     movieFileAudioBufferProducer->InitBufferListener();
     audioCaptureWrap->AddBufferListener(movieFileAudioBufferProducer->GetAudioCaptureBufferListener());
 
-    auto audioPipeline = movieFilePipelineManager_->GetPipelineWithProducer(movieFileAudioBufferProducer);
+    auto audioPipeline = movieFilePipelineManager_->GetPipelineWithProducer(
+        movieFileAudioBufferProducer, 1, PipelineAffinityHint::AUDIO);
     if (isEnableRawAudio_) { // 使能先录后编，则走算法流程
         auto effectPlugin = std::make_shared<MovieFileAudioEffectPlugin>(streamInfo);
         auto audioEffectStreamInfo = effectPlugin->GetOutAudioStreamInfo();
@@ -237,7 +238,8 @@ void MovieFileControllerVideo::ConfigRawAudioPipeline(
     movieFileAudioRawBufferProducer->InitBufferListener();
     audioCaptureWrap->AddBufferListener(movieFileAudioRawBufferProducer->GetAudioCaptureBufferListener());
 
-    auto audioRawPipeline = movieFilePipelineManager_->GetPipelineWithProducer(movieFileAudioRawBufferProducer);
+    auto audioRawPipeline = movieFilePipelineManager_->GetPipelineWithProducer(
+        movieFileAudioRawBufferProducer, 1, PipelineAffinityHint::AUDIO);
     auto audioRawPlugin = std::make_shared<MovieFileAudioRawPlugin>();
     audioRawPipeline->AddPlugin(0, audioRawPlugin);
     MovieFileAudioEncoderEncodeNode::EncodeConfig audioEncodeConfig {
@@ -268,7 +270,8 @@ void MovieFileControllerVideo::ConfigMicAudioPipeline(const AudioStandard::Audio
         movieFileAudioMicBufferProducer_.Set(movieFileAudioMicBufferProducer);
         movieFileAudioMicBufferProducer->InitBufferListener();
 
-        auto audioMicPipeline = movieFilePipelineManager_->GetPipelineWithProducer(movieFileAudioMicBufferProducer);
+        auto audioMicPipeline = movieFilePipelineManager_->GetPipelineWithProducer(
+            movieFileAudioMicBufferProducer, 1, PipelineAffinityHint::AUDIO);
         auto audioMicPlugin = std::make_shared<MovieFileAudioRawPlugin>();
         audioMicPipeline->AddPlugin(0, audioMicPlugin);
 
@@ -300,7 +303,8 @@ void MovieFileControllerVideo::ConfigProcessAudioPipeline(const AudioStandard::A
         movieFileAudioProcessBufferProducer->InitBufferListener();
 
         auto audioProcessPipeline =
-            movieFilePipelineManager_->GetPipelineWithProducer(movieFileAudioProcessBufferProducer);
+            movieFilePipelineManager_->GetPipelineWithProducer(
+                movieFileAudioProcessBufferProducer, 1, PipelineAffinityHint::AUDIO);
 
         auto audioPlugin = std::make_shared<MovieFileAudioPlugin>();
         audioProcessPipeline->AddPlugin(0, audioPlugin);
@@ -405,7 +409,8 @@ sptr<OHOS::IBufferProducer> MovieFileControllerVideo::GetMetaProducer()
 
 void MovieFileControllerVideo::SetupPipeline(std::shared_ptr<MovieFileConsumer> movieFileConsumer)
 {
-    auto videoPipeline = movieFilePipelineManager_->GetPipelineWithProducer(movieFileVideoEncodedBufferProducer_);
+    auto videoPipeline = movieFilePipelineManager_->GetPipelineWithProducer(
+        movieFileVideoEncodedBufferProducer_, 1, PipelineAffinityHint::VIDEO);
     videoPipeline->SetDataConsumer(movieFileConsumer);
 
     auto movieFileAudioRawBufferProducer = movieFileAudioRawBufferProducer_.Get();
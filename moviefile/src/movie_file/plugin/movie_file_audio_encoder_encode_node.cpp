@@ -108,6 +108,14 @@ uint32_t GetSampleFormatByteSize(uint32_t sampleFormat)
 
 MovieFileAudioEncoderEncodeNode::MovieFileAudioEncoderEncodeNode(EncodeConfig& encodeConfig)
 {
+    outputBufferPool_ = std::make_shared<MovieFileBufferPool<OH_AVBuffer*>>(
+        "audioEncodedBufferPool",
+        [](int32_t capacity) { return OH_AVBuffer_Create(capacity); },
+        [](OH_AVBuffer*& buffer) {
+            OH_AVBuffer_Destroy(buffer);
+            buffer = nullptr;
+        },
+        [](OH_AVBuffer* const& buffer) { return OH_AVBuffer_GetCapacity(buffer); });
     int32_t oneFrameSize = encodeConfig.sampleRate / MOVIE_FILE_AUDIO_ONE_THOUSAND * encodeConfig.channelCount *
                            static_cast<int32_t>(GetSampleFormatByteSize(encodeConfig.sampleFormat)) *
                            MOVIE_FILE_AUDIO_DURATION_EACH_AUDIO_FRAME;
@@ -151,6 +159,7 @@ MovieFileAudioEncoderEncodeNode::MovieFileAudioEncoderEncodeNode(EncodeConfig& e
 
 MovieFileAudioEncoderEncodeNode::~MovieFileAudioEncoderEncodeNode()
 {
+    MEDIA_INFO_LOG("~MovieFileAudioEncoderEncodeNode %{public}s", outputBufferPool_->Dump().c_str());
     if (encoderCallback_) {
         encoderCallback_->Release();
     }
@@ -181,10 +190,12 @@ std::unique_ptr<UnifiedPipelineAudioPackagedEncodedBuffer> MovieFileAudioEncoder
 
     auto returnBuffer = std::make_unique<UnifiedPipelineAudioPackagedEncodedBuffer>(returnBufferType);
     returnBuffer->WrapData(packagedAVBufferInfo);
-    returnBuffer->SetBufferMemoryReleaser([](AVEncoderedPackagedOH_AVBufferInfo* packagedInfo) {
+    // The buffer can outlive the node in the consumer queues, so the releaser holds the pool.
+    returnBuffer->SetBufferMemoryReleaser([bufferPool = outputBufferPool_](
+        AVEncoderedPackagedOH_AVBufferInfo* packagedInfo) {
         MEDIA_DEBUG_LOG("MovieFileAudioEncoderEncodeNode::ProcessBuffer encodedBuffer release");
         for (auto& bufferInfo : packagedInfo->infos) {
-            OH_AVBuffer_Destroy(bufferInfo.buffer);
+            bufferPool->Release(bufferInfo.buffer);
         }
     });
     return returnBuffer;
@@ -283,12 +294,12 @@ std::list<AVEncoderOH_AVBufferInfo> MovieFileAudioEncoderEncodeNode::DequeueBuff
             // 内存进行深拷贝
             OH_AVCodecBufferAttr attr = { 0, 0, 0, AVCODEC_BUFFER_FLAGS_NONE };
             OH_AVBuffer_GetBufferAttr(audioBuffer, &attr);
-            MEDIA_DEBUG_LOG("DequeueBuffer OH_AVBuffer_Create with size: %{public}d", attr.size);
-            OH_AVBuffer* destBuffer = OH_AVBuffer_Create(attr.size);
+            MEDIA_DEBUG_LOG("DequeueBuffer acquire buffer with size: %{public}d", attr.size);
+            OH_AVBuffer* destBuffer = outputBufferPool_->Acquire(attr.size);
             CHECK_RETURN_RET_ELOG(destBuffer == nullptr, {}, "destBuffer is null");
             auto sourceAddr = OH_AVBuffer_GetAddr(audioBuffer);
             auto destAddr = OH_AVBuffer_GetAddr(destBuffer);
-            errno_t cpyRet = memcpy_s(destAddr, attr.size, sourceAddr, attr.size);
+            errno_t cpyRet = memcpy_s(destAddr, OH_AVBuffer_GetCapacity(destBuffer), sourceAddr, attr.size);
             CHECK_PRINT_ELOG(cpyRet != 0, "DequeueBuffer memcpy_s failed. %{public}d", cpyRet);
 
             // 归还编码器内存
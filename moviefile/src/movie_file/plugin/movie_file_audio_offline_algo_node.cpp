@@ -29,6 +29,8 @@ namespace {
 // 注意：此处g_packageBufferList是 thread_local 类型，如果pipeline开启了多线程，这个地方需要做必要的优化适配
 thread_local std::list<PipelineAudioBufferData> g_packageBufferList {};
 constexpr int32_t PACKAGE_COUNT = 5;
+constexpr int32_t IDLE_PACKAGE_COUNT = 2;
+constexpr int32_t MICROSECONDS_PER_MILLISECOND = 1000;
 } // namespace
 
 const std::string MovieFileAudioOfflineAlgoNode::CHAIN_NAME_OFFLINE = "offline_record_algo";
@@ -98,7 +100,7 @@ std::unique_ptr<UnifiedPipelineAudioPackagedBuffer> MovieFileAudioOfflineAlgoNod
         "MovieFileAudioOfflineAlgoNode::ProcessBuffer bufferData.dataSize not enough");
     g_packageBufferList.emplace_back(bufferData);
     size_t dataCount = g_packageBufferList.size();
-    CHECK_RETURN_RET(dataCount < PACKAGE_COUNT, nullptr);
+    CHECK_RETURN_RET(dataCount < GetPackageCount(), nullptr);
     // 达到缓存数量，进行内存复制
     size_t unprocessedSize = oneUnprocessedSize_ * dataCount;
     uint8_t unprocessedPtr[unprocessedSize];
@@ -135,6 +137,17 @@ std::unique_ptr<UnifiedPipelineAudioPackagedBuffer> MovieFileAudioOfflineAlgoNod
     return packagedAduioBuffer;
 };
 
+size_t MovieFileAudioOfflineAlgoNode::GetPackageCount()
+{
+    // Every Process call is a round trip to the audio server, full batches amortize it while buffers queue up.
+    // When the pipeline keeps up, smaller batches hold the audio for less time before it reaches the muxer.
+    // Without latency samples there is nothing to go on, so the full batch is kept.
+    PipelinePressure pressure = GetPipelinePressureStats();
+    bool isIdle = pressure.queueDepth == 0 && pressure.latencyP99Us > 0 &&
+        pressure.latencyP99Us < MOVIE_FILE_AUDIO_DURATION_EACH_AUDIO_FRAME * MICROSECONDS_PER_MILLISECOND;
+    return isIdle ? IDLE_PACKAGE_COUNT : PACKAGE_COUNT;
+}
+
 void MovieFileAudioOfflineAlgoNode::ProcessCommand(UnifiedPipelineCommand* command)
 {
     CHECK_RETURN(command == nullptr || command->IsConsumed());
@@ -15,31 +15,129 @@
 
 #include "unified_pipeline_threadpool.h"
 
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <fstream>
 #include <memory>
+#include <sched.h>
+#include <string>
 #include <thread>
+#include <unistd.h>
 #include <utility>
 #include <vector>
 
 #include "camera_log.h"
-#include "unified_pipeline_worker_thread.h"
 namespace OHOS {
 namespace CameraStandard {
+namespace {
+constexpr auto WORKER_KEEP_ALIVE_TIME = std::chrono::seconds(5);
+// The histograms are halved every this many samples so they follow the recent load.
+constexpr uint64_t PRESSURE_DECAY_SAMPLES = 512;
+constexpr int32_t PERCENTILE_MEDIAN = 50;
+constexpr int32_t PERCENTILE_TAIL = 99;
+constexpr int32_t PERCENTILE_FULL = 100;
 
-void UnifiedPipelineThreadpool::OnIdle()
+struct CpuTopology {
+    cpu_set_t allCpus;
+    cpu_set_t littleCpus;
+    cpu_set_t bigCpus;
+    bool isHeterogeneous = false;
+};
+
+bool ReadCpuValue(const std::string& path, int64_t& value)
 {
-    HandleTask();
+    std::ifstream file(path);
+    return static_cast<bool>(file >> value);
 }
 
-UnifiedPipelineThreadpool::UnifiedPipelineThreadpool(size_t minThreads, size_t maxThreads)
-    : minThreads_(minThreads), maxThreads_(maxThreads)
-{}
+// Cores are told apart by cpu_capacity, or by their maximum frequency where capacity is not exported.
+CpuTopology LoadCpuTopology()
+{
+    CpuTopology topology;
+    CPU_ZERO(&topology.allCpus);
+    CPU_ZERO(&topology.littleCpus);
+    CPU_ZERO(&topology.bigCpus);
+    long cpuCount = sysconf(_SC_NPROCESSORS_CONF);
+    CHECK_RETURN_RET(cpuCount <= 0, topology);
+    cpuCount = std::min<long>(cpuCount, CPU_SETSIZE);
+    std::vector<int64_t> capacities(static_cast<size_t>(cpuCount), 0);
+    for (long cpu = 0; cpu < cpuCount; ++cpu) {
+        std::string cpuPath = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+        CPU_SET(cpu, &topology.allCpus);
+        if (!ReadCpuValue(cpuPath + "/cpu_capacity", capacities[cpu]) &&
+            !ReadCpuValue(cpuPath + "/cpufreq/cpuinfo_max_freq", capacities[cpu])) {
+            return topology;
+        }
+    }
+    auto minMax = std::minmax_element(capacities.begin(), capacities.end());
+    CHECK_RETURN_RET(*minMax.first == *minMax.second, topology);
+    for (long cpu = 0; cpu < cpuCount; ++cpu) {
+        CPU_SET(cpu, capacities[cpu] == *minMax.first ? &topology.littleCpus : &topology.bigCpus);
+    }
+    topology.isHeterogeneous = true;
+    return topology;
+}
+
+bool GetCpuSetForHint(PipelineAffinityHint hint, cpu_set_t& cpuSet)
+{
+    static const CpuTopology topology = LoadCpuTopology();
+    CHECK_RETURN_RET(!topology.isHeterogeneous, false);
+    switch (hint) {
+        case PipelineAffinityHint::AUDIO:
+            cpuSet = topology.littleCpus;
+            break;
+        case PipelineAffinityHint::VIDEO:
+            cpuSet = topology.bigCpus;
+            break;
+        default:
+            cpuSet = topology.allCpus;
+            break;
+    }
+    return true;
+}
+
+template<size_t N>
+size_t BucketOf(const std::array<int64_t, N>& bounds, int64_t value)
+{
+    return static_cast<size_t>(std::lower_bound(bounds.begin(), bounds.end(), value) - bounds.begin());
+}
+
+template<size_t N>
+void RecordSample(std::array<std::atomic<uint64_t>, N>& buckets, std::atomic<uint64_t>& samples, size_t bucket)
+{
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    CHECK_RETURN((samples.fetch_add(1, std::memory_order_relaxed) + 1) % PRESSURE_DECAY_SAMPLES != 0);
+    // Samples recorded concurrently with the decay may be lost, which is fine for a load estimate.
+    for (auto& count : buckets) {
+        count.store(count.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+}
+
+template<size_t N>
+int64_t Percentile(const std::array<uint64_t, N + 1>& histogram, const std::array<int64_t, N>& bounds,
+    int32_t percentile)
+{
+    uint64_t total = 0;
+    for (auto count : histogram) {
+        total += count;
+    }
+    CHECK_RETURN_RET(total == 0, 0);
+    uint64_t rank = (total * static_cast<uint64_t>(percentile) + PERCENTILE_FULL - 1) / PERCENTILE_FULL;
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < N; ++i) {
+        cumulative += histogram[i];
+        CHECK_RETURN_RET(cumulative >= rank, bounds[i]);
+    }
+    // The open ended bucket reports its lower bound.
+    return bounds[N - 1];
+}
+} // namespace
 
-std::shared_ptr<WorkerThread> UnifiedPipelineThreadpool::CreateWorkerNoLock()
+UnifiedPipelineThreadpool::UnifiedPipelineThreadpool(size_t minThreads, size_t maxThreads)
+    : workerList_(std::make_shared<const WorkerList>())
 {
-    auto worker = std::make_shared<WorkerThread>();
-    worker->SetStatusCallback(weak_from_this());
-    workers_.emplace_back(worker);
-    return worker;
+    SetThreadCount(minThreads, maxThreads);
 }
 
 UnifiedPipelineThreadpool::~UnifiedPipelineThreadpool()
@@ -47,52 +145,240 @@ UnifiedPipelineThreadpool::~UnifiedPipelineThreadpool()
     Shutdown();
 }
 
+void UnifiedPipelineThreadpool::SetThreadCount(size_t min, size_t max)
+{
+    // Workers are started on demand; extra ones retire once they have idled for the keep alive time.
+    max = std::max<size_t>(max, 1);
+    minThreads_ = std::min(min, max);
+    maxThreads_ = max;
+    MEDIA_DEBUG_LOG("UnifiedPipelineThreadpool::SetThreadCount min:%{public}zu max:%{public}zu", minThreads_.load(),
+        maxThreads_.load());
+}
+
+void UnifiedPipelineThreadpool::SetAffinityHint(PipelineAffinityHint hint)
+{
+    // Every worker applies the hint to itself before taking its next task.
+    affinityHint_ = hint;
+}
+
 void UnifiedPipelineThreadpool::Shutdown()
 {
-    std::vector<std::shared_ptr<WorkerThread>> shutdownWorkers = {};
+    std::vector<std::shared_ptr<Worker>> shutdownWorkers = {};
     {
-        std::lock_guard<std::mutex> taskLock(workerMutex_);
+        std::lock_guard<std::mutex> workerLock(workerMutex_);
         CHECK_RETURN(isShutdown_);
         isShutdown_ = true;
-        size_t pendingTaskSize = tasks_.size();
-        MEDIA_INFO_LOG(
-            "UnifiedPipelineThreadpool::Shutdown drop task size:%{public}d", static_cast<uint32_t>(pendingTaskSize));
+        MEDIA_INFO_LOG("UnifiedPipelineThreadpool::Shutdown drop task size:%{public}d",
+            static_cast<uint32_t>(GetTaskSize()));
         shutdownWorkers = workers_;
+        shutdownWorkers.insert(shutdownWorkers.end(), retiredWorkers_.begin(), retiredWorkers_.end());
+        retiredWorkers_.clear();
+    }
+    {
+        std::lock_guard<std::mutex> parkLock(parkMutex_);
+        parkCondition_.notify_all();
     }
     for (auto& worker : shutdownWorkers) {
-        worker->Shutdown();
+        CHECK_CONTINUE(!worker->thread.joinable());
+        if (worker->thread.get_id() == std::this_thread::get_id()) {
+            // Shut down from one of its own tasks, the worker exits when the task returns.
+            worker->thread.detach();
+        } else {
+            worker->thread.join();
+        }
     }
 }
 
-std::shared_ptr<WorkerThread> UnifiedPipelineThreadpool::GetAnIdleWorkerNoLock()
+bool UnifiedPipelineThreadpool::TryStartWorker()
 {
-    for (auto& worker : workers_) {
-        CHECK_RETURN_RET(worker->IsIdle(), worker);
+    std::lock_guard<std::mutex> workerLock(workerMutex_);
+    CHECK_RETURN_RET(isShutdown_, false);
+    for (auto& retired : retiredWorkers_) {
+        CHECK_EXECUTE(retired->thread.joinable(), retired->thread.join());
     }
-    std::shared_ptr<WorkerThread> idleWorker = nullptr;
-    if (workers_.size() < maxThreads_) {
-        idleWorker = CreateWorkerNoLock();
+    retiredWorkers_.clear();
+    size_t maxThreads = maxThreads_;
+    CHECK_RETURN_RET(workers_.size() >= maxThreads, false);
+    size_t targetSize = std::min(std::max(workers_.size() + 1, minThreads_.load()), maxThreads);
+    while (workers_.size() < targetSize) {
+        auto worker = std::make_shared<Worker>();
+        workers_.emplace_back(worker);
+        worker->thread = std::thread([this, worker]() { WorkerLoop(worker); });
     }
-    return idleWorker;
+    PublishWorkersLocked();
+    return true;
+}
+
+void UnifiedPipelineThreadpool::PublishWorkersLocked()
+{
+    std::atomic_store(&workerList_, std::shared_ptr<const WorkerList>(std::make_shared<const WorkerList>(workers_)));
+}
+
+std::shared_ptr<const UnifiedPipelineThreadpool::WorkerList> UnifiedPipelineThreadpool::LoadWorkers()
+{
+    return std::atomic_load(&workerList_);
 }
 
-void UnifiedPipelineThreadpool::HandleTask()
+bool UnifiedPipelineThreadpool::Post(const std::shared_ptr<PipelineTask>& task)
 {
-    std::shared_ptr<PipelineTask> workerTask = nullptr;
-    std::lock_guard<std::mutex> taskLock(workerMutex_);
-    CHECK_RETURN(isShutdown_ || tasks_.empty());
-    workerTask = tasks_.front();
-    std::shared_ptr<WorkerThread> idleWorker = GetAnIdleWorkerNoLock();
-    if (idleWorker != nullptr && idleWorker->SubmitTask(workerTask)) {
-        tasks_.pop_front();
-    } else {
-        auto taskSize = tasks_.size();
-        if (taskSize >= 10) { // if task size greater 10 , let's log some msg.
-            MEDIA_WARNING_LOG(
-                "UnifiedPipelineThreadpool::HandleTask no idle thread, wait... task size:%{public}zu", taskSize);
+    CHECK_RETURN_RET(isShutdown_, false);
+    QueuedTask queuedTask { task, std::chrono::steady_clock::now() };
+    // Every idle worker already has a task coming, so this one needs a new worker.
+    if (queuedTasks_.load() >= idleWorkers_.load()) {
+        TryStartWorker();
+    }
+    while (!PushTask(queuedTask)) {
+        // The workers loaded by PushTask all retired meanwhile.
+        CHECK_RETURN_RET(!TryStartWorker() && isShutdown_, false);
+    }
+    RecordDepth(queuedTasks_.fetch_add(1) + 1);
+    WakeWorker();
+    return true;
+}
+
+bool UnifiedPipelineThreadpool::PushTask(QueuedTask& queuedTask)
+{
+    auto workers = LoadWorkers();
+    CHECK_RETURN_RET(workers->empty(), false);
+    size_t workerCount = workers->size();
+    size_t first = nextWorker_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < workerCount; ++i) {
+        auto& worker = (*workers)[(first + i) % workerCount];
+        std::lock_guard<std::mutex> taskLock(worker->taskMutex);
+        CHECK_CONTINUE(worker->isRetired);
+        worker->tasks.emplace_back(std::move(queuedTask));
+        return true;
+    }
+    return false;
+}
+
+void UnifiedPipelineThreadpool::WakeWorker()
+{
+    // Pairs with the idle count increment in WaitForTask: either the worker sees the task or we see the worker.
+    CHECK_RETURN(idleWorkers_.load() == 0);
+    std::lock_guard<std::mutex> parkLock(parkMutex_);
+    parkCondition_.notify_one();
+}
+
+void UnifiedPipelineThreadpool::WorkerLoop(std::shared_ptr<Worker> self)
+{
+    PipelineAffinityHint appliedHint = PipelineAffinityHint::NONE;
+    while (!isShutdown_) {
+        ApplyAffinityHint(appliedHint);
+        QueuedTask queuedTask;
+        if (PopTask(self, queuedTask) || StealTask(self, queuedTask)) {
+            RunTask(queuedTask);
+            continue;
         }
+        CHECK_BREAK(!WaitForTask(self));
     }
 }
 
+bool UnifiedPipelineThreadpool::PopTask(const std::shared_ptr<Worker>& self, QueuedTask& queuedTask)
+{
+    std::lock_guard<std::mutex> taskLock(self->taskMutex);
+    CHECK_RETURN_RET(self->tasks.empty(), false);
+    queuedTask = std::move(self->tasks.front());
+    self->tasks.pop_front();
+    queuedTasks_.fetch_sub(1);
+    return true;
+}
+
+bool UnifiedPipelineThreadpool::StealTask(const std::shared_ptr<Worker>& self, QueuedTask& queuedTask)
+{
+    auto workers = LoadWorkers();
+    size_t workerCount = workers->size();
+    auto selfIt = std::find(workers->begin(), workers->end(), self);
+    size_t first = selfIt == workers->end() ? 0 : static_cast<size_t>(selfIt - workers->begin()) + 1;
+    for (size_t i = 0; i < workerCount; ++i) {
+        auto& victim = (*workers)[(first + i) % workerCount];
+        CHECK_CONTINUE(victim == self);
+        std::lock_guard<std::mutex> taskLock(victim->taskMutex);
+        CHECK_CONTINUE(victim->tasks.empty());
+        // Take the oldest task, so tasks still start in the order they were posted to the victim.
+        queuedTask = std::move(victim->tasks.front());
+        victim->tasks.pop_front();
+        queuedTasks_.fetch_sub(1);
+        return true;
+    }
+    return false;
+}
+
+void UnifiedPipelineThreadpool::RunTask(QueuedTask& queuedTask)
+{
+    auto latency = std::chrono::steady_clock::now() - queuedTask.postTime;
+    RecordLatency(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+    CHECK_RETURN(queuedTask.task == nullptr || !queuedTask.task->func);
+    queuedTask.task->func();
+}
+
+bool UnifiedPipelineThreadpool::WaitForTask(const std::shared_ptr<Worker>& self)
+{
+    bool hasTask = false;
+    {
+        std::unique_lock<std::mutex> parkLock(parkMutex_);
+        idleWorkers_.fetch_add(1);
+        hasTask = parkCondition_.wait_for(
+            parkLock, WORKER_KEEP_ALIVE_TIME, [this] { return isShutdown_ || queuedTasks_.load() > 0; });
+        idleWorkers_.fetch_sub(1);
+    }
+    CHECK_RETURN_RET(isShutdown_, false);
+    return hasTask || !TryRetire(self);
+}
+
+bool UnifiedPipelineThreadpool::TryRetire(const std::shared_ptr<Worker>& self)
+{
+    std::lock_guard<std::mutex> workerLock(workerMutex_);
+    CHECK_RETURN_RET(isShutdown_ || workers_.size() <= minThreads_, false);
+    {
+        std::lock_guard<std::mutex> taskLock(self->taskMutex);
+        CHECK_RETURN_RET(!self->tasks.empty(), false);
+        self->isRetired = true;
+    }
+    workers_.erase(std::remove(workers_.begin(), workers_.end(), self), workers_.end());
+    // Joined by the next TryStartWorker or Shutdown.
+    retiredWorkers_.emplace_back(self);
+    PublishWorkersLocked();
+    MEDIA_DEBUG_LOG("UnifiedPipelineThreadpool::TryRetire worker size:%{public}zu", workers_.size());
+    return true;
+}
+
+void UnifiedPipelineThreadpool::ApplyAffinityHint(PipelineAffinityHint& appliedHint)
+{
+    PipelineAffinityHint hint = affinityHint_.load(std::memory_order_relaxed);
+    CHECK_RETURN(hint == appliedHint);
+    appliedHint = hint;
+    cpu_set_t cpuSet;
+    CHECK_RETURN(!GetCpuSetForHint(hint, cpuSet));
+    int32_t ret = sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+    CHECK_PRINT_WLOG(ret != 0, "UnifiedPipelineThreadpool::ApplyAffinityHint hint:%{public}d failed:%{public}d",
+        static_cast<int32_t>(hint), errno);
+}
+
+void UnifiedPipelineThreadpool::RecordDepth(int64_t depth)
+{
+    RecordSample(depthBuckets_, depthSamples_, BucketOf(PipelinePressure::DEPTH_BOUNDS, depth));
+    CHECK_PRINT_WLOG(depth >= 10, "UnifiedPipelineThreadpool::Post no idle thread, wait... task size:%{public}" PRId64,
+        depth); // if task size greater 10 , let's log some msg.
+}
+
+void UnifiedPipelineThreadpool::RecordLatency(int64_t latencyUs)
+{
+    RecordSample(latencyBuckets_, latencySamples_, BucketOf(PipelinePressure::LATENCY_BOUNDS_US, latencyUs));
+}
+
+PipelinePressure UnifiedPipelineThreadpool::GetPressure()
+{
+    PipelinePressure pressure;
+    pressure.queueDepth = GetTaskSize();
+    for (size_t i = 0; i < PipelinePressure::BUCKET_COUNT; ++i) {
+        pressure.depthHistogram[i] = depthBuckets_[i].load(std::memory_order_relaxed);
+        pressure.latencyHistogram[i] = latencyBuckets_[i].load(std::memory_order_relaxed);
+    }
+    pressure.latencyP50Us =
+        Percentile(pressure.latencyHistogram, PipelinePressure::LATENCY_BOUNDS_US, PERCENTILE_MEDIAN);
+    pressure.latencyP99Us = Percentile(pressure.latencyHistogram, PipelinePressure::LATENCY_BOUNDS_US, PERCENTILE_TAIL);
+    return pressure;
+}
 } // namespace CameraStandard
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -15,31 +15,51 @@
 
 #include "unified_pipeline.h"
 
+#include <algorithm>
+
 #include "camera_log.h"
 
 namespace OHOS {
 namespace CameraStandard {
 
-UnifiedPipeline::UnifiedPipeline(int32_t maxThreadSize) : maxThreadSize_(maxThreadSize) {}
+UnifiedPipeline::UnifiedPipeline(int32_t maxThreadSize) : maxThreadSize_(maxThreadSize)
+{
+    snapshot_ = std::make_shared<const PipelineSnapshot>();
+}
+
+UnifiedPipeline::~UnifiedPipeline()
+{
+    isShutdown_.store(true);
+    {
+        std::lock_guard<std::mutex> lock(windowMutex_);
+        windowCv_.notify_all();
+    }
+    // Workers run nodes owned by this pipeline, stop them before the nodes go away.
+    std::shared_ptr<UnifiedPipelineThreadpool> threadPool;
+    {
+        std::lock_guard<std::mutex> lock(threadPoolMutex_);
+        threadPool = threadPool_;
+    }
+    CHECK_EXECUTE(threadPool != nullptr, threadPool->Shutdown());
+}
 
 std::shared_ptr<UnifiedPipelineThreadpool> UnifiedPipeline::GetThreadPool()
 {
     CHECK_RETURN_RET(threadPool_ != nullptr, threadPool_);
     std::lock_guard<std::mutex> lock(threadPoolMutex_);
     if (threadPool_ == nullptr) {
-        threadPool_ = std::make_shared<UnifiedPipelineThreadpool>(maxThreadSize_);
+        threadPool_ = std::make_shared<UnifiedPipelineThreadpool>(1, maxThreadSize_);
     }
     return threadPool_;
 }
 
 std::unique_ptr<UnifiedPipelineBuffer> UnifiedPipeline::PluginsProcessBuffer(
-    std::unique_ptr<UnifiedPipelineBuffer> inBuffer,
-    const std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>>& plugins)
+    std::unique_ptr<UnifiedPipelineBuffer> inBuffer, const std::vector<std::shared_ptr<UnifiedPipelinePlugin>>& plugins)
 {
     auto bufferData = std::move(inBuffer);
     MEDIA_DEBUG_LOG("UnifiedPipeline::PluginsProcessBuffer bufferType:%{public}d", bufferData->GetBufferType());
-    for (auto& pluginPair : plugins) {
-        bufferData = pluginPair.second->ProcessBuffer(std::move(bufferData));
+    for (auto& plugin : plugins) {
+        bufferData = plugin->ProcessBuffer(std::move(bufferData));
         if (bufferData == nullptr) {
             break;
         }
@@ -48,96 +68,171 @@ std::unique_ptr<UnifiedPipelineBuffer> UnifiedPipeline::PluginsProcessBuffer(
     return bufferData;
 }
 
-void UnifiedPipeline::PluginsProcessCommand(UnifiedPipelineCommand* command,
-    const std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>>& plugins)
+void UnifiedPipeline::PluginsProcessCommand(
+    UnifiedPipelineCommand* command, const std::vector<std::shared_ptr<UnifiedPipelinePlugin>>& plugins)
 {
     CHECK_RETURN(command == nullptr);
     CHECK_RETURN(command->IsConsumed());
-    for (auto& pluginPair : plugins) {
-        pluginPair.second->ProcessCommand(command);
+    for (auto& plugin : plugins) {
+        plugin->ProcessCommand(command);
         CHECK_RETURN(command->IsConsumed());
     }
 }
 
+void UnifiedPipeline::SetAffinityHint(PipelineAffinityHint hint)
+{
+    auto threadPool = GetThreadPool();
+    threadPool->SetAffinityHint(hint);
+}
+
 int64_t UnifiedPipeline::GetPipelinePressure()
 {
     auto threadPool = GetThreadPool();
     return threadPool->GetTaskSize();
 }
 
-void UnifiedPipeline::OnBufferArrival(std::unique_ptr<UnifiedPipelineBuffer> sourceData)
+PipelinePressure UnifiedPipeline::GetPipelinePressureStats()
 {
-    CHECK_RETURN(sourceData == nullptr);
     auto threadPool = GetThreadPool();
+    return threadPool->GetPressure();
+}
 
-    // plugins_ 必须在锁范围内进行拷贝之后放到线程池中，避免多线程操作plugins_出现异常。
-    std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>> plugins;
-    {
-        std::lock_guard<std::mutex> lock(pluginsMutex_);
-        plugins = plugins_;
+void UnifiedPipeline::PublishSnapshotLocked()
+{
+    auto snapshot = std::make_shared<PipelineSnapshot>();
+    snapshot->plugins.reserve(plugins_.size());
+    for (auto& pluginPair : plugins_) {
+        snapshot->plugins.emplace_back(pluginPair.second);
     }
+    snapshot->dataConsumer = dataConsumer_;
+    std::atomic_store(&snapshot_, std::shared_ptr<const PipelineSnapshot>(std::move(snapshot)));
+}
 
-    std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer;
-    {
-        std::lock_guard<std::mutex> lockDataConsumer(dataConsumerMutex_);
-        dataConsumer = dataConsumer_;
+std::shared_ptr<const UnifiedPipeline::PipelineSnapshot> UnifiedPipeline::LoadSnapshot()
+{
+    return std::atomic_load(&snapshot_);
+}
+
+UnifiedPipeline::DispatchNode* UnifiedPipeline::AcquireNode()
+{
+    DispatchNode* node = nullptr;
+    CHECK_RETURN_RET(nodePool_.TryPop(node), node);
+    auto newNode = std::make_unique<DispatchNode>();
+    node = newNode.get();
+    node->task = std::make_shared<PipelineTask>([this, node]() { RunNode(node); });
+    std::lock_guard<std::mutex> lock(nodesMutex_);
+    nodes_.emplace_back(std::move(newNode));
+    return node;
+}
+
+void UnifiedPipeline::RecycleNode(DispatchNode* node)
+{
+    node->buffer = nullptr;
+    node->command = nullptr;
+    node->snapshot = nullptr;
+    CHECK_RETURN(nodePool_.TryPush(node));
+    // More nodes in flight than the pool keeps, give this one back.
+    std::lock_guard<std::mutex> lock(nodesMutex_);
+    auto it = std::find_if(nodes_.begin(), nodes_.end(),
+        [node](const std::unique_ptr<DispatchNode>& ownedNode) { return ownedNode.get() == node; });
+    CHECK_EXECUTE(it != nodes_.end(), nodes_.erase(it));
+}
+
+void UnifiedPipeline::Dispatch(DispatchNode* node)
+{
+    auto threadPool = GetThreadPool();
+    node->snapshot = LoadSnapshot();
+    // Sequence numbers are handed out in submission order so the head of the reorder window is
+    // always the oldest task in the pool's queue.
+    std::lock_guard<std::mutex> lock(dispatchMutex_);
+    // nextSequence_ overflow is fine, deliverSequence_ overflows the same way
+    node->sequence = nextSequence_++;
+    if (!threadPool->Post(node->task)) {
+        MEDIA_WARNING_LOG("UnifiedPipeline::Dispatch thread pool is shut down");
+        nextSequence_--;
+        RecycleNode(node);
     }
+}
 
-    std::unique_lock<std::mutex> pipelineThreadLock(pipelineThreadMtx_);
-
-    // currentBufferId_ overflow is fine, because handledBufferId_ will also overflow
-    auto currentId = currentBufferId_++;
-    threadPool->Submit([plugins, inBuffer = std::move(sourceData), dataConsumer, this, currentId]() mutable {
-        auto bufferData = PluginsProcessBuffer(std::move(inBuffer), plugins);
-        std::unique_lock<std::mutex> pipelineThreadLock(pipelineThreadMtx_);
-        pipelineThreadCv_.wait(pipelineThreadLock, [this, &currentId] { return handledBufferId_ == currentId; });
-        if (bufferData != nullptr) {
-            auto strongDataConsumer = dataConsumer.lock();
-            if (strongDataConsumer) {
-                strongDataConsumer->OnBufferArrival(std::move(bufferData));
-            }
-        }
-        handledBufferId_++;
-        pipelineThreadCv_.notify_all();
-    });
-};
+void UnifiedPipeline::OnBufferArrival(std::unique_ptr<UnifiedPipelineBuffer> sourceData)
+{
+    CHECK_RETURN(sourceData == nullptr);
+    DispatchNode* node = AcquireNode();
+    node->buffer = std::move(sourceData);
+    Dispatch(node);
+}
 
 void UnifiedPipeline::OnCommandArrival(std::unique_ptr<UnifiedPipelineCommand> command)
 {
     CHECK_RETURN(command == nullptr || command->IsConsumed());
-    auto threadPool = GetThreadPool();
+    DispatchNode* node = AcquireNode();
+    node->command = std::move(command);
+    Dispatch(node);
+}
 
-    // plugins_ 必须在锁范围内进行拷贝之后放到线程池中，避免多线程操作plugins_出现异常。
-    std::map<int32_t, std::shared_ptr<UnifiedPipelinePlugin>, std::less<int32_t>> plugins;
-    {
-        std::lock_guard<std::mutex> lock(pluginsMutex_);
-        plugins = plugins_;
+void UnifiedPipeline::RunNode(DispatchNode* node)
+{
+    const auto& plugins = node->snapshot->plugins;
+    if (node->buffer != nullptr) {
+        node->buffer = PluginsProcessBuffer(std::move(node->buffer), plugins);
+    } else {
+        PluginsProcessCommand(node->command.get(), plugins);
     }
+    CompleteNode(node);
+}
 
-    std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer;
-    {
-        std::lock_guard<std::mutex> lockDataConsumer(dataConsumerMutex_);
-        dataConsumer = dataConsumer_;
+void UnifiedPipeline::CompleteNode(DispatchNode* node)
+{
+    uint64_t sequence = node->sequence;
+    if (sequence - deliverSequence_.load() >= REORDER_WINDOW) {
+        // Rare: this node overtook a whole window of earlier ones, wait for room in its slot.
+        std::unique_lock<std::mutex> lock(windowMutex_);
+        windowWaiters_.fetch_add(1);
+        windowCv_.wait(lock, [this, sequence] {
+            return isShutdown_.load() || sequence - deliverSequence_.load() < REORDER_WINDOW;
+        });
+        windowWaiters_.fetch_sub(1);
     }
+    if (isShutdown_.load()) {
+        RecycleNode(node);
+        return;
+    }
+    reorderSlots_[sequence % REORDER_WINDOW].node.store(node);
 
-    std::unique_lock<std::mutex> pipelineThreadLock(pipelineThreadMtx_);
-
-    // currentBufferId_ overflow is fine, because handledBufferId_ will also overflow
-    auto currentId = currentBufferId_++;
-    threadPool->Submit([plugins, inCommand = std::move(command), dataConsumer, this, currentId]() mutable {
-        PluginsProcessCommand(inCommand.get(), plugins);
-        CHECK_RETURN(inCommand->IsConsumed());
-
-        std::unique_lock<std::mutex> pipelineThreadLock(pipelineThreadMtx_);
-        pipelineThreadCv_.wait(pipelineThreadLock, [this, &currentId] { return handledBufferId_ == currentId; });
-        auto strongDataConsumer = dataConsumer.lock();
-        if (strongDataConsumer) {
-            strongDataConsumer->OnCommandArrival(std::move(inCommand));
+    // Whoever finds the head of the window ready delivers it and everything ready behind it; the
+    // other completers just park their node and go back to the pool.
+    while (true) {
+        bool expected = false;
+        CHECK_RETURN(!isDelivering_.compare_exchange_strong(expected, true));
+        uint64_t deliverSequence = deliverSequence_.load();
+        uint64_t deliveredCount = 0;
+        DispatchNode* readyNode = nullptr;
+        while ((readyNode = reorderSlots_[deliverSequence % REORDER_WINDOW].node.exchange(nullptr)) != nullptr) {
+            DeliverNode(readyNode);
+            RecycleNode(readyNode);
+            deliverSequence_.store(++deliverSequence);
+            deliveredCount++;
+        }
+        isDelivering_.store(false);
+        if (deliveredCount > 0 && windowWaiters_.load() > 0) {
+            std::lock_guard<std::mutex> lock(windowMutex_);
+            windowCv_.notify_all();
         }
-        handledBufferId_++;
-        pipelineThreadCv_.notify_all();
-    });
-};
+        // A node may have been parked after the scan but before the flag was released.
+        CHECK_RETURN(reorderSlots_[deliverSequence % REORDER_WINDOW].node.load() == nullptr);
+    }
+}
+
+void UnifiedPipeline::DeliverNode(DispatchNode* node)
+{
+    auto dataConsumer = node->snapshot->dataConsumer.lock();
+    CHECK_RETURN(dataConsumer == nullptr);
+    if (node->buffer != nullptr) {
+        dataConsumer->OnBufferArrival(std::move(node->buffer));
+    } else if (node->command != nullptr && !node->command->IsConsumed()) {
+        dataConsumer->OnCommandArrival(std::move(node->command));
+    }
+}
 
 void UnifiedPipeline::AddPlugin(int32_t order, std::shared_ptr<UnifiedPipelinePlugin> plugin)
 {
@@ -145,6 +240,7 @@ void UnifiedPipeline::AddPlugin(int32_t order, std::shared_ptr<UnifiedPipelinePl
     std::lock_guard<std::mutex> lock(pluginsMutex_);
     plugins_[order] = plugin;
     plugin->SetPipelinePressureMonitor(weak_from_this());
+    PublishSnapshotLocked();
 }
 
 void UnifiedPipeline::RemovePlugin(std::shared_ptr<UnifiedPipelinePlugin> plugin)
@@ -158,18 +254,21 @@ void UnifiedPipeline::RemovePlugin(std::shared_ptr<UnifiedPipelinePlugin> plugin
             ++it;
         }
     }
+    PublishSnapshotLocked();
 }
 
 void UnifiedPipeline::ClearPlugin()
 {
     std::lock_guard<std::mutex> lock(pluginsMutex_);
     plugins_.clear();
+    PublishSnapshotLocked();
 }
 
 void UnifiedPipeline::SetDataConsumer(std::weak_ptr<UnifiedPipelineDataConsumer> dataConsumer)
 {
-    std::lock_guard<std::mutex> lock(dataConsumerMutex_);
+    std::lock_guard<std::mutex> lock(pluginsMutex_);
     dataConsumer_ = dataConsumer;
+    PublishSnapshotLocked();
 }
 } // namespace CameraStandard
-} // namespace OHOS
\ No newline at end of file
+} // namespace OHOS
@@ -51,12 +51,13 @@ bool UnifiedPipelineManager::ReleasePipelineManager(PipelineManagerId managerId)
 UnifiedPipelineManager::UnifiedPipelineManager() {}
 
 std::shared_ptr<UnifiedPipeline> UnifiedPipelineManager::GetPipelineWithProducer(
-    std::shared_ptr<UnifiedPipelineDataProducer> producer, int32_t threadMax)
+    std::shared_ptr<UnifiedPipelineDataProducer> producer, int32_t threadMax, PipelineAffinityHint affinityHint)
 {
     std::lock_guard<std::mutex> lock(pipelinesMutex_);
     auto it = pipelines_.find(producer);
     CHECK_RETURN_RET(it != pipelines_.end(), it->second);
     auto newPipeline = std::make_shared<UnifiedPipeline>(threadMax);
+    newPipeline->SetAffinityHint(affinityHint);
     producer->SetBufferListener(newPipeline);
     pipelines_[producer] = newPipeline;
     return newPipeline;
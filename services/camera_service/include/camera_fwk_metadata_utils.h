@@ -28,9 +28,17 @@ namespace CameraFwkMetadataUtils {
 bool MergeMetadata(const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata,
     std::shared_ptr<OHOS::Camera::CameraMetadata> dstMetadata);
 
+// isSystemCaller, resolved once by the caller, decides whether system only tags are kept. dstMetadata is
+// replaced by a larger copy when the merged items do not fit, so it grows once per merge instead of per item.
+bool MergeMetadata(const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata,
+    std::shared_ptr<OHOS::Camera::CameraMetadata>& dstMetadata, bool isSystemCaller);
+
 std::shared_ptr<OHOS::Camera::CameraMetadata> CopyMetadata(
     const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata);
 
+std::shared_ptr<OHOS::Camera::CameraMetadata> CopyMetadata(
+    const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata, bool isSystemCaller);
+
 bool UpdateMetadataTag(
     const camera_metadata_item_t& srcItem, std::shared_ptr<OHOS::Camera::CameraMetadata> dstMetadata);
 
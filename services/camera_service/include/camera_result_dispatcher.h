@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_RESULT_DISPATCHER_H
+#define OHOS_CAMERA_RESULT_DISPATCHER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "camera_metadata_operator.h"
+
+namespace OHOS {
+namespace CameraStandard {
+constexpr size_t MAX_RESULT_SUBSCRIBED_TAGS = 32;
+constexpr size_t MAX_RESULT_SUBSCRIBERS = 32;
+
+// Subscribed items found in one result, valid for the duration of the dispatch only.
+class CameraResultItems {
+public:
+    const camera_metadata_item_t* Find(uint32_t tag) const;
+
+private:
+    friend class CameraResultDispatcher;
+    std::array<camera_metadata_item_t, MAX_RESULT_SUBSCRIBED_TAGS> items_ {};
+    size_t count_ = 0;
+};
+
+/**
+ * Routes the items of a device result to the consumers that subscribed to their tags. The result
+ * header is walked once per frame and a subscriber is called once when any of its tags is present,
+ * so the cost of a result grows with its item count and not with the number of consumers.
+ */
+class CameraResultDispatcher {
+public:
+    using Handler = std::function<void(const CameraResultItems& items, uint64_t timestamp)>;
+
+    // Subscribers are expected to be registered before results flow, they are called in order of registration.
+    bool Subscribe(std::initializer_list<uint32_t> tags, Handler handler);
+    void Dispatch(const common_metadata_header_t* header, uint64_t timestamp);
+    std::string Dump();
+
+private:
+    struct TagEntry {
+        uint32_t tag = 0;
+        uint32_t subscriberMask = 0;
+        std::atomic<uint64_t> hitCount = 0;
+    };
+
+    void RecordFrame(int64_t costNs);
+
+    std::shared_mutex mutex_; // Lock for the subscriptions, the counters are atomic.
+    std::array<TagEntry, MAX_RESULT_SUBSCRIBED_TAGS> tags_;
+    size_t tagCount_ = 0;
+    std::unordered_map<uint32_t, size_t> tagIndex_;
+    std::vector<Handler> subscribers_;
+
+    std::atomic<uint64_t> frameCount_ = 0;
+    std::atomic<uint64_t> totalCostNs_ = 0;
+    std::atomic<int64_t> maxCostNs_ = 0;
+    std::atomic<int64_t> lastCostNs_ = 0;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_RESULT_DISPATCHER_H
@@ -28,6 +28,7 @@
 #include <shared_mutex>
 
 #include "camera_privacy.h"
+#include "camera_result_dispatcher.h"
 #include "camera_sensor_plugin.h"
 #include "v1_0/icamera_device_callback.h"
 #include "camera_metadata_info.h"
@@ -104,6 +105,10 @@ public:
     uint8_t GetUsedAsPosition();
     bool GetDeviceMuteMode();
     float GetZoomRatio();
+    // Zoom ratio of the latest result, false when none was reported within maxAgeMs.
+    bool GetReportedZoomRatio(float& zoomRatio, uint64_t maxAgeMs);
+    // Changes whenever the fps or zoom performance the HAL would report may have changed.
+    uint64_t GetZoomStatusGeneration();
     int32_t GetFocusMode();
     int32_t GetVideoStabilizationMode();
     void SetConcurrentCaptureTag(bool flag);
@@ -111,6 +116,7 @@ public:
     void UnsetSpectrumCallback();
     void OnSpectrumInfoChange(std::shared_ptr<OHOS::Camera::CameraMetadata> ability, const uint64_t timestamp);
     sptr<ICameraSpectrumInfoCallback> GetSpectrumCallback();
+    std::string DumpResultDispatcher();
 #ifdef CAMERA_MOVING_PHOTO
     void EnableMovingPhoto(bool isMovingPhotoEnabled);
     bool CheckMovingPhotoSupported(int32_t mode);
@@ -239,7 +245,11 @@ private:
     std::mutex opMutex_; // Lock the operations updateSettings_, streamOperator_, and hdiCameraDevice_.
     std::shared_ptr<OHOS::Camera::CameraMetadata> updateSettings_;
     sptr<OHOS::HDI::Camera::V1_0::ICameraDevice> hdiCameraDevice_;
+    // System app check of the last calling token that updated settings, guarded by opMutex_.
+    uint64_t systemCallerTokenId_ = 0;
+    bool isSystemCaller_ = false;
     std::shared_ptr<OHOS::Camera::CameraMetadata> cachedSettings_;
+    CameraResultDispatcher resultDispatcher_;
     int32_t cameraConcurrentType_ = 0;
     std::atomic<bool> isDeviceOpenedByConcurrent_ = false;
 
@@ -309,11 +319,19 @@ private:
     void RegisterDisplayModeListener();
     void UnregisterDisplayModeListener();
     void CheckOnResultData(std::shared_ptr<OHOS::Camera::CameraMetadata> cameraResult);
+    void RegisterResultSubscribers();
+    void HandleSpectrumInfo(const camera_metadata_item_t& item, const uint64_t timestamp);
+    void HandleDeviceProtectionStatus(const camera_metadata_item_t& item);
+    void HandleZoomRatio(const camera_metadata_item_t& item);
+    bool UpdateZoomStatusValue(uint32_t tag, const camera_metadata_item_t& item);
+    void AdvanceZoomStatusGeneration();
     bool CanOpenCamera();
     void ResetZoomTimer();
+    bool IsSystemCallerLocked();
     void CheckZoomChange(const std::shared_ptr<OHOS::Camera::CameraMetadata>& settings);
     void CheckFocusChange(const std::shared_ptr<OHOS::Camera::CameraMetadata>& settings);
     void CheckVideoStabilizationChange(const std::shared_ptr<OHOS::Camera::CameraMetadata>& settings);
+    void CheckZoomStatusChange(const std::shared_ptr<OHOS::Camera::CameraMetadata>& settings);
     void UnPrepareZoom();
     int32_t OpenDevice(bool isEnableSecCam = false);
     void HandleFoldableDevice();
@@ -336,6 +354,7 @@ private:
 #endif
 #ifdef CAMERA_MOVING_PHOTO
     void GetMovingPhotoStartAndEndTime(std::shared_ptr<OHOS::Camera::CameraMetadata> cameraResult);
+    void HandleMovingPhotoTime(const camera_metadata_item_t& item);
     bool isMovingPhotoEnabled_ = false;
     std::mutex movingPhotoStartTimeCallbackLock_;
     std::mutex movingPhotoEndTimeCallbackLock_;
@@ -354,6 +373,7 @@ private:
     void ReportMechMetadata(std::shared_ptr<OHOS::Camera::CameraMetadata> cameraResult);
 #ifdef CAMERA_FRAMEWORK_FEATURE_MEDIA_STREAM
     void SaveKeyFrameInfo(std::shared_ptr<OHOS::Camera::CameraMetadata> cameraResult);
+    void HandleKeyFrameInfo(const camera_metadata_item_t& timestampItem, const camera_metadata_item_t& typeItem);
 #endif
     bool GetScanScene();
     void UpdateScanSceneMetadata(uint32_t previewQuality);
@@ -374,6 +394,11 @@ private:
     std::shared_mutex zoomInfoCallbackLock_;
     std::function<void(ZoomInfo)> zoomInfoCallback_;
     float zoomRatio_ = 1.0f;
+    std::atomic<float> reportedZoomRatio_ {1.0f};
+    std::atomic<uint64_t> zoomRatioReportTime_ {0};
+    std::atomic<uint64_t> zoomStatusGeneration_ {0};
+    std::mutex zoomStatusValueMutex_;
+    std::map<uint32_t, std::vector<uint32_t>> zoomStatusValues_;
     int32_t focusMode_ = -1;
     bool focusStatus_ = false;
     std::map<int64_t, uint8_t> keyFrameInfoMap_;
@@ -18,6 +18,7 @@
 #define EXPORT_API __attribute__((visibility("default")))
 
 #include <refbase.h>
+#include <atomic>
 #include <iostream>
 #include <map>
 #include <utility>
@@ -25,6 +26,7 @@
 #include <mutex>
 #include <string>
 #include <vector>
+#include "json_cache_converter/binary_cache_converter.h"
 #include "json_cache_converter/json_cache_converter.h"
 #include "camera_log.h"
 #include "camera_metadata_info.h"
@@ -99,6 +101,11 @@ public:
     virtual int32_t GetCameraAbility(const std::string &cameraId,
         std::shared_ptr<OHOS::Camera::CameraMetadata> &ability);
     virtual int32_t GetCameraIdSortedByCameraType(std::vector<std::string>& cameraIds);
+    // Advances whenever a camera host or a camera is added or removed. Starts from the boot time so that a
+    // generation handed out by an earlier service instance never matches.
+    uint64_t GetCameraGeneration();
+    // Generation the camera was added at, its ability does not change before it is removed. 0 if unknown.
+    uint64_t GetCameraAbilityGeneration(const std::string& cameraId);
     virtual int32_t OpenCameraDevice(std::string &cameraId,
                                      const sptr<ICameraDeviceCallback> &callback,
                                      sptr<OHOS::HDI::Camera::V1_0::ICameraDevice> &pDevice,
@@ -109,10 +116,8 @@ public:
     virtual int32_t SetTorchLevel(float level);
     void NotifyDeviceStateChangeInfo(int notifyType, int deviceState);
 
-    void ParseJsonFileToMap(const std::string& filePath, std::string& clientName,
-                                       std::string& cameraId);
-    void SaveMapToJsonFile(const std::string& filePath, const std::string& clientName,
-                                       const std::string& cameraId);
+    void LoadRestoreParamCache(std::string& clientName, std::string& cameraId);
+    void SaveRestoreParamCache(const std::string& clientName, const std::string& cameraId);
     void SaveRestoreParam(sptr<HCameraRestoreParam> cameraRestoreParam);
 
     void UpdateRestoreParamCloseTime(const std::string& clientName, const std::string& cameraId);
@@ -153,6 +158,7 @@ private:
     sptr<CameraHostInfo> FindCameraHostInfo(const std::string& cameraId);
     sptr<CameraHostInfo> FindLocalCameraHostInfo();
     bool IsCameraHostInfoAdded(const std::string& svcName);
+    uint64_t AdvanceCameraGeneration();
 
     std::mutex mutex_;
     std::mutex deviceMutex_;
@@ -164,11 +170,13 @@ private:
     std::map<std::string, sptr<ICameraDeviceService>> cameraDevices_;
     std::map<std::string, std::map<std::string, sptr<HCameraRestoreParam>>> persistentParamMap_;
     std::map<std::string, sptr<HCameraRestoreParam>> transitentParamMap_;
+    BinaryCacheConverter restoreParamCache_;
     ::OHOS::sptr<HDI::ServiceManager::V1_0::IServStatListener> registerServStatListener_;
     bool muteMode_;
     bool isHasSavedParam = false;
     bool isHasPrelaunch_ = false;
     bool isHasOpenCamera_ = false;
+    std::atomic<uint64_t> cameraGeneration_;
 };
 
 class RegisterServStatListener : public HDI::ServiceManager::V1_0::ServStatListenerStub {
@@ -16,6 +16,7 @@
 #ifndef OHOS_CAMERA_RESTORE_PARAM_H
 #define OHOS_CAMERA_RESTORE_PARAM_H
 
+#include <atomic>
 #include <iostream>
 #include <refbase.h>
 #include <sys/time.h>
@@ -55,12 +56,20 @@ public:
     int GetFlodStatus();
     void SetFoldStatus(int foldStaus);
     void SetScanStatus(bool isScan);
+    // For edits made in place on the metadata returned by GetSetting.
+    void MarkSettingChanged();
 
     inline bool IsScan() const
     {
         return mIsScan;
     }
 
+    // Bumped by every setter, tells the restore param cache the record changed since it was encoded.
+    inline uint32_t GetGeneration() const
+    {
+        return mGeneration.load(std::memory_order_relaxed);
+    }
+
 private:
     std::mutex restoreParamMutex_;
     std::string mClientName;
@@ -73,6 +82,7 @@ private:
     int32_t mOpMode = 0;
     int mFoldStatus = 0;
     bool mIsScan = false;
+    std::atomic<uint32_t> mGeneration {0};
 };
 } // namespace CameraStandard
 } // namespace OHOS
@@ -140,6 +140,9 @@ public:
         vector<shared_ptr<OHOS::Camera::CameraMetadata>>& cameraAbilityList) override;
     int32_t GetCameraIds(std::vector<std::string>& cameraIds) override;
     int32_t GetPhysicalCameraIds(std::vector<std::string>& cameraIds) override;
+    int32_t GetCamerasSince(uint64_t knownGeneration, uint64_t& generation, std::vector<std::string>& cameraIds,
+        std::vector<std::string>& changedCameraIds,
+        std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>>& changedAbilityList) override;
     void FillPhysicalCameras(vector<shared_ptr<CameraMetaInfo>>& cameraInfos, vector<string>& cameraIds,
         vector<shared_ptr<OHOS::Camera::CameraMetadata>>& cameraAbilityList);
     int32_t GetPhysicalCameras(
@@ -400,6 +403,9 @@ private:
         vector<string>& cameraIds, vector<shared_ptr<OHOS::Camera::CameraMetadata>>& cameraAbilityList);
     shared_ptr<CameraMetaInfo>GetCameraMetaInfo(std::string &cameraId,
         shared_ptr<OHOS::Camera::CameraMetadata>cameraAbility);
+    shared_ptr<CameraMetaInfo> GetCatalogCameraMetaInfo(std::string& cameraId,
+        shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility);
+    void PruneCameraCatalog(const vector<string>& cameraIds);
     void OnMute(bool muteMode);
     void ExecutePidSetCallback(const sptr<ICameraServiceCallback>& callback, std::vector<std::string> &cameraIds);
 
@@ -422,6 +428,7 @@ private:
     void DumpCameraThumbnail(common_metadata_header_t* metadataEntry, CameraInfoDumper& infoDumper);
     void DumpCameraConcurrency(
         CameraInfoDumper& infoDumper, std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>>& cameraAbilityList);
+    void DumpResultDispatcher(CameraInfoDumper& infoDumper);
 
     vector<shared_ptr<CameraMetaInfo>> ChooseDeFaultCameras(vector<shared_ptr<CameraMetaInfo>> cameraInfos);
     vector<shared_ptr<CameraMetaInfo>> ChoosePhysicalCameras(const vector<shared_ptr<CameraMetaInfo>>& cameraInfos,
@@ -492,6 +499,17 @@ private:
     std::mutex flashStatusCallbacksMutex_;
     map<string, FlashStatus> flashStatusCallbacks_;
 
+    // Meta info derived from the ability of each camera, valid while the camera keeps its ability generation
+    // and the device its foldable state.
+    // A null meta info marks a camera hidden on this device.
+    struct CameraCatalogEntry {
+        uint64_t abilityGeneration = 0;
+        bool isFoldable = false;
+        shared_ptr<CameraMetaInfo> metaInfo;
+    };
+    std::mutex cameraCatalogMutex_;
+    map<string, CameraCatalogEntry> cameraCatalog_;
+
     bool muteModeStored_;
     bool isFoldable = false;
     bool isFoldableInit = false;
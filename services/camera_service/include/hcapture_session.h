@@ -44,6 +44,7 @@
 #include "moving_photo_proxy.h"
 #endif
 #include "safe_map.h"
+#include "smooth_zoom_planner.h"
 #ifdef CAMERA_USE_SENSOR
 #include "sensor_agent.h"
 #include "sensor_agent_type.h"
@@ -155,6 +156,8 @@ public:
     int32_t SetColorSpace(int32_t curColorSpace, bool isNeedUpdate) override;
     bool QueryFpsAndZoomRatio(
         float &currentFps, float &currentZoomRatio, std::vector<float> &crossZoomAndTime, int32_t operationMode);
+    bool QueryZoomStatus(sptr<HCameraDevice>& cameraDevice, float &currentFps, float &currentZoomRatio,
+        std::vector<float> &crossZoomAndTime, int32_t operationMode);
     bool QueryZoomPerformance(
         std::vector<float> &crossZoomAndTime, int32_t operationMode, const camera_metadata_item_t &zoomItem);
     int32_t GetRangeId(float& zoomRatio, std::vector<float>& crossZoom);
@@ -405,6 +408,7 @@ private:
     std::mutex cbMutex_;
     // Make sure device thread safe,set device by {SetCameraDevice}, get device by {GetCameraDevice}
     std::mutex cameraDeviceLock_;
+    SmoothZoomPlanner smoothZoomPlanner_;
     std::mutex streamOperatorLock_;
     sptr<HCameraDevice> cameraDevice_;
 #ifdef CAMERA_USE_SENSOR
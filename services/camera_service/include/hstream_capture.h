@@ -184,6 +184,7 @@ public:
     int32_t SetEditData(const std::string& editData) override;
     int32_t SetShotParam(int32_t captureId, const std::string& shotParam) override;
     int32_t EnableOriginalImage(bool enabled) override;
+    int32_t ReleasePhotoBuffer(int32_t sequence) override;
     bool IsOriginalImageEnable();
     void FillingPictureExtendLhdrGainmapStreamInfos(StreamInfo_V1_5 &streamInfo);
     inline void SetIsNeedLhdrGainmap(bool isNeedLhdrGainmap)
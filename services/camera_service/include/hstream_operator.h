@@ -22,11 +22,13 @@
 #include <functional>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <refbase.h>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include "sp_holder.h"
 #include "camera_util.h"
 #include "hcamera_device.h"
@@ -79,6 +81,12 @@ class MovingPhotoVideoCacheIntf;
 
 bool IsHdr(ColorSpace colorSpace);
 
+/**
+ * Streams of an operator. Changes are published as an immutable snapshot holding the streams ordered
+ * by framework id and indexed by framework and HDI id, so the HDI callback threads look streams up
+ * without taking the lock of the configuration path. The ids of a stream may change after it is added,
+ * an index hit is checked against the current id and a miss falls back to a scan of the snapshot.
+ */
 class StreamContainer {
 public:
     StreamContainer() {};
@@ -90,13 +98,26 @@ public:
     sptr<HStreamCommon> GetHdiStream(int32_t streamId);
     void Clear();
     size_t Size();
+    // Rebuilds the snapshot once the ids of the streams have been assigned.
+    void Reindex();
 
     std::list<sptr<HStreamCommon>> GetStreams(const StreamType streamType);
     std::list<sptr<HStreamCommon>> GetAllStreams();
 
 private:
-    std::mutex streamsLock_;
+    struct Snapshot {
+        std::map<StreamType, std::vector<sptr<HStreamCommon>>> typedStreams;
+        std::vector<sptr<HStreamCommon>> allStreams;
+        std::unordered_map<int32_t, sptr<HStreamCommon>> fwkIndex;
+        std::unordered_map<int32_t, sptr<HStreamCommon>> hdiIndex;
+    };
+
+    void PublishUnlocked();
+    std::shared_ptr<const Snapshot> GetSnapshot() const;
+
+    std::mutex streamsLock_; // Serializes the changes, readers use the snapshot.
     std::map<const StreamType, std::list<sptr<HStreamCommon>>> streams_;
+    std::shared_ptr<const Snapshot> snapshot_ = std::make_shared<const Snapshot>();
 };
 
 class CameraInfoDumper;
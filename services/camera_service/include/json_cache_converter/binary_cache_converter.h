@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BINARY_CACHE_CONVERTER_H
+#define BINARY_CACHE_CONVERTER_H
+
+#include "hcamera_restore_param.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace OHOS {
+namespace CameraStandard {
+
+namespace {
+    const std::string SAVE_RESTORE_BINARY_FILE_PATH = "/data/service/el1/public/camera_service/SaveRestore.bin";
+}
+
+/**
+ * Fixed layout binary form of the prelaunch restore parameters, mapped read only at boot instead of
+ * parsing SaveRestore.json. Each record keeps its encoded bytes with the parameter and the generation they
+ * were encoded from, so a save only encodes the records changed since and swaps the file in by rename.
+ * Not thread safe, HCameraHostManager calls it under saveRestoreMutex_.
+ */
+class BinaryCacheConverter {
+public:
+    using PersistentParamMap = std::map<std::string, std::map<std::string, sptr<HCameraRestoreParam>>>;
+    using TransientParamMap = std::map<std::string, sptr<HCameraRestoreParam>>;
+
+    BinaryCacheConverter() = default;
+    virtual ~BinaryCacheConverter() = default;
+
+    // Reads the binary cache, or migrates jsonFilePath into it once when there is no valid binary cache.
+    bool LoadOrMigrate(const std::string& binaryFilePath, const std::string& jsonFilePath,
+                       PersistentParamMap& pMap, TransientParamMap& tMap,
+                       std::string& clientName, std::string& cameraId);
+    bool ParseBinaryFileToMap(const std::string& binaryFilePath, PersistentParamMap& pMap,
+                              TransientParamMap& tMap, std::string& clientName, std::string& cameraId);
+    bool SaveMapToBinaryFile(const std::string& binaryFilePath, const PersistentParamMap& pMap,
+                             const TransientParamMap& tMap, const std::string& clientName,
+                             const std::string& cameraId);
+    void Clear();
+
+private:
+    enum class RecordType : uint8_t {
+        PERSISTENT = 1,
+        TRANSIENT,
+    };
+
+    // Map kind, outer key and inner key, the inner key of a transient record is empty.
+    using RecordKey = std::tuple<RecordType, std::string, std::string>;
+
+    struct CachedRecord {
+        sptr<HCameraRestoreParam> param;
+        uint32_t generation;
+        std::vector<uint8_t> bytes;
+    };
+
+    bool ParseBinary(const uint8_t* data, size_t size, PersistentParamMap& pMap, TransientParamMap& tMap,
+                     std::string& clientName, std::string& cameraId);
+    static bool ParseRecord(const uint8_t* data, size_t size, RecordKey& key, sptr<HCameraRestoreParam>& param);
+    static bool ParseStreamInfos(const uint8_t* data, size_t size, size_t& pos, uint32_t streamCount,
+                                 std::vector<StreamInfo_V1_1>& streamInfos);
+    static void EncodeRecord(const RecordKey& key, const sptr<HCameraRestoreParam>& param,
+                             std::vector<uint8_t>& bytes);
+    void AppendRecord(const RecordKey& key, const sptr<HCameraRestoreParam>& param,
+                      std::map<RecordKey, CachedRecord>& records, std::vector<uint8_t>& content, bool& isDirty);
+    static bool WriteFileAtomically(const std::string& filePath, const std::vector<uint8_t>& content);
+
+    std::map<RecordKey, CachedRecord> records_;
+    std::string savedClientName_;
+    std::string savedCameraId_;
+    bool isFileSynced_ = false;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // BINARY_CACHE_CONVERTER_H
@@ -64,6 +64,8 @@ public:
                                   const std::map<std::string, sptr<HCameraRestoreParam>>& tMap,
                                   const std::string& clientName, const std::string& cameraId);
 private:
+    friend class BinaryCacheConverter;
+
     static bool ParseJsonToPMap(const nlohmann::json& rootJson,
                                 std::map<std::string, std::map<std::string, sptr<HCameraRestoreParam>>>& pMap_);
     static bool ParseJsonToTMap(const nlohmann::json& rootJson,
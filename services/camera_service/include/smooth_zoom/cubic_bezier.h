@@ -22,7 +22,7 @@ namespace OHOS {
 namespace CameraStandard {
 class CubicBezier : public IZoomAlgorithm {
 public:
-    CubicBezier() = default;
+    CubicBezier();
     ~CubicBezier() = default;
 
     bool SetBezierValue(const std::vector<float>& zoomBezierValue) override;
@@ -30,21 +30,27 @@ public:
         const float& frameInterval) override;
 
 private:
-    static float GetDuration(const float& currentZoom, const float& targetZoom);
+    float GetDuration(const float& currentZoom, const float& targetZoom) const;
 
-    static float GetCubicBezierY(const float& time);
+    float GetCubicBezierY(const float& time) const;
 
-    static float GetCubicBezierX(const float& time);
+    float GetCubicBezierX(const float& time) const;
 
-    static float BinarySearch(const float& value);
+    float BinarySearch(const float& value);
 
-    static float GetInterpolation(const float& input);
+    float GetInterpolation(const float& input);
 
-    static float mControPointX1;
-    static float mControPointX2;
-    static float mControPointY1;
-    static float mControPointY2;
-    static float mDurationBase;
+    void BuildCubicBezierXTable();
+
+    // Control points are per instance so that concurrent sessions with different HAL curves do not clobber
+    // each other.
+    float mControPointX1;
+    float mControPointX2;
+    float mControPointY1;
+    float mControPointY2;
+    float mDurationBase;
+    // X of the curve sampled on the search grid, rebuilt whenever the control points change.
+    std::vector<float> mCubicBezierXTable;
 };
 } // namespace CameraStandard
 } // namespace OHOS
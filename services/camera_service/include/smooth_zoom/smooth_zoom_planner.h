@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_SMOOTH_ZOOM_PLANNER_H
+#define OHOS_CAMERA_SMOOTH_ZOOM_PLANNER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "smooth_zoom.h"
+
+namespace OHOS {
+namespace CameraStandard {
+/**
+ * Per session state of the smooth zoom. The fps and crossover table queried from the HAL are kept until the
+ * device reports that they may have changed, and the zoom curve is only rebuilt when its control points change,
+ * so that a zoom gesture does not have to query the HAL or resample the curve on every step.
+ */
+class SmoothZoomPlanner {
+public:
+    SmoothZoomPlanner() = default;
+    ~SmoothZoomPlanner() = default;
+
+    bool GetZoomStatus(const void* device, uint64_t generation, int32_t operationMode, float& fps,
+        std::vector<float>& crossZoomAndTime);
+    void SetZoomStatus(const void* device, uint64_t generation, int32_t operationMode, float fps,
+        const std::vector<float>& crossZoomAndTime);
+    void Invalidate();
+
+    // The bezier control points of a device ability, read once per ability object.
+    bool GetZoomBezierValue(const std::shared_ptr<const void>& ability, bool& isFound,
+        std::vector<float>& zoomBezierValue);
+    void SetZoomBezierValue(const std::shared_ptr<const void>& ability, bool isFound,
+        const std::vector<float>& zoomBezierValue);
+
+    // An empty zoomBezierValue selects the default curve of the algorithm.
+    std::vector<float> GetZoomArray(SmoothZoomType type, const std::vector<float>& zoomBezierValue,
+        float currentZoom, float targetZoom, float frameInterval);
+
+private:
+    std::mutex statusMutex_;
+    bool isStatusValid_ = false;
+    const void* statusDevice_ = nullptr;
+    uint64_t statusGeneration_ = 0;
+    int32_t statusOperationMode_ = 0;
+    uint64_t statusTime_ = 0;
+    float fps_ = 0.0f;
+    std::vector<float> crossZoomAndTime_;
+    std::weak_ptr<const void> bezierAbility_;
+    bool isBezierFound_ = false;
+    std::vector<float> abilityBezierValue_;
+
+    std::mutex algorithmMutex_;
+    std::shared_ptr<IZoomAlgorithm> zoomAlgorithm_;
+    SmoothZoomType zoomType_ = SmoothZoomType::NORMAL;
+    std::vector<float> zoomBezierValue_;
+};
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_SMOOTH_ZOOM_PLANNER_H
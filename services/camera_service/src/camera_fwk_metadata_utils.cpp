@@ -15,10 +15,14 @@
 
 #include "camera_fwk_metadata_utils.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "camera_log.h"
+#include "camera_metadata.h"
 #include "camera_metadata_operator.h"
 #include "camera_util.h"
 
@@ -61,47 +65,143 @@ bool CheckSysMeta(uint32_t item)
     return sysTags.find(item) != sysTags.end();
 }
 
-bool MergeMetadata(const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata,
-    std::shared_ptr<OHOS::Camera::CameraMetadata> dstMetadata)
+namespace {
+struct TagIndex {
+    uint32_t tag;
+    uint32_t index;
+};
+
+// Item indexes of the header ordered by tag. For a tag present more than once the last item wins, as it
+// would have when the items were applied one by one.
+std::vector<TagIndex> SortByTag(const common_metadata_header_t* header, bool isSystemCaller)
+{
+    std::vector<TagIndex> tags;
+    tags.reserve(header->item_count);
+    camera_metadata_item_t item;
+    for (uint32_t index = 0; index < header->item_count; index++) {
+        CHECK_CONTINUE_ELOG(OHOS::Camera::GetCameraMetadataItem(header, index, &item) != CAM_META_SUCCESS,
+            "Failed to get metadata item at index: %{public}u", index);
+        CHECK_CONTINUE(!isSystemCaller && CheckSysMeta(item.item));
+        tags.push_back({ item.item, index });
+    }
+    std::stable_sort(tags.begin(), tags.end(), [](const TagIndex& a, const TagIndex& b) { return a.tag < b.tag; });
+    auto last = std::unique(tags.rbegin(), tags.rend(),
+        [](const TagIndex& a, const TagIndex& b) { return a.tag == b.tag; });
+    tags.erase(tags.begin(), last.base());
+    return tags;
+}
+
+// Grows the destination once for everything the merge adds, instead of letting addEntry reallocate per item.
+void ReserveMetadata(std::shared_ptr<OHOS::Camera::CameraMetadata>& metadata, uint32_t addItemCount,
+    uint32_t maxAddDataCount)
+{
+    common_metadata_header_t* header = metadata->get();
+    uint32_t itemCapacity = header->item_count + addItemCount;
+    uint32_t dataCapacity = header->data_count + maxAddDataCount;
+    CHECK_RETURN(itemCapacity <= header->item_capacity && dataCapacity <= header->data_capacity);
+    auto grown = std::make_shared<OHOS::Camera::CameraMetadata>(
+        std::max(itemCapacity, header->item_capacity), std::max(dataCapacity, header->data_capacity));
+    CHECK_RETURN_ELOG(grown->get() == nullptr, "ReserveMetadata alloc failed");
+    int32_t ret = OHOS::Camera::CopyCameraMetadataItems(grown->get(), header);
+    CHECK_RETURN_ELOG(ret != CAM_META_SUCCESS, "ReserveMetadata copy failed ret:%{public}d", ret);
+    metadata = grown;
+}
+
+bool UpdateItemByIndex(std::shared_ptr<OHOS::Camera::CameraMetadata>& dstMetadata, uint32_t index,
+    const camera_metadata_item_t& srcItem)
+{
+    int32_t ret = OHOS::Camera::CameraMetadata::UpdateCameraMetadataItemByIndex(
+        dstMetadata->get(), index, srcItem.data.u8, srcItem.count, nullptr);
+    // updateEntry finds the item again but can resize the buffer when the new value does not fit.
+    return ret == CAM_META_SUCCESS || dstMetadata->updateEntry(srcItem.item, srcItem.data.u8, srcItem.count);
+}
+
+bool AddItem(std::shared_ptr<OHOS::Camera::CameraMetadata>& dstMetadata, const camera_metadata_item_t& srcItem)
+{
+    int32_t ret = OHOS::Camera::CameraMetadata::AddCameraMetadataItem(
+        dstMetadata->get(), srcItem.item, srcItem.data.u8, srcItem.count);
+    return ret == CAM_META_SUCCESS || dstMetadata->addEntry(srcItem.item, srcItem.data.u8, srcItem.count);
+}
+
+/*
+ * Both headers are walked once in tag order: source tags found in the destination are updated at the
+ * destination index, the others are appended after the destination has been sized for all of them.
+ */
+bool MergeMetadataItems(const std::shared_ptr<OHOS::Camera::CameraMetadata>& srcMetadata,
+    std::shared_ptr<OHOS::Camera::CameraMetadata>& dstMetadata, bool isSystemCaller, bool canReallocate)
 {
-    bool isSysCall = CheckSystemApp();
     CHECK_RETURN_RET(srcMetadata == nullptr || dstMetadata == nullptr, false);
     auto srcHeader = srcMetadata->get();
     CHECK_RETURN_RET(srcHeader == nullptr, false);
     auto dstHeader = dstMetadata->get();
     CHECK_RETURN_RET(dstHeader == nullptr, false);
-    auto srcItemCount = srcHeader->item_count;
-    camera_metadata_item_t srcItem;
-    for (uint32_t index = 0; index < srcItemCount; index++) {
-        int ret = OHOS::Camera::GetCameraMetadataItem(srcHeader, index, &srcItem);
-        CHECK_RETURN_RET_ELOG(
-            ret != CAM_META_SUCCESS, false, "Failed to get metadata item at index: %{public}d", index);
-        bool status = false;
-        uint32_t currentIndex;
-        MEDIA_DEBUG_LOG("MergeMetadata src item:%{public}d", srcItem.item);
-        if (!isSysCall) {
-            CHECK_EXECUTE(CheckSysMeta(srcItem.item), continue);
+    std::vector<TagIndex> srcTags = SortByTag(srcHeader, isSystemCaller);
+    std::vector<TagIndex> dstTags = SortByTag(dstHeader, true);
+    std::vector<std::pair<uint32_t, uint32_t>> updates;
+    std::vector<uint32_t> adds;
+    auto dstIt = dstTags.begin();
+    for (const auto& srcTag : srcTags) {
+        while (dstIt != dstTags.end() && dstIt->tag < srcTag.tag) {
+            ++dstIt;
         }
-        MEDIA_DEBUG_LOG("MergeMetadata update item:%{public}d", srcItem.item);
-        ret = OHOS::Camera::FindCameraMetadataItemIndex(dstMetadata->get(), srcItem.item, &currentIndex);
-        if (ret == CAM_META_ITEM_NOT_FOUND) {
-            status = dstMetadata->addEntry(srcItem.item, srcItem.data.u8, srcItem.count);
-        } else if (ret == CAM_META_SUCCESS) {
-            status = dstMetadata->updateEntry(srcItem.item, srcItem.data.u8, srcItem.count);
+        if (dstIt != dstTags.end() && dstIt->tag == srcTag.tag) {
+            updates.emplace_back(dstIt->index, srcTag.index);
+        } else {
+            adds.push_back(srcTag.index);
         }
-        CHECK_RETURN_RET_ELOG(!status, false, "Failed to update metadata item: %{public}d", srcItem.item);
+    }
+    CHECK_EXECUTE(canReallocate && !adds.empty(),
+        ReserveMetadata(dstMetadata, static_cast<uint32_t>(adds.size()), srcHeader->data_count));
+
+    camera_metadata_item_t srcItem;
+    for (const auto& [dstIndex, srcIndex] : updates) {
+        CHECK_RETURN_RET_ELOG(OHOS::Camera::GetCameraMetadataItem(srcHeader, srcIndex, &srcItem) != CAM_META_SUCCESS,
+            false, "Failed to get metadata item at index: %{public}u", srcIndex);
+        MEDIA_DEBUG_LOG("MergeMetadata update item:%{public}d", srcItem.item);
+        CHECK_RETURN_RET_ELOG(!UpdateItemByIndex(dstMetadata, dstIndex, srcItem), false,
+            "Failed to update metadata item: %{public}d", srcItem.item);
+    }
+    for (uint32_t srcIndex : adds) {
+        CHECK_RETURN_RET_ELOG(OHOS::Camera::GetCameraMetadataItem(srcHeader, srcIndex, &srcItem) != CAM_META_SUCCESS,
+            false, "Failed to get metadata item at index: %{public}u", srcIndex);
+        MEDIA_DEBUG_LOG("MergeMetadata add item:%{public}d", srcItem.item);
+        CHECK_RETURN_RET_ELOG(!AddItem(dstMetadata, srcItem), false,
+            "Failed to update metadata item: %{public}d", srcItem.item);
     }
     return true;
 }
+} // namespace
+
+bool MergeMetadata(const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata,
+    std::shared_ptr<OHOS::Camera::CameraMetadata> dstMetadata)
+{
+    // dstMetadata is a copy of the caller's pointer, the items are merged into the caller's buffer as it is.
+    return MergeMetadataItems(srcMetadata, dstMetadata, CheckSystemApp(), false);
+}
+
+bool MergeMetadata(const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata,
+    std::shared_ptr<OHOS::Camera::CameraMetadata>& dstMetadata, bool isSystemCaller)
+{
+    return MergeMetadataItems(srcMetadata, dstMetadata, isSystemCaller, true);
+}
 
 std::shared_ptr<OHOS::Camera::CameraMetadata> CopyMetadata(
     const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata)
 {
+    return CopyMetadata(srcMetadata, CheckSystemApp());
+}
+
+std::shared_ptr<OHOS::Camera::CameraMetadata> CopyMetadata(
+    const std::shared_ptr<OHOS::Camera::CameraMetadata> srcMetadata, bool isSystemCaller)
+{
+    // Only a system caller may see every tag, the others get the copy without the system tags.
+    CHECK_RETURN_RET(isSystemCaller, OHOS::CameraStandard::CopyMetadata(srcMetadata));
     CHECK_RETURN_RET_ELOG(srcMetadata == nullptr, nullptr, "CopyMetadata fail, src is null");
     auto metadataHeader = srcMetadata->get();
+    CHECK_RETURN_RET(metadataHeader == nullptr, nullptr);
     auto newMetadata =
         std::make_shared<OHOS::Camera::CameraMetadata>(metadataHeader->item_capacity, metadataHeader->data_capacity);
-    MergeMetadata(srcMetadata, newMetadata);
+    MergeMetadataItems(srcMetadata, newMetadata, false, false);
     return newMetadata;
 }
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "camera_result_dispatcher.h"
+
+#include <chrono>
+#include <mutex>
+#include <sstream>
+
+#include "camera_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr int64_t NANOS_PER_MICRO = 1000;
+} // namespace
+
+const camera_metadata_item_t* CameraResultItems::Find(uint32_t tag) const
+{
+    for (size_t index = 0; index < count_; index++) {
+        CHECK_RETURN_RET(items_[index].item == tag, &items_[index]);
+    }
+    return nullptr;
+}
+
+bool CameraResultDispatcher::Subscribe(std::initializer_list<uint32_t> tags, Handler handler)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    CHECK_RETURN_RET_ELOG(handler == nullptr || subscribers_.size() >= MAX_RESULT_SUBSCRIBERS, false,
+        "CameraResultDispatcher::Subscribe invalid handler or too many subscribers");
+    uint32_t subscriberBit = 1u << subscribers_.size();
+    for (uint32_t tag : tags) {
+        auto it = tagIndex_.find(tag);
+        if (it == tagIndex_.end()) {
+            CHECK_RETURN_RET_ELOG(tagCount_ >= MAX_RESULT_SUBSCRIBED_TAGS, false,
+                "CameraResultDispatcher::Subscribe too many tags, tag: %{public}u", tag);
+            tags_[tagCount_].tag = tag;
+            it = tagIndex_.emplace(tag, tagCount_++).first;
+        }
+        tags_[it->second].subscriberMask |= subscriberBit;
+    }
+    subscribers_.push_back(std::move(handler));
+    return true;
+}
+
+void CameraResultDispatcher::Dispatch(const common_metadata_header_t* header, uint64_t timestamp)
+{
+    CHECK_RETURN(header == nullptr);
+    auto begin = std::chrono::steady_clock::now();
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    CameraResultItems items;
+    uint32_t pendingMask = 0;
+    camera_metadata_item_t item;
+    for (uint32_t index = 0; index < header->item_count && items.count_ < MAX_RESULT_SUBSCRIBED_TAGS; index++) {
+        CHECK_CONTINUE(OHOS::Camera::GetCameraMetadataItem(header, index, &item) != CAM_META_SUCCESS);
+        auto it = tagIndex_.find(item.item);
+        CHECK_CONTINUE(it == tagIndex_.end() || item.count == 0);
+        TagEntry& entry = tags_[it->second];
+        entry.hitCount.fetch_add(1, std::memory_order_relaxed);
+        pendingMask |= entry.subscriberMask;
+        items.items_[items.count_++] = item;
+    }
+    for (size_t index = 0; index < subscribers_.size() && pendingMask != 0; index++) {
+        uint32_t subscriberBit = 1u << index;
+        CHECK_CONTINUE((pendingMask & subscriberBit) == 0);
+        pendingMask &= ~subscriberBit;
+        subscribers_[index](items, timestamp);
+    }
+    RecordFrame(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count());
+}
+
+void CameraResultDispatcher::RecordFrame(int64_t costNs)
+{
+    frameCount_.fetch_add(1, std::memory_order_relaxed);
+    totalCostNs_.fetch_add(static_cast<uint64_t>(costNs), std::memory_order_relaxed);
+    lastCostNs_.store(costNs, std::memory_order_relaxed);
+    int64_t maxCostNs = maxCostNs_.load(std::memory_order_relaxed);
+    while (costNs > maxCostNs && !maxCostNs_.compare_exchange_weak(maxCostNs, costNs, std::memory_order_relaxed)) {
+    }
+}
+
+std::string CameraResultDispatcher::Dump()
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    uint64_t frameCount = frameCount_.load(std::memory_order_relaxed);
+    uint64_t averageNs = frameCount == 0 ? 0 : totalCostNs_.load(std::memory_order_relaxed) / frameCount;
+    std::ostringstream oss;
+    oss << "ResultDispatcher frames:" << frameCount << " subscribers:" << subscribers_.size()
+        << " cost(us) last:" << lastCostNs_.load(std::memory_order_relaxed) / NANOS_PER_MICRO
+        << " avg:" << static_cast<int64_t>(averageNs) / NANOS_PER_MICRO
+        << " max:" << maxCostNs_.load(std::memory_order_relaxed) / NANOS_PER_MICRO;
+    for (size_t index = 0; index < tagCount_; index++) {
+        const char* tagName = OHOS::Camera::GetCameraMetadataItemName(tags_[index].tag);
+        oss << "\n  " << (tagName == nullptr ? "unknown" : tagName) << "(" << tags_[index].tag << ")"
+            << " hits:" << tags_[index].hitCount.load(std::memory_order_relaxed);
+    }
+    return oss.str();
+}
+} // namespace CameraStandard
+} // namespace OHOS
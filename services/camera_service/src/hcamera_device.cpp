@@ -15,6 +15,7 @@
 
 #include "hcamera_device.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -30,6 +31,7 @@
 #include "camera_error_code.h"
 #include "camera_log.h"
 #include "camera_fwk_metadata_utils.h"
+#include "camera_surface_buffer_pool.h"
 #include "camera_metadata_info.h"
 #include "camera_metadata_operator.h"
 #include "camera_util.h"
@@ -239,6 +241,59 @@ HCameraDevice::HCameraDevice(
         std::lock_guard<std::mutex> lock(originCameraIdLock_);
         originCameraId_ = cameraID;
     }
+    AdvanceZoomStatusGeneration();
+    RegisterResultSubscribers();
+}
+
+void HCameraDevice::RegisterResultSubscribers()
+{
+    resultDispatcher_.Subscribe({ OHOS_ABILITY_SPECTRUM_INFOS },
+        [this](const CameraResultItems& items, uint64_t timestamp) {
+            HandleSpectrumInfo(*items.Find(OHOS_ABILITY_SPECTRUM_INFOS), timestamp);
+        });
+    resultDispatcher_.Subscribe({ OHOS_DEVICE_PROTECTION_STATE },
+        [this](const CameraResultItems& items, uint64_t) {
+            HandleDeviceProtectionStatus(*items.Find(OHOS_DEVICE_PROTECTION_STATE));
+        });
+#ifdef CAMERA_MOVING_PHOTO
+    resultDispatcher_.Subscribe({ OHOS_MOVING_PHOTO_START, OHOS_MOVING_PHOTO_END },
+        [this](const CameraResultItems& items, uint64_t) {
+            CHECK_RETURN(!isMovingPhotoEnabled_);
+            for (uint32_t tag : { OHOS_MOVING_PHOTO_START, OHOS_MOVING_PHOTO_END }) {
+                const camera_metadata_item_t* item = items.Find(tag);
+                CHECK_EXECUTE(item != nullptr, HandleMovingPhotoTime(*item));
+            }
+        });
+#endif
+    resultDispatcher_.Subscribe({ OHOS_CONTROL_ZOOM_RATIO },
+        [this](const CameraResultItems& items, uint64_t) {
+            HandleZoomRatio(*items.Find(OHOS_CONTROL_ZOOM_RATIO));
+        });
+    resultDispatcher_.Subscribe({ OHOS_STATUS_CAMERA_CURRENT_FPS, OHOS_STATUS_CAMERA_ZOOM_PERFORMANCE },
+        [this](const CameraResultItems& items, uint64_t) {
+            // The HAL may repeat both tags on every frame, only a changed value invalidates the zoom status.
+            bool isChanged = false;
+            for (uint32_t tag : { OHOS_STATUS_CAMERA_CURRENT_FPS, OHOS_STATUS_CAMERA_ZOOM_PERFORMANCE }) {
+                const camera_metadata_item_t* item = items.Find(tag);
+                CHECK_EXECUTE(item != nullptr && UpdateZoomStatusValue(tag, *item), isChanged = true);
+            }
+            CHECK_EXECUTE(isChanged, AdvanceZoomStatusGeneration());
+        });
+#ifdef CAMERA_FRAMEWORK_FEATURE_MEDIA_STREAM
+    resultDispatcher_.Subscribe({ OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP, OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE },
+        [this](const CameraResultItems& items, uint64_t) {
+            CHECK_RETURN(!isKeyFrameReportEnabled_.load());
+            const camera_metadata_item_t* timestampItem = items.Find(OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP);
+            const camera_metadata_item_t* typeItem = items.Find(OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE);
+            CHECK_RETURN_DLOG(timestampItem == nullptr || typeItem == nullptr, "KeyFrameInfo is incomplete");
+            HandleKeyFrameInfo(*timestampItem, *typeItem);
+        });
+#endif
+}
+
+std::string HCameraDevice::DumpResultDispatcher()
+{
+    return "Camera:" + cameraID_ + " " + resultDispatcher_.Dump();
 }
 
 HCameraDevice::~HCameraDevice()
@@ -348,6 +403,37 @@ float HCameraDevice::GetZoomRatio()
     return zoomRatio_;
 }
 
+bool HCameraDevice::GetReportedZoomRatio(float& zoomRatio, uint64_t maxAgeMs)
+{
+    uint64_t reportTime = zoomRatioReportTime_.load();
+    CHECK_RETURN_RET(reportTime == 0 ||
+        DeferredProcessing::SteadyClock::GetTimestampMilli() - reportTime > maxAgeMs, false);
+    zoomRatio = reportedZoomRatio_.load();
+    return true;
+}
+
+uint64_t HCameraDevice::GetZoomStatusGeneration()
+{
+    return zoomStatusGeneration_.load();
+}
+
+bool HCameraDevice::UpdateZoomStatusValue(uint32_t tag, const camera_metadata_item_t& item)
+{
+    std::lock_guard<std::mutex> lock(zoomStatusValueMutex_);
+    std::vector<uint32_t>& lastValue = zoomStatusValues_[tag];
+    bool isSame = lastValue.size() == item.count && std::equal(lastValue.begin(), lastValue.end(), item.data.ui32);
+    CHECK_RETURN_RET(isSame, false);
+    lastValue.assign(item.data.ui32, item.data.ui32 + item.count);
+    return true;
+}
+
+void HCameraDevice::AdvanceZoomStatusGeneration()
+{
+    // Drawn from one process wide counter so that a generation never matches a status read from another device.
+    static std::atomic<uint64_t> zoomStatusGenerationSeed = 0;
+    zoomStatusGeneration_.store(++zoomStatusGenerationSeed);
+}
+
 int32_t HCameraDevice::GetFocusMode()
 {
     return focusMode_;
@@ -748,6 +834,11 @@ void HCameraDevice::ReportDeviceProtectionStatus(const std::shared_ptr<OHOS::Cam
     camera_metadata_item_t item;
     int ret = OHOS::Camera::FindCameraMetadataItem(metadata->get(), OHOS_DEVICE_PROTECTION_STATE, &item);
     CHECK_RETURN(ret != CAM_META_SUCCESS || item.count == 0);
+    HandleDeviceProtectionStatus(item);
+}
+
+void HCameraDevice::HandleDeviceProtectionStatus(const camera_metadata_item_t& item)
+{
     int32_t status = item.data.i32[0];
     MEDIA_INFO_LOG("HCameraDevice::ReportDeviceProtectionStatus status: %{public}d", status);
     CHECK_RETURN(!CanReportDeviceProtectionStatus(status));
@@ -936,6 +1027,12 @@ int32_t HCameraDevice::CloseDevice()
 {
     MEDIA_INFO_LOG("HCameraDevice::CloseDevice start");
     CAMERA_SYNC_TRACE;
+    AdvanceZoomStatusGeneration();
+    {
+        std::lock_guard<std::mutex> lock(zoomStatusValueMutex_);
+        zoomStatusValues_.clear();
+    }
+    zoomRatioReportTime_.store(0);
     ReleaseSessionBeforeCloseDevice();
     bool isFoldable = OHOS::Rosen::DisplayManagerLite::GetInstance().IsFoldable();
     CHECK_EXECUTE(isFoldable, UnregisterFoldStatusListener());
@@ -962,7 +1059,7 @@ int32_t HCameraDevice::CloseDevice()
     if (cameraHostManager_) {
         cameraHostManager_->RemoveCameraDevice(cameraID_, GetCameraIdTransform(), isIspDead_);
         cameraHostManager_->UpdateRestoreParamCloseTime(GetClientName(), cameraID_);
-        cameraHostManager_->SaveMapToJsonFile(SAVE_RESTORE_FILE_PATH, GetClientName(),  cameraID_);
+        cameraHostManager_->SaveRestoreParamCache(GetClientName(), cameraID_);
     }
     SetDeviceServiceCallback(nullptr);
     uint64_t currentTime = DeferredProcessing::SteadyClock::GetTimestampMilli();
@@ -970,6 +1067,8 @@ int32_t HCameraDevice::CloseDevice()
         POWERMGR_SYSEVENT_CAMERA_DISCONNECT(cameraID_.c_str(), currentTime - openCamTime_));
     MEDIA_DEBUG_LOG("HCameraDevice::CloseDevice end");
     NotifyCameraStatus(CAMERA_CLOSE);
+    // photo copies still held by the pipeline are released by their last owner
+    CameraSurfaceBufferPool::GetInstance().TrimAll();
 #ifdef MEMMGR_OVERRID
     RequireMemory(Memory::CAMERA_END);
 #endif
@@ -1112,6 +1211,14 @@ void HCameraDevice::CheckVideoStabilizationChange(const std::shared_ptr<OHOS::Ca
     videoStabilizationMode_ = videoStabilizationMode;
 }
 
+void HCameraDevice::CheckZoomStatusChange(const std::shared_ptr<OHOS::Camera::CameraMetadata>& settings)
+{
+    // A new frame rate range changes the fps the smooth zoom plans against.
+    camera_metadata_item_t item;
+    int32_t ret = OHOS::Camera::FindCameraMetadataItem(settings->get(), OHOS_CONTROL_FPS_RANGES, &item);
+    CHECK_EXECUTE(ret == CAM_META_SUCCESS, AdvanceZoomStatusGeneration());
+}
+
 #ifdef CAMERA_MOVING_PHOTO
 bool HCameraDevice::CheckMovingPhotoSupported(int32_t mode)
 {
@@ -1144,27 +1251,28 @@ void HCameraDevice::EnableMovingPhoto(bool isMovingPhotoEnabled)
 void HCameraDevice::GetMovingPhotoStartAndEndTime(std::shared_ptr<OHOS::Camera::CameraMetadata> cameraResult)
 {
     MEDIA_DEBUG_LOG("HCameraDevice::GetMovingPhotoStartAndEndTime enter.");
-    {
-        std::lock_guard<std::mutex> lock(movingPhotoStartTimeCallbackLock_);
-        if (movingPhotoStartTimeCallback_) {
-            camera_metadata_item_t item;
-            int ret = OHOS::Camera::FindCameraMetadataItem(cameraResult->get(), OHOS_MOVING_PHOTO_START, &item);
-            if (ret == CAM_META_SUCCESS && item.count != 0) {
-                int64_t captureId = item.data.i64[0];
-                int64_t startTime = item.data.i64[1];
-                movingPhotoStartTimeCallback_(static_cast<int32_t>(captureId), startTime);
-            }
-        }
-    }
-    std::lock_guard<std::mutex> lock(movingPhotoEndTimeCallbackLock_);
-    CHECK_RETURN(!movingPhotoEndTimeCallback_);
+    CHECK_RETURN(cameraResult == nullptr);
     camera_metadata_item_t item;
-    int ret = OHOS::Camera::FindCameraMetadataItem(cameraResult->get(), OHOS_MOVING_PHOTO_END, &item);
-    bool canMovingPhoto = ret == CAM_META_SUCCESS && item.count != 0;
-    if (canMovingPhoto) {
-        int64_t captureId = item.data.i64[0];
-        int64_t endTime = item.data.i64[1];
-        movingPhotoEndTimeCallback_(static_cast<int32_t>(captureId), endTime);
+    for (uint32_t tag : { OHOS_MOVING_PHOTO_START, OHOS_MOVING_PHOTO_END }) {
+        int ret = OHOS::Camera::FindCameraMetadataItem(cameraResult->get(), tag, &item);
+        CHECK_EXECUTE(ret == CAM_META_SUCCESS && item.count != 0, HandleMovingPhotoTime(item));
+    }
+}
+
+void HCameraDevice::HandleMovingPhotoTime(const camera_metadata_item_t& item)
+{
+    constexpr uint32_t movingPhotoTimeCount = 2;
+    CHECK_RETURN(item.count < movingPhotoTimeCount);
+    int64_t captureId = item.data.i64[0];
+    int64_t timestamp = item.data.i64[1];
+    if (item.item == OHOS_MOVING_PHOTO_START) {
+        std::lock_guard<std::mutex> lock(movingPhotoStartTimeCallbackLock_);
+        CHECK_EXECUTE(movingPhotoStartTimeCallback_,
+            movingPhotoStartTimeCallback_(static_cast<int32_t>(captureId), timestamp));
+    } else if (item.item == OHOS_MOVING_PHOTO_END) {
+        std::lock_guard<std::mutex> lock(movingPhotoEndTimeCallbackLock_);
+        CHECK_EXECUTE(movingPhotoEndTimeCallback_,
+            movingPhotoEndTimeCallback_(static_cast<int32_t>(captureId), timestamp));
     }
 }
 
@@ -1438,11 +1546,14 @@ int32_t HCameraDevice::UpdateSetting(const std::shared_ptr<OHOS::Camera::CameraM
     CheckZoomChange(settings);
     CheckFocusChange(settings);
     CheckVideoStabilizationChange(settings);
+    CheckZoomStatusChange(settings);
 
     uint32_t count = OHOS::Camera::GetCameraMetadataItemCount(settings->get());
     CHECK_RETURN_RET_ELOG(!count, CAMERA_OK, "HCameraDevice::UpdateSetting Nothing to update");
     std::lock_guard<std::mutex> lock(opMutex_);
-    bool canSettings = updateSettings_ == nullptr || !CameraFwkMetadataUtils::MergeMetadata(settings, updateSettings_);
+    bool isSystemCaller = IsSystemCallerLocked();
+    bool canSettings = updateSettings_ == nullptr ||
+        !CameraFwkMetadataUtils::MergeMetadata(settings, updateSettings_, isSystemCaller);
     if (canSettings) {
         updateSettings_ = settings;
     }
@@ -1459,7 +1570,7 @@ int32_t HCameraDevice::UpdateSetting(const std::shared_ptr<OHOS::Camera::CameraM
         UpdateDeviceOpenLifeCycleSettings(updateSettings_);
         {
             std::lock_guard<std::mutex> cachedLock(cachedSettingsMutex_);
-            CameraFwkMetadataUtils::MergeMetadata(settings, cachedSettings_);
+            CameraFwkMetadataUtils::MergeMetadata(settings, cachedSettings_, isSystemCaller);
         }
         updateSettings_ = nullptr;
     }
@@ -1467,6 +1578,17 @@ int32_t HCameraDevice::UpdateSetting(const std::shared_ptr<OHOS::Camera::CameraM
     return CAMERA_OK;
 }
 
+bool HCameraDevice::IsSystemCallerLocked()
+{
+    // Settings arrive at display rate from the same client, the token lookup is only redone when the caller changes.
+    uint64_t callingTokenId = IPCSkeleton::GetCallingFullTokenID();
+    if (systemCallerTokenId_ == 0 || systemCallerTokenId_ != callingTokenId) {
+        isSystemCaller_ = CheckSystemApp();
+        systemCallerTokenId_ = callingTokenId;
+    }
+    return isSystemCaller_;
+}
+
 int32_t HCameraDevice::SetUsedAsPosition(uint8_t value)
 {
     MEDIA_INFO_LOG("HCameraDevice::SetUsedAsPosition as %{public}d", value);
@@ -1926,44 +2048,40 @@ int32_t HCameraDevice::OnResult(const uint64_t timestamp, const std::vector<uint
     if (cameraResult == nullptr) {
         cameraResult = std::make_shared<OHOS::Camera::CameraMetadata>(0, 0);
     }
-    if (IsCameraDebugOn()) {
+    bool isCameraDebugOn = IsCameraDebugOn();
+    if (isCameraDebugOn) {
         CameraFwkMetadataUtils::DumpMetadataInfo(cameraResult);
     }
     auto callback = GetDeviceServiceCallback();
     if (callback != nullptr) {
         callback->OnResult(timestamp, cameraResult);
     }
-    
-    OnSpectrumInfoChange(cameraResult, timestamp);
-
-    ReportDeviceProtectionStatus(cameraResult);
-    if (IsCameraDebugOn()) {
+    // One walk of the result feeds every internal consumer subscribed to its tags.
+    resultDispatcher_.Dispatch(cameraResult->get(), timestamp);
+    if (isCameraDebugOn) {
         CheckOnResultData(cameraResult);
     }
-#ifdef CAMERA_MOVING_PHOTO
-    if (isMovingPhotoEnabled_) {
-        GetMovingPhotoStartAndEndTime(cameraResult);
-    }
-#endif
-    ReportZoomInfos(cameraResult);
     ReportMechMetadata(cameraResult);
-#ifdef CAMERA_FRAMEWORK_FEATURE_MEDIA_STREAM
-    if (isKeyFrameReportEnabled_.load()) {
-        SaveKeyFrameInfo(cameraResult);
-    }
-#endif
     return CAMERA_OK;
 }
 
 void HCameraDevice::ReportZoomInfos(std::shared_ptr<OHOS::Camera::CameraMetadata> cameraResult)
 {
-    std::shared_lock<std::shared_mutex> lock(zoomInfoCallbackLock_);
-    CHECK_RETURN(!zoomInfoCallback_);
-    float zoomRatio = 1.0;
+    CHECK_RETURN(cameraResult == nullptr);
     camera_metadata_item_t item;
     int ret = OHOS::Camera::FindCameraMetadataItem(cameraResult->get(), OHOS_CONTROL_ZOOM_RATIO, &item);
     CHECK_RETURN(ret != CAM_META_SUCCESS || item.count == 0);
-    zoomRatio = item.data.f[0];
+    HandleZoomRatio(item);
+}
+
+void HCameraDevice::HandleZoomRatio(const camera_metadata_item_t& item)
+{
+    CHECK_RETURN(item.count == 0);
+    float zoomRatio = item.data.f[0];
+    reportedZoomRatio_.store(zoomRatio);
+    zoomRatioReportTime_.store(DeferredProcessing::SteadyClock::GetTimestampMilli());
+    std::shared_lock<std::shared_mutex> lock(zoomInfoCallbackLock_);
+    CHECK_RETURN(!zoomInfoCallback_);
     MEDIA_DEBUG_LOG("ReportZoomInfos zoomRatio: %{public}f", zoomRatio);
     if (zoomRatio != zoomRatio_) {
         ZoomInfo zoomInfo;
@@ -2107,7 +2225,7 @@ void HCameraDevice::RemoveResourceWhenHostDied()
     if (cameraHostManager_) {
         cameraHostManager_->RemoveCameraDevice(cameraID_);
         cameraHostManager_->UpdateRestoreParamCloseTime(GetClientName(), cameraID_);
-        cameraHostManager_->SaveMapToJsonFile(SAVE_RESTORE_FILE_PATH, GetClientName(),  cameraID_);
+        cameraHostManager_->SaveRestoreParamCache(GetClientName(), cameraID_);
     }
     uint64_t currentTime = DeferredProcessing::SteadyClock::GetTimestampMilli();
     CHECK_EXECUTE(currentTime > openCamTime_,
@@ -2254,15 +2372,20 @@ void HCameraDevice::SaveKeyFrameInfo(std::shared_ptr<OHOS::Camera::CameraMetadat
         MEDIA_DEBUG_LOG("OHOS_CINEMA_VIDEO_KEY_FRAME_TIMESTAMP FindCameraMetadataItem failed, ret: %{public}d", ret);
         return;
     }
-    int64_t keyFrameTimestamp = item.data.i64[0];
-
-    ret = OHOS::Camera::FindCameraMetadataItem(cameraResult->get(), OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE, &item);
-    if (ret != CAM_META_SUCCESS || item.count == 0) {
+    camera_metadata_item_t typeItem;
+    ret = OHOS::Camera::FindCameraMetadataItem(cameraResult->get(), OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE, &typeItem);
+    if (ret != CAM_META_SUCCESS || typeItem.count == 0) {
         MEDIA_DEBUG_LOG("OHOS_CINEMA_VIDEO_KEY_FRAME_TYPE FindCameraMetadataItem failed, ret: %{public}d", ret);
         return;
     }
-    uint8_t keyFrameType = item.data.u8[0];
+    HandleKeyFrameInfo(item, typeItem);
+}
 
+void HCameraDevice::HandleKeyFrameInfo(
+    const camera_metadata_item_t& timestampItem, const camera_metadata_item_t& typeItem)
+{
+    int64_t keyFrameTimestamp = timestampItem.data.i64[0];
+    uint8_t keyFrameType = typeItem.data.u8[0];
     CHECK_RETURN_DLOG(keyFrameInfoMap_.count(keyFrameTimestamp) > 0,
                       "KeyFrameInfo of the same timestamp is already saved");
     MEDIA_INFO_LOG("SaveKeyFrameInfo keyFrameTimestamp: %{public}" PRId64 ", keyFrameType: %{public}d",
@@ -2375,25 +2498,22 @@ void HCameraDevice::OnSpectrumInfoChange(
     std::shared_ptr<OHOS::Camera::CameraMetadata> ability, const uint64_t timestamp)
 {
     MEDIA_DEBUG_LOG("HCameraDevice::SetSpectrumInfoChange ENTER");
+    CHECK_RETURN(ability == nullptr);
     camera_metadata_item_t item;
     int32_t ret =
         OHOS::Camera::FindCameraMetadataItem(ability->get(), OHOS_ABILITY_SPECTRUM_INFOS, &item);
     CHECK_RETURN_ELOG(ret != CAM_META_SUCCESS, "HCameraDevice::OnSpectrumInfoChange not find spectrum tag");
-    std::vector<float> spectrumInfo;
-    if (ret == CAM_META_SUCCESS && item.count > 0) {
-        spectrumInfo.reserve(item.count);
-        for (uint32_t i = 0; i < item.count; i++) {
-            spectrumInfo.emplace_back(static_cast<float>(item.data.f[i]));
-        }
-        MEDIA_DEBUG_LOG("HCameraDevice::OnSpectrumInfoChange, spectrumInfo size: %{public}zu",
-            spectrumInfo.size());
-    } else {
-        MEDIA_DEBUG_LOG("HCameraDevice::OnSpectrumInfoChange the spectrum data is null");
-    }
+    HandleSpectrumInfo(item, timestamp);
+}
+
+void HCameraDevice::HandleSpectrumInfo(const camera_metadata_item_t& item, const uint64_t timestamp)
+{
     auto spectrumInfoCallback = GetSpectrumCallback();
-    if (spectrumInfo.size() > 0 && spectrumInfoCallback) {
-        spectrumInfoCallback->OnCameraSpectrumInfo(userId_, spectrumInfo, timestamp);
-    }
+    CHECK_RETURN(spectrumInfoCallback == nullptr);
+    CHECK_RETURN_DLOG(item.count == 0, "HCameraDevice::OnSpectrumInfoChange the spectrum data is null");
+    std::vector<float> spectrumInfo(item.data.f, item.data.f + item.count);
+    MEDIA_DEBUG_LOG("HCameraDevice::OnSpectrumInfoChange, spectrumInfo size: %{public}zu", spectrumInfo.size());
+    spectrumInfoCallback->OnCameraSpectrumInfo(userId_, spectrumInfo, timestamp);
 }
 
 void HCameraDevice::SetSpectrumCallback(int32_t userId, sptr<ICameraSpectrumInfoCallback> callback)
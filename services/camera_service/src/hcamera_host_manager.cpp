@@ -25,6 +25,7 @@
 #include "metadata_utils.h"
 #include "os_account_manager.h"
 #include "v1_2/icamera_host_callback.h"
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
@@ -44,9 +45,22 @@ constexpr int32_t MAX_SYS_UID = 10000;
 std::shared_ptr<SimpleTimer> closeTimer_;
 
 using namespace OHOS::HDI::Camera::V1_0;
+enum class OrientationView : uint8_t {
+    UNCHECKED = 0,
+    NOT_NEEDED,
+    NEEDED,
+};
+
 struct HCameraHostManager::CameraDeviceInfo {
     std::string cameraId;
     std::shared_ptr<OHOS::Camera::CameraMetadata> ability;
+    // Whether clients see the ability with a corrected sensor orientation, decided once per ability.
+    OrientationView orientationView = OrientationView::UNCHECKED;
+    // Corrected copies of the ability shared by every client of the same class, indexed by natural direction
+    // correct, built on first use and never modified after.
+    std::shared_ptr<OHOS::Camera::CameraMetadata> orientationViews[2];
+    // Camera generation the device was added at, set before it is published in devices_.
+    uint64_t generation = 0;
     std::mutex mutex;
 
     explicit CameraDeviceInfo(const std::string& cameraId, sptr<ICameraDevice> device = nullptr)
@@ -91,6 +105,7 @@ public:
     int32_t GetCameraHostVersion();
     int32_t GetCameras(std::vector<std::string>& cameraIds);
     int32_t GetCameraAbility(const std::string& cameraId, std::shared_ptr<OHOS::Camera::CameraMetadata>& ability);
+    uint64_t GetCameraAbilityGeneration(const std::string& cameraId);
     int32_t OpenCamera(std::string& cameraId, const sptr<ICameraDeviceCallback>& callback,
                        sptr<OHOS::HDI::Camera::V1_0::ICameraDevice>& pDevice, bool isEnableSecCam = false);
     int32_t SetFlashlight(const std::string& cameraId, bool isEnable);
@@ -118,9 +133,12 @@ private:
     void NotifyCameraHostDied();
     void AddDevice(const std::string& cameraId);
     void RemoveDevice(const std::string& cameraId);
+    uint64_t AdvanceCameraGeneration();
     void Cast2MultiVersionCameraHost();
     void UpdateMuteSetting(std::shared_ptr<OHOS::Camera::CameraMetadata> setting);
-    void UpdateCameraAbility(std::shared_ptr<OHOS::Camera::CameraMetadata>& inAbility);
+    void UpdateCameraAbility(std::shared_ptr<CameraDeviceInfo>& deviceInfo,
+        std::shared_ptr<OHOS::Camera::CameraMetadata>& inAbility);
+    bool IsOrientationViewNeeded(const std::shared_ptr<OHOS::Camera::CameraMetadata>& inAbility);
 
     std::weak_ptr<StatusCallback> statusCallback_;
     std::weak_ptr<CameraHostDeadCallback> cameraHostDeadCallback_;
@@ -248,8 +266,11 @@ bool HCameraHostManager::CameraHostInfo::Init()
             "CameraHostInfo::Init", ret, true, CameraReportUtils::GetCallerInfo());
         return false;
     }
+    uint64_t generation = AdvanceCameraGeneration();
     for (const auto& cameraId : cameraIds_) {
-        devices_.push_back(std::make_shared<HCameraHostManager::CameraDeviceInfo>(cameraId));
+        auto deviceInfo = std::make_shared<HCameraHostManager::CameraDeviceInfo>(cameraId);
+        deviceInfo->generation = generation;
+        devices_.push_back(deviceInfo);
     }
     return true;
 }
@@ -318,7 +339,7 @@ int32_t HCameraHostManager::CameraHostInfo::GetCameraAbility(const std::string&
             deviceInfo->ability = ability;
         }
     }
-    UpdateCameraAbility(ability);
+    UpdateCameraAbility(deviceInfo, ability);
 #ifdef HOOK_CAMERA_OPERATOR
     CHECK_PRINT_DLOG(!CameraRotatePlugin::GetInstance()->HookCameraAbility(cameraId, ability),
         "CameraHostInfo::HookCameraAbility failed ");
@@ -326,48 +347,64 @@ int32_t HCameraHostManager::CameraHostInfo::GetCameraAbility(const std::string&
     return CAMERA_OK;
 }
 
-void HCameraHostManager::CameraHostInfo::UpdateCameraAbility(std::shared_ptr<OHOS::Camera::CameraMetadata>& inAbility)
+uint64_t HCameraHostManager::CameraHostInfo::GetCameraAbilityGeneration(const std::string& cameraId)
+{
+    auto deviceInfo = FindCameraDeviceInfo(cameraId);
+    CHECK_RETURN_RET(deviceInfo == nullptr, 0);
+    return deviceInfo->generation;
+}
+
+void HCameraHostManager::CameraHostInfo::UpdateCameraAbility(std::shared_ptr<CameraDeviceInfo>& deviceInfo,
+    std::shared_ptr<OHOS::Camera::CameraMetadata>& inAbility)
 {
     CHECK_RETURN_ELOG(inAbility == nullptr, "CameraHostInfo::UpdateCameraAbility ability is nullptr");
+    // Called under deviceInfo->mutex, the ability is only replaced when the device is added again.
+    if (deviceInfo->orientationView == OrientationView::UNCHECKED) {
+        deviceInfo->orientationView =
+            IsOrientationViewNeeded(inAbility) ? OrientationView::NEEDED : OrientationView::NOT_NEEDED;
+    }
+    CHECK_RETURN(deviceInfo->orientationView != OrientationView::NEEDED);
 
-    bool isLogicCamera = system::GetParameter("const.system.sensor_correction_enable", "0") == "1";
-    auto foldScreenType = system::GetParameter("const.window.foldscreen.type", "");
-    CHECK_RETURN(!isLogicCamera || foldScreenType.empty() || foldScreenType[0] != '7');
+    bool isNaturalDirectionCorrect = false;
+    int tokenId = static_cast<int32_t>(IPCSkeleton::GetCallingTokenID());
+    std::string clientName = GetClientNameByToken(tokenId);
+    CameraApplistManager::GetInstance()->GetNaturalDirectionCorrectByBundleName(clientName, isNaturalDirectionCorrect);
+
+    auto& view = deviceInfo->orientationViews[isNaturalDirectionCorrect ? 1 : 0];
+    if (view == nullptr) {
+        int32_t sensorOrientation = isNaturalDirectionCorrect ? CAMERA_ORIENTATION_0 : CAMERA_FRONT_ORIENTATION;
+        MEDIA_DEBUG_LOG("CameraHostInfo::UpdateCameraAbility sensorOrientation: %{public}d", sensorOrientation);
+        auto outputCapability = CameraFwkMetadataUtils::CopyMetadata(inAbility);
+        CHECK_RETURN_ELOG(outputCapability == nullptr,
+            "CameraHostInfo::UpdateCameraAbility outputCapability is nullptr");
+        outputCapability->updateEntry(OHOS_SENSOR_ORIENTATION, &sensorOrientation, 1);
+        view = outputCapability;
+    }
+    inAbility = view;
+}
+
+bool HCameraHostManager::CameraHostInfo::IsOrientationViewNeeded(
+    const std::shared_ptr<OHOS::Camera::CameraMetadata>& inAbility)
+{
+    // Both parameters are read only, Init reads them once.
+    CHECK_RETURN_RET(!isLogicCamera_ || foldScreenType_.empty() || foldScreenType_[0] != '7', false);
 
     camera_metadata_item_t item;
     int32_t ret = OHOS::Camera::FindCameraMetadataItem(inAbility->get(), OHOS_ABILITY_CAMERA_POSITION, &item);
-    int32_t cameraPosition = OHOS_CAMERA_POSITION_BACK;
-    CHECK_RETURN_ELOG(ret != CAM_META_SUCCESS || item.count <= 0,
+    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS || item.count <= 0, false,
         "CameraHostInfo::UpdateCameraAbility Get cameraPosition failed");
-    cameraPosition = static_cast<int32_t>(item.data.u8[0]);
-    CHECK_RETURN(cameraPosition != OHOS_CAMERA_POSITION_FRONT);
+    int32_t cameraPosition = static_cast<int32_t>(item.data.u8[0]);
+    CHECK_RETURN_RET(cameraPosition != OHOS_CAMERA_POSITION_FRONT, false);
 
     bool isVariable = false;
     ret = OHOS::Camera::FindCameraMetadataItem(inAbility->get(), OHOS_ABILITY_SENSOR_ORIENTATION_VARIABLE, &item);
     CHECK_EXECUTE(ret == CAM_META_SUCCESS, isVariable = item.count > 0 && item.data.u8[0]);
-    CHECK_RETURN_DLOG(!isVariable, "CameraHostInfo::UpdateCameraAbility donot support Variable Orientation");
+    CHECK_RETURN_RET_DLOG(!isVariable, false, "CameraHostInfo::UpdateCameraAbility donot support Variable Orientation");
 
     ret = OHOS::Camera::FindCameraMetadataItem(inAbility->get(), OHOS_SENSOR_ORIENTATION, &item);
-    CHECK_RETURN_ELOG(ret != CAM_META_SUCCESS || item.count <= 0,
+    CHECK_RETURN_RET_ELOG(ret != CAM_META_SUCCESS || item.count <= 0, false,
         "CameraHostInfo::UpdateCameraAbility Get sensorOrientation failed");
-    int32_t sensorOrientation = item.data.i32[0];
-    CHECK_RETURN(sensorOrientation != CAMERA_ORIENTATION_0);
-
-    bool isNaturalDirectionCorrect = false;
-    int tokenId = static_cast<int32_t>(IPCSkeleton::GetCallingTokenID());
-    std::string clientName = GetClientNameByToken(tokenId);
-    CameraApplistManager::GetInstance()->GetNaturalDirectionCorrectByBundleName(clientName, isNaturalDirectionCorrect);
-
-    if (isNaturalDirectionCorrect) {
-        sensorOrientation = CAMERA_ORIENTATION_0;
-    } else {
-        sensorOrientation = CAMERA_FRONT_ORIENTATION;
-    }
-    MEDIA_DEBUG_LOG("CameraHostInfo::UpdateCameraAbility sensorOrientation: %{public}d", sensorOrientation);
-    auto outputCapability = CameraFwkMetadataUtils::CopyMetadata(inAbility);
-    CHECK_RETURN_ELOG(outputCapability == nullptr, "CameraHostInfo::UpdateCameraAbility outputCapability is nullptr");
-    outputCapability->updateEntry(OHOS_SENSOR_ORIENTATION, &sensorOrientation, 1);
-    inAbility = outputCapability;
+    return item.data.i32[0] == CAMERA_ORIENTATION_0;
 }
 
 int32_t HCameraHostManager::CameraHostInfo::OpenCamera(std::string& cameraId,
@@ -504,6 +541,7 @@ int32_t HCameraHostManager::CameraHostInfo::Prelaunch(sptr<HCameraRestoreParam>
     DumpMetadata(cameraRestoreParam->GetSetting());
     if (muteMode) {
         UpdateMuteSetting(cameraRestoreParam->GetSetting());
+        cameraRestoreParam->MarkSettingChanged();
     }
     OHOS::Camera::MetadataUtils::ConvertMetadataToVec(cameraRestoreParam->GetSetting(), settings);
     prelaunchConfig.setting = settings;
@@ -826,7 +864,9 @@ void HCameraHostManager::CameraHostInfo::AddDevice(const std::string& cameraId)
     if (std::none_of(devices_.begin(), devices_.end(),
                      [&cameraId](auto& devInfo) { return devInfo->cameraId == cameraId; })) {
         cameraIds_.push_back(cameraId);
-        devices_.push_back(std::make_shared<HCameraHostManager::CameraDeviceInfo>(cameraId));
+        auto deviceInfo = std::make_shared<HCameraHostManager::CameraDeviceInfo>(cameraId);
+        deviceInfo->generation = AdvanceCameraGeneration();
+        devices_.push_back(deviceInfo);
         MEDIA_INFO_LOG("CameraHostInfo::AddDevice, camera %{public}s added", cameraId.c_str());
     } else {
         MEDIA_WARNING_LOG("CameraHostInfo::AddDevice, camera %{public}s already exists", cameraId.c_str());
@@ -841,11 +881,21 @@ void HCameraHostManager::CameraHostInfo::RemoveDevice(const std::string& cameraI
     devices_.erase(std::remove_if(devices_.begin(), devices_.end(),
         [&cameraId](const auto& devInfo) { return devInfo->cameraId == cameraId; }),
         devices_.end());
+    AdvanceCameraGeneration();
     for (auto id : cameraIds_) {
         MEDIA_INFO_LOG("CameraHostInfo::RemoveDevice, current camera %{public}s", id.c_str());
     }
 }
 
+uint64_t HCameraHostManager::CameraHostInfo::AdvanceCameraGeneration()
+{
+    auto deadCallback = cameraHostDeadCallback_.lock();
+    CHECK_RETURN_RET_ELOG(deadCallback == nullptr, 0, "CameraHostInfo::AdvanceCameraGeneration no host manager");
+    auto hostManager = deadCallback->GetHostManager().promote();
+    CHECK_RETURN_RET_ELOG(hostManager == nullptr, 0, "CameraHostInfo::AdvanceCameraGeneration no host manager");
+    return hostManager->AdvanceCameraGeneration();
+}
+
 bool HCameraHostManager::CameraHostInfo::IsUsbCamera(const std::string& cameraId)
 {
     std::shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility;
@@ -858,7 +908,9 @@ bool HCameraHostManager::CameraHostInfo::IsUsbCamera(const std::string& cameraId
 }
 
 HCameraHostManager::HCameraHostManager(std::shared_ptr<StatusCallback> statusCallback)
-    : statusCallback_(statusCallback), cameraHostInfos_(), muteMode_(false)
+    : statusCallback_(statusCallback), cameraHostInfos_(), muteMode_(false),
+      cameraGeneration_(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now().time_since_epoch()).count()))
 {
     MEDIA_INFO_LOG("HCameraHostManager construct called");
 }
@@ -1064,6 +1116,23 @@ int32_t HCameraHostManager::GetCameraAbility(const std::string &cameraId,
     return cameraHostInfo->GetCameraAbility(cameraId, ability);
 }
 
+uint64_t HCameraHostManager::GetCameraGeneration()
+{
+    return cameraGeneration_.load();
+}
+
+uint64_t HCameraHostManager::GetCameraAbilityGeneration(const std::string& cameraId)
+{
+    auto cameraHostInfo = FindCameraHostInfo(cameraId);
+    CHECK_RETURN_RET(cameraHostInfo == nullptr, 0);
+    return cameraHostInfo->GetCameraAbilityGeneration(cameraId);
+}
+
+uint64_t HCameraHostManager::AdvanceCameraGeneration()
+{
+    return ++cameraGeneration_;
+}
+
 int32_t HCameraHostManager::GetVersionByCamera(const std::string& cameraId)
 {
     MEDIA_INFO_LOG("GetVersionByCamera camera = %{public}s", cameraId.c_str());
@@ -1156,40 +1225,37 @@ int32_t HCameraHostManager::Prelaunch(const std::string& cameraId, std::string c
     return 0;
 }
 
-void HCameraHostManager::ParseJsonFileToMap(const std::string& filePath,
-                                            std::string& clientName, std::string& cameraId)
+void HCameraHostManager::LoadRestoreParamCache(std::string& clientName, std::string& cameraId)
 {
-    MEDIA_INFO_LOG("Parse JsonFile To Map Begin!");
+    MEDIA_INFO_LOG("Load RestoreParamCache Begin!");
     std::lock_guard<std::mutex> lock(saveRestoreMutex_);
-    bool isParseSucc = JsonCacheConverter::ParseJsonFileToMap(filePath,
-                                                              persistentParamMap_,
-                                                              transitentParamMap_,
-                                                              clientName, cameraId);
-    CHECK_EXECUTE(!isParseSucc,
+    bool isLoadSucc = restoreParamCache_.LoadOrMigrate(SAVE_RESTORE_BINARY_FILE_PATH, SAVE_RESTORE_FILE_PATH,
+                                                       persistentParamMap_, transitentParamMap_,
+                                                       clientName, cameraId);
+    CHECK_EXECUTE(!isLoadSucc,
                   persistentParamMap_.clear();
                   transitentParamMap_.clear();
                   clientName.clear();
                   cameraId.clear();
-                  MEDIA_ERR_LOG("Failed to Parse JsonFile To Map");
+                  MEDIA_ERR_LOG("Failed to Load RestoreParamCache");
                   return);
-    MEDIA_INFO_LOG("Parse JsonFile To Map Succ!");
+    MEDIA_INFO_LOG("Load RestoreParamCache Succ!");
 }
 
-void HCameraHostManager::SaveMapToJsonFile(const std::string& filePath,
-                                           const std::string& clientName, const std::string& cameraId)
+void HCameraHostManager::SaveRestoreParamCache(const std::string& clientName, const std::string& cameraId)
 {
-    MEDIA_INFO_LOG("Save Map To JsonFile Begin!");
+    MEDIA_INFO_LOG("Save RestoreParamCache Begin!");
     std::lock_guard<std::mutex> lock(saveRestoreMutex_);
-    bool isSaveSucc = JsonCacheConverter::SaveMapToJsonFile(filePath,
-                                                            persistentParamMap_,
-                                                            transitentParamMap_,
-                                                            clientName, cameraId);
+    bool isSaveSucc = restoreParamCache_.SaveMapToBinaryFile(SAVE_RESTORE_BINARY_FILE_PATH,
+                                                             persistentParamMap_,
+                                                             transitentParamMap_,
+                                                             clientName, cameraId);
     CHECK_EXECUTE(!isSaveSucc,
-                  MEDIA_ERR_LOG("Failed to Save Map To JsonFile");
-                  CHECK_EXECUTE(remove(filePath.c_str()) != 0,
-                                std::ofstream ofs(filePath, std::ios::out | std::ios::trunc));
+                  MEDIA_ERR_LOG("Failed to Save RestoreParamCache");
+                  restoreParamCache_.Clear();
+                  remove(SAVE_RESTORE_BINARY_FILE_PATH.c_str());
                   return);
-    MEDIA_INFO_LOG("Save Map To JsonFile Succ!");
+    MEDIA_INFO_LOG("Save RestoreParamCache Succ!");
 }
 
 int32_t HCameraHostManager::PreSwitchCamera(const std::string& cameraId)
@@ -1403,6 +1469,7 @@ void HCameraHostManager::RemoveCameraHost(const std::string& svcName)
     }
     *it = nullptr;
     cameraHostInfos_.erase(it);
+    AdvanceCameraGeneration();
     auto statusCallback = statusCallback_.lock();
     if (statusCallback && svcName == LOCAL_SERVICE_NAME) {
         statusCallback->OnTorchStatus(TorchStatus::TORCH_STATUS_UNAVAILABLE);
@@ -73,6 +73,7 @@ int HCameraRestoreParam::GetStartActiveTime()
 void HCameraRestoreParam::SetCloseCameraTime(timeval closeCameraTime)
 {
     mCloseCameraTime = closeCameraTime;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 std::string HCameraRestoreParam::GetCameraId()
@@ -88,6 +89,7 @@ std::string HCameraRestoreParam::GetClientName()
 void HCameraRestoreParam::SetCameraOpMode(int32_t opMode)
 {
     mOpMode = opMode;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 int32_t HCameraRestoreParam::GetCameraOpMode()
@@ -98,12 +100,14 @@ int32_t HCameraRestoreParam::GetCameraOpMode()
 void HCameraRestoreParam::SetStreamInfo(std::vector<StreamInfo_V1_1> &streamInfos)
 {
     mStreamInfos = streamInfos;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 void HCameraRestoreParam::SetSetting(std::shared_ptr<OHOS::Camera::CameraMetadata>& settings)
 {
     std::lock_guard<std::mutex> lock(restoreParamMutex_);
     mSettings = settings;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 void HCameraRestoreParam::UpdateExposureSetting(long timeInterval)
@@ -115,16 +119,19 @@ void HCameraRestoreParam::UpdateExposureSetting(long timeInterval)
         return;
     }
     OHOS::Camera::DeleteCameraMetadataItem(mSettings->get(), OHOS_CONTROL_AE_EXPOSURE_COMPENSATION);
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 void HCameraRestoreParam::SetRestoreParamType(RestoreParamTypeOhos restoreParamType)
 {
     mRestoreParamType = restoreParamType;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 void HCameraRestoreParam::SetStartActiveTime(int activeTime)
 {
     mStartActiveTime = activeTime;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 int HCameraRestoreParam::GetFlodStatus()
@@ -135,11 +142,18 @@ int HCameraRestoreParam::GetFlodStatus()
 void HCameraRestoreParam::SetFoldStatus(int foldStaus)
 {
     mFoldStatus = foldStaus;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 
 void HCameraRestoreParam::SetScanStatus(bool isScan)
 {
     mIsScan = isScan;
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
+}
+
+void HCameraRestoreParam::MarkSettingChanged()
+{
+    mGeneration.fetch_add(1, std::memory_order_relaxed);
 }
 } // namespace CameraStandard
 } // namespace OHOS
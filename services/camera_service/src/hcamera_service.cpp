@@ -16,6 +16,8 @@
 #include "hcamera_service.h"
 
 #include <algorithm>
+#include <cinttypes>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <parameter.h>
@@ -46,6 +48,7 @@
 #include "camera_common_event_manager.h"
 #include "camera_metadata.h"
 #include "camera_parameters_config_parser.h"
+#include "camera_surface_buffer_pool.h"
 #include "datashare_predicates.h"
 #include "datashare_result_set.h"
 #include "deferred_processing_service.h"
@@ -235,7 +238,7 @@ void HCameraService::OnStart()
     isLogicCamera_ = system::GetParameter("const.system.sensor_correction_enable", "0") == "1";
     foldScreenType_ = system::GetParameter("const.window.foldscreen.type", "");
     cameraExtendProxy_.Set(CameraExtendProxy::CreateCameraExtendProxy());
-    cameraHostManager_->ParseJsonFileToMap(SAVE_RESTORE_FILE_PATH, preCameraClient_, preCameraId_);
+    cameraHostManager_->LoadRestoreParamCache(preCameraClient_, preCameraId_);
     RefreshRssCameraStatus();
     cameraDisplayPlugin_ = CameraDisplayPlugin::GetInstance();
     if (cameraDisplayPlugin_ != nullptr && cameraDisplayPlugin_->LoadSo()) {
@@ -768,10 +771,6 @@ int32_t HCameraService::GetCameras(
     ElevateThreadPriority();
 #endif
 
-    isFoldableMutex.lock();
-    isFoldable = isFoldableInit ? isFoldable : g_isFoldScreen;
-    isFoldableInit = true;
-    isFoldableMutex.unlock();
     vector<shared_ptr<CameraMetaInfo>> cameraInfos;
     int32_t ret = ParseCamerasInfos(cameraIds, cameraInfos);
     FillCameras(cameraInfos, cameraIds, cameraAbilityList);
@@ -790,6 +789,11 @@ int32_t HCameraService::GetPhysicalCameras(
 
 int32_t HCameraService::ParseCamerasInfos(vector<string>& cameraIds, vector<shared_ptr<CameraMetaInfo>>& cameraInfos)
 {
+    // The meta info derived below depends on isFoldable, set it before the first camera is cataloged.
+    isFoldableMutex.lock();
+    isFoldable = isFoldableInit ? isFoldable : g_isFoldScreen;
+    isFoldableInit = true;
+    isFoldableMutex.unlock();
     int32_t ret = cameraHostManager_->GetCameras(cameraIds);
     CHECK_RETURN_RET_ELOG(ret != CAMERA_OK, ret, "HCameraService::GetCameras failed");
     shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility;
@@ -797,13 +801,54 @@ int32_t HCameraService::ParseCamerasInfos(vector<string>& cameraIds, vector<shar
         ret = cameraHostManager_->GetCameraAbility(id, cameraAbility);
         CHECK_RETURN_RET_ELOG(
             ret != CAMERA_OK || cameraAbility == nullptr, ret, "HCameraService::GetCameraAbility failed");
-        auto cameraMetaInfo = GetCameraMetaInfo(id, cameraAbility);
+        auto cameraMetaInfo = GetCatalogCameraMetaInfo(id, cameraAbility);
         CHECK_CONTINUE(cameraMetaInfo == nullptr);
         cameraInfos.emplace_back(cameraMetaInfo);
     }
+    PruneCameraCatalog(cameraIds);
     return ret;
 }
 
+shared_ptr<CameraMetaInfo> HCameraService::GetCatalogCameraMetaInfo(std::string& cameraId,
+    shared_ptr<OHOS::Camera::CameraMetadata> cameraAbility)
+{
+#ifdef HOOK_CAMERA_OPERATOR
+    // The rotate plugin may rewrite the position on every call, nothing derived from the ability is stable.
+    return GetCameraMetaInfo(cameraId, cameraAbility);
+#else
+    uint64_t abilityGeneration = cameraHostManager_->GetCameraAbilityGeneration(cameraId);
+    isFoldableMutex.lock();
+    bool isFoldableNow = isFoldable;
+    isFoldableMutex.unlock();
+    {
+        lock_guard<mutex> lock(cameraCatalogMutex_);
+        auto it = cameraCatalog_.find(cameraId);
+        bool isCached = it != cameraCatalog_.end() && it->second.abilityGeneration == abilityGeneration &&
+            it->second.isFoldable == isFoldableNow;
+        if (isCached) {
+            CHECK_RETURN_RET(it->second.metaInfo == nullptr, nullptr);
+            // Clients of another class see another view of the same ability, the derived fields are shared.
+            auto cameraMetaInfo = make_shared<CameraMetaInfo>(*it->second.metaInfo);
+            cameraMetaInfo->cameraAbility = cameraAbility;
+            return cameraMetaInfo;
+        }
+    }
+    auto cameraMetaInfo = GetCameraMetaInfo(cameraId, cameraAbility);
+    lock_guard<mutex> lock(cameraCatalogMutex_);
+    cameraCatalog_[cameraId] = { abilityGeneration, isFoldableNow, cameraMetaInfo };
+    return cameraMetaInfo;
+#endif
+}
+
+void HCameraService::PruneCameraCatalog(const vector<string>& cameraIds)
+{
+    lock_guard<mutex> lock(cameraCatalogMutex_);
+    for (auto it = cameraCatalog_.begin(); it != cameraCatalog_.end();) {
+        bool isRemoved = std::find(cameraIds.begin(), cameraIds.end(), it->first) == cameraIds.end();
+        it = isRemoved ? cameraCatalog_.erase(it) : std::next(it);
+    }
+}
+
 shared_ptr<CameraMetaInfo> HCameraService::GetCameraMetaInfo(std::string &cameraId,
     shared_ptr<OHOS::Camera::CameraMetadata>cameraAbility)
 {
@@ -816,19 +861,17 @@ shared_ptr<CameraMetaInfo> HCameraService::GetCameraMetaInfo(std::string &camera
     res = OHOS::Camera::FindCameraMetadataItem(metadata, OHOS_ABILITY_CAMERA_CONNECTION_TYPE, &item);
     uint8_t connectionType =
         (res == CAM_META_SUCCESS && item.count) ? item.data.u8[0] : OHOS_CAMERA_CONNECTION_TYPE_BUILTIN;
-    auto foldScreenType = system::GetParameter("const.window.foldscreen.type", "")[0];
+    static const char foldScreenType = system::GetParameter("const.window.foldscreen.type", "")[0];
+    isFoldableMutex.lock();
+    bool isFoldableNow = isFoldable;
     isFoldableMutex.unlock();
-    bool isOtherFold = isFoldable && cameraPosition == OHOS_CAMERA_POSITION_FRONT &&
+    bool isOtherFold = isFoldableNow && cameraPosition == OHOS_CAMERA_POSITION_FRONT &&
         foldType == OHOS_CAMERA_FOLDSCREEN_OTHER &&
         (foldScreenType == '1' || foldScreenType == '7' || foldScreenType == '8')
         && connectionType != OHOS_CAMERA_CONNECTION_TYPE_REMOTE;
-    if (isOtherFold) {
-        isFoldableMutex.unlock();
-        return nullptr;
-    }
+    CHECK_RETURN_RET(isOtherFold, nullptr);
     bool isFoldInner =
-        isFoldable && cameraPosition == OHOS_CAMERA_POSITION_FRONT && foldType == OHOS_CAMERA_FOLDSCREEN_INNER;
-    isFoldableMutex.unlock();
+        isFoldableNow && cameraPosition == OHOS_CAMERA_POSITION_FRONT && foldType == OHOS_CAMERA_FOLDSCREEN_INNER;
     if (isFoldInner) {
         cameraPosition = POSITION_FOLD_INNER;
     }
@@ -986,6 +1029,39 @@ int32_t HCameraService::GetPhysicalCameraIds(vector<string>& cameraIds)
     return ret;
 }
 
+int32_t HCameraService::GetCamerasSince(uint64_t knownGeneration, uint64_t& generation,
+    std::vector<std::string>& cameraIds, std::vector<std::string>& changedCameraIds,
+    std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>>& changedAbilityList)
+{
+    CAMERA_SYNC_TRACE;
+    cameraIds.clear();
+    changedCameraIds.clear();
+    changedAbilityList.clear();
+#ifdef HOOK_CAMERA_OPERATOR
+    // The rotate plugin rewrites the abilities on every call, a generation the client can never match keeps
+    // it from caching them.
+    generation = 0;
+#else
+    // Read before the cameras, a change racing with this call is reported again on the next one.
+    generation = cameraHostManager_->GetCameraGeneration();
+    CHECK_RETURN_RET_DLOG(generation == knownGeneration, CAMERA_OK,
+        "HCameraService::GetCamerasSince unchanged since %{public}" PRIu64, knownGeneration);
+#endif
+    std::vector<std::shared_ptr<OHOS::Camera::CameraMetadata>> cameraAbilityList;
+    int32_t ret = GetCameras(cameraIds, cameraAbilityList);
+    CHECK_RETURN_RET_ELOG(ret != CAMERA_OK, ret, "HCameraService::GetCamerasSince GetCameras failed");
+    for (size_t i = 0; i < cameraIds.size() && i < cameraAbilityList.size(); i++) {
+#ifndef HOOK_CAMERA_OPERATOR
+        CHECK_CONTINUE(cameraHostManager_->GetCameraAbilityGeneration(cameraIds[i]) <= knownGeneration);
+#endif
+        changedCameraIds.emplace_back(cameraIds[i]);
+        changedAbilityList.emplace_back(cameraAbilityList[i]);
+    }
+    MEDIA_DEBUG_LOG("HCameraService::GetCamerasSince %{public}zu cameras, %{public}zu changed", cameraIds.size(),
+        changedCameraIds.size());
+    return ret;
+}
+
 int32_t HCameraService::GetCameraAbility(const std::string& cameraId,
     std::shared_ptr<OHOS::Camera::CameraMetadata>& cameraAbility)
 {
@@ -3272,6 +3348,18 @@ void HCameraService::DumpCameraConcurrency(
     HCaptureSession::DumpSessions(infoDumper);
 }
 
+void HCameraService::DumpResultDispatcher(CameraInfoDumper& infoDumper)
+{
+    std::vector<sptr<HCameraDeviceHolder>> cameraHolders =
+        HCameraDeviceManager::GetInstance()->GetActiveCameraHolders();
+    for (auto& holder : cameraHolders) {
+        CHECK_CONTINUE(holder == nullptr);
+        sptr<HCameraDevice> device = holder->GetDevice();
+        CHECK_CONTINUE(device == nullptr);
+        infoDumper.Msg(device->DumpResultDispatcher());
+    }
+}
+
 int32_t HCameraService::Dump(int fd, const vector<u16string> &args)
 {
     unordered_set<u16string> argSets;
@@ -3302,6 +3390,16 @@ int32_t HCameraService::Dump(int fd, const vector<u16string> &args)
         infoDumper.Tip("--------Dump Clientwise Info Begin-------");
         HCaptureSession::DumpSessions(infoDumper);
     }
+    result = args.empty() || argSets.count(u16string(u"bufferpool"));
+    if (result) {
+        infoDumper.Tip("--------Dump SurfaceBufferPool Begin-------");
+        infoDumper.Msg(CameraSurfaceBufferPool::GetInstance().Dump());
+    }
+    result = args.empty() || argSets.count(u16string(u"resultdispatch"));
+    if (result) {
+        infoDumper.Tip("--------Dump ResultDispatcher Begin-------");
+        DumpResultDispatcher(infoDumper);
+    }
     CHECK_EXECUTE(argSets.count(std::u16string(u"debugOn")), SetCameraDebugValue(true));
     if (argSets.count(std::u16string(u"concurrency"))) {
         DumpCameraConcurrency(infoDumper, cameraAbilityList);
@@ -118,6 +118,7 @@ constexpr int32_t TELE_TELE2_ZOOM_PER = 7;
 constexpr int32_t ZOOM_IN_PER = 0;
 constexpr int32_t ZOOM_OUT_PERF = 1;
 constexpr int32_t ZOOM_BEZIER_VALUE_COUNT = 5;
+constexpr int32_t ZOOM_RATIO_MULTIPLE = 100;
 constexpr int32_t SPECIAL_BUNDLE_FPS = 15;
 constexpr int32_t SPECIAL_BUNDLE_ROTATE = 0;
 constexpr float DATA_HELPER_BOOL_TRUE = 1;
@@ -1986,6 +1987,30 @@ bool HCaptureSession::QueryFpsAndZoomRatio(
     // LCOV_EXCL_STOP
 }
 
+bool HCaptureSession::QueryZoomStatus(sptr<HCameraDevice>& cameraDevice, float &currentFps,
+    float &currentZoomRatio, std::vector<float> &crossZoomAndTime, int32_t operationMode)
+{
+    // Follow-up steps of a zoom gesture reuse the status of the first one and take the current zoom from the
+    // latest result, the HAL is only queried again once the device reports that the status may have changed.
+    constexpr uint64_t ZOOM_RESULT_MAX_AGE_MS = 100;
+    uint64_t generation = cameraDevice->GetZoomStatusGeneration();
+    float reportedZoomRatio = 0.0f;
+    bool isStatusCached = smoothZoomPlanner_.GetZoomStatus(
+        cameraDevice.GetRefPtr(), generation, operationMode, currentFps, crossZoomAndTime) &&
+        cameraDevice->GetReportedZoomRatio(reportedZoomRatio, ZOOM_RESULT_MAX_AGE_MS);
+    if (isStatusCached) {
+        currentZoomRatio = std::round(reportedZoomRatio * ZOOM_RATIO_MULTIPLE);
+        MEDIA_DEBUG_LOG("HCaptureSession::QueryZoomStatus cached fps %{public}f, zoom %{public}f, "
+            "sessionID: %{public}d", currentFps, currentZoomRatio, GetSessionId());
+        return true;
+    }
+    crossZoomAndTime.clear();
+    bool isQueried = QueryFpsAndZoomRatio(currentFps, currentZoomRatio, crossZoomAndTime, operationMode);
+    CHECK_EXECUTE(isQueried, smoothZoomPlanner_.SetZoomStatus(
+        cameraDevice.GetRefPtr(), generation, operationMode, currentFps, crossZoomAndTime));
+    return isQueried;
+}
+
 bool HCaptureSession::QueryZoomPerformance(
     std::vector<float> &crossZoomAndTime, int32_t operationMode, const camera_metadata_item_t &zoomItem)
 {
@@ -2191,17 +2216,21 @@ bool HCaptureSession::QueryZoomBezierValue(std::vector<float> &zoomBezierValue)
     CHECK_RETURN_RET_ELOG(
         cameraDevice == nullptr, false, "HCaptureSession::QueryZoomBezierValue() cameraDevice is null");
     std::shared_ptr<OHOS::Camera::CameraMetadata> ability = cameraDevice->GetDeviceAbility();
+    CHECK_RETURN_RET_ELOG(ability == nullptr, false, "HCaptureSession::QueryZoomBezierValue() ability is null");
+    bool isFound = false;
+    CHECK_RETURN_RET(smoothZoomPlanner_.GetZoomBezierValue(ability, isFound, zoomBezierValue), isFound);
     camera_metadata_item_t bezierItem;
     int retFindMeta =
         OHOS::Camera::FindCameraMetadataItem(ability->get(), OHOS_ABILITY_CAMERA_ZOOM_BEZIER_CURVC_POINT, &bezierItem);
-    CHECK_RETURN_RET_ELOG(retFindMeta == CAM_META_ITEM_NOT_FOUND, false,
-        "HCaptureSession::QueryZoomBezierValue() current bezierValue not found");
-    for (int i = 0; i < static_cast<int>(bezierItem.count); i++) {
+    isFound = retFindMeta != CAM_META_ITEM_NOT_FOUND;
+    for (int i = 0; isFound && i < static_cast<int>(bezierItem.count); i++) {
         zoomBezierValue.push_back(bezierItem.data.f[i]);
         MEDIA_DEBUG_LOG("HCaptureSession::QueryZoomBezierValue()  bezierValue %{public}f.",
             static_cast<float>(bezierItem.data.f[i]));
     }
-    return true;
+    smoothZoomPlanner_.SetZoomBezierValue(ability, isFound, zoomBezierValue);
+    CHECK_PRINT_ELOG(!isFound, "HCaptureSession::QueryZoomBezierValue() current bezierValue not found");
+    return isFound;
 }
 
 bool HCaptureSession::supportHalCalSmoothZoom(float targetZoomRatio)
@@ -2238,7 +2267,6 @@ bool HCaptureSession::supportHalCalSmoothZoom(float targetZoomRatio)
 int32_t HCaptureSession::SetSmoothZoom(
     int32_t smoothZoomType, int32_t operationMode, float targetZoomRatio, float& duration)
 {
-    constexpr int32_t ZOOM_RATIO_MULTIPLE = 100;
     const int32_t MAX_FPS = 60;
     auto cameraDevice = GetCameraDevice();
     CHECK_RETURN_RET_ELOG(cameraDevice == nullptr, CAMERA_UNKNOWN_ERROR,
@@ -2253,7 +2281,7 @@ int32_t HCaptureSession::SetSmoothZoom(
     int32_t currentRangeId = 0;
     std::vector<float> crossZoomAndTime {};
     std::vector<float> zoomBezierValue {};
-    QueryFpsAndZoomRatio(currentFps, currentZoomRatio, crossZoomAndTime, operationMode);
+    QueryZoomStatus(cameraDevice, currentFps, currentZoomRatio, crossZoomAndTime, operationMode);
     currentFps = currentFps > MAX_FPS ? MAX_FPS : currentFps;
     std::vector<float> mCrossZoom {};
     std::vector<std::vector<float>> crossTime {};
@@ -2265,11 +2293,9 @@ int32_t HCaptureSession::SetSmoothZoom(
     currentRangeId = GetRangeId(currentZoomRatio, mCrossZoom);
     float waitMs = GetCrossWaitTime(crossTime, targetRangeId, currentRangeId);
     bool retHaveBezierValue = QueryZoomBezierValue(zoomBezierValue);
-    auto zoomAlgorithm = SmoothZoom::GetZoomAlgorithm(static_cast<SmoothZoomType>(smoothZoomType));
-    if (retHaveBezierValue && zoomBezierValue.size() == ZOOM_BEZIER_VALUE_COUNT) {
-        zoomAlgorithm->SetBezierValue(zoomBezierValue);
-    }
-    auto array = zoomAlgorithm->GetZoomArray(currentZoomRatio, targetZoomRatio, frameIntervalMs);
+    CHECK_EXECUTE(!retHaveBezierValue || zoomBezierValue.size() != ZOOM_BEZIER_VALUE_COUNT, zoomBezierValue.clear());
+    auto array = smoothZoomPlanner_.GetZoomArray(static_cast<SmoothZoomType>(smoothZoomType), zoomBezierValue,
+        currentZoomRatio, targetZoomRatio, frameIntervalMs);
     CHECK_RETURN_RET_ELOG(array.empty(), CAMERA_UNKNOWN_ERROR, "HCaptureSession::SetSmoothZoom array is empty");
     if (currentZoomRatio < targetZoomRatio) {
         std::sort(mCrossZoom.begin(), mCrossZoom.end());
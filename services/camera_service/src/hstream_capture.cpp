@@ -23,6 +23,7 @@
 #include "camera_log.h"
 #include "camera_report_uitls.h"
 #include "camera_server_photo_proxy.h"
+#include "camera_surface_buffer_pool.h"
 #include "camera_util.h"
 #include "hstream_common.h"
 #include "ipc_skeleton.h"
@@ -66,6 +67,9 @@ static const int8_t PHOTO_ASSET_TIMEOUT = 10;
 static const std::string BURST_UUID_BEGIN = "";
 static std::string g_currentBurstUuid = BURST_UUID_BEGIN;
 static const uint32_t TASKMANAGER_ONE = 1;
+#ifdef MEMMGR_OVERRID
+static const int32_t LOW_AVAILABLE_MEMORY_KB = 512 * 1024; // memory manager reports KB
+#endif
 #ifdef CAMERA_CAPTURE_YUV
 static const uint32_t PHOTO_SAVE_MAX_NUM = 3;
 static const uint32_t PHOTO_STATE_TIMEOUT = 20; // 20s
@@ -824,6 +828,19 @@ int32_t HStreamCapture::SetShotParam(int32_t captureId, const std::string& shotP
     return SUCCESS;
 }
 
+int32_t HStreamCapture::ReleasePhotoBuffer(int32_t sequence)
+{
+    MEDIA_DEBUG_LOG("ReleasePhotoBuffer sequence:%{public}d", sequence);
+    auto& bufferPool = CameraSurfaceBufferPool::GetInstance();
+    bufferPool.Release(static_cast<uint32_t>(sequence), reinterpret_cast<uintptr_t>(this));
+#ifdef MEMMGR_OVERRID
+    // Low on memory, the released buffer is not kept for the next photo.
+    CHECK_EXECUTE(Memory::MemMgrClient::GetInstance().GetAvailableMemory() < LOW_AVAILABLE_MEMORY_KB,
+        bufferPool.TrimIdle());
+#endif
+    return CAMERA_OK;
+}
+
 int32_t HStreamCapture::EnableOriginalImage(bool enabled)
 {
     MEDIA_INFO_LOG("EnableOriginalImage: %{public}d", enabled);
@@ -1281,6 +1298,7 @@ int32_t HStreamCapture::ReleaseStream(bool isDelay)
     }
     MediaLibraryManagerProxy::FreeMediaLibraryDynamiclibDelayed();
 #endif
+    CameraSurfaceBufferPool::GetInstance().ForgetOwner(reinterpret_cast<uintptr_t>(this));
     int32_t errorCode = HStreamCommon::ReleaseStream(isDelay);
     auto hStreamOperatorSptr_ = hStreamOperator_.promote();
     bool isSwitchToOfflinePhoto = hStreamOperatorSptr_ && mSwitchToOfflinePhoto_;
@@ -1684,6 +1702,8 @@ int32_t HStreamCapture::OnPhotoAvailable(sptr<SurfaceBuffer> surfaceBuffer, cons
     std::lock_guard<std::mutex> lock(photoCallbackLock_);
     auto photoAvaiableCallback = photoAvaiableCallback_.Get();
     if (photoAvaiableCallback != nullptr) {
+        // The client hands the buffer back through ReleasePhotoBuffer once the app released the image.
+        CameraSurfaceBufferPool::GetInstance().Track(surfaceBuffer, reinterpret_cast<uintptr_t>(this));
         photoAvaiableCallback->OnPhotoAvailable(surfaceBuffer, timestamp, isRaw);
     }
     return CAMERA_OK;
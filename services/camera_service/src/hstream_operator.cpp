@@ -47,7 +47,6 @@
 #include "display_lite.h"
 #include "display_manager_lite.h"
 #include "errors.h"
-#include "fixed_size_list.h"
 #include "hcamera_device_manager.h"
 #include "hcamera_restore_param.h"
 #include "hstream_capture.h"
@@ -788,6 +787,8 @@ int32_t HStreamOperator::LinkInputAndOutputs(const std::shared_ptr<OHOS::Camera:
             }
         });
     }
+    // The HDI ids were assigned above, index the streams by them before the first result arrives.
+    streamContainer_.Reindex();
 
     rc = CreateAndCommitStreams(allStreamInfos, settings, opMode);
     MEDIA_INFO_LOG("HStreamOperator::LinkInputAndOutputs execute success");
@@ -1005,8 +1006,8 @@ sptr<HStreamRepeat> HStreamOperator::FindPreviewStreamRepeat()
 
 const sptr<HStreamCommon> HStreamOperator::GetStreamByStreamID(int32_t streamId)
 {
-    auto stream = streamContainer_.GetStream(streamId) != nullptr ? streamContainer_.GetStream(streamId) :
-        streamContainerOffline_.GetStream(streamId);
+    auto stream = streamContainer_.GetStream(streamId);
+    CHECK_EXECUTE(stream == nullptr, stream = streamContainerOffline_.GetStream(streamId));
 
     CHECK_PRINT_ELOG(
         stream == nullptr, "HStreamOperator::GetStreamByStreamID get stream fail, streamId is:%{public}d", streamId);
@@ -1015,8 +1016,8 @@ const sptr<HStreamCommon> HStreamOperator::GetStreamByStreamID(int32_t streamId)
 
 const sptr<HStreamCommon> HStreamOperator::GetHdiStreamByStreamID(int32_t streamId)
 {
-    auto stream = streamContainer_.GetHdiStream(streamId) != nullptr ? streamContainer_.GetHdiStream(streamId) :
-        streamContainerOffline_.GetHdiStream(streamId);
+    auto stream = streamContainer_.GetHdiStream(streamId);
+    CHECK_EXECUTE(stream == nullptr, stream = streamContainerOffline_.GetHdiStream(streamId));
     CHECK_PRINT_DLOG(
         stream == nullptr, "HStreamOperator::GetHdiStreamByStreamID get stream fail, streamId is:%{public}d", streamId);
     return stream;
@@ -2557,11 +2558,13 @@ std::vector<int32_t> HStreamOperator::GetFrameRateRange()
 bool StreamContainer::AddStream(sptr<HStreamCommon> stream)
 {
     // LCOV_EXCL_START
+    CHECK_RETURN_RET(stream == nullptr, false);
     std::lock_guard<std::mutex> lock(streamsLock_);
     auto& list = streams_[stream->GetStreamType()];
     auto it = std::find_if(list.begin(), list.end(), [stream](auto item) { return item == stream; });
     if (it == list.end()) {
         list.emplace_back(stream);
+        PublishUnlocked();
         return true;
     }
     return false;
@@ -2571,23 +2574,63 @@ bool StreamContainer::AddStream(sptr<HStreamCommon> stream)
 bool StreamContainer::RemoveStream(sptr<HStreamCommon> stream)
 {
     // LCOV_EXCL_START
+    CHECK_RETURN_RET(stream == nullptr, false);
     std::lock_guard<std::mutex> lock(streamsLock_);
     auto& list = streams_[stream->GetStreamType()];
     auto it = std::find_if(list.begin(), list.end(), [stream](auto item) { return item == stream; });
     CHECK_RETURN_RET(it == list.end(), false);
     list.erase(it);
+    PublishUnlocked();
     return true;
     // LCOV_EXCL_STOP
 }
 
-sptr<HStreamCommon> StreamContainer::GetStream(int32_t streamId)
+void StreamContainer::Reindex()
 {
     std::lock_guard<std::mutex> lock(streamsLock_);
+    PublishUnlocked();
+}
+
+void StreamContainer::PublishUnlocked()
+{
+    auto snapshot = std::make_shared<Snapshot>();
+    auto orderByFwkId = [](const sptr<HStreamCommon>& left, const sptr<HStreamCommon>& right) {
+        return left->GetFwkStreamId() < right->GetFwkStreamId();
+    };
     for (auto& pair : streams_) {
-        // LCOV_EXCL_START
-        for (auto& stream : pair.second) {
-            CHECK_RETURN_RET(stream->GetFwkStreamId() == streamId, stream);
+        auto& typedStreams = snapshot->typedStreams[pair.first];
+        typedStreams.reserve(pair.second.size());
+        // Streams sharing an id keep the order the former insertion sort gave them, the latest added first.
+        for (auto it = pair.second.rbegin(); it != pair.second.rend(); ++it) {
+            CHECK_CONTINUE(*it == nullptr);
+            typedStreams.emplace_back(*it);
+            snapshot->fwkIndex.emplace((*it)->GetFwkStreamId(), *it);
+            snapshot->hdiIndex.emplace((*it)->GetHdiStreamId(), *it);
+        }
+        std::stable_sort(typedStreams.begin(), typedStreams.end(), orderByFwkId);
+    }
+    for (auto it = streams_.rbegin(); it != streams_.rend(); ++it) {
+        for (auto streamIt = it->second.rbegin(); streamIt != it->second.rend(); ++streamIt) {
+            CHECK_EXECUTE(*streamIt != nullptr, snapshot->allStreams.emplace_back(*streamIt));
         }
+    }
+    std::stable_sort(snapshot->allStreams.begin(), snapshot->allStreams.end(), orderByFwkId);
+    std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>(std::move(snapshot)));
+}
+
+std::shared_ptr<const StreamContainer::Snapshot> StreamContainer::GetSnapshot() const
+{
+    return std::atomic_load(&snapshot_);
+}
+
+sptr<HStreamCommon> StreamContainer::GetStream(int32_t streamId)
+{
+    auto snapshot = GetSnapshot();
+    auto it = snapshot->fwkIndex.find(streamId);
+    CHECK_RETURN_RET(it != snapshot->fwkIndex.end() && it->second->GetFwkStreamId() == streamId, it->second);
+    for (auto& stream : snapshot->allStreams) {
+        // LCOV_EXCL_START
+        CHECK_RETURN_RET(stream->GetFwkStreamId() == streamId, stream);
         // LCOV_EXCL_STOP
     }
     return nullptr;
@@ -2595,11 +2638,11 @@ sptr<HStreamCommon> StreamContainer::GetStream(int32_t streamId)
 
 sptr<HStreamCommon> StreamContainer::GetHdiStream(int32_t streamId)
 {
-    std::lock_guard<std::mutex> lock(streamsLock_);
-    for (auto& pair : streams_) {
-        for (auto& stream : pair.second) {
-            CHECK_RETURN_RET(stream->GetHdiStreamId() == streamId, stream);
-        }
+    auto snapshot = GetSnapshot();
+    auto it = snapshot->hdiIndex.find(streamId);
+    CHECK_RETURN_RET(it != snapshot->hdiIndex.end() && it->second->GetHdiStreamId() == streamId, it->second);
+    for (auto& stream : snapshot->allStreams) {
+        CHECK_RETURN_RET(stream->GetHdiStreamId() == streamId, stream);
     }
     return nullptr;
 }
@@ -2609,57 +2652,29 @@ void StreamContainer::Clear()
     // LCOV_EXCL_START
     std::lock_guard<std::mutex> lock(streamsLock_);
     streams_.clear();
+    PublishUnlocked();
     // LCOV_EXCL_STOP
 }
 
 size_t StreamContainer::Size()
 {
     // LCOV_EXCL_START
-    std::lock_guard<std::mutex> lock(streamsLock_);
-    size_t totalSize = 0;
-    for (auto& pair : streams_) {
-        totalSize += pair.second.size();
-    }
-    return totalSize;
+    return GetSnapshot()->allStreams.size();
     // LCOV_EXCL_STOP
 }
 
 std::list<sptr<HStreamCommon>> StreamContainer::GetStreams(const StreamType streamType)
 {
-    std::lock_guard<std::mutex> lock(streamsLock_);
-    std::list<sptr<HStreamCommon>> totalOrderedStreams;
-    for (auto& stream : streams_[streamType]) {
-        // LCOV_EXCL_START
-        if (!stream) {
-            MEDIA_WARNING_LOG("stream is nullptr!, skip");
-            continue;
-        }
-        auto insertPos = std::find_if(totalOrderedStreams.begin(), totalOrderedStreams.end(),
-            [&stream](auto& it) { return stream->GetFwkStreamId() <= it->GetFwkStreamId(); });
-        totalOrderedStreams.emplace(insertPos, stream);
-        // LCOV_EXCL_STOP
-    }
-    return totalOrderedStreams;
+    auto snapshot = GetSnapshot();
+    auto it = snapshot->typedStreams.find(streamType);
+    CHECK_RETURN_RET(it == snapshot->typedStreams.end(), std::list<sptr<HStreamCommon>>());
+    return std::list<sptr<HStreamCommon>>(it->second.begin(), it->second.end());
 }
 
 std::list<sptr<HStreamCommon>> StreamContainer::GetAllStreams()
 {
-    std::lock_guard<std::mutex> lock(streamsLock_);
-    std::list<sptr<HStreamCommon>> totalOrderedStreams;
-    for (auto& pair : streams_) {
-        for (auto& stream : pair.second) {
-            // LCOV_EXCL_START
-            if (!stream) {
-                MEDIA_WARNING_LOG("stream is nullptr!, skip");
-                continue;
-            }
-            auto insertPos = std::find_if(totalOrderedStreams.begin(), totalOrderedStreams.end(),
-                [&stream](auto& it) { return stream->GetFwkStreamId() <= it->GetFwkStreamId(); });
-            totalOrderedStreams.emplace(insertPos, stream);
-            // LCOV_EXCL_STOP
-        }
-    }
-    return totalOrderedStreams;
+    auto snapshot = GetSnapshot();
+    return std::list<sptr<HStreamCommon>>(snapshot->allStreams.begin(), snapshot->allStreams.end());
 }
 
 void HStreamOperator::SetMechCallback(std::function<void(int32_t,
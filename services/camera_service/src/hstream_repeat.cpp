@@ -26,6 +26,7 @@
 #include "camera_device_ability_items.h"
 #include "camera_log.h"
 #include "camera_metadata.h"
+#include "camera_metadata_overlay.h"
 #include "camera_metadata_operator.h"
 #include "display_manager_lite.h"
 #include "display/graphic/common/v2_1/cm_color_space.h"
@@ -540,19 +541,18 @@ int32_t HStreamRepeat::Start(std::shared_ptr<OHOS::Camera::CameraMetadata> setti
     UpdateSketchStatus(SketchStatus::STARTING);
     SetFrameRate(settings);
 
-    std::vector<uint8_t> ability;
+    // The ability stays shared, the stream start tags are collected in the overlay delta.
+    std::shared_ptr<OHOS::Camera::CameraMetadata> ability = nullptr;
     {
         std::lock_guard<std::mutex> lock(cameraAbilityLock_);
-        OHOS::Camera::MetadataUtils::ConvertMetadataToVec(cameraAbility_, ability);
-    }
-    std::shared_ptr<OHOS::Camera::CameraMetadata> dynamicSetting = nullptr;
-    OHOS::Camera::MetadataUtils::ConvertVecToMetadata(ability, dynamicSetting);
-    if (dynamicSetting == nullptr) {
-        dynamicSetting = std::make_shared<OHOS::Camera::CameraMetadata>(0, 0);
+        ability = cameraAbility_;
     }
+    CameraMetadataOverlay overlay(ability);
+    std::shared_ptr<OHOS::Camera::CameraMetadata>& dynamicSetting = overlay.GetDelta();
     // open video dfx switch for hal, no need close
     if (repeatStreamType_ == RepeatStreamType::PREVIEW) {
-        OpenVideoDfxSwitch(dynamicSetting);
+        std::lock_guard<std::mutex> lock(cameraAbilityLock_);
+        CHECK_EXECUTE(!overlay.IsInBase(OHOS_CONTROL_VIDEO_DEBUG_SWITCH), OpenVideoDfxSwitch(dynamicSetting));
     }
     bool isNeedUpdateVideoSetting = repeatStreamType_ == RepeatStreamType::VIDEO
 #ifdef CAMERA_FRAMEWORK_FEATURE_MEDIA_STREAM
@@ -591,8 +591,13 @@ int32_t HStreamRepeat::Start(std::shared_ptr<OHOS::Camera::CameraMetadata> setti
 #endif
     bool isLive = IsLive();
     CHECK_EXECUTE(isLive, UpdateLiveSettings(dynamicSetting));
+    std::shared_ptr<OHOS::Camera::CameraMetadata> captureMetadata = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(cameraAbilityLock_);
+        captureMetadata = overlay.Merge();
+    }
     std::vector<uint8_t> captureSetting;
-    OHOS::Camera::MetadataUtils::ConvertMetadataToVec(dynamicSetting, captureSetting);
+    OHOS::Camera::MetadataUtils::ConvertMetadataToVec(captureMetadata, captureSetting);
 
     CaptureInfo captureInfo;
     captureInfo.streamIds_ = { GetHdiStreamId() };
@@ -607,7 +612,7 @@ int32_t HStreamRepeat::Start(std::shared_ptr<OHOS::Camera::CameraMetadata> setti
     int32_t ret = 0;
     {
         std::lock_guard<std::mutex> startStopLock(streamStartStopLock_);
-        HStreamCommon::PrintCaptureDebugLog(dynamicSetting);
+        HStreamCommon::PrintCaptureDebugLog(captureMetadata);
         CamRetCode rc = (CamRetCode)(streamOperator->Capture(preparedCaptureId, captureInfo, true));
         if (rc != HDI::Camera::V1_0::NO_ERROR) {
             ResetCaptureId();
@@ -931,23 +936,17 @@ int32_t HStreamRepeat::RemoveSketchStreamRepeat()
 int32_t HStreamRepeat::SetFrameRate(int32_t minFrameRate, int32_t maxFrameRate)
 {
     streamFrameRateRange_ = {minFrameRate, maxFrameRate};
-    std::vector<uint8_t> ability;
     std::vector<uint8_t> repeatSettings;
     CHECK_RETURN_RET_ELOG(cameraAbility_ == nullptr, CAMERA_OK, "HStreamRepeat::SetFrameRate cameraAbility_ is null");
     {
         std::lock_guard<std::mutex> lock(cameraAbilityLock_);
-        OHOS::Camera::MetadataUtils::ConvertMetadataToVec(cameraAbility_, ability);
-        std::shared_ptr<OHOS::Camera::CameraMetadata> dynamicSetting = nullptr;
-        OHOS::Camera::MetadataUtils::ConvertVecToMetadata(ability, dynamicSetting);
-        if (dynamicSetting == nullptr) {
-            dynamicSetting = std::make_shared<OHOS::Camera::CameraMetadata>(0, 0);
-        }
-        CHECK_RETURN_RET_ELOG(
-            dynamicSetting == nullptr, CAMERA_INVALID_ARG, "HStreamRepeat::SetFrameRate dynamicSetting is nullptr.");
+        CameraMetadataOverlay overlay(cameraAbility_);
+        CHECK_RETURN_RET_ELOG(overlay.GetDelta() == nullptr, CAMERA_INVALID_ARG,
+            "HStreamRepeat::SetFrameRate dynamicSetting is nullptr.");
         bool status = AddOrUpdateMetadata(
-            dynamicSetting, OHOS_CONTROL_FPS_RANGES, streamFrameRateRange_.data(), streamFrameRateRange_.size());
+            overlay.GetDelta(), OHOS_CONTROL_FPS_RANGES, streamFrameRateRange_.data(), streamFrameRateRange_.size());
         CHECK_PRINT_ELOG(!status, "HStreamRepeat::SetFrameRate Failed to set frame range");
-        OHOS::Camera::MetadataUtils::ConvertMetadataToVec(dynamicSetting, repeatSettings);
+        overlay.Flatten(repeatSettings);
     }
     auto streamOperator = GetStreamOperator();
 
@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "binary_cache_converter.h"
+
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "json_cache_converter.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+constexpr uint32_t BINARY_CACHE_MAGIC = 0x43525043; // "CPRC"
+constexpr uint32_t BINARY_CACHE_VERSION = 1;
+constexpr int32_t BINARY_CACHE_FILE_MODE = 0660;
+constexpr uint32_t CRC_POLYNOMIAL = 0xEDB88320;
+constexpr uint32_t CRC_TABLE_SIZE = 256;
+constexpr uint32_t BITS_PER_BYTE = 8;
+const std::string TEMP_FILE_SUFFIX = ".tmp";
+
+struct FileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordCount;
+    uint16_t clientNameSize;
+    uint16_t cameraIdSize;
+};
+
+// Precedes every record, crc covers the size bytes that follow the header.
+struct RecordHeader {
+    uint32_t size;
+    uint32_t crc;
+};
+
+struct ParamRecord {
+    int64_t closeTimeSec;
+    int64_t closeTimeUsec;
+    int32_t restoreParamType;
+    int32_t startActiveTime;
+    int32_t opMode;
+    int32_t foldStatus;
+    uint32_t streamCount;
+    uint32_t settingsSize;
+    uint16_t outerKeySize;
+    uint16_t innerKeySize;
+    uint16_t clientNameSize;
+    uint16_t cameraIdSize;
+    uint8_t type;
+    uint8_t reserved[7];
+};
+
+struct StreamRecord {
+    int32_t streamId;
+    int32_t width;
+    int32_t height;
+    int32_t format;
+    int32_t dataspace;
+    int32_t intent;
+    int32_t minFrameDuration;
+    int32_t encodeType;
+    uint32_t extendedCount;
+    uint8_t tunneledMode;
+    uint8_t hasBufferQueue;
+    uint8_t reserved[2];
+};
+
+struct ExtendedRecord {
+    int32_t type;
+    int32_t width;
+    int32_t height;
+    int32_t format;
+    int32_t dataspace;
+    uint8_t hasBufferQueue;
+    uint8_t reserved[3];
+};
+
+// The layout is the file format, a change here needs a new BINARY_CACHE_VERSION.
+static_assert(sizeof(FileHeader) == 16, "FileHeader layout changed");
+static_assert(sizeof(RecordHeader) == 8, "RecordHeader layout changed");
+static_assert(sizeof(ParamRecord) == 56, "ParamRecord layout changed");
+static_assert(sizeof(StreamRecord) == 40, "StreamRecord layout changed");
+static_assert(sizeof(ExtendedRecord) == 24, "ExtendedRecord layout changed");
+
+uint32_t Crc32(const uint8_t* data, size_t size)
+{
+    static const std::array<uint32_t, CRC_TABLE_SIZE> table = [] {
+        std::array<uint32_t, CRC_TABLE_SIZE> crcTable {};
+        for (uint32_t i = 0; i < CRC_TABLE_SIZE; i++) {
+            uint32_t crc = i;
+            for (uint32_t bit = 0; bit < BITS_PER_BYTE; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC_POLYNOMIAL : crc >> 1;
+            }
+            crcTable[i] = crc;
+        }
+        return crcTable;
+    }();
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> BITS_PER_BYTE);
+    }
+    return ~crc;
+}
+
+template<typename T>
+void Append(std::vector<uint8_t>& bytes, const T& value)
+{
+    const auto* begin = reinterpret_cast<const uint8_t*>(&value);
+    bytes.insert(bytes.end(), begin, begin + sizeof(T));
+}
+
+void AppendString(std::vector<uint8_t>& bytes, const std::string& value)
+{
+    bytes.insert(bytes.end(), value.begin(), value.end());
+}
+
+template<typename T>
+bool Read(const uint8_t* data, size_t size, size_t& pos, T& value)
+{
+    CHECK_RETURN_RET(size < pos || size - pos < sizeof(T), false);
+    std::memcpy(&value, data + pos, sizeof(T));
+    pos += sizeof(T);
+    return true;
+}
+
+bool ReadString(const uint8_t* data, size_t size, size_t& pos, size_t length, std::string& value)
+{
+    CHECK_RETURN_RET(size < pos || size - pos < length, false);
+    value.assign(reinterpret_cast<const char*>(data + pos), length);
+    pos += length;
+    return true;
+}
+
+uint16_t GetStringSize(const std::string& value)
+{
+    return static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+}
+} // namespace
+
+bool BinaryCacheConverter::LoadOrMigrate(const std::string& binaryFilePath, const std::string& jsonFilePath,
+    PersistentParamMap& pMap, TransientParamMap& tMap, std::string& clientName, std::string& cameraId)
+{
+    std::error_code ec;
+    bool hasJsonFile = std::filesystem::exists(jsonFilePath, ec);
+    if (ParseBinaryFileToMap(binaryFilePath, pMap, tMap, clientName, cameraId)) {
+        CHECK_EXECUTE(hasJsonFile, std::filesystem::remove(jsonFilePath, ec));
+        return true;
+    }
+    CHECK_RETURN_RET(!hasJsonFile, false);
+    MEDIA_INFO_LOG("BinaryCacheConverter::LoadOrMigrate migrate json cache");
+    if (!JsonCacheConverter::ParseJsonFileToMap(jsonFilePath, pMap, tMap, clientName, cameraId)) {
+        // An unreadable json cache is dropped, it would fail the same way on every boot.
+        std::filesystem::remove(jsonFilePath, ec);
+        return false;
+    }
+    // The json cache is only removed once its binary copy is on disk, a failed save retries on the next boot.
+    CHECK_RETURN_RET_ELOG(!SaveMapToBinaryFile(binaryFilePath, pMap, tMap, clientName, cameraId), true,
+        "BinaryCacheConverter::LoadOrMigrate save binary cache failed, keep json cache");
+    std::filesystem::remove(jsonFilePath, ec);
+    return true;
+}
+
+bool BinaryCacheConverter::ParseBinaryFileToMap(const std::string& binaryFilePath, PersistentParamMap& pMap,
+    TransientParamMap& tMap, std::string& clientName, std::string& cameraId)
+{
+    MEDIA_DEBUG_LOG("BinaryCacheConverter::ParseBinaryFileToMap Begin!");
+    Clear();
+    int fd = open(binaryFilePath.c_str(), O_RDONLY | O_CLOEXEC);
+    CHECK_RETURN_RET_DLOG(fd < 0, false, "no binary cache, errno: %{public}d", errno);
+    struct stat fileStat = {};
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        MEDIA_ERR_LOG("invalid binary cache size");
+        close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    CHECK_RETURN_RET_ELOG(addr == MAP_FAILED, false, "mmap binary cache failed, errno: %{public}d", errno);
+    PersistentParamMap tempPmap;
+    TransientParamMap tempTmap;
+    std::string tempClientName;
+    std::string tempCameraId;
+    bool isParseSucc = ParseBinary(static_cast<const uint8_t*>(addr), size, tempPmap, tempTmap,
+        tempClientName, tempCameraId);
+    munmap(addr, size);
+    if (!isParseSucc) {
+        MEDIA_ERR_LOG("Failed to parse binary cache");
+        Clear();
+        return false;
+    }
+    pMap = std::move(tempPmap);
+    tMap = std::move(tempTmap);
+    clientName = tempClientName;
+    cameraId = tempCameraId;
+    savedClientName_ = std::move(tempClientName);
+    savedCameraId_ = std::move(tempCameraId);
+    isFileSynced_ = true;
+    return true;
+}
+
+bool BinaryCacheConverter::ParseBinary(const uint8_t* data, size_t size, PersistentParamMap& pMap,
+    TransientParamMap& tMap, std::string& clientName, std::string& cameraId)
+{
+    size_t pos = 0;
+    FileHeader header;
+    CHECK_RETURN_RET(!Read(data, size, pos, header), false);
+    CHECK_RETURN_RET_ELOG(header.magic != BINARY_CACHE_MAGIC || header.version != BINARY_CACHE_VERSION, false,
+        "binary cache version mismatch, version: %{public}u", header.version);
+    CHECK_RETURN_RET(!ReadString(data, size, pos, header.clientNameSize, clientName), false);
+    CHECK_RETURN_RET(!ReadString(data, size, pos, header.cameraIdSize, cameraId), false);
+    for (uint32_t i = 0; i < header.recordCount; i++) {
+        RecordHeader recordHeader;
+        CHECK_RETURN_RET(!Read(data, size, pos, recordHeader), false);
+        CHECK_RETURN_RET(size - pos < recordHeader.size, false);
+        const uint8_t* body = data + pos;
+        CHECK_RETURN_RET_ELOG(Crc32(body, recordHeader.size) != recordHeader.crc, false,
+            "binary cache record %{public}u corrupted", i);
+        RecordKey key;
+        sptr<HCameraRestoreParam> param = nullptr;
+        CHECK_RETURN_RET(!ParseRecord(body, recordHeader.size, key, param), false);
+        auto& [type, outerKey, innerKey] = key;
+        CHECK_EXECUTE(type == RecordType::PERSISTENT, pMap[outerKey][innerKey] = param);
+        CHECK_EXECUTE(type == RecordType::TRANSIENT, tMap[outerKey] = param);
+        // The mapped bytes are the encoding of the parameter just parsed, a later save reuses them as they are.
+        records_[key] = { param, param->GetGeneration(),
+            std::vector<uint8_t>(body - sizeof(RecordHeader), body + recordHeader.size) };
+        pos += recordHeader.size;
+    }
+    return true;
+}
+
+bool BinaryCacheConverter::ParseRecord(const uint8_t* data, size_t size, RecordKey& key,
+    sptr<HCameraRestoreParam>& param)
+{
+    size_t pos = 0;
+    ParamRecord record;
+    CHECK_RETURN_RET(!Read(data, size, pos, record), false);
+    CHECK_RETURN_RET_ELOG(record.type != static_cast<uint8_t>(RecordType::PERSISTENT) &&
+        record.type != static_cast<uint8_t>(RecordType::TRANSIENT), false, "illegal record type");
+    CHECK_RETURN_RET_ELOG(record.restoreParamType < RestoreParamTypeOhos::NO_NEED_RESTORE_PARAM_OHOS ||
+        record.restoreParamType > ENUM_LIMIT, false, "illegal value of restoreParamType");
+    auto& [type, outerKey, innerKey] = key;
+    type = static_cast<RecordType>(record.type);
+    std::string clientName;
+    std::string cameraId;
+    CHECK_RETURN_RET(!ReadString(data, size, pos, record.outerKeySize, outerKey) ||
+        !ReadString(data, size, pos, record.innerKeySize, innerKey) ||
+        !ReadString(data, size, pos, record.clientNameSize, clientName) ||
+        !ReadString(data, size, pos, record.cameraIdSize, cameraId), false);
+
+    std::vector<StreamInfo_V1_1> streamInfos;
+    CHECK_RETURN_RET(!ParseStreamInfos(data, size, pos, record.streamCount, streamInfos), false);
+    CHECK_RETURN_RET(size - pos != record.settingsSize, false);
+    std::shared_ptr<OHOS::Camera::CameraMetadata> settings = nullptr;
+    if (record.settingsSize > 0) {
+        std::vector<uint8_t> metadataBytes(data + pos, data + size);
+        OHOS::Camera::MetadataUtils::ConvertVecToMetadata(metadataBytes, settings);
+        CHECK_RETURN_RET_ELOG(settings == nullptr, false, "Failed to convert vec to settings.");
+    }
+
+    param = new HCameraRestoreParam(clientName, cameraId);
+    param->SetStreamInfo(streamInfos);
+    param->SetSetting(settings);
+    param->SetCloseCameraTime({ static_cast<time_t>(record.closeTimeSec),
+        static_cast<suseconds_t>(record.closeTimeUsec) });
+    param->SetRestoreParamType(static_cast<RestoreParamTypeOhos>(record.restoreParamType));
+    param->SetStartActiveTime(record.startActiveTime);
+    param->SetCameraOpMode(record.opMode);
+    param->SetFoldStatus(record.foldStatus);
+    return true;
+}
+
+bool BinaryCacheConverter::ParseStreamInfos(const uint8_t* data, size_t size, size_t& pos, uint32_t streamCount,
+    std::vector<StreamInfo_V1_1>& streamInfos)
+{
+    for (uint32_t i = 0; i < streamCount; i++) {
+        StreamRecord stream;
+        CHECK_RETURN_RET(!Read(data, size, pos, stream), false);
+        CHECK_RETURN_RET_ELOG(stream.intent < PREVIEW || stream.intent > ENUM_LIMIT ||
+            stream.encodeType < ENCODE_TYPE_NULL || stream.encodeType > ENUM_LIMIT, false,
+            "illegal value of stream record");
+        StreamInfo_V1_1 streamInfo;
+        auto& v1_0 = streamInfo.v1_0;
+        v1_0.streamId_ = stream.streamId;
+        v1_0.width_ = stream.width;
+        v1_0.height_ = stream.height;
+        v1_0.format_ = stream.format;
+        v1_0.dataspace_ = stream.dataspace;
+        v1_0.intent_ = static_cast<HDI::Camera::V1_0::StreamIntent>(stream.intent);
+        v1_0.tunneledMode_ = stream.tunneledMode != 0;
+        v1_0.minFrameDuration_ = stream.minFrameDuration;
+        v1_0.encodeType_ = static_cast<HDI::Camera::V1_0::EncodeType>(stream.encodeType);
+        CHECK_RETURN_RET(stream.hasBufferQueue && !JsonCacheConverter::CreateProducerForPrelaunch(v1_0), false);
+        for (uint32_t j = 0; j < stream.extendedCount; j++) {
+            ExtendedRecord extended;
+            CHECK_RETURN_RET(!Read(data, size, pos, extended), false);
+            CHECK_RETURN_RET_ELOG(extended.type < HDI::Camera::V1_1::EXTENDED_STREAM_INFO_QUICK_THUMBNAIL ||
+                extended.type > ENUM_LIMIT, false, "illegal value of extended record");
+            HDI::Camera::V1_1::ExtendedStreamInfo extendedInfo;
+            extendedInfo.type = static_cast<HDI::Camera::V1_1::ExtendedStreamInfoType>(extended.type);
+            extendedInfo.width = extended.width;
+            extendedInfo.height = extended.height;
+            extendedInfo.format = extended.format;
+            extendedInfo.dataspace = extended.dataspace;
+            CHECK_RETURN_RET(extended.hasBufferQueue &&
+                !JsonCacheConverter::CreateProducerForPrelaunch(extendedInfo), false);
+            streamInfo.extendedStreamInfos.push_back(extendedInfo);
+        }
+        streamInfos.push_back(std::move(streamInfo));
+    }
+    return true;
+}
+
+bool BinaryCacheConverter::SaveMapToBinaryFile(const std::string& binaryFilePath, const PersistentParamMap& pMap,
+    const TransientParamMap& tMap, const std::string& clientName, const std::string& cameraId)
+{
+    MEDIA_DEBUG_LOG("BinaryCacheConverter::SaveMapToBinaryFile Begin!");
+    FileHeader header = { BINARY_CACHE_MAGIC, BINARY_CACHE_VERSION, 0, GetStringSize(clientName),
+        GetStringSize(cameraId) };
+    std::vector<uint8_t> content;
+    Append(content, header);
+    content.insert(content.end(), clientName.begin(), clientName.begin() + header.clientNameSize);
+    content.insert(content.end(), cameraId.begin(), cameraId.begin() + header.cameraIdSize);
+    std::map<RecordKey, CachedRecord> records;
+    bool isDirty = !isFileSynced_ || clientName != savedClientName_ || cameraId != savedCameraId_;
+    for (const auto& [outerKey, innerMap] : pMap) {
+        for (const auto& [innerKey, param] : innerMap) {
+            CHECK_EXECUTE(param != nullptr,
+                AppendRecord({ RecordType::PERSISTENT, outerKey, innerKey }, param, records, content, isDirty));
+        }
+    }
+    for (const auto& [key, param] : tMap) {
+        CHECK_EXECUTE(param != nullptr,
+            AppendRecord({ RecordType::TRANSIENT, key, "" }, param, records, content, isDirty));
+    }
+    // A removed record changes the file as well.
+    isDirty = isDirty || records.size() != records_.size();
+    records_ = std::move(records);
+    CHECK_RETURN_RET_DLOG(!isDirty, true, "binary cache unchanged");
+    header.recordCount = static_cast<uint32_t>(records_.size());
+    std::memcpy(content.data(), &header, sizeof(header));
+    isFileSynced_ = WriteFileAtomically(binaryFilePath, content);
+    savedClientName_ = clientName;
+    savedCameraId_ = cameraId;
+    return isFileSynced_;
+}
+
+void BinaryCacheConverter::AppendRecord(const RecordKey& key, const sptr<HCameraRestoreParam>& param,
+    std::map<RecordKey, CachedRecord>& records, std::vector<uint8_t>& content, bool& isDirty)
+{
+    uint32_t generation = param->GetGeneration();
+    auto it = records_.find(key);
+    if (it == records_.end() || it->second.param != param || it->second.generation != generation) {
+        CachedRecord record = { param, generation, {} };
+        EncodeRecord(key, param, record.bytes);
+        it = records_.insert_or_assign(key, std::move(record)).first;
+        isDirty = true;
+    }
+    content.insert(content.end(), it->second.bytes.begin(), it->second.bytes.end());
+    records.emplace(key, std::move(it->second));
+}
+
+void BinaryCacheConverter::EncodeRecord(const RecordKey& key, const sptr<HCameraRestoreParam>& param,
+    std::vector<uint8_t>& bytes)
+{
+    const auto& [type, outerKey, innerKey] = key;
+    std::string clientName = param->GetClientName();
+    std::string cameraId = param->GetCameraId();
+    std::vector<StreamInfo_V1_1> streamInfos = param->GetStreamInfo();
+    std::vector<uint8_t> metadataBytes;
+    auto settings = param->GetSetting();
+    bool hasSettings = settings != nullptr && OHOS::Camera::MetadataUtils::ConvertMetadataToVec(settings,
+        metadataBytes);
+    CHECK_EXECUTE(!hasSettings, metadataBytes.clear());
+    timeval closeCameraTime = param->GetCloseCameraTime();
+
+    ParamRecord record = {};
+    record.closeTimeSec = static_cast<int64_t>(closeCameraTime.tv_sec);
+    record.closeTimeUsec = static_cast<int64_t>(closeCameraTime.tv_usec);
+    record.restoreParamType = static_cast<int32_t>(param->GetRestoreParamType());
+    record.startActiveTime = param->GetStartActiveTime();
+    record.opMode = param->GetCameraOpMode();
+    record.foldStatus = param->GetFlodStatus();
+    record.streamCount = static_cast<uint32_t>(streamInfos.size());
+    record.settingsSize = static_cast<uint32_t>(metadataBytes.size());
+    record.outerKeySize = GetStringSize(outerKey);
+    record.innerKeySize = GetStringSize(innerKey);
+    record.clientNameSize = GetStringSize(clientName);
+    record.cameraIdSize = GetStringSize(cameraId);
+    record.type = static_cast<uint8_t>(type);
+
+    bytes.clear();
+    bytes.resize(sizeof(RecordHeader));
+    Append(bytes, record);
+    AppendString(bytes, outerKey.substr(0, record.outerKeySize));
+    AppendString(bytes, innerKey.substr(0, record.innerKeySize));
+    AppendString(bytes, clientName.substr(0, record.clientNameSize));
+    AppendString(bytes, cameraId.substr(0, record.cameraIdSize));
+    for (const auto& streamInfo : streamInfos) {
+        const auto& v1_0 = streamInfo.v1_0;
+        StreamRecord stream = {};
+        stream.streamId = v1_0.streamId_;
+        stream.width = v1_0.width_;
+        stream.height = v1_0.height_;
+        stream.format = v1_0.format_;
+        stream.dataspace = v1_0.dataspace_;
+        stream.intent = static_cast<int32_t>(v1_0.intent_);
+        stream.minFrameDuration = v1_0.minFrameDuration_;
+        stream.encodeType = static_cast<int32_t>(v1_0.encodeType_);
+        stream.extendedCount = static_cast<uint32_t>(streamInfo.extendedStreamInfos.size());
+        stream.tunneledMode = v1_0.tunneledMode_ ? 1 : 0;
+        stream.hasBufferQueue = v1_0.bufferQueue_ == nullptr ? 0 : 1;
+        Append(bytes, stream);
+        for (const auto& extendedInfo : streamInfo.extendedStreamInfos) {
+            ExtendedRecord extended = {};
+            extended.type = static_cast<int32_t>(extendedInfo.type);
+            extended.width = extendedInfo.width;
+            extended.height = extendedInfo.height;
+            extended.format = extendedInfo.format;
+            extended.dataspace = extendedInfo.dataspace;
+            extended.hasBufferQueue = extendedInfo.bufferQueue == nullptr ? 0 : 1;
+            Append(bytes, extended);
+        }
+    }
+    bytes.insert(bytes.end(), metadataBytes.begin(), metadataBytes.end());
+
+    RecordHeader recordHeader;
+    recordHeader.size = static_cast<uint32_t>(bytes.size() - sizeof(RecordHeader));
+    recordHeader.crc = Crc32(bytes.data() + sizeof(RecordHeader), recordHeader.size);
+    std::memcpy(bytes.data(), &recordHeader, sizeof(recordHeader));
+}
+
+bool BinaryCacheConverter::WriteFileAtomically(const std::string& filePath, const std::vector<uint8_t>& content)
+{
+    std::string tempFilePath = filePath + TEMP_FILE_SUFFIX;
+    int fd = open(tempFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, BINARY_CACHE_FILE_MODE);
+    CHECK_RETURN_RET_ELOG(fd < 0, false, "Failed to open binary cache, errno: %{public}d", errno);
+    size_t written = 0;
+    while (written < content.size()) {
+        ssize_t ret = write(fd, content.data() + written, content.size() - written);
+        CHECK_BREAK(ret <= 0 && errno != EINTR);
+        written += ret > 0 ? static_cast<size_t>(ret) : 0;
+    }
+    bool isWriteSucc = written == content.size() && fsync(fd) == 0;
+    close(fd);
+    // Readers see either the previous file or the complete new one, never a partial write.
+    if (!isWriteSucc || rename(tempFilePath.c_str(), filePath.c_str()) != 0) {
+        MEDIA_ERR_LOG("Failed to write binary cache, errno: %{public}d", errno);
+        unlink(tempFilePath.c_str());
+        return false;
+    }
+    return true;
+}
+
+void BinaryCacheConverter::Clear()
+{
+    records_.clear();
+    savedClientName_.clear();
+    savedCameraId_.clear();
+    isFileSynced_ = false;
+}
+} // namespace CameraStandard
+} // namespace OHOS
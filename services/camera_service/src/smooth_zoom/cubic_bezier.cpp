@@ -32,13 +32,13 @@ constexpr float DURATION_SLOP = 55.0;
 constexpr float DURATION_BASE = 450.0;
 constexpr float DURATION_POWER = 1.2;
 constexpr int MAX_ZOOM_ARRAY_SIZE = 100;
+constexpr size_t ZOOM_BEZIER_VALUE_COUNT = 5;
 }
 
-float CubicBezier::mControPointX1 = CONTROL_POINT_X1;
-float CubicBezier::mControPointX2 = CONTROL_POINT_X2;
-float CubicBezier::mControPointY1 = CONTROL_POINT_Y1;
-float CubicBezier::mControPointY2 = CONTROL_POINT_Y2;
-float CubicBezier::mDurationBase = DURATION_BASE;
+CubicBezier::CubicBezier()
+    : mControPointX1(CONTROL_POINT_X1), mControPointX2(CONTROL_POINT_X2), mControPointY1(CONTROL_POINT_Y1),
+      mControPointY2(CONTROL_POINT_Y2), mDurationBase(DURATION_BASE)
+{}
 
 std::vector<float> CubicBezier::GetZoomArray(const float& currentZoom, const float& targetZoom,
     const float& frameInterval)
@@ -60,7 +60,7 @@ std::vector<float> CubicBezier::GetZoomArray(const float& currentZoom, const flo
     return result;
 }
 
-float CubicBezier::GetDuration(const float& currentZoom, const float& targetZoom)
+float CubicBezier::GetDuration(const float& currentZoom, const float& targetZoom) const
 {
     CHECK_RETURN_RET(currentZoom == 0, 0);
     return (DURATION_SLOP * DURATION_POWER * abs(log(targetZoom / currentZoom)) + mDurationBase);
@@ -74,35 +74,50 @@ bool CubicBezier::SetBezierValue(const std::vector<float>& zoomBezierValue)
     const size_t CONTROL_POINT_X2_INDEX = 3;
     const size_t CONTROL_POINT_Y2_INDEX = 4;
 
+    CHECK_RETURN_RET_ELOG(zoomBezierValue.size() < ZOOM_BEZIER_VALUE_COUNT, false,
+        "CubicBezier::SetBezierValue invalid size:%{public}zu", zoomBezierValue.size());
+    bool isCurveChanged = mControPointX1 != zoomBezierValue[CONTROL_POINT_X1_INDEX] ||
+        mControPointX2 != zoomBezierValue[CONTROL_POINT_X2_INDEX];
     mDurationBase = zoomBezierValue[DURATION_BASE_INDEX];
     mControPointX1 = zoomBezierValue[CONTROL_POINT_X1_INDEX];
     mControPointY1 = zoomBezierValue[CONTROL_POINT_Y1_INDEX];
     mControPointX2 = zoomBezierValue[CONTROL_POINT_X2_INDEX];
     mControPointY2 = zoomBezierValue[CONTROL_POINT_Y2_INDEX];
+    CHECK_EXECUTE(isCurveChanged, mCubicBezierXTable.clear());
     return true;
 }
 
-float CubicBezier::GetCubicBezierY(const float& time)
+float CubicBezier::GetCubicBezierY(const float& time) const
 {
     return CUBIC_BEZIER_MULTIPLE * (1- time) * (1 - time) * time * mControPointY1 +
         CUBIC_BEZIER_MULTIPLE * (1- time) * time * time * mControPointY2 + time * time * time;
 }
 
-float CubicBezier::GetCubicBezierX(const float& time)
+float CubicBezier::GetCubicBezierX(const float& time) const
 {
     return CUBIC_BEZIER_MULTIPLE * (1- time) * (1 - time) * time * mControPointX1 +
         CUBIC_BEZIER_MULTIPLE * (1- time) * time * time * mControPointX2 + time * time * time;
 }
 
+void CubicBezier::BuildCubicBezierXTable()
+{
+    int resolution = static_cast<int>(MAX_RESOLUTION);
+    mCubicBezierXTable.resize(resolution + 1);
+    for (int i = 0; i <= resolution; i++) {
+        mCubicBezierXTable[i] = GetCubicBezierX(SERCH_STEP * i);
+    }
+}
+
 float CubicBezier::BinarySearch(const float& value)
 {
+    CHECK_EXECUTE(mCubicBezierXTable.empty(), BuildCubicBezierXTable());
     int low = 0;
     int high = MAX_RESOLUTION;
     int num = 0;
     while (low <= high) {
         num = num + 1;
         int middle = (low + high) / 2;
-        float approximation = GetCubicBezierX(SERCH_STEP * middle);
+        float approximation = mCubicBezierXTable[middle];
         if (approximation < value) {
             low = middle + 1;
         } else if (approximation > value) {
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026-2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "smooth_zoom_planner.h"
+
+#include "camera_log.h"
+#include "steady_clock.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace {
+// Upper bound on the age of a cached status, in case a change is not reported by the device.
+constexpr uint64_t ZOOM_STATUS_MAX_AGE_MS = 1000;
+}
+
+bool SmoothZoomPlanner::GetZoomStatus(const void* device, uint64_t generation, int32_t operationMode, float& fps,
+    std::vector<float>& crossZoomAndTime)
+{
+    std::lock_guard<std::mutex> lock(statusMutex_);
+    CHECK_RETURN_RET(!isStatusValid_ || statusDevice_ != device || statusGeneration_ != generation ||
+        statusOperationMode_ != operationMode, false);
+    CHECK_RETURN_RET_DLOG(DeferredProcessing::SteadyClock::GetElapsedTimeMs(statusTime_) > ZOOM_STATUS_MAX_AGE_MS,
+        false, "SmoothZoomPlanner::GetZoomStatus status expired");
+    fps = fps_;
+    crossZoomAndTime = crossZoomAndTime_;
+    return true;
+}
+
+void SmoothZoomPlanner::SetZoomStatus(const void* device, uint64_t generation, int32_t operationMode, float fps,
+    const std::vector<float>& crossZoomAndTime)
+{
+    std::lock_guard<std::mutex> lock(statusMutex_);
+    isStatusValid_ = true;
+    statusDevice_ = device;
+    statusGeneration_ = generation;
+    statusOperationMode_ = operationMode;
+    statusTime_ = DeferredProcessing::SteadyClock::GetTimestampMilli();
+    fps_ = fps;
+    crossZoomAndTime_ = crossZoomAndTime;
+}
+
+void SmoothZoomPlanner::Invalidate()
+{
+    std::lock_guard<std::mutex> lock(statusMutex_);
+    isStatusValid_ = false;
+    statusDevice_ = nullptr;
+    crossZoomAndTime_.clear();
+}
+
+bool SmoothZoomPlanner::GetZoomBezierValue(const std::shared_ptr<const void>& ability, bool& isFound,
+    std::vector<float>& zoomBezierValue)
+{
+    std::lock_guard<std::mutex> lock(statusMutex_);
+    // A released ability cannot be locked any more, so a new ability at the same address is read again.
+    CHECK_RETURN_RET(ability == nullptr || bezierAbility_.lock() != ability, false);
+    isFound = isBezierFound_;
+    zoomBezierValue = abilityBezierValue_;
+    return true;
+}
+
+void SmoothZoomPlanner::SetZoomBezierValue(const std::shared_ptr<const void>& ability, bool isFound,
+    const std::vector<float>& zoomBezierValue)
+{
+    std::lock_guard<std::mutex> lock(statusMutex_);
+    bezierAbility_ = ability;
+    isBezierFound_ = isFound;
+    abilityBezierValue_ = zoomBezierValue;
+}
+
+std::vector<float> SmoothZoomPlanner::GetZoomArray(SmoothZoomType type, const std::vector<float>& zoomBezierValue,
+    float currentZoom, float targetZoom, float frameInterval)
+{
+    std::lock_guard<std::mutex> lock(algorithmMutex_);
+    bool isTypeChanged = zoomAlgorithm_ == nullptr || zoomType_ != type;
+    if (isTypeChanged || zoomBezierValue_ != zoomBezierValue) {
+        if (isTypeChanged || zoomBezierValue.empty()) {
+            zoomAlgorithm_ = SmoothZoom::GetZoomAlgorithm(type);
+            zoomType_ = type;
+        }
+        CHECK_EXECUTE(!zoomBezierValue.empty(), zoomAlgorithm_->SetBezierValue(zoomBezierValue));
+        zoomBezierValue_ = zoomBezierValue;
+    }
+    return zoomAlgorithm_->GetZoomArray(currentZoom, targetZoom, frameInterval);
+}
+} // namespace CameraStandard
+} // namespace OHOS
@@ -17,6 +17,8 @@
 #define OHOS_CAMERA_DPS_SHARED_BUFFER_H
 
 #include <ashmem.h>
+#include <memory>
+#include <string>
 
 #include "ibuffer.h"
 
@@ -28,6 +30,9 @@ public:
     explicit SharedBuffer(int64_t capacity);
     ~SharedBuffer();
 
+    // Wraps a dup of an fd owned by someone else, the content is shared and not copied.
+    static std::unique_ptr<SharedBuffer> CreateFromFd(int fd, int64_t size);
+
     int32_t Initialize();
     int64_t GetSize() override;
     int32_t CopyFrom(uint8_t* address, int64_t bytes) override;
@@ -35,11 +40,22 @@ public:
     int GetFd() const override;
 
 private:
+    friend class SharedBufferPool;
+
+    // Pooled buffer lent for an image, the region goes back to SharedBufferPool on destruction. The first
+    // dirtyBytes of a reused region still hold an earlier image.
+    SharedBuffer(int64_t capacity, sptr<Ashmem> ashmem, int32_t userId, const std::string& imageId,
+        int64_t dirtyBytes);
+
     int32_t AllocateAshmemUnlocked();
     void DeallocAshmem();
 
     const int64_t capacity_;
     sptr<Ashmem> ashmem_ {nullptr};
+    bool isPooled_ {false};
+    int32_t userId_ {0};
+    std::string imageId_;
+    int64_t dirtyBytes_ {0};
 };
 } // namespace DeferredProcessing
 } // namespace CameraStandard
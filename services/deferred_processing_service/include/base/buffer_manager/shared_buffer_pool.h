@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_DPS_SHARED_BUFFER_POOL_H
+#define OHOS_CAMERA_DPS_SHARED_BUFFER_POOL_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "shared_buffer.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace DeferredProcessing {
+/**
+ * Keeps the mapped ashmem regions of released SharedBuffers, keyed by size class, so that draining
+ * a backlog of photos does not create, map, unmap and close a region per image. The fd of a result
+ * is handed to the client by a oneway call, so the region of an image is only reused after the
+ * client has released that image, regions the client never releases are closed by the trim timer.
+ */
+class SharedBufferPool {
+public:
+    static SharedBufferPool& GetInstance();
+
+    ~SharedBufferPool() = default;
+    SharedBufferPool(const SharedBufferPool&) = delete;
+    SharedBufferPool& operator=(const SharedBufferPool&) = delete;
+
+    // Returns an initialized buffer of at least the given size for the image, reusing a released region when one fits.
+    std::unique_ptr<SharedBuffer> Acquire(int64_t size, int32_t userId, const std::string& imageId);
+    // Called once the client is done with the result of the image, its regions may be written again.
+    void Release(int32_t userId, const std::string& imageId);
+    void Trim(bool force = false);
+
+    inline uint32_t GetOutstandingCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return outstandingCount_;
+    }
+
+    inline uint32_t GetCachedCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return static_cast<uint32_t>(freeRegions_.size());
+    }
+
+    inline uint32_t GetLentCount()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return static_cast<uint32_t>(lentImages_.size());
+    }
+
+private:
+    friend class SharedBuffer;
+
+    using ImageKey = std::pair<int32_t, std::string>;
+
+    struct FreeRegion {
+        sptr<Ashmem> ashmem;
+        uint64_t releaseTime;
+        int64_t dirtyBytes;
+    };
+
+    struct LentRegion {
+        int64_t capacity;
+        FreeRegion region;
+    };
+
+    struct LentImage {
+        uint32_t liveCount {0};
+        bool isReleased {false};
+        uint64_t lendTime {0};
+        std::vector<LentRegion> regions;
+    };
+
+    SharedBufferPool() = default;
+
+    // Called by a pooled SharedBuffer on destruction.
+    void Recycle(int32_t userId, const std::string& imageId, int64_t capacity, sptr<Ashmem> ashmem,
+        int64_t dirtyBytes);
+    void CacheRegionUnlocked(int64_t capacity, FreeRegion region);
+    void StartTrimTimerUnlocked();
+
+    std::mutex mutex_;
+    std::multimap<int64_t, FreeRegion> freeRegions_;
+    std::map<ImageKey, LentImage> lentImages_;
+    int64_t cachedBytes_ {0};
+    uint32_t outstandingCount_ {0};
+    uint32_t trimTimerId_ {0};
+};
+} // namespace DeferredProcessing
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_DPS_SHARED_BUFFER_POOL_H
@@ -130,18 +130,8 @@ public:
             "Invalid buffer handle for imageId: %{public}s", imageId.c_str());
 
         auto imageInfo = CreateFromMeta(bufferHandle->size, buffer.metadata);
-        auto dataSize = imageInfo->GetDataSize();
-        MappedMemory mapped(bufferHandle->fd, dataSize);
-        DP_CHECK_ERROR_RETURN_RET_LOG(!mapped, DPS_ERROR_IMAGE_PROC_FAILED,
-            "Memory mapping failed for imageId: %{public}s", imageId.c_str());
-
-        auto bufferPtr = std::make_unique<SharedBuffer>(dataSize);
-        DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr->Initialize() != DP_OK, DPS_ERROR_IMAGE_PROC_FAILED,
-            "Failed to initialize shared buffer for imageId: %{public}s", imageId.c_str());
-
-        auto ret = bufferPtr->CopyFrom(mapped.data(), dataSize);
-        DP_CHECK_ERROR_RETURN_RET_LOG(ret != DP_OK, DPS_ERROR_IMAGE_PROC_FAILED,
-            "Failed to copy buffer for imageId: %{public}s", imageId.c_str());
+        auto bufferPtr = CreateResultBuffer(imageId, bufferHandle->fd, imageInfo->GetDataSize());
+        DP_CHECK_RETURN_RET(bufferPtr == nullptr, DPS_ERROR_IMAGE_PROC_FAILED);
 
         DP_INFO_LOG("DPS_PHOTO: bufferHandle fd: %{public}d, bufferPtr fd: %{public}d",
             bufferHandle->fd, bufferPtr->GetFd());
@@ -151,6 +141,9 @@ public:
     }
 
 private:
+    // Result buffer for the client, handed through from the HDI fd when enabled, else copied into a pooled region.
+    std::unique_ptr<SharedBuffer> CreateResultBuffer(const std::string& imageId, int fd, int32_t dataSize);
+    std::unique_ptr<SharedBuffer> CopyToSharedBuffer(const std::string& imageId, uint8_t* data, int64_t size);
     int32_t JudgeBuffersType(
         const std::vector<HDI::Camera::V1_5::ImageBufferInfo_V1_4>& buffers, std::unique_ptr<ImageInfo>& imageInfo);
     int32_t JudgeBuffersTypeV7(const std::string& imageId,
@@ -195,6 +188,8 @@ private:
     }
 
     const int32_t userId_;
+    // Only for HALs that never reuse a result buffer once it is delivered.
+    const bool isBufferHandOffEnabled_;
 #ifdef CAMERA_CAPTURE_YUV
     std::string bundleName_;
 #endif
@@ -39,6 +39,7 @@ public:
     virtual void UpdatePriorityJob(JobPriority cur, JobPriority pre) = 0;
     virtual void UpdateJobSize() = 0;
     virtual void TryDoNextJob(const std::string& imageId, bool isTryDo) = 0;
+    virtual void UpdateJobState(const std::string& imageId, JobState state, JobPriority priority) = 0;
 };
 } // namespace DeferredProcessing
 } // namespace CameraStandard
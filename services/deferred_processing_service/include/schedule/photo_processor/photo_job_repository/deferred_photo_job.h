@@ -203,6 +203,7 @@ public:
 private:
     void UpdateTime();
     void RecordJobRunningPriority();
+    void NotifyJobState();
 
     const std::string imageId_;
     const PhotoJobType photoJobType_;
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OHOS_CAMERA_DPS_PHOTO_JOB_JOURNAL_H
+#define OHOS_CAMERA_DPS_PHOTO_JOB_JOURNAL_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "basic_definitions.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace DeferredProcessing {
+struct PhotoJobRecord {
+    std::string imageId;
+    PhotoJobType type {PhotoJobType::OFFLINE};
+    bool discardable {false};
+    std::string bundleName;
+    JobState state {JobState::PENDING};
+    JobPriority priority {JobPriority::NORMAL};
+    uint64_t sequence {0}; // Order in which the job was added.
+};
+
+/**
+ * Append-only journal of the photo job transitions, so a restarted DPS gets its backlog back with the
+ * priorities and states it had. Records are CRC checked and written into a shared mapping of the file,
+ * which the kernel keeps when the process dies, a torn record at the tail ends the replay. The mapping
+ * is synced to storage once per group of records, and the journal is rewritten with only the live jobs
+ * when it fills up or holds mostly dead records.
+ */
+class PhotoJobJournal {
+public:
+    explicit PhotoJobJournal(const std::string& path);
+    ~PhotoJobJournal();
+
+    // Maps the journal and replays it, jobs receives the live jobs in the order they were added.
+    int32_t Open(std::vector<PhotoJobRecord>& jobs);
+    void RecordAdd(const PhotoJobRecord& job);
+    void RecordState(const std::string& imageId, JobState state, JobPriority priority);
+    void RecordRemove(const std::string& imageId);
+    // Syncs what the pending group of records wrote, blocking until it is stored when sync is set.
+    void Flush(bool sync = false);
+
+    inline size_t GetLiveJobSize()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return liveJobs_.size();
+    }
+
+private:
+    enum class RecordType : uint8_t {
+        ADD = 1,
+        STATE,
+        REMOVE,
+    };
+
+    bool Map(const std::string& path, size_t capacity);
+    void Unmap();
+    void Replay(std::vector<std::pair<std::string, uint64_t>>& order);
+    bool ApplyRecord(RecordType type, const uint8_t* data, uint32_t size,
+        std::vector<std::pair<std::string, uint64_t>>& order);
+    bool Append(RecordType type, const std::vector<uint8_t>& payload);
+    bool WriteRecord(RecordType type, const std::vector<uint8_t>& payload);
+    bool Compact(size_t minCapacity);
+    void FlushUnlocked(bool sync);
+    void EncodeAdd(const PhotoJobRecord& job, std::vector<uint8_t>& payload);
+
+    std::mutex mutex_;
+    const std::string path_;
+    int32_t fd_ {-1};
+    uint8_t* base_ {nullptr};
+    size_t capacity_ {0};
+    size_t offset_ {0};
+    size_t syncedOffset_ {0};
+    uint32_t pendingRecords_ {0};
+    uint32_t recordCount_ {0};
+    uint64_t nextSequence_ {0};
+    std::unordered_map<std::string, PhotoJobRecord> liveJobs_ {};
+};
+} // namespace DeferredProcessing
+} // namespace CameraStandard
+} // namespace OHOS
+#endif // OHOS_CAMERA_DPS_PHOTO_JOB_JOURNAL_H
@@ -22,6 +22,7 @@
 #include "dps_metadata_info.h"
 #include "enable_shared_create.h"
 #include "istate_change_listener.h"
+#include "photo_job_journal.h"
 #include "photo_job_queue.h"
 #include "ideferred_photo_processing_session.h"
 
@@ -38,6 +39,7 @@ public:
     void UpdatePriorityJob(JobPriority cur, JobPriority pre) override;
     void UpdateJobSize() override;
     void TryDoNextJob(const std::string& imageId, bool isTryDo) override;
+    void UpdateJobState(const std::string& imageId, JobState state, JobPriority priority) override;
 
 private:
     std::weak_ptr<PhotoJobRepository> repository_;
@@ -48,6 +50,8 @@ public:
     ~PhotoJobRepository();
 
     int32_t Initialize() override;
+    // Replays the journal at journalPath into the repository and records every later job change there.
+    int32_t RestoreJobs(const std::string& journalPath);
     void AddDeferredJob(const std::string& imageId, bool discardable, DpsMetadata& metadata,
         const std::string& bundleName);
     void RemoveDeferredJob(const std::string& imageId, bool restorable);
@@ -73,6 +77,7 @@ public:
     void UpdateRunningJobUnLocked(const std::string& imageId, bool running);
     void UpdatePriorityNumUnLocked(JobPriority cur, JobPriority pre);
     void UpdateJobSizeUnLocked();
+    void UpdateJobStateUnLocked(const std::string& imageId, JobState state, JobPriority priority);
     void NotifyJobChanged(const std::string& imageId, bool isTryDo);
 
     inline int32_t GetUserId() const
@@ -85,12 +90,15 @@ protected:
 
 private:
     void ReportEvent(const DeferredPhotoJobPtr& jobPtr, IDeferredPhotoProcessingSessionIpcCode event);
+    void RestoreJobUnLocked(const PhotoJobRecord& record);
 
     const int32_t userId_;
     std::unique_ptr<PhotoJobQueue> offlineJobQueue_ {nullptr};
     std::shared_ptr<PhotoJobStateListener> jobChangeListener_ {nullptr};
     std::unordered_set<std::string> runningJob_ {};
     std::unordered_map<std::string, DeferredPhotoJobPtr> backgroundJobMap_ {};
+    std::unique_ptr<PhotoJobJournal> journal_ {nullptr};
+    bool restoring_ {false};
     std::unordered_map<JobPriority, int32_t> priorityToNum_ = {
         {JobPriority::HIGH, 0},
         {JobPriority::LOW, 0},
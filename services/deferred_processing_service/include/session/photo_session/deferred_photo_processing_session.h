@@ -48,6 +48,7 @@ public:
     int32_t ProcessImage(const std::string& appName, const std::string& imageId) override;
     int32_t CancelProcessImage(const std::string& imageId) override;
     int32_t NotifyProcessImage() override;
+    int32_t ReleaseImageBuffer(const std::string& imageId) override;
 
 private:
     void ReportEvent(const std::string& imageId, int32_t event);
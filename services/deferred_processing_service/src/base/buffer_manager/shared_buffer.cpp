@@ -19,6 +19,8 @@
 #include <unistd.h>
 
 #include "dp_log.h"
+#include "securec.h"
+#include "shared_buffer_pool.h"
 
 namespace OHOS {
 namespace CameraStandard {
@@ -30,12 +32,35 @@ SharedBuffer::SharedBuffer(int64_t capacity)
     DP_DEBUG_LOG("entered, capacity = %{public}" PRId64, capacity_);
 }
 
+SharedBuffer::SharedBuffer(int64_t capacity, sptr<Ashmem> ashmem, int32_t userId, const std::string& imageId,
+    int64_t dirtyBytes)
+    : capacity_(capacity), ashmem_(std::move(ashmem)), isPooled_(true), userId_(userId), imageId_(imageId),
+      dirtyBytes_(dirtyBytes)
+{
+    DP_DEBUG_LOG("entered, pooled capacity = %{public}" PRId64, capacity_);
+}
+
 SharedBuffer::~SharedBuffer()
 {
     DP_DEBUG_LOG("entered.");
+    if (isPooled_ && ashmem_ != nullptr) {
+        SharedBufferPool::GetInstance().Recycle(userId_, imageId_, capacity_, std::move(ashmem_), dirtyBytes_);
+        return;
+    }
     DeallocAshmem();
 }
 
+std::unique_ptr<SharedBuffer> SharedBuffer::CreateFromFd(int fd, int64_t size)
+{
+    DP_CHECK_ERROR_RETURN_RET_LOG(fd < 0 || size <= 0 || size > INT32_MAX, nullptr,
+        "invalid fd: %{public}d, size: %{public}" PRId64, fd, size);
+    int dupFd = dup(fd);
+    DP_CHECK_ERROR_RETURN_RET_LOG(dupFd < 0, nullptr, "dup failed, error = %{public}s.", std::strerror(errno));
+    auto buffer = std::make_unique<SharedBuffer>(size);
+    buffer->ashmem_ = sptr<Ashmem>::MakeSptr(dupFd, static_cast<int32_t>(size));
+    return buffer;
+}
+
 int32_t SharedBuffer::Initialize()
 {
     return AllocateAshmemUnlocked();
@@ -54,6 +79,14 @@ int32_t SharedBuffer::CopyFrom(uint8_t* address, int64_t bytes)
     DP_DEBUG_LOG("capacity: %{public}" PRId64 ", bytes: %{public}" PRId64, capacity_, bytes);
     auto ret = ashmem_->WriteToAshmem(address, bytes, 0);
     DP_CHECK_ERROR_RETURN_RET_LOG(!ret, DP_ERR, "copy failed.");
+    if (dirtyBytes_ > bytes) {
+        // The fd exposes the whole region, do not leak the tail of the image that used it before.
+        auto tail = const_cast<void*>(ashmem_->ReadFromAshmem(dirtyBytes_ - bytes, bytes));
+        DP_CHECK_ERROR_RETURN_RET_LOG(tail == nullptr, DP_ERR, "failed to clear the stale tail.");
+        DP_CHECK_ERROR_RETURN_RET_LOG(memset_s(tail, dirtyBytes_ - bytes, 0, dirtyBytes_ - bytes) != EOK, DP_ERR,
+            "failed to clear the stale tail.");
+    }
+    dirtyBytes_ = bytes;
     return DP_OK;
 }
 
@@ -66,6 +99,7 @@ void SharedBuffer::Reset()
 
 int32_t SharedBuffer::AllocateAshmemUnlocked()
 {
+    DP_CHECK_RETURN_RET(ashmem_ != nullptr, DP_OK);
     std::string_view name = "DPS ShareMemory";
     ashmem_ = Ashmem::CreateAshmem(name.data(), capacity_);
     DP_CHECK_ERROR_RETURN_RET_LOG(ashmem_ == nullptr, DP_INIT_FAIL,
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "shared_buffer_pool.h"
+
+#include "camera_timer.h"
+#include "dp_log.h"
+#include "steady_clock.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace DeferredProcessing {
+namespace {
+constexpr int64_t SIZE_CLASS_BYTES = 1024 * 1024;
+constexpr int64_t MAX_SLACK_BYTES = 2 * SIZE_CLASS_BYTES;
+constexpr int64_t MAX_CACHED_BYTES = 64 * SIZE_CLASS_BYTES;
+constexpr size_t MAX_CACHED_REGIONS = 6;
+constexpr uint32_t IDLE_TRIM_MS = 30000;
+constexpr uint32_t INVALID_TIMER_ID = 0;
+
+int64_t GetSizeClass(int64_t size)
+{
+    return (size + SIZE_CLASS_BYTES - 1) / SIZE_CLASS_BYTES * SIZE_CLASS_BYTES;
+}
+
+void CloseRegion(const sptr<Ashmem>& ashmem)
+{
+    ashmem->UnmapAshmem();
+    ashmem->CloseAshmem();
+}
+} // namespace
+
+SharedBufferPool& SharedBufferPool::GetInstance()
+{
+    static SharedBufferPool instance;
+    return instance;
+}
+
+std::unique_ptr<SharedBuffer> SharedBufferPool::Acquire(int64_t size, int32_t userId, const std::string& imageId)
+{
+    DP_CHECK_ERROR_RETURN_RET_LOG(size <= 0, nullptr, "invalid size: %{public}" PRId64, size);
+    int64_t sizeClass = GetSizeClass(size);
+    std::unique_ptr<SharedBuffer> buffer = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = freeRegions_.lower_bound(sizeClass);
+        if (it != freeRegions_.end() && it->first - sizeClass <= MAX_SLACK_BYTES) {
+            int64_t capacity = it->first;
+            buffer = std::unique_ptr<SharedBuffer>(new SharedBuffer(capacity, std::move(it->second.ashmem),
+                userId, imageId, it->second.dirtyBytes));
+            cachedBytes_ -= capacity;
+            freeRegions_.erase(it);
+            DP_DEBUG_LOG("reuse capacity: %{public}" PRId64 ", size: %{public}" PRId64, capacity, size);
+        }
+    }
+
+    if (buffer == nullptr) {
+        buffer = std::unique_ptr<SharedBuffer>(new SharedBuffer(sizeClass, nullptr, userId, imageId, 0));
+        DP_CHECK_ERROR_RETURN_RET_LOG(buffer->Initialize() != DP_OK, nullptr,
+            "failed to allocate capacity: %{public}" PRId64, sizeClass);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& image = lentImages_[ImageKey(userId, imageId)];
+    image.liveCount++;
+    image.isReleased = false;
+    image.lendTime = SteadyClock::GetTimestampMilli();
+    outstandingCount_++;
+    return buffer;
+}
+
+void SharedBufferPool::Release(int32_t userId, const std::string& imageId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = lentImages_.find(ImageKey(userId, imageId));
+    DP_CHECK_RETURN(it == lentImages_.end());
+    auto& image = it->second;
+    image.isReleased = true;
+    for (auto& lent : image.regions) {
+        CacheRegionUnlocked(lent.capacity, std::move(lent.region));
+    }
+    image.regions.clear();
+    DP_CHECK_EXECUTE(image.liveCount == 0, lentImages_.erase(it));
+    DP_DEBUG_LOG("released imageId: %{public}s, cached: %{public}zu", imageId.c_str(), freeRegions_.size());
+}
+
+void SharedBufferPool::Recycle(int32_t userId, const std::string& imageId, int64_t capacity,
+    sptr<Ashmem> ashmem, int64_t dirtyBytes)
+{
+    DP_CHECK_RETURN(ashmem == nullptr);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (outstandingCount_ > 0) {
+        outstandingCount_--;
+    }
+    FreeRegion region {std::move(ashmem), SteadyClock::GetTimestampMilli(), dirtyBytes};
+    auto it = lentImages_.find(ImageKey(userId, imageId));
+    if (it == lentImages_.end()) {
+        CloseRegion(region.ashmem);
+        return;
+    }
+    auto& image = it->second;
+    if (image.liveCount > 0) {
+        image.liveCount--;
+    }
+    if (image.isReleased) {
+        CacheRegionUnlocked(capacity, std::move(region));
+        DP_CHECK_EXECUTE(image.liveCount == 0, lentImages_.erase(it));
+    } else {
+        // The client may still be reading the result, hold the region until it releases the image.
+        image.regions.push_back({capacity, std::move(region)});
+    }
+    StartTrimTimerUnlocked();
+}
+
+void SharedBufferPool::CacheRegionUnlocked(int64_t capacity, FreeRegion region)
+{
+    if (freeRegions_.size() >= MAX_CACHED_REGIONS || cachedBytes_ + capacity > MAX_CACHED_BYTES) {
+        CloseRegion(region.ashmem);
+        return;
+    }
+    region.releaseTime = SteadyClock::GetTimestampMilli();
+    freeRegions_.emplace(capacity, std::move(region));
+    cachedBytes_ += capacity;
+}
+
+void SharedBufferPool::Trim(bool force)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    trimTimerId_ = INVALID_TIMER_ID;
+    uint64_t now = SteadyClock::GetTimestampMilli();
+    for (auto it = freeRegions_.begin(); it != freeRegions_.end();) {
+        if (!force && now - it->second.releaseTime < IDLE_TRIM_MS) {
+            ++it;
+            continue;
+        }
+        CloseRegion(it->second.ashmem);
+        cachedBytes_ -= it->first;
+        it = freeRegions_.erase(it);
+    }
+    // Closing only drops the service side of a region, a client still holding its fd keeps reading it.
+    for (auto it = lentImages_.begin(); it != lentImages_.end();) {
+        if (!force && now - it->second.lendTime < IDLE_TRIM_MS) {
+            ++it;
+            continue;
+        }
+        for (auto& lent : it->second.regions) {
+            CloseRegion(lent.region.ashmem);
+        }
+        it->second.regions.clear();
+        if (it->second.liveCount == 0) {
+            it = lentImages_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    DP_INFO_LOG("cached: %{public}zu, cachedBytes: %{public}" PRId64 ", lent: %{public}zu, outstanding: %{public}u",
+        freeRegions_.size(), cachedBytes_, lentImages_.size(), outstandingCount_);
+    DP_CHECK_EXECUTE(!freeRegions_.empty() || !lentImages_.empty(), StartTrimTimerUnlocked());
+}
+
+void SharedBufferPool::StartTrimTimerUnlocked()
+{
+    DP_CHECK_RETURN(trimTimerId_ != INVALID_TIMER_ID);
+    trimTimerId_ = CameraTimer::GetInstance().Register([]() {
+        SharedBufferPool::GetInstance().Trim();
+    }, IDLE_TRIM_MS, true);
+}
+} // namespace DeferredProcessing
+} // namespace CameraStandard
+} // namespace OHOS
@@ -24,6 +24,7 @@
 #include "picture_proxy.h"
 #include "securec.h"
 #include "service_died_command.h"
+#include "shared_buffer_pool.h"
 #include "camera_util.h"
 
 #include "image_effect_proxy.h"
@@ -42,7 +43,9 @@
 namespace OHOS {
 namespace CameraStandard {
 namespace DeferredProcessing {
-PhotoProcessResult::PhotoProcessResult(const int32_t userId) : userId_(userId)
+PhotoProcessResult::PhotoProcessResult(const int32_t userId)
+    : userId_(userId),
+      isBufferHandOffEnabled_(system::GetParameter("const.camera_service.dps_buffer_handoff_enable", "0") == "1")
 {
     DP_DEBUG_LOG("entered.");
 }
@@ -84,6 +87,30 @@ void PhotoProcessResult::OnPhotoSessionDied()
 }
 // LCOV_EXCL_STOP
 
+std::unique_ptr<SharedBuffer> PhotoProcessResult::CreateResultBuffer(
+    const std::string& imageId, int fd, int32_t dataSize)
+{
+    if (isBufferHandOffEnabled_) {
+        auto bufferPtr = SharedBuffer::CreateFromFd(fd, dataSize);
+        DP_CHECK_RETURN_RET(bufferPtr != nullptr, bufferPtr);
+    }
+    MappedMemory mapped(fd, dataSize);
+    DP_CHECK_ERROR_RETURN_RET_LOG(!mapped, nullptr, "Memory mapping failed for imageId: %{public}s", imageId.c_str());
+    return CopyToSharedBuffer(imageId, mapped.data(), dataSize);
+}
+
+std::unique_ptr<SharedBuffer> PhotoProcessResult::CopyToSharedBuffer(
+    const std::string& imageId, uint8_t* data, int64_t size)
+{
+    auto bufferPtr = SharedBufferPool::GetInstance().Acquire(size, userId_, imageId);
+    DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr == nullptr, nullptr,
+        "Failed to initialize shared buffer for imageId: %{public}s", imageId.c_str());
+    auto ret = bufferPtr->CopyFrom(data, size);
+    DP_CHECK_ERROR_RETURN_RET_LOG(ret != DP_OK, nullptr,
+        "Failed to copy buffer for imageId: %{public}s", imageId.c_str());
+    return bufferPtr;
+}
+
 int32_t PhotoProcessResult::ProcessPictureInfoV1_3(const std::string& imageId,
     const HDI::Camera::V1_3::ImageBufferInfoExt& buffer)
 {
@@ -290,18 +317,8 @@ int32_t PhotoProcessResult::ProcessPictureInfoV1_6(
         if (deferredFormat != static_cast<int32_t>(PhotoFormat::YUV)) {
             // JPG
             DP_INFO_LOG("ProcessPictureInfoV1_6 JPG process");
-            auto dataSize = imageInfoSingle->GetDataSize();
-            MappedMemory mapped(bufferHandle->fd, dataSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(
-                !mapped, DPS_ERROR_IMAGE_PROC_FAILED, "Memory mapping failed for imageId: %{public}s", imageId.c_str());
-
-            auto bufferPtr = std::make_unique<SharedBuffer>(dataSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr->Initialize() != DP_OK, DPS_ERROR_IMAGE_PROC_FAILED,
-                "Failed to initialize shared buffer for imageId: %{public}s", imageId.c_str());
-
-            auto ret = bufferPtr->CopyFrom(mapped.data(), dataSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(ret != DP_OK, DPS_ERROR_IMAGE_PROC_FAILED,
-                "Failed to copy buffer for imageId: %{public}s", imageId.c_str());
+            auto bufferPtr = CreateResultBuffer(imageId, bufferHandle->fd, imageInfoSingle->GetDataSize());
+            DP_CHECK_RETURN_RET(bufferPtr == nullptr, DPS_ERROR_IMAGE_PROC_FAILED);
 
             DP_INFO_LOG("DPS_PHOTO: bufferHandle fd: %{public}d, bufferPtr fd: %{public}d", bufferHandle->fd,
                 bufferPtr->GetFd());
@@ -337,13 +354,8 @@ int32_t PhotoProcessResult::ProcessPictureInfoV1_6(
             if (isDump) {
                 PictureAdapter::DumpEncoded(buffer.get(), bfSize, title + "100encode");
             }
-            auto bufferPtr = std::make_unique<SharedBuffer>(bfSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr->Initialize() != DP_OK, nullptr,
-                "Encode Failed to initialize shared buffer for imageId: %{public}s", imageId.c_str());
-
-            auto ret = bufferPtr->CopyFrom(buffer.get(), bfSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(
-                ret != DP_OK, nullptr, "Encode Failed to copy buffer for imageId: %{public}s", imageId.c_str());
+            auto bufferPtr = CopyToSharedBuffer(imageId, buffer.get(), bfSize);
+            DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr == nullptr, nullptr, "Encode Failed to copy buffer");
 
             DP_INFO_LOG("Encode DPS_PHOTO: bufferHandle fd: %{public}d, bufferPtr fd: %{public}d", bufferHandle->fd,
                 bufferPtr->GetFd());
@@ -556,18 +568,8 @@ int32_t PhotoProcessResult::ProcessPictureInfoV1_7(
         if (deferredFormat != static_cast<int32_t>(PhotoFormat::YUV)) {
             // JPG
             DP_INFO_LOG("ProcessPictureInfoV1_7 JPG process");
-            auto dataSize = imageInfoSingle->GetDataSize();
-            MappedMemory mapped(bufferHandle->fd, dataSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(
-                !mapped, DPS_ERROR_IMAGE_PROC_FAILED, "Memory mapping failed for imageId: %{public}s", imageId.c_str());
-
-            auto bufferPtr = std::make_unique<SharedBuffer>(dataSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr->Initialize() != DP_OK, DPS_ERROR_IMAGE_PROC_FAILED,
-                "Failed to initialize shared buffer for imageId: %{public}s", imageId.c_str());
-
-            auto ret = bufferPtr->CopyFrom(mapped.data(), dataSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(ret != DP_OK, DPS_ERROR_IMAGE_PROC_FAILED,
-                "Failed to copy buffer for imageId: %{public}s", imageId.c_str());
+            auto bufferPtr = CreateResultBuffer(imageId, bufferHandle->fd, imageInfoSingle->GetDataSize());
+            DP_CHECK_RETURN_RET(bufferPtr == nullptr, DPS_ERROR_IMAGE_PROC_FAILED);
 
             DP_INFO_LOG("DPS_PHOTO: bufferHandle fd: %{public}d, bufferPtr fd: %{public}d", bufferHandle->fd,
                 bufferPtr->GetFd());
@@ -603,13 +605,8 @@ int32_t PhotoProcessResult::ProcessPictureInfoV1_7(
             if (isDump) {
                 PictureAdapter::DumpEncoded(buffer.get(), bfSize, title + "100encode");
             }
-            auto bufferPtr = std::make_unique<SharedBuffer>(bfSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr->Initialize() != DP_OK, nullptr,
-                "Encode Failed to initialize shared buffer for imageId: %{public}s", imageId.c_str());
-
-            auto ret = bufferPtr->CopyFrom(buffer.get(), bfSize);
-            DP_CHECK_ERROR_RETURN_RET_LOG(
-                ret != DP_OK, nullptr, "Encode Failed to copy buffer for imageId: %{public}s", imageId.c_str());
+            auto bufferPtr = CopyToSharedBuffer(imageId, buffer.get(), bfSize);
+            DP_CHECK_ERROR_RETURN_RET_LOG(bufferPtr == nullptr, nullptr, "Encode Failed to copy buffer");
 
             DP_INFO_LOG("Encode DPS_PHOTO: bufferHandle fd: %{public}d, bufferPtr fd: %{public}d", bufferHandle->fd,
                 bufferPtr->GetFd());
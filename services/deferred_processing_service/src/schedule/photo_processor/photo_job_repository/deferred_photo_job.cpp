@@ -88,6 +88,7 @@ DeferredPhotoJob::DeferredPhotoJob(const std::string& imageId, const PhotoJobTyp
 bool DeferredPhotoJob::Prepare()
 {
     ChangeStateTo(pending_);
+    NotifyJobState();
     return true;
 }
 
@@ -96,12 +97,14 @@ bool DeferredPhotoJob::Start(uint32_t timerId)
     timerId_ = timerId;
     ChangeStateTo(running_);
     RecordJobRunningPriority();
+    NotifyJobState();
     return true;
 }
 bool DeferredPhotoJob::Complete()
 {
     ResetTimer();
     ChangeStateTo(completed_);
+    NotifyJobState();
     return true;
 }
 
@@ -110,6 +113,7 @@ bool DeferredPhotoJob::Fail()
     SetJobPriority(JobPriority::NORMAL);
     ResetTimer();
     ChangeStateTo(failed_);
+    NotifyJobState();
     return true;
 }
 
@@ -118,6 +122,7 @@ bool DeferredPhotoJob::Error()
     SetJobPriority(JobPriority::NORMAL);
     ResetTimer();
     ChangeStateTo(error_);
+    NotifyJobState();
     return true;
 }
 
@@ -138,6 +143,7 @@ bool DeferredPhotoJob::SetJobPriority(JobPriority priority)
     auto listener = jobChangeListener_.lock();
     DP_CHECK_EXECUTE(listener, listener->UpdatePriorityJob(priority, priority_));
     priority_ = priority;
+    NotifyJobState();
     return true;
 }
 
@@ -158,6 +164,13 @@ void DeferredPhotoJob::RecordJobRunningPriority()
         imageId_.c_str(), priority_, runningPriority_);
     runningPriority_ = priority_;
 }
+
+void DeferredPhotoJob::NotifyJobState()
+{
+    auto listener = jobChangeListener_.lock();
+    DP_CHECK_RETURN(listener == nullptr);
+    listener->UpdateJobState(imageId_, GetCurStatus(), priority_);
+}
 } // namespace DeferredProcessing
 } // namespace CameraStandard
 } // namespace OHOS
\ No newline at end of file
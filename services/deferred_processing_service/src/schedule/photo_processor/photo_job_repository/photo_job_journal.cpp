@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "photo_job_journal.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "dp_log.h"
+
+namespace OHOS {
+namespace CameraStandard {
+namespace DeferredProcessing {
+namespace {
+constexpr uint32_t JOURNAL_MAGIC = 0x4A535044; // "DPSJ"
+constexpr uint32_t JOURNAL_VERSION = 1;
+constexpr size_t HEADER_SIZE = 2 * sizeof(uint32_t);
+constexpr size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+constexpr size_t DEFAULT_CAPACITY = 256 * 1024;
+constexpr uint32_t GROUP_COMMIT_RECORDS = 32;
+constexpr uint32_t COMPACT_MIN_RECORDS = 1024;
+constexpr uint32_t COMPACT_DEAD_RATIO = 8;
+constexpr uint32_t CRC_POLYNOMIAL = 0xEDB88320;
+constexpr uint32_t CRC_TABLE_SIZE = 256;
+constexpr uint32_t BITS_PER_BYTE = 8;
+constexpr int32_t JOURNAL_FILE_MODE = 0660;
+constexpr char TEMP_SUFFIX[] = ".tmp";
+
+const std::array<uint32_t, CRC_TABLE_SIZE>& GetCrcTable()
+{
+    static const std::array<uint32_t, CRC_TABLE_SIZE> table = [] {
+        std::array<uint32_t, CRC_TABLE_SIZE> crcTable {};
+        for (uint32_t i = 0; i < CRC_TABLE_SIZE; i++) {
+            uint32_t crc = i;
+            for (uint32_t bit = 0; bit < BITS_PER_BYTE; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC_POLYNOMIAL : crc >> 1;
+            }
+            crcTable[i] = crc;
+        }
+        return crcTable;
+    }();
+    return table;
+}
+
+uint32_t Crc32(const uint8_t* data, size_t size)
+{
+    const auto& table = GetCrcTable();
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> BITS_PER_BYTE);
+    }
+    return ~crc;
+}
+
+template<typename T>
+void Put(std::vector<uint8_t>& buffer, T value)
+{
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void PutString(std::vector<uint8_t>& buffer, const std::string& value)
+{
+    uint16_t size = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+    Put(buffer, size);
+    buffer.insert(buffer.end(), value.begin(), value.begin() + size);
+}
+
+class Reader {
+public:
+    Reader(const uint8_t* data, uint32_t size) : data_(data), size_(size) {}
+
+    template<typename T>
+    bool Get(T& value)
+    {
+        DP_CHECK_RETURN_RET(size_ - pos_ < sizeof(T), false);
+        std::memcpy(&value, data_ + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool GetString(std::string& value)
+    {
+        uint16_t size = 0;
+        DP_CHECK_RETURN_RET(!Get(size) || size_ - pos_ < size, false);
+        value.assign(reinterpret_cast<const char*>(data_ + pos_), size);
+        pos_ += size;
+        return true;
+    }
+
+private:
+    const uint8_t* data_;
+    uint32_t size_;
+    uint32_t pos_ {0};
+};
+
+size_t GetPageSize()
+{
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+}
+} // namespace
+
+PhotoJobJournal::PhotoJobJournal(const std::string& path) : path_(path)
+{
+    DP_DEBUG_LOG("entered, path: %{public}s", path_.c_str());
+}
+
+PhotoJobJournal::~PhotoJobJournal()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    FlushUnlocked(true);
+    Unmap();
+}
+
+int32_t PhotoJobJournal::Open(std::vector<PhotoJobRecord>& jobs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    Unmap();
+    liveJobs_.clear();
+    DP_CHECK_ERROR_RETURN_RET_LOG(!Map(path_, DEFAULT_CAPACITY), DP_MEM_MAP_FAILED,
+        "map journal failed, path: %{public}s", path_.c_str());
+    std::vector<std::pair<std::string, uint64_t>> order;
+    Replay(order);
+    jobs.clear();
+    jobs.reserve(liveJobs_.size());
+    for (const auto& [imageId, sequence] : order) {
+        auto it = liveJobs_.find(imageId);
+        // An id removed and added again only keeps the place of its last add.
+        if (it != liveJobs_.end() && it->second.sequence == sequence) {
+            jobs.push_back(it->second);
+        }
+    }
+    DP_INFO_LOG("DPS_PHOTO: journal replayed, jobs: %{public}zu, records: %{public}u", jobs.size(), recordCount_);
+    return DP_OK;
+}
+
+void PhotoJobJournal::RecordAdd(const PhotoJobRecord& job)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    DP_CHECK_RETURN(base_ == nullptr);
+    auto& record = liveJobs_[job.imageId];
+    record = job;
+    record.sequence = nextSequence_++;
+    std::vector<uint8_t> payload;
+    EncodeAdd(record, payload);
+    Append(RecordType::ADD, payload);
+}
+
+void PhotoJobJournal::RecordState(const std::string& imageId, JobState state, JobPriority priority)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    DP_CHECK_RETURN(base_ == nullptr);
+    auto it = liveJobs_.find(imageId);
+    DP_CHECK_RETURN(it == liveJobs_.end());
+    DP_CHECK_RETURN(it->second.state == state && it->second.priority == priority);
+    it->second.state = state;
+    it->second.priority = priority;
+    std::vector<uint8_t> payload;
+    PutString(payload, imageId);
+    Put(payload, static_cast<int8_t>(state));
+    Put(payload, static_cast<int8_t>(priority));
+    Append(RecordType::STATE, payload);
+}
+
+void PhotoJobJournal::RecordRemove(const std::string& imageId)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    DP_CHECK_RETURN(base_ == nullptr);
+    DP_CHECK_RETURN(liveJobs_.erase(imageId) == 0);
+    std::vector<uint8_t> payload;
+    PutString(payload, imageId);
+    Append(RecordType::REMOVE, payload);
+}
+
+void PhotoJobJournal::Flush(bool sync)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    FlushUnlocked(sync);
+}
+
+bool PhotoJobJournal::Map(const std::string& path, size_t capacity)
+{
+    fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, JOURNAL_FILE_MODE);
+    DP_CHECK_ERROR_RETURN_RET_LOG(fd_ < 0, false, "open journal failed, errno: %{public}d", errno);
+    off_t fileSize = lseek(fd_, 0, SEEK_END);
+    capacity_ = std::max(capacity, static_cast<size_t>(std::max<off_t>(fileSize, 0)));
+    if (fileSize < static_cast<off_t>(capacity_) && ftruncate(fd_, static_cast<off_t>(capacity_)) != 0) {
+        DP_ERR_LOG("resize journal failed, errno: %{public}d", errno);
+        Unmap();
+        return false;
+    }
+    void* addr = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (addr == MAP_FAILED) {
+        DP_ERR_LOG("mmap journal failed, errno: %{public}d", errno);
+        Unmap();
+        return false;
+    }
+    base_ = static_cast<uint8_t*>(addr);
+    return true;
+}
+
+void PhotoJobJournal::Unmap()
+{
+    DP_CHECK_EXECUTE(base_ != nullptr, munmap(base_, capacity_));
+    DP_CHECK_EXECUTE(fd_ >= 0, close(fd_));
+    base_ = nullptr;
+    fd_ = -1;
+    capacity_ = 0;
+    offset_ = 0;
+    syncedOffset_ = 0;
+    pendingRecords_ = 0;
+    recordCount_ = 0;
+}
+
+void PhotoJobJournal::Replay(std::vector<std::pair<std::string, uint64_t>>& order)
+{
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    std::memcpy(&magic, base_, sizeof(magic));
+    std::memcpy(&version, base_ + sizeof(magic), sizeof(version));
+    if (magic != JOURNAL_MAGIC || version != JOURNAL_VERSION) {
+        DP_CHECK_ERROR_PRINT_LOG(magic != 0, "discard journal, magic: %{public}x, version: %{public}u",
+            magic, version);
+        std::memset(base_, 0, capacity_);
+        std::memcpy(base_, &JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+        std::memcpy(base_ + sizeof(JOURNAL_MAGIC), &JOURNAL_VERSION, sizeof(JOURNAL_VERSION));
+        offset_ = HEADER_SIZE;
+        return;
+    }
+    offset_ = HEADER_SIZE;
+    while (capacity_ - offset_ > RECORD_HEADER_SIZE) {
+        uint32_t size = 0;
+        uint32_t crc = 0;
+        std::memcpy(&size, base_ + offset_, sizeof(size));
+        std::memcpy(&crc, base_ + offset_ + sizeof(size), sizeof(crc));
+        DP_LOOP_BREAK_LOG(size == 0, "DPS_PHOTO: journal replayed to %{public}zu", offset_);
+        const uint8_t* data = base_ + offset_ + RECORD_HEADER_SIZE;
+        bool valid = size <= capacity_ - offset_ - RECORD_HEADER_SIZE && Crc32(data, size) == crc &&
+            ApplyRecord(static_cast<RecordType>(data[0]), data + 1, size - 1, order);
+        if (!valid) {
+            // A record torn by a crash, drop it and whatever follows so new records never join stale bytes.
+            DP_WARNING_LOG("DPS_PHOTO: journal truncated at %{public}zu", offset_);
+            std::memset(base_ + offset_, 0, capacity_ - offset_);
+            break;
+        }
+        offset_ += RECORD_HEADER_SIZE + size;
+        recordCount_++;
+    }
+    syncedOffset_ = offset_;
+}
+
+bool PhotoJobJournal::ApplyRecord(RecordType type, const uint8_t* data, uint32_t size,
+    std::vector<std::pair<std::string, uint64_t>>& order)
+{
+    Reader reader(data, size);
+    std::string imageId;
+    DP_CHECK_RETURN_RET(!reader.GetString(imageId), false);
+    int8_t state = 0;
+    int8_t priority = 0;
+    switch (type) {
+        case RecordType::ADD: {
+            PhotoJobRecord record;
+            uint8_t jobType = 0;
+            uint8_t discardable = 0;
+            DP_CHECK_RETURN_RET(!reader.Get(jobType) || !reader.Get(discardable) ||
+                !reader.GetString(record.bundleName) || !reader.Get(state) || !reader.Get(priority), false);
+            record.imageId = imageId;
+            record.type = static_cast<PhotoJobType>(jobType);
+            record.discardable = discardable != 0;
+            record.state = static_cast<JobState>(state);
+            record.priority = static_cast<JobPriority>(priority);
+            record.sequence = nextSequence_++;
+            order.emplace_back(imageId, record.sequence);
+            liveJobs_[imageId] = std::move(record);
+            return true;
+        }
+        case RecordType::STATE: {
+            DP_CHECK_RETURN_RET(!reader.Get(state) || !reader.Get(priority), false);
+            auto it = liveJobs_.find(imageId);
+            DP_CHECK_RETURN_RET(it == liveJobs_.end(), true);
+            it->second.state = static_cast<JobState>(state);
+            it->second.priority = static_cast<JobPriority>(priority);
+            return true;
+        }
+        case RecordType::REMOVE:
+            liveJobs_.erase(imageId);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool PhotoJobJournal::Append(RecordType type, const std::vector<uint8_t>& payload)
+{
+    size_t recordSize = RECORD_HEADER_SIZE + 1 + payload.size();
+    bool isFull = offset_ + recordSize > capacity_;
+    bool isMostlyDead = recordCount_ >= COMPACT_MIN_RECORDS && recordCount_ > liveJobs_.size() * COMPACT_DEAD_RATIO;
+    // The live jobs already include this change, so the rewritten journal carries it.
+    DP_CHECK_RETURN_RET((isFull || isMostlyDead) && Compact(recordSize), true);
+    DP_CHECK_ERROR_RETURN_RET_LOG(isFull || base_ == nullptr, false, "journal unavailable, record dropped");
+    return WriteRecord(type, payload);
+}
+
+bool PhotoJobJournal::WriteRecord(RecordType type, const std::vector<uint8_t>& payload)
+{
+    uint32_t size = static_cast<uint32_t>(payload.size() + 1);
+    uint8_t* record = base_ + offset_;
+    uint8_t* data = record + RECORD_HEADER_SIZE;
+    data[0] = static_cast<uint8_t>(type);
+    DP_CHECK_EXECUTE(!payload.empty(), std::memcpy(data + 1, payload.data(), payload.size()));
+    uint32_t crc = Crc32(data, size);
+    std::memcpy(record + sizeof(size), &crc, sizeof(crc));
+    // The size goes last, a reader never sees a record before its body is in place.
+    std::memcpy(record, &size, sizeof(size));
+    offset_ += RECORD_HEADER_SIZE + size;
+    recordCount_++;
+    DP_CHECK_EXECUTE(++pendingRecords_ >= GROUP_COMMIT_RECORDS, FlushUnlocked(false));
+    return true;
+}
+
+bool PhotoJobJournal::Compact(size_t minCapacity)
+{
+    std::vector<const PhotoJobRecord*> jobs;
+    jobs.reserve(liveJobs_.size());
+    for (const auto& item : liveJobs_) {
+        jobs.push_back(&item.second);
+    }
+    std::sort(jobs.begin(), jobs.end(), [](auto lhs, auto rhs) { return lhs->sequence < rhs->sequence; });
+    std::vector<uint8_t> content;
+    Put(content, JOURNAL_MAGIC);
+    Put(content, JOURNAL_VERSION);
+    std::vector<uint8_t> payload;
+    for (const auto* job : jobs) {
+        payload.clear();
+        EncodeAdd(*job, payload);
+        uint32_t size = static_cast<uint32_t>(payload.size() + 1);
+        std::vector<uint8_t> body;
+        body.reserve(size);
+        body.push_back(static_cast<uint8_t>(RecordType::ADD));
+        body.insert(body.end(), payload.begin(), payload.end());
+        Put(content, size);
+        Put(content, Crc32(body.data(), body.size()));
+        content.insert(content.end(), body.begin(), body.end());
+    }
+    size_t capacity = DEFAULT_CAPACITY;
+    while (capacity < (content.size() + minCapacity) * 2) {
+        capacity *= 2;
+    }
+
+    std::string tempPath = path_ + TEMP_SUFFIX;
+    int32_t fd = open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, JOURNAL_FILE_MODE);
+    DP_CHECK_ERROR_RETURN_RET_LOG(fd < 0, false, "open compacted journal failed, errno: %{public}d", errno);
+    bool written = ftruncate(fd, static_cast<off_t>(capacity)) == 0 &&
+        write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()) && fsync(fd) == 0;
+    close(fd);
+    if (!written || rename(tempPath.c_str(), path_.c_str()) != 0) {
+        DP_ERR_LOG("write compacted journal failed, errno: %{public}d", errno);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    DP_INFO_LOG("DPS_PHOTO: journal compacted, records: %{public}u, jobs: %{public}zu", recordCount_, jobs.size());
+    munmap(base_, capacity_);
+    close(fd_);
+    base_ = nullptr;
+    fd_ = -1;
+    DP_CHECK_ERROR_RETURN_RET_LOG(!Map(path_, capacity), false, "remap compacted journal failed");
+    offset_ = content.size();
+    syncedOffset_ = offset_;
+    pendingRecords_ = 0;
+    recordCount_ = static_cast<uint32_t>(jobs.size());
+    return true;
+}
+
+void PhotoJobJournal::FlushUnlocked(bool sync)
+{
+    DP_CHECK_RETURN(base_ == nullptr || offset_ == syncedOffset_);
+    size_t start = syncedOffset_ - syncedOffset_ % GetPageSize();
+    int32_t ret = msync(base_ + start, offset_ - start, sync ? MS_SYNC : MS_ASYNC);
+    DP_CHECK_ERROR_PRINT_LOG(ret != 0, "msync journal failed, errno: %{public}d", errno);
+    syncedOffset_ = offset_;
+    pendingRecords_ = 0;
+}
+
+void PhotoJobJournal::EncodeAdd(const PhotoJobRecord& job, std::vector<uint8_t>& payload)
+{
+    PutString(payload, job.imageId);
+    Put(payload, static_cast<uint8_t>(job.type));
+    Put(payload, static_cast<uint8_t>(job.discardable ? 1 : 0));
+    PutString(payload, job.bundleName);
+    Put(payload, static_cast<int8_t>(job.state));
+    Put(payload, static_cast<int8_t>(job.priority));
+}
+} // namespace DeferredProcessing
+} // namespace CameraStandard
+} // namespace OHOS
@@ -61,6 +61,15 @@ void PhotoJobStateListener::TryDoNextJob(const std::string& imageId, bool isTryD
     repository->NotifyJobChanged(imageId, isTryDo);
 }
 
+void PhotoJobStateListener::UpdateJobState(const std::string& imageId, JobState state, JobPriority priority)
+{
+    DP_DEBUG_LOG("UpdateJobState: %{public}s, state: %{public}d, priority: %{public}d",
+        imageId.c_str(), state, priority);
+    auto repository = repository_.lock();
+    DP_CHECK_ERROR_RETURN_LOG(repository == nullptr, "PhotoJobRepository is nullptr.");
+    repository->UpdateJobStateUnLocked(imageId, state, priority);
+}
+
 PhotoJobRepository::PhotoJobRepository(const int32_t userId) : userId_(userId)
 {
     DP_DEBUG_LOG("entered, userId: %{public}d", userId_);
@@ -91,6 +100,24 @@ int32_t PhotoJobRepository::Initialize()
     return DP_OK;
 }
 
+int32_t PhotoJobRepository::RestoreJobs(const std::string& journalPath)
+{
+    auto journal = std::make_unique<PhotoJobJournal>(journalPath);
+    std::vector<PhotoJobRecord> records;
+    int32_t ret = journal->Open(records);
+    DP_CHECK_ERROR_RETURN_RET_LOG(ret != DP_OK, ret, "DPS_PHOTO: open journal failed, ret: %{public}d", ret);
+    restoring_ = true;
+    for (const auto& record : records) {
+        RestoreJobUnLocked(record);
+    }
+    restoring_ = false;
+    journal_ = std::move(journal);
+    DP_INFO_LOG("DPS_PHOTO: restored jobs: %{public}zu", records.size());
+    DP_CHECK_RETURN_RET(records.empty(), DP_OK);
+    NotifyJobChanged(records.front().imageId, true);
+    return DP_OK;
+}
+
 void PhotoJobRepository::AddDeferredJob(const std::string& imageId, bool discardable, DpsMetadata& metadata,
     const std::string& bundleName)
 {
@@ -109,6 +136,15 @@ void PhotoJobRepository::AddDeferredJob(const std::string& imageId, bool discard
     } else {
         offlineJobQueue_->Push(jobPtr);
     }
+    if (journal_) {
+        PhotoJobRecord record;
+        record.imageId = imageId;
+        record.type = jobPtr->GetPhotoJobType();
+        record.discardable = discardable;
+        record.bundleName = bundleName;
+        record.priority = jobPtr->GetCurPriority();
+        journal_->RecordAdd(record);
+    }
     jobPtr->Prepare();
     ReportEvent(jobPtr, IDeferredPhotoProcessingSessionIpcCode::COMMAND_ADD_IMAGE);
 }
@@ -130,6 +166,7 @@ void PhotoJobRepository::RemoveDeferredJob(const std::string& imageId, bool rest
     } else {
         offlineJobQueue_->Remove(jobPtr);
     }
+    DP_CHECK_EXECUTE(journal_, journal_->RecordRemove(imageId));
     jobPtr->Delete();
     ReportEvent(jobPtr, IDeferredPhotoProcessingSessionIpcCode::COMMAND_REMOVE_IMAGE);
 }
@@ -212,7 +249,7 @@ uint32_t PhotoJobRepository::GetJobTimerId(const std::string& imageId)
 void PhotoJobRepository::NotifyJobChanged(const std::string& imageId, bool isTryDo)
 {
     offlineJobQueue_->UpdateById(imageId);
-    DP_CHECK_RETURN(!isTryDo);
+    DP_CHECK_RETURN(!isTryDo || restoring_);
     DP_INFO_LOG("DPS_PHOTO: NotifyJobChanged imageId %{public}s", imageId.c_str());
     auto ret = DPS_SendCommand<NotifyJobChangedCommand>(userId_);
     DP_CHECK_ERROR_RETURN_LOG(ret != DP_OK, "NotifyJobChanged failed, ret: %{public}d", ret);
@@ -246,6 +283,12 @@ void PhotoJobRepository::UpdateJobSizeUnLocked()
     EventsMonitor::GetInstance().NotifyPhotoProcessSize(offlineJobQueue_->GetSize(), backgroundJobMap_.size());
 }
 
+void PhotoJobRepository::UpdateJobStateUnLocked(const std::string& imageId, JobState state, JobPriority priority)
+{
+    DP_CHECK_RETURN(journal_ == nullptr || restoring_);
+    journal_->RecordState(imageId, state, priority);
+}
+
 DeferredPhotoJobPtr PhotoJobRepository::GetJobUnLocked(const std::string& imageId)
 {
     auto jobPtr = offlineJobQueue_->GetJobById(imageId);
@@ -335,6 +378,37 @@ bool PhotoJobRepository::IsRunningJob(const std::string& imageId)
     return runningJob_.find(imageId) != runningJob_.end();
 }
 
+void PhotoJobRepository::RestoreJobUnLocked(const PhotoJobRecord& record)
+{
+    DP_CHECK_RETURN(GetJobUnLocked(record.imageId) != nullptr);
+    auto jobPtr = std::make_shared<DeferredPhotoJob>(
+        record.imageId, record.type, record.discardable, jobChangeListener_, record.bundleName);
+    if (jobPtr->GetPhotoJobType() == PhotoJobType::BACKGROUND) {
+        backgroundJobMap_.emplace(record.imageId, jobPtr);
+    } else {
+        offlineJobQueue_->Push(jobPtr);
+    }
+    // A job cut off while running did not finish, it goes back to pending.
+    switch (record.state) {
+        case JobState::FAILED:
+            jobPtr->Fail();
+            break;
+        case JobState::COMPLETED:
+            jobPtr->Complete();
+            break;
+        case JobState::ERROR:
+            jobPtr->Error();
+            break;
+        default:
+            jobPtr->Prepare();
+            break;
+    }
+    DP_CHECK_EXECUTE(record.priority != JobPriority::NONE, jobPtr->SetJobPriority(record.priority));
+    offlineJobQueue_->UpdateById(record.imageId);
+    DP_DEBUG_LOG("DPS_PHOTO: RestoreJob imageId: %{public}s, state: %{public}d, priority: %{public}d",
+        record.imageId.c_str(), record.state, record.priority);
+}
+
 void PhotoJobRepository::ReportEvent(const DeferredPhotoJobPtr& jobPtr, IDeferredPhotoProcessingSessionIpcCode event)
 {
     DP_CHECK_ERROR_RETURN_LOG(jobPtr == nullptr, "DeferredPhotoJob is nullptr.");
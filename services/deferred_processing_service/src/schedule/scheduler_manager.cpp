@@ -20,6 +20,11 @@
 namespace OHOS {
 namespace CameraStandard {
 namespace DeferredProcessing {
+namespace {
+    constexpr char PHOTO_JOURNAL_PREFIX[] = "dps_photo_job_";
+    constexpr char PHOTO_JOURNAL_SUFFIX[] = ".journal";
+}
+
 SchedulerManager::SchedulerManager()
 {
     DP_DEBUG_LOG("entered.");
@@ -74,6 +79,8 @@ void SchedulerManager::CreatePhotoProcessor(const int32_t userId)
     auto photoProcessor = DeferredPhotoProcessor::Create(userId, photoRepository, photoPost);
     auto photoController = DeferredPhotoController::Create(userId, photoProcessor);
     photoController_[userId] = photoController;
+    photoRepository->RestoreJobs(std::string(PATH) + PHOTO_JOURNAL_PREFIX + std::to_string(userId) +
+        PHOTO_JOURNAL_SUFFIX);
 }
 
 std::shared_ptr<VideoPostProcessor> SchedulerManager::GetVideoPostProcessor(const int32_t userId)
@@ -20,6 +20,7 @@
 #include "dps_event_report.h"
 #include "events_info.h"
 #include "photo_command.h"
+#include "shared_buffer_pool.h"
 #include "sync_command.h"
 
 namespace OHOS {
@@ -147,6 +148,13 @@ int32_t DeferredPhotoProcessingSession::NotifyProcessImage()
     return DP_OK;
 }
 
+int32_t DeferredPhotoProcessingSession::ReleaseImageBuffer(const std::string& imageId)
+{
+    DP_DEBUG_LOG("DPS_PHOTO: ReleaseImageBuffer imageId: %{public}s", imageId.c_str());
+    SharedBufferPool::GetInstance().Release(userId_, imageId);
+    return DP_OK;
+}
+
 void DeferredPhotoProcessingSession::ReportEvent(const std::string& imageId, int32_t event)
 {
     DPSEventInfo dpsEventInfo;
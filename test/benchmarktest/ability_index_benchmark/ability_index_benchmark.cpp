@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ability/camera_ability_index.h"
+#include "camera_metadata_operator.h"
+
+using namespace OHOS::CameraStandard;
+
+namespace {
+constexpr int32_t PINCH_STEPS = 1000;
+constexpr int32_t SCENE_MODE_COUNT = 24;
+constexpr int32_t ZOOM_CAP_STEP = 3;
+constexpr int32_t MIN_ZOOM = 100;
+constexpr int32_t MAX_ZOOM = 1500;
+constexpr int32_t FEATURED_MODE = SCENE_MODE_COUNT - 1;
+constexpr uint32_t ABILITY_ITEMS = 16;
+constexpr uint32_t ABILITY_DATA = 512;
+constexpr float ZOOM_FACTOR = 100.0;
+
+// A device ability holding the zoom cap of every scene mode, the featured mode being the last one.
+std::shared_ptr<OHOS::Camera::CameraMetadata> CreateAbility()
+{
+    auto ability = std::make_shared<OHOS::Camera::CameraMetadata>(ABILITY_ITEMS, ABILITY_DATA);
+    std::vector<int32_t> zoomCap;
+    for (int32_t mode = 0; mode < SCENE_MODE_COUNT; mode++) {
+        zoomCap.insert(zoomCap.end(), { mode, MIN_ZOOM, MAX_ZOOM });
+    }
+    ability->addEntry(OHOS_ABILITY_SCENE_ZOOM_CAP, zoomCap.data(), zoomCap.size());
+    std::vector<uint8_t> focusModes = { OHOS_CAMERA_FOCUS_MODE_AUTO, OHOS_CAMERA_FOCUS_MODE_CONTINUOUS_AUTO };
+    ability->addEntry(OHOS_ABILITY_FOCUS_MODES, focusModes.data(), focusModes.size());
+    return ability;
+}
+
+float GetPinchTarget(int32_t step)
+{
+    return 1.0f + static_cast<float>(step % (MAX_ZOOM / MIN_ZOOM * ZOOM_CAP_STEP)) / ZOOM_CAP_STEP;
+}
+
+// SetZoomRatio before the index: look the zoom cap up and walk it on every step.
+void BM_PinchZoomLookup(benchmark::State& state)
+{
+    auto ability = CreateAbility();
+    for (auto _ : state) {
+        float zoomRatio = 0.0;
+        for (int32_t step = 0; step < PINCH_STEPS; step++) {
+            camera_metadata_item_t item;
+            int ret = OHOS::Camera::FindCameraMetadataItem(ability->get(), OHOS_ABILITY_SCENE_ZOOM_CAP, &item);
+            if (ret != CAM_META_SUCCESS) {
+                continue;
+            }
+            std::vector<float> range = { 0.0, 0.0 };
+            for (uint32_t i = 0; i + ZOOM_CAP_STEP - 1 < item.count; i += ZOOM_CAP_STEP) {
+                if (item.data.i32[i] == FEATURED_MODE) {
+                    range = { item.data.i32[i + 1] / ZOOM_FACTOR, item.data.i32[i + ZOOM_CAP_STEP - 1] / ZOOM_FACTOR };
+                    break;
+                }
+            }
+            zoomRatio = std::clamp(GetPinchTarget(step), range[0], range[1]);
+            benchmark::DoNotOptimize(zoomRatio);
+        }
+    }
+}
+
+void BM_PinchZoomIndex(benchmark::State& state)
+{
+    auto ability = CreateAbility();
+    for (auto _ : state) {
+        std::shared_ptr<const CameraAbilityIndex> index = nullptr;
+        float zoomRatio = 0.0;
+        for (int32_t step = 0; step < PINCH_STEPS; step++) {
+            if (index == nullptr || !index->IsMatched(ability, FEATURED_MODE, FEATURED_MODE)) {
+                index = std::make_shared<CameraAbilityIndex>(ability, FEATURED_MODE, FEATURED_MODE);
+            }
+            const std::vector<float>& range = index->GetZoomRatioRange();
+            zoomRatio = std::clamp(GetPinchTarget(step), range[0], range[1]);
+            benchmark::DoNotOptimize(zoomRatio);
+        }
+    }
+}
+} // namespace
+
+BENCHMARK(BM_PinchZoomLookup);
+BENCHMARK(BM_PinchZoomIndex);
+
+BENCHMARK_MAIN();
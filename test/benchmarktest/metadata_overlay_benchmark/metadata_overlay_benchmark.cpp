@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "camera_metadata.h"
+#include "camera_metadata_overlay.h"
+
+using namespace OHOS::CameraStandard;
+
+namespace {
+constexpr uint32_t SECTION_SHIFT = 16;
+constexpr uint32_t MAX_SECTION_COUNT = 64;
+constexpr uint32_t MAX_TAGS_PER_SECTION = 128;
+constexpr uint32_t ITEM_DATA_COUNT = 4;
+
+/*
+ * Stand-in for a device ability: the first itemCount valid tags of the metadata sections, each
+ * holding a few values, roughly the shape of what HCameraDevice hands to its streams.
+ */
+std::shared_ptr<OHOS::Camera::CameraMetadata> CreateAbility(uint32_t itemCount)
+{
+    auto ability =
+        std::make_shared<OHOS::Camera::CameraMetadata>(itemCount, itemCount * ITEM_DATA_COUNT * sizeof(int64_t));
+    std::vector<int64_t> payload(ITEM_DATA_COUNT, 1);
+    uint32_t added = 0;
+    for (uint32_t section = 0; section < MAX_SECTION_COUNT && added < itemCount; section++) {
+        for (uint32_t offset = 0; offset < MAX_TAGS_PER_SECTION && added < itemCount; offset++) {
+            uint32_t tag = (section << SECTION_SHIFT) + offset;
+            if (OHOS::Camera::CameraMetadata::AddCameraMetadataItem(
+                ability->get(), tag, payload.data(), ITEM_DATA_COUNT) == CAM_META_SUCCESS) {
+                added++;
+            }
+        }
+    }
+    return ability;
+}
+
+// The tags HStreamRepeat::Start writes for a preview or video stream.
+void PatchStartSettings(std::shared_ptr<OHOS::Camera::CameraMetadata>& settings)
+{
+    uint8_t mirror = 1;
+    uint8_t dfxSwitch = 1;
+    uint8_t muteMode = 0;
+    std::vector<int32_t> fpsRange = { 30, 30 };
+    AddOrUpdateMetadata(settings, OHOS_CONTROL_CAPTURE_MIRROR, &mirror, 1);
+    AddOrUpdateMetadata(settings, OHOS_CONTROL_VIDEO_DEBUG_SWITCH, &dfxSwitch, 1);
+    AddOrUpdateMetadata(settings, OHOS_CONTROL_FPS_RANGES, fpsRange.data(), fpsRange.size());
+    AddOrUpdateMetadata(settings, OHOS_CONTROL_MUTE_MODE, &muteMode, 1);
+}
+
+// Stream start before the overlay: serialize the ability, parse it back, patch and serialize again.
+void BM_StartSettingsRoundTrip(benchmark::State& state)
+{
+    auto ability = CreateAbility(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        std::vector<uint8_t> abilityVec;
+        OHOS::Camera::MetadataUtils::ConvertMetadataToVec(ability, abilityVec);
+        std::shared_ptr<OHOS::Camera::CameraMetadata> dynamicSetting = nullptr;
+        OHOS::Camera::MetadataUtils::ConvertVecToMetadata(abilityVec, dynamicSetting);
+        PatchStartSettings(dynamicSetting);
+        std::vector<uint8_t> captureSetting;
+        OHOS::Camera::MetadataUtils::ConvertMetadataToVec(dynamicSetting, captureSetting);
+        benchmark::DoNotOptimize(captureSetting.data());
+    }
+}
+
+void BM_StartSettingsOverlay(benchmark::State& state)
+{
+    auto ability = CreateAbility(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state) {
+        CameraMetadataOverlay overlay(ability);
+        PatchStartSettings(overlay.GetDelta());
+        std::vector<uint8_t> captureSetting;
+        overlay.Flatten(captureSetting);
+        benchmark::DoNotOptimize(captureSetting.data());
+    }
+}
+} // namespace
+
+BENCHMARK(BM_StartSettingsRoundTrip)->Arg(100)->Arg(300)->Arg(600);
+BENCHMARK(BM_StartSettingsOverlay)->Arg(100)->Arg(300)->Arg(600);
+
+BENCHMARK_MAIN();
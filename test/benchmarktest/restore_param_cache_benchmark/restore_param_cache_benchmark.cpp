@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "binary_cache_converter.h"
+#include "camera_metadata.h"
+#include "json_cache_converter.h"
+
+using namespace OHOS;
+using namespace OHOS::CameraStandard;
+
+namespace {
+const std::string BENCHMARK_JSON_FILE_PATH = "/data/local/tmp/restore_param_cache_benchmark.json";
+const std::string BENCHMARK_BINARY_FILE_PATH = "/data/local/tmp/restore_param_cache_benchmark.bin";
+constexpr uint32_t SECTION_SHIFT = 16;
+constexpr uint32_t MAX_SECTION_COUNT = 64;
+constexpr uint32_t MAX_TAGS_PER_SECTION = 128;
+constexpr uint32_t STREAM_COUNT = 3;
+constexpr uint32_t SETTING_ITEM_COUNT = 64;
+constexpr uint32_t ITEM_DATA_COUNT = 4;
+constexpr int32_t START_ACTIVE_TIME = 5;
+
+// The first SETTING_ITEM_COUNT valid tags of the metadata sections, about what a session leaves in its settings.
+std::shared_ptr<OHOS::Camera::CameraMetadata> CreateSettings()
+{
+    auto settings = std::make_shared<OHOS::Camera::CameraMetadata>(SETTING_ITEM_COUNT,
+        SETTING_ITEM_COUNT * ITEM_DATA_COUNT * sizeof(int64_t));
+    std::vector<int64_t> payload(ITEM_DATA_COUNT, 1);
+    uint32_t added = 0;
+    for (uint32_t section = 0; section < MAX_SECTION_COUNT && added < SETTING_ITEM_COUNT; section++) {
+        for (uint32_t offset = 0; offset < MAX_TAGS_PER_SECTION && added < SETTING_ITEM_COUNT; offset++) {
+            uint32_t tag = (section << SECTION_SHIFT) + offset;
+            if (OHOS::Camera::CameraMetadata::AddCameraMetadataItem(
+                settings->get(), tag, payload.data(), ITEM_DATA_COUNT) == CAM_META_SUCCESS) {
+                added++;
+            }
+        }
+    }
+    return settings;
+}
+
+sptr<HCameraRestoreParam> CreateParam(const std::string& clientName, const std::string& cameraId)
+{
+    std::vector<StreamInfo_V1_1> streamInfos(STREAM_COUNT);
+    for (uint32_t i = 0; i < STREAM_COUNT; i++) {
+        streamInfos[i].v1_0.streamId_ = static_cast<int32_t>(i);
+        streamInfos[i].v1_0.width_ = 1920;
+        streamInfos[i].v1_0.height_ = 1080;
+        streamInfos[i].v1_0.intent_ = static_cast<StreamIntent>(i);
+    }
+    sptr<HCameraRestoreParam> param = new HCameraRestoreParam(clientName, cameraId, streamInfos, CreateSettings(),
+        PERSISTENT_DEFAULT_PARAM_OHOS, START_ACTIVE_TIME);
+    param->SetCloseCameraTime({1, 0});
+    return param;
+}
+
+/*
+ * Stand-in for a device that prelaunched the camera from bundleCount applications, each keeping a
+ * persistent parameter for the back and front camera and a transient one.
+ */
+void CreateParamMaps(int64_t bundleCount, BinaryCacheConverter::PersistentParamMap& pMap,
+    BinaryCacheConverter::TransientParamMap& tMap)
+{
+    for (int64_t i = 0; i < bundleCount; i++) {
+        std::string clientName = "com.example.bundle" + std::to_string(i);
+        pMap[clientName]["device/0"] = CreateParam(clientName, "device/0");
+        pMap[clientName]["device/1"] = CreateParam(clientName, "device/1");
+        tMap[clientName] = CreateParam(clientName, "device/0");
+    }
+}
+
+void BM_JsonCacheLoad(benchmark::State& state)
+{
+    BinaryCacheConverter::PersistentParamMap pMap;
+    BinaryCacheConverter::TransientParamMap tMap;
+    CreateParamMaps(state.range(0), pMap, tMap);
+    JsonCacheConverter::SaveMapToJsonFile(BENCHMARK_JSON_FILE_PATH, pMap, tMap, "", "");
+    for (auto _ : state) {
+        BinaryCacheConverter::PersistentParamMap loadedPMap;
+        BinaryCacheConverter::TransientParamMap loadedTMap;
+        std::string clientName;
+        std::string cameraId;
+        benchmark::DoNotOptimize(JsonCacheConverter::ParseJsonFileToMap(BENCHMARK_JSON_FILE_PATH, loadedPMap,
+            loadedTMap, clientName, cameraId));
+    }
+    std::remove(BENCHMARK_JSON_FILE_PATH.c_str());
+}
+
+void BM_BinaryCacheLoad(benchmark::State& state)
+{
+    BinaryCacheConverter::PersistentParamMap pMap;
+    BinaryCacheConverter::TransientParamMap tMap;
+    CreateParamMaps(state.range(0), pMap, tMap);
+    BinaryCacheConverter().SaveMapToBinaryFile(BENCHMARK_BINARY_FILE_PATH, pMap, tMap, "", "");
+    for (auto _ : state) {
+        BinaryCacheConverter converter;
+        BinaryCacheConverter::PersistentParamMap loadedPMap;
+        BinaryCacheConverter::TransientParamMap loadedTMap;
+        std::string clientName;
+        std::string cameraId;
+        benchmark::DoNotOptimize(converter.ParseBinaryFileToMap(BENCHMARK_BINARY_FILE_PATH, loadedPMap,
+            loadedTMap, clientName, cameraId));
+    }
+    std::remove(BENCHMARK_BINARY_FILE_PATH.c_str());
+}
+
+// Saving again after one application closed the camera, the binary cache only encodes that record.
+void BM_BinaryCacheSaveOneChanged(benchmark::State& state)
+{
+    BinaryCacheConverter::PersistentParamMap pMap;
+    BinaryCacheConverter::TransientParamMap tMap;
+    CreateParamMaps(state.range(0), pMap, tMap);
+    BinaryCacheConverter converter;
+    converter.SaveMapToBinaryFile(BENCHMARK_BINARY_FILE_PATH, pMap, tMap, "", "");
+    auto& changedParam = pMap.begin()->second.begin()->second;
+    long closeTime = 0;
+    for (auto _ : state) {
+        changedParam->SetCloseCameraTime({++closeTime, 0});
+        benchmark::DoNotOptimize(converter.SaveMapToBinaryFile(BENCHMARK_BINARY_FILE_PATH, pMap, tMap, "", ""));
+    }
+    std::remove(BENCHMARK_BINARY_FILE_PATH.c_str());
+}
+} // namespace
+
+BENCHMARK(BM_JsonCacheLoad)->Arg(16)->Arg(128)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BinaryCacheLoad)->Arg(16)->Arg(128)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BinaryCacheSaveOneChanged)->Arg(16)->Arg(128)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include "blocking_queue.h"
+#include "ring_blocking_queue.h"
+
+using namespace OHOS::CameraStandard;
+
+namespace {
+constexpr size_t FRAME_CACHE_SIZE = 45;
+constexpr int64_t NANOS_PER_SECOND = 1000000000;
+using Frame = std::shared_ptr<int64_t>;
+
+// Per-frame producer path of VideoCacheFilter::OnBufferAvailable before the ring. The timed Pop keeps a
+// concurrent consumer emptying the queue between Full() and Pop() from parking the producer.
+void PushFrame(BlockingQueue<Frame>& queue, Frame frame)
+{
+    if (queue.Full()) {
+        Frame dropped = queue.Pop(0);
+        benchmark::DoNotOptimize(dropped);
+    }
+    queue.Push(std::move(frame), 0);
+}
+
+void PushFrame(RingBlockingQueue<Frame>& queue, Frame frame)
+{
+    Frame dropped;
+    queue.PushOverwrite(std::move(frame), dropped);
+    benchmark::DoNotOptimize(dropped);
+}
+
+/*
+ * The benchmark thread runs the producer path back to back while an observer thread, paced at the
+ * frame rate given as argument, does what the shutter and drain threads do per frame: poll the size,
+ * peek the oldest frame and occasionally snapshot the whole cache.
+ */
+template <typename Queue>
+void BM_FrameCachePush(benchmark::State& state)
+{
+    const int64_t fps = state.range(0);
+    Queue queue("benchmark", FRAME_CACHE_SIZE);
+    Frame frame = std::make_shared<int64_t>(0);
+    std::atomic<bool> running { true };
+    std::atomic<int64_t> observerOps { 0 };
+    std::thread observer([&queue, &running, &observerOps, fps]() {
+        auto interval = std::chrono::nanoseconds(NANOS_PER_SECOND / fps);
+        auto next = std::chrono::steady_clock::now();
+        int64_t frameIndex = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            benchmark::DoNotOptimize(queue.Size());
+            benchmark::DoNotOptimize(queue.Full());
+            benchmark::DoNotOptimize(queue.Front());
+            if (++frameIndex % fps == 0) {
+                benchmark::DoNotOptimize(queue.GetAllElements());
+            }
+            observerOps.fetch_add(1, std::memory_order_relaxed);
+            next += interval;
+            std::this_thread::sleep_until(next);
+        }
+    });
+    for (auto _ : state) {
+        PushFrame(queue, frame);
+    }
+    running = false;
+    observer.join();
+    state.SetItemsProcessed(state.iterations());
+    state.counters["observerOps"] = static_cast<double>(observerOps.load());
+}
+
+// Push and pop from two threads, the consumer being the VideoCacheFilter drain path.
+template <typename Queue>
+void BM_FrameCacheHandoff(benchmark::State& state)
+{
+    Queue queue("benchmark", FRAME_CACHE_SIZE);
+    Frame frame = std::make_shared<int64_t>(0);
+    std::atomic<bool> running { true };
+    std::thread consumer([&queue, &running]() {
+        while (running.load(std::memory_order_relaxed)) {
+            benchmark::DoNotOptimize(queue.Pop(1));
+        }
+    });
+    for (auto _ : state) {
+        PushFrame(queue, frame);
+    }
+    running = false;
+    queue.SetActive(false);
+    consumer.join();
+    state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_FrameCachePush, BlockingQueue<Frame>)->Arg(30)->Arg(60)->Arg(120)->Arg(240);
+BENCHMARK_TEMPLATE(BM_FrameCachePush, RingBlockingQueue<Frame>)->Arg(30)->Arg(60)->Arg(120)->Arg(240);
+BENCHMARK_TEMPLATE(BM_FrameCacheHandoff, BlockingQueue<Frame>);
+BENCHMARK_TEMPLATE(BM_FrameCacheHandoff, RingBlockingQueue<Frame>);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <queue>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "timing_wheel.h"
+
+using namespace OHOS::CameraStandard::DeferredProcessing;
+
+namespace {
+constexpr int32_t TIMER_COUNT = 10000;
+constexpr uint64_t START_US = 1ULL << 36;
+constexpr uint64_t MAX_DELAY_US = 10 * 60 * 1000 * 1000ULL;
+constexpr uint64_t ADVANCE_STEP_US = 5 * 1000 * 1000ULL;
+constexpr uint32_t RANDOM_SEED = 20250101;
+constexpr int32_t CANCEL_RATIO = 2;
+
+struct Owner {
+    int32_t id;
+};
+
+std::vector<uint64_t> CreateDelays()
+{
+    std::mt19937_64 engine(RANDOM_SEED);
+    std::uniform_int_distribution<uint64_t> delay(1, MAX_DELAY_US);
+    std::vector<uint64_t> delays(TIMER_COUNT);
+    std::generate(delays.begin(), delays.end(), [&engine, &delay]() { return delay(engine); });
+    return delays;
+}
+
+// TimerCore before the wheel: a timeline of expirations plus the timers registered at each of them.
+class LegacyTimeline {
+public:
+    void Register(uint64_t timestamp, const std::shared_ptr<Owner>& owner)
+    {
+        if (registeredTimers_.count(timestamp) == 0) {
+            timeline_.push(timestamp);
+        }
+        registeredTimers_[timestamp].push_back(owner);
+    }
+
+    void Deregister(uint64_t timestamp, const std::shared_ptr<Owner>& owner)
+    {
+        auto it = registeredTimers_.find(timestamp);
+        if (it == registeredTimers_.end()) {
+            return;
+        }
+        auto& timers = it->second;
+        timers.erase(std::remove_if(timers.begin(), timers.end(), [&owner](auto& weakOwner) {
+            return !owner.owner_before(weakOwner) && !weakOwner.owner_before(owner);
+        }), timers.end());
+        if (timers.empty()) {
+            registeredTimers_.erase(it);
+        }
+    }
+
+    // Cancelled expirations stay in the timeline and still cost a pop.
+    void Expire(uint64_t now, std::vector<std::weak_ptr<Owner>>& expired)
+    {
+        while (!timeline_.empty() && timeline_.top() <= now) {
+            auto timestamp = timeline_.top();
+            timeline_.pop();
+            auto it = registeredTimers_.find(timestamp);
+            if (it == registeredTimers_.end()) {
+                continue;
+            }
+            std::move(it->second.begin(), it->second.end(), std::back_inserter(expired));
+            registeredTimers_.erase(it);
+        }
+    }
+
+private:
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> timeline_;
+    std::map<uint64_t, std::vector<std::weak_ptr<Owner>>> registeredTimers_;
+};
+
+std::vector<std::shared_ptr<Owner>> CreateOwners()
+{
+    std::vector<std::shared_ptr<Owner>> owners;
+    owners.reserve(TIMER_COUNT);
+    for (int32_t i = 0; i < TIMER_COUNT; i++) {
+        owners.push_back(std::make_shared<Owner>(Owner { i }));
+    }
+    return owners;
+}
+
+// 10k timers started, every other one cancelled, the rest expired by a core waking every few seconds.
+void BM_TimerCoreLegacy(benchmark::State& state)
+{
+    auto delays = CreateDelays();
+    auto owners = CreateOwners();
+    for (auto _ : state) {
+        LegacyTimeline timeline;
+        for (int32_t i = 0; i < TIMER_COUNT; i++) {
+            timeline.Register(START_US + delays[i], owners[i]);
+        }
+        for (int32_t i = 0; i < TIMER_COUNT; i += CANCEL_RATIO) {
+            timeline.Deregister(START_US + delays[i], owners[i]);
+        }
+        std::vector<std::weak_ptr<Owner>> expired;
+        for (uint64_t now = START_US; now <= START_US + MAX_DELAY_US; now += ADVANCE_STEP_US) {
+            timeline.Expire(now, expired);
+        }
+        timeline.Expire(START_US + MAX_DELAY_US, expired);
+        benchmark::DoNotOptimize(expired.data());
+    }
+    state.SetItemsProcessed(state.iterations() * TIMER_COUNT);
+}
+
+void BM_TimerCoreWheel(benchmark::State& state)
+{
+    auto delays = CreateDelays();
+    auto owners = CreateOwners();
+    std::vector<TimingWheel<std::weak_ptr<Owner>>::TimerId> ids(TIMER_COUNT);
+    for (auto _ : state) {
+        TimingWheel<std::weak_ptr<Owner>> wheel(START_US);
+        for (int32_t i = 0; i < TIMER_COUNT; i++) {
+            ids[i] = wheel.Add(START_US + delays[i], owners[i]);
+        }
+        for (int32_t i = 0; i < TIMER_COUNT; i += CANCEL_RATIO) {
+            wheel.Remove(ids[i]);
+        }
+        std::vector<std::weak_ptr<Owner>> expired;
+        for (uint64_t now = START_US; now <= START_US + MAX_DELAY_US; now += ADVANCE_STEP_US) {
+            wheel.Advance(now, expired);
+        }
+        wheel.Advance(START_US + MAX_DELAY_US, expired);
+        benchmark::DoNotOptimize(expired.data());
+    }
+    state.SetItemsProcessed(state.iterations() * TIMER_COUNT);
+}
+} // namespace
+
+BENCHMARK(BM_TimerCoreLegacy);
+BENCHMARK(BM_TimerCoreWheel);
+
+BENCHMARK_MAIN();
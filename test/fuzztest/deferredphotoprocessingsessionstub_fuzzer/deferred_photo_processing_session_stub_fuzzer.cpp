@@ -110,6 +110,16 @@ void NotifyProcessImageTest(uint32_t code)
     session_->OnRemoteRequest(code, data, reply, option);
 }
 
+void ReleaseImageBufferTest(uint32_t code, FuzzedDataProvider& fdp)
+{
+    MessageParcel data;
+    MessageParcel reply;
+    MessageOption option(MessageOption::TF_ASYNC);
+    data.WriteInterfaceToken(DeferredPhotoProcessingSession::GetDescriptor());
+    data.WriteString16(Str8ToStr16(fdp.ConsumeRandomLengthString(MAX_LENGTH_STRING)));
+    session_->OnRemoteRequest(code, data, reply, option);
+}
+
 bool FuzzTest(FuzzedDataProvider& fdp)
 {
     static const IDeferredPhotoProcessingSessionIpcCode ipccodes[] = {
@@ -121,6 +131,7 @@ bool FuzzTest(FuzzedDataProvider& fdp)
         IDeferredPhotoProcessingSessionIpcCode::COMMAND_PROCESS_IMAGE,
         IDeferredPhotoProcessingSessionIpcCode::COMMAND_CANCEL_PROCESS_IMAGE,
         IDeferredPhotoProcessingSessionIpcCode::COMMAND_NOTIFY_PROCESS_IMAGE,
+        IDeferredPhotoProcessingSessionIpcCode::COMMAND_RELEASE_IMAGE_BUFFER,
     };
     IDeferredPhotoProcessingSessionIpcCode code = fdp.PickValueInArray(ipccodes);
     switch (code) {
@@ -156,6 +167,10 @@ bool FuzzTest(FuzzedDataProvider& fdp)
             NotifyProcessImageTest(static_cast<uint32_t>(code));
             break;
         }
+        case IDeferredPhotoProcessingSessionIpcCode::COMMAND_RELEASE_IMAGE_BUFFER: {
+            ReleaseImageBufferTest(static_cast<uint32_t>(code), fdp);
+            break;
+        }
     }
     return true;
 }
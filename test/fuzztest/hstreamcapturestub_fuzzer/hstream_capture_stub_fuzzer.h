@@ -138,6 +138,11 @@ public:
     {
         return 0;
     }
+
+    ErrCode ReleasePhotoBuffer(int32_t sequence) override
+    {
+        return 0;
+    }
 };
 }  // namespace CameraStandard
 }  // namespace OHOS
@@ -76,7 +76,7 @@ void TimerCoreFuzzer::TimerCoreFuzzTest()
     const std::shared_ptr<Timer>& timer = temp;
     fuzz_->GetInstance();
     fuzz_->RegisterTimer(timestampMs, timer);
-    fuzz_->DeregisterTimer(timestampMs, timer);
+    fuzz_->DeregisterTimer(timer);
 }
 
 void Test()